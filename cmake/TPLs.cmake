@@ -24,6 +24,9 @@ message(STATUS "------------------------------------------")
 set(CHARM_ROOT ${TPL_DIR}/charm)
 find_package(Charm)
 
+#### Threads, used by the thread pool for loops inside chares
+find_package(Threads)
+
 #### MKL (optional)
 find_package(MKL)
 if(MKL_FOUND)
@@ -0,0 +1,114 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/AlignedAllocator.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Standard-conforming allocator returning aligned memory
+  \details   Standard-conforming allocator returning memory aligned to a
+    compile-time boundary, e.g., the width of a cache line or of a vector
+    register, for use with standard containers, e.g., std::vector.
+*/
+// *****************************************************************************
+#ifndef AlignedAllocator_h
+#define AlignedAllocator_h
+
+#include <new>
+#include <vector>
+#include <cstdlib>
+#include <cstddef>
+
+#include "NoWarning/pup_stl.hpp"
+
+namespace tk {
+
+//! Allocator returning memory aligned to Align bytes
+//! \tparam T Type of objects to allocate
+//! \tparam Align Alignment in bytes, must be a power of two and a multiple of
+//!   sizeof(void*)
+template< class T, std::size_t Align = 64 >
+class AlignedAllocator {
+
+  static_assert( Align >= sizeof(void*) && (Align & (Align-1)) == 0,
+                 "Alignment must be a power of two and at least "
+                 "sizeof(void*)" );
+
+  public:
+    using value_type = T;
+    using pointer = T*;
+    using const_pointer = const T*;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+
+    //! Rebind allocator to another type with the same alignment
+    template< class U >
+    struct rebind { using other = AlignedAllocator< U, Align >; };
+
+    //! Default constructor
+    AlignedAllocator() noexcept {}
+
+    //! Converting constructor from an allocator of another type
+    template< class U >
+    AlignedAllocator( const AlignedAllocator< U, Align >& ) noexcept {}
+
+    //! Allocate aligned memory for n objects
+    //! \param[in] n Number of objects to allocate memory for
+    //! \return Pointer to the aligned memory allocated
+    T* allocate( std::size_t n ) {
+      if (n == 0) return nullptr;
+      void* p = nullptr;
+      if (posix_memalign( &p, Align, n * sizeof(T) )) throw std::bad_alloc();
+      return static_cast< T* >( p );
+    }
+
+    //! Deallocate memory
+    //! \param[in] p Pointer to memory previously returned by allocate()
+    void deallocate( T* p, std::size_t ) noexcept { std::free( p ); }
+};
+
+//! Allocators of the same alignment are interchangeable
+template< class T, class U, std::size_t Align >
+bool operator==( const AlignedAllocator< T, Align >&,
+                 const AlignedAllocator< U, Align >& ) noexcept
+{ return true; }
+
+//! Allocators of the same alignment are interchangeable
+template< class T, class U, std::size_t Align >
+bool operator!=( const AlignedAllocator< T, Align >&,
+                 const AlignedAllocator< U, Align >& ) noexcept
+{ return false; }
+
+} // tk::
+
+//! Extensions to Charm++'s Pack/Unpack routines
+namespace PUP {
+
+//////////////////// Serialize std::vector with aligned allocator ////////////
+
+//! Pack/Unpack std::vector of arithmetic type using tk::AlignedAllocator
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in] v std::vector to pack/unpack
+template< class T, std::size_t Align >
+inline void pup( PUP::er& p,
+                 std::vector< T, tk::AlignedAllocator< T, Align > >& v )
+{
+  auto n = v.size();
+  p | n;
+  if (p.isUnpacking()) v.resize( n );
+  PUParray( p, v.data(), n );
+}
+
+//! Pack/Unpack std::vector of arithmetic type using tk::AlignedAllocator
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in] v std::vector to pack/unpack
+template< class T, std::size_t Align >
+inline void operator|( PUP::er& p,
+                       std::vector< T, tk::AlignedAllocator< T, Align > >& v )
+{ pup( p, v ); }
+
+} // PUP::
+
+#endif // AlignedAllocator_h
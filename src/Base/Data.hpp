@@ -20,9 +20,11 @@
 #include <set>
 #include <algorithm>
 
+#include "QuinoaConfig.hpp"
 #include "Types.hpp"
 #include "Keywords.hpp"
 #include "Exception.hpp"
+#include "AlignedAllocator.hpp"
 
 #include "NoWarning/pup_stl.hpp"
 
@@ -31,6 +33,28 @@ namespace tk {
 //! Tags for selecting data layout policies
 const uint8_t UnkEqComp = 0;
 const uint8_t EqCompUnk = 1;
+const uint8_t BlkEqCompUnk = 2;
+
+//! Number of unknowns per block in the blocked (BlkEqCompUnk) data layout
+constexpr std::size_t DataBlockWidth = DATA_BLOCK_WIDTH;
+static_assert( DataBlockWidth > 0 &&
+               (DataBlockWidth & (DataBlockWidth-1)) == 0,
+               "Data block width must be a power of two" );
+
+//! Alignment in bytes of the blocked (BlkEqCompUnk) data layout
+constexpr std::size_t DataBlockAlign = 64;
+
+//! Underlying storage type of the data layouts
+//! \details The blocked layout uses aligned memory so a component of all
+//!   unknowns of a block can be loaded into a vector register with a single
+//!   aligned load.
+template< uint8_t Layout >
+struct DataStore { using type = std::vector< tk::real >; };
+template<>
+struct DataStore< BlkEqCompUnk > {
+  using type =
+    std::vector< tk::real, AlignedAllocator< tk::real, DataBlockAlign > >;
+};
 
 //! Zero-runtime-cost data-layout wrappers with type-based compile-time dispatch
 template< uint8_t Layout >
@@ -41,6 +65,9 @@ class Data {
     //!    also for type of offset
     using ncomp_t = kw::ncomp::info::expect::type;
 
+    //! Underlying storage type
+    using store_t = typename DataStore< Layout >::type;
+
   public:
     //! Default constructor (required for Charm++ migration)
     explicit Data() : m_vec(), m_nunk(), m_nprop() {}
@@ -50,7 +77,7 @@ class Data {
     //! \param[in] np Total number of properties, i.e., scalar variables or
     //!   components, per unknown
     explicit Data( ncomp_t nu, ncomp_t np ) :
-      m_vec( nu*np ),
+      m_vec( size( nu, np, int2type< Layout >() ) ),
       m_nunk( nu ),
       m_nprop( np ) {}
 
@@ -118,7 +145,7 @@ class Data {
     //!   equations among other systems
     //! \return Pointer to data of type tk::real for use with var()
     //! \see Example client code in Statistics::setupOrdinary() and
-    //!   Statistics::accumulateOrd() in Statistics/Statistics.C.
+    //!   Statistics::accumulate() in Statistics/Statistics.C.
     const tk::real*
     cptr( ncomp_t component, ncomp_t offset ) const
     { return cptr( component, offset, int2type< Layout >() ); }
@@ -144,7 +171,7 @@ class Data {
     //! \param[in] unknown Unknown index
     //! \return Const reference to data of type tk::real
     //! \see Example client code in Statistics::setupOrdinary() and
-    //!   Statistics::accumulateOrd() in Statistics/Statistics.C.
+    //!   Statistics::accumulate() in Statistics/Statistics.C.
     const tk::real&
     var( const tk::real* pt, ncomp_t unknown ) const
     { return var( pt, unknown, int2type< Layout >() ); }
@@ -170,7 +197,7 @@ class Data {
     //! \param[in] unknown Unknown index
     //! \return Non-const reference to data of type tk::real
     //! \see Example client code in Statistics::setupOrdinary() and
-    //!   Statistics::accumulateOrd() in Statistics/Statistics.C.
+    //!   Statistics::accumulate() in Statistics/Statistics.C.
     //! \see "Avoid Duplication in const and Non-const Member Function," and
     //!   "Use const whenever possible," Scott Meyers, Effective C++, 3d ed.
     tk::real&
@@ -179,6 +206,55 @@ class Data {
                static_cast< const Data& >( *this ).var( pt, unknown ) );
     }
 
+    //! Const ptr to a component of all unknowns of a block
+    //! \details Only available with the blocked (BlkEqCompUnk) data layout.
+    //!   Returns an aligned pointer to DataBlockWidth contiguous values of a
+    //!   component, one for each unknown of the block, so that kernels can
+    //!   load and store a component of a whole block of unknowns with a single
+    //!   vector instruction. Entry i of block b belongs to unknown
+    //!   b*DataBlockWidth+i, the entries beyond nunk() in the last block are
+    //!   padding. Requirement: offset + component < nprop, block < nblock(),
+    //!   enforced with an assert in DEBUG mode.
+    //! \param[in] block Block index
+    //! \param[in] component Component index, i.e., position of a scalar within
+    //!   a system
+    //! \param[in] offset System offset specifying the position of the system of
+    //!   equations among other systems
+    //! \return Const pointer to the values of the component in the block
+    const tk::real*
+    bptr( ncomp_t block, ncomp_t component, ncomp_t offset ) const {
+      static_assert( Layout == BlkEqCompUnk,
+                     "Block access requires the blocked data layout" );
+      Assert( block < nblock(), "Out-of-bounds access: block < number of "
+              "blocks" );
+      return cptr( component, offset ) + block*m_nprop*DataBlockWidth;
+    }
+
+    //! Non-const ptr to a component of all unknowns of a block
+    //! \details Only available with the blocked (BlkEqCompUnk) data layout.
+    //!   Requirement: offset + component < nprop, block < nblock(), enforced
+    //!   with an assert in DEBUG mode.
+    //! \param[in] block Block index
+    //! \param[in] component Component index, i.e., position of a scalar within
+    //!   a system
+    //! \param[in] offset System offset specifying the position of the system of
+    //!   equations among other systems
+    //! \return Non-const pointer to the values of the component in the block
+    tk::real*
+    bptr( ncomp_t block, ncomp_t component, ncomp_t offset ) {
+      return const_cast< tk::real* >(
+               static_cast< const Data& >( *this ).
+                 bptr( block, component, offset ) );
+    }
+
+    //! Access to number of blocks of unknowns
+    //! \details For the blocked (BlkEqCompUnk) data layout this is the number
+    //!   of blocks of DataBlockWidth unknowns, the last one possibly partially
+    //!   filled, for the other layouts this equals the number of unknowns.
+    //! \return Number of blocks of unknowns
+    ncomp_t nblock() const noexcept
+    { return blocks( m_nunk, int2type< Layout >() ); }
+
     //! Access to number of unknowns
     //! \return Number of unknowns
     ncomp_t nunk() const noexcept { return m_nunk; }
@@ -266,11 +342,11 @@ class Data {
 
     //! Const-ref accessor to underlying raw data
     //! \return Constant reference to underlying raw data
-    const std::vector< tk::real >& data() const { return m_vec; }
+    const store_t& data() const { return m_vec; }
 
     //! Non-const-ref accessor to underlying raw data
     //! \return Non-constant reference to underlying raw data
-    std::vector< tk::real >& data() { return m_vec; }
+    store_t& data() { return m_vec; }
 
     //! Compound operator-=
     //! \param[in] rhs Data object to subtract
@@ -389,21 +465,8 @@ class Data {
 
     //! Remove a number of unknowns
     //! \param[in] unknown Set of indices of unknowns to remove
-    void rm( const std::set< ncomp_t >& unknown ) {
-      auto remove = [ &unknown ]( std::size_t i ) -> bool {
-        if (unknown.find(i) != end(unknown)) return true;
-        return false;
-      };
-      std::size_t last = 0;
-      for(std::size_t i=0; i<m_nunk; ++i, ++last) {
-        while( remove(i) ) ++i;
-        if (i >= m_nunk) break;
-        for (ncomp_t p = 0; p<m_nprop; ++p)
-          m_vec[ last*m_nprop+p ] = m_vec[ i*m_nprop+p ];
-      }
-      m_vec.resize( last*m_nprop );
-      m_nunk -= unknown.size();
-    }
+    void rm( const std::set< ncomp_t >& unknown )
+    { rm( unknown, int2type< Layout >() ); }
 
     //! Fill vector of unknowns with the same value
     //! \details Requirement: offset + component < nprop, enforced with an
@@ -448,6 +511,57 @@ class Data {
     //!   Patterns Applied, Addison-Wesley Professional, 2001.
     template< uint8_t m > struct int2type { enum { value = m }; };
 
+    //! Overloads for the sizes of the underlying storage
+    //! \param[in] nu Number of unknowns
+    //! \param[in] np Number of properties per unknown
+    //! \return Number of reals to allocate for nu unknowns with np properties
+    //! \note The blocked layout rounds the number of unknowns up to the next
+    //!   multiple of the block width.
+    template< uint8_t L >
+    static std::size_t size( ncomp_t nu, ncomp_t np, int2type< L > )
+    { return nu*np; }
+    static std::size_t size( ncomp_t nu, ncomp_t np, int2type< BlkEqCompUnk > )
+    { return blocks( nu, int2type< BlkEqCompUnk >() ) * DataBlockWidth * np; }
+
+    //! Overloads for the number of blocks of unknowns
+    //! \param[in] nu Number of unknowns
+    //! \return Number of blocks nu unknowns are stored in
+    template< uint8_t L >
+    static std::size_t blocks( ncomp_t nu, int2type< L > ) { return nu; }
+    static std::size_t blocks( ncomp_t nu, int2type< BlkEqCompUnk > )
+    { return (nu + DataBlockWidth - 1) / DataBlockWidth; }
+
+    //! Remove a number of unknowns
+    //! \param[in] unknown Set of indices of unknowns to remove
+    template< uint8_t L >
+    void rm( const std::set< ncomp_t >& unknown, int2type< L > ) {
+      auto remove = [ &unknown ]( std::size_t i ) -> bool {
+        if (unknown.find(i) != end(unknown)) return true;
+        return false;
+      };
+      std::size_t last = 0;
+      for(std::size_t i=0; i<m_nunk; ++i, ++last) {
+        while( remove(i) ) ++i;
+        if (i >= m_nunk) break;
+        for (ncomp_t p = 0; p<m_nprop; ++p)
+          m_vec[ last*m_nprop+p ] = m_vec[ i*m_nprop+p ];
+      }
+      m_vec.resize( last*m_nprop );
+      m_nunk -= unknown.size();
+    }
+    void rm( const std::set< ncomp_t >& unknown, int2type< BlkEqCompUnk > ) {
+      std::size_t last = 0;
+      for (std::size_t i=0; i<m_nunk; ++i)
+        if (unknown.find(i) == end(unknown)) {
+          if (i != last)
+            for (ncomp_t p=0; p<m_nprop; ++p)
+              operator()( last, p, 0 ) = operator()( i, p, 0 );
+          ++last;
+        }
+      m_vec.resize( size( last, m_nprop, int2type< BlkEqCompUnk >() ) );
+      m_nunk = last;
+    }
+
     //! Overloads for the various const data accesses
     //! \details Requirement: offset + component < nprop, unknown < nunk,
     //!   enforced with an assert in DEBUG mode, see also the constructor.
@@ -479,6 +593,17 @@ class Data {
               "unknowns" );
       return m_vec[ (offset+component)*m_nunk + unknown ];
     }
+    const tk::real&
+    access( ncomp_t unknown, ncomp_t component, ncomp_t offset,
+            int2type< BlkEqCompUnk > ) const
+    {
+      Assert( offset + component < m_nprop, "Out-of-bounds access: offset + "
+              "component < number of properties" );
+      Assert( unknown < m_nunk, "Out-of-bounds access: unknown < number of "
+              "unknowns" );
+      return m_vec[ (unknown/DataBlockWidth*m_nprop + offset + component) *
+                    DataBlockWidth + unknown%DataBlockWidth ];
+    }
 
     // Overloads for the various const ptr to physical variable accesses
     //! \details Requirement: offset + component < nprop, unknown < nunk,
@@ -502,6 +627,12 @@ class Data {
               "component < number of properties" );
       return m_vec.data() + (offset+component)*m_nunk;
     }
+    const tk::real*
+    cptr( ncomp_t component, ncomp_t offset, int2type< BlkEqCompUnk > ) const {
+      Assert( offset + component < m_nprop, "Out-of-bounds access: offset + "
+              "component < number of properties" );
+      return m_vec.data() + (offset+component)*DataBlockWidth;
+    }
 
     // Overloads for the various const physical variable accesses
     //!   Requirement: unknown < nunk, enforced with an assert in DEBUG mode,
@@ -525,6 +656,14 @@ class Data {
               "unknowns" );
       return *(pt + unknown);
     }
+    const tk::real&
+    var( const tk::real* const pt, ncomp_t unknown, int2type< BlkEqCompUnk > )
+    const {
+      Assert( unknown < m_nunk, "Out-of-bounds access: unknown < number of "
+              "unknowns" );
+      return *(pt + unknown/DataBlockWidth*m_nprop*DataBlockWidth +
+               unknown%DataBlockWidth);
+    }
 
     //! Add new unknown
     //! \param[in] prop Vector of properties to initialize the new unknown with
@@ -538,18 +677,40 @@ class Data {
       ++m_nunk;
       for (ncomp_t i=0; i<m_nprop; ++i) operator()( u, i, 0 ) = prop[i];
     }
+    void push_back( const std::vector< tk::real >& prop,
+                    int2type< BlkEqCompUnk > )
+    {
+      Assert( prop.size() == m_nprop, "Incorrect number of properties" );
+      ncomp_t u = m_nunk;
+      resize( m_nunk+1, 0.0, int2type< BlkEqCompUnk >() );
+      for (ncomp_t i=0; i<m_nprop; ++i) operator()( u, i, 0 ) = prop[i];
+    }
 
     //! Resize data store to contain 'count' elements
     //! \param[in] count Resize store to contain 'count' elements
     //! \param[in] value Value to initialize new data with
-    //! \note Only the UnkEqComp overload is provided as this operation would be
-    //!   too inefficient with the EqCompUnk data layout.
+    //! \note Only the UnkEqComp and BlkEqCompUnk overloads are provided as
+    //!   this operation would be too inefficient with the EqCompUnk data
+    //!   layout.
     //! \note This works for both shrinking and enlarging, as this simply
-    //!   translates to std::vector::resize().
+    //!   translates to std::vector::resize(). With the blocked layout the new
+    //!   unknowns that were padding in the previous last block are also
+    //!   initialized to value.
     void resize( std::size_t count, tk::real value, int2type< UnkEqComp > ) {
       m_vec.resize( count * m_nprop, value );
       m_nunk = count;
     }
+    void resize( std::size_t count, tk::real value, int2type< BlkEqCompUnk > )
+    {
+      auto nu = m_nunk;
+      auto pad = std::min( count, blocks( nu, int2type< BlkEqCompUnk >() ) *
+                                  DataBlockWidth );
+      m_vec.resize( size( count, m_nprop, int2type< BlkEqCompUnk >() ), value );
+      m_nunk = count;
+      // initialize new unknowns that were padding in the previous last block
+      for (ncomp_t u=nu; u<pad; ++u)
+        for (ncomp_t c=0; c<m_nprop; ++c) operator()( u, c, 0 ) = value;
+    }
 
     // Overloads for the name-queries of data lauouts
     //! \return The name of the data layout used
@@ -559,8 +720,12 @@ class Data {
     { return "unknown-major"; }
     static std::string layout( int2type< EqCompUnk > )
     { return "equation-major"; }
+    static std::string layout( int2type< BlkEqCompUnk > ) {
+      return "blocked equation-major (" + std::to_string(DataBlockWidth) +
+             " unknowns/block)";
+    }
 
-    std::vector< tk::real > m_vec;      //!< Data pointer
+    store_t m_vec;                      //!< Data pointer
     ncomp_t m_nunk;                     //!< Number of unknowns
     ncomp_t m_nprop;                    //!< Number of properties/unknown
 };
@@ -669,6 +834,60 @@ maxdiff( const Data< Layout >& lhs, const Data< Layout >& rhs ) {
   return m;
 }
 
+//! Assert that Data objects have the same number of unknowns and properties
+//! \details End of recursion
+template< uint8_t Layout >
+void sameshape( const Data< Layout >& ) {}
+
+//! Assert that Data objects have the same number of unknowns and properties
+//! \param[in] d First Data object
+//! \param[in] e Second Data object
+//! \param[in] ds Further Data objects
+template< uint8_t Layout, class... Ds >
+void sameshape( const Data< Layout >& d, const Data< Layout >& e,
+                const Ds&... ds )
+{
+  Assert( d.nunk() == e.nunk(), "Number of unknowns unequal" );
+  Assert( d.nprop() == e.nprop(), "Number of properties unequal" );
+  sameshape( e, ds... );
+}
+
+//! Fused element-wise update of multiple Data objects in a single pass
+//! \param[in] f Function called for each raw position of the underlying data
+//!   as f( d[i], ds[i]... ), with its first argument passed by reference, so
+//!   it can be used to update d, e.g., [&]( tk::real& u, tk::real du ){
+//!   u += dt*du; } computes u += dt*du without temporaries
+//! \param[in,out] d Data object to update
+//! \param[in,out] ds Further Data objects, passed to f as the underlying
+//!   reference type, so f may update them as well or only read them
+//! \details Unlike the arithmetic operators, which allocate a temporary for
+//!   each operation of an expression, this evaluates an arbitrary expression
+//!   of any number of operands in a single pass over memory, without
+//!   allocation. Since operands are accessed at the same raw position,
+//!   independent of components, offsets, etc., the Data objects must have the
+//!   same number of unknowns and properties. With the blocked (BlkEqCompUnk)
+//!   data layout f is not called for the padding beyond nunk() in the last
+//!   block, so, e.g., dividing by a Data object does not divide by zero.
+template< uint8_t Layout, class F, class... Ds >
+void fused( F f, Data< Layout >& d, Ds&... ds ) {
+  sameshape( d, ds... );
+  if (Layout == BlkEqCompUnk) {
+    const auto nu = d.nunk();
+    const auto np = d.nprop();
+    for (std::size_t b=0; b<d.nblock(); ++b) {
+      // number of unknowns in block, skipping padding in the last one
+      const auto w = std::min( DataBlockWidth, nu - b*DataBlockWidth );
+      for (std::size_t p=0; p<np; ++p) {
+        const auto o = (b*np + p)*DataBlockWidth;
+        for (std::size_t i=o; i<o+w; ++i) f( d.data()[i], ds.data()[i]... );
+      }
+    }
+  } else {
+    const auto n = d.data().size();
+    for (std::size_t i=0; i<n; ++i) f( d.data()[i], ds.data()[i]... );
+  }
+}
+
 } // tk::
 
 #endif // Data_h
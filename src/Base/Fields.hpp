@@ -25,6 +25,8 @@ namespace tk {
 using Fields = Data< UnkEqComp >;
 #elif defined FIELD_DATA_LAYOUT_AS_EQUATION_MAJOR
 using Fields = Data< EqCompUnk >;
+#elif defined FIELD_DATA_LAYOUT_AS_BLOCK_MAJOR
+using Fields = Data< BlkEqCompUnk >;
 #endif
 
 } // tk::
@@ -0,0 +1,63 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/ParticleStore.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Storage of particles tracked in physical space
+  \see       ParticleStore.h for more info.
+*/
+// *****************************************************************************
+
+#include "ParticleStore.hpp"
+
+using tk::ParticleStore;
+
+constexpr std::size_t ParticleStore::npos;
+
+void
+ParticleStore::compact()
+// *****************************************************************************
+//  Remove dead particles, renumbering the live ones
+//! \details The live particles are moved toward the front of the arrays in a
+//!   single pass, keeping their order.
+//! \warning This invalidates the indices of the particles, thus it must not be
+//!   called while indices are held elsewhere, e.g., by messages in flight.
+// *****************************************************************************
+{
+  if (m_ndead == 0) return;
+
+  std::size_t last = 0;
+  for (std::size_t i=0; i<size(); ++i)
+    if (live(i)) {
+      if (i != last) {
+        for (std::size_t d=0; d<3; ++d) m_coord[d][last] = m_coord[d][i];
+        m_elem[last] = m_elem[i];
+      }
+      ++last;
+    }
+
+  for (std::size_t d=0; d<3; ++d) m_coord[d].resize( last );
+  m_elem.resize( last );
+  m_ndead = 0;
+}
+
+std::vector< tk::real >
+ParticleStore::pack( const std::vector< std::size_t >& idx ) const
+// *****************************************************************************
+//  Pack coordinates of particles for migration to another chare
+//! \param[in] idx Indices of particles whose coordinates to pack
+//! \return Coordinates of the particles in idx, three per particle, in the
+//!   order of idx
+//! \details A single flat array is sent instead of an array per particle so
+//!   that migrating a batch of particles is a single contiguous message.
+// *****************************************************************************
+{
+  std::vector< tk::real > p( idx.size()*3 );
+  for (std::size_t j=0; j<idx.size(); ++j) {
+    Assert( idx[j] < size(), "Particle index out of bounds" );
+    for (std::size_t d=0; d<3; ++d) p[ j*3+d ] = m_coord[d][ idx[j] ];
+  }
+  return p;
+}
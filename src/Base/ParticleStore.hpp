@@ -0,0 +1,158 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/ParticleStore.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Storage of particles tracked in physical space
+  \details   Storage of particles tracked in physical space. The coordinates
+    of the particles are stored as a structure of arrays, one array per
+    spatial direction, together with the id of the mesh element each particle
+    has last been found in. Particles are removed by marking them dead
+    (tombstoning), which keeps the indices of all other particles, e.g., those
+    referred to by messages in flight, unchanged. Dead particles are then
+    removed all at once, by compacting the arrays in a single pass, when it is
+    safe to renumber the particles, e.g., at the end of a time step, and only
+    if enough of them have accumulated. This replaces compacting all particle
+    data on each removal, which makes removing a burst of particles cost
+    O(N) instead of O(N^2).
+*/
+// *****************************************************************************
+#ifndef ParticleStore_h
+#define ParticleStore_h
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <cstddef>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Storage of particles tracked in physical space
+class ParticleStore {
+
+  public:
+    //! Element id marking a dead particle
+    static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+    //! Constructor
+    //! \param[in] npar Number of particles to store, all live and located in
+    //!   element 0
+    explicit ParticleStore( std::size_t npar = 0 ) :
+      m_coord{{ std::vector< tk::real >( npar, 0.0 ),
+                std::vector< tk::real >( npar, 0.0 ),
+                std::vector< tk::real >( npar, 0.0 ) }},
+      m_elem( npar, 0 ),
+      m_ndead( 0 ) {}
+
+    //! Number of particles stored, including dead ones
+    //! \return Number of particles stored, including dead ones
+    std::size_t size() const { return m_elem.size(); }
+
+    //! Number of dead particles
+    //! \return Number of particles removed since the last compaction
+    std::size_t ndead() const { return m_ndead; }
+
+    //! Number of live particles
+    //! \return Number of particles stored that have not been removed
+    std::size_t nlive() const { return size() - m_ndead; }
+
+    //! Query if a particle is live
+    //! \param[in] i Particle index
+    //! \return True if particle i has not been removed
+    bool live( std::size_t i ) const { return m_elem[i] != npos; }
+
+    //! Const-ref access to particle coordinates
+    //! \return Const reference to the coordinates of all particles, including
+    //!   dead ones, one array per spatial direction
+    const std::array< std::vector< tk::real >, 3 >& coord() const
+    { return m_coord; }
+
+    //! Ref access to particle coordinates
+    //! \return Reference to the coordinates of all particles, including dead
+    //!   ones, one array per spatial direction
+    //! \note The caller must not resize the arrays.
+    std::array< std::vector< tk::real >, 3 >& coord() { return m_coord; }
+
+    //! Particle coordinates
+    //! \param[in] i Particle index
+    //! \return Coordinates of particle i
+    std::array< tk::real, 3 > position( std::size_t i ) const
+    { return {{ m_coord[0][i], m_coord[1][i], m_coord[2][i] }}; }
+
+    //! Ref access to the element id of a particle
+    //! \param[in] i Particle index
+    //! \return Reference to the id of the element particle i has last been
+    //!   found in
+    std::size_t& elem( std::size_t i ) {
+      Assert( live(i), "Element of dead particle accessed" );
+      return m_elem[i];
+    }
+
+    //! Add a particle
+    //! \param[in] p Coordinates of the particle to add
+    //! \param[in] e Id of the element the particle is located in
+    void push_back( const std::array< tk::real, 3 >& p, std::size_t e ) {
+      Assert( e != npos, "Element id of particle invalid" );
+      for (std::size_t d=0; d<3; ++d) m_coord[d].push_back( p[d] );
+      m_elem.push_back( e );
+    }
+
+    //! Remove a particle by marking it dead
+    //! \param[in] i Particle index
+    //! \details The data of the particle is only removed by compact(), until
+    //!   then the indices of all other particles remain unchanged.
+    void kill( std::size_t i ) {
+      if (!live(i)) return;
+      m_elem[i] = npos;
+      ++m_ndead;
+    }
+
+    //! Remove dead particles, renumbering the live ones
+    void compact();
+
+    //! Remove dead particles if enough of them have accumulated
+    //! \param[in] maxdead Fraction of dead particles above which to compact
+    //! \return True if compacted
+    bool compact( tk::real maxdead ) {
+      if (static_cast< tk::real >( m_ndead ) <=
+          maxdead * static_cast< tk::real >( size() )) return false;
+      compact();
+      return true;
+    }
+
+    //! Pack coordinates of particles for migration to another chare
+    std::vector< tk::real > pack( const std::vector< std::size_t >& idx ) const;
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) {
+      p | m_coord;
+      p | m_elem;
+      p | m_ndead;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] s ParticleStore object reference
+    friend void operator|( PUP::er& p, ParticleStore& s ) { s.pup(p); }
+    //@}
+
+  private:
+    //! Particle coordinates, one array per spatial direction
+    std::array< std::vector< tk::real >, 3 > m_coord;
+    //! Id of the element each particle has last been found in, npos if dead
+    std::vector< std::size_t > m_elem;
+    //! Number of dead particles
+    std::size_t m_ndead;
+};
+
+} // tk::
+
+#endif // ParticleStore_h
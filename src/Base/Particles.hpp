@@ -24,6 +24,8 @@ namespace tk {
 using Particles = Data< UnkEqComp >;
 #elif defined PARTICLE_DATA_LAYOUT_AS_EQUATION_MAJOR
 using Particles = Data< EqCompUnk >;
+#elif defined PARTICLE_DATA_LAYOUT_AS_BLOCK_MAJOR
+using Particles = Data< BlkEqCompUnk >;
 #endif
 
 } // tk::
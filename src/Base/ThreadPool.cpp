@@ -0,0 +1,163 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/ThreadPool.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Thread pool for shared-memory parallel loops inside a chare
+  \details   Thread pool for shared-memory parallel loops inside a chare.
+*/
+// *****************************************************************************
+
+#include "ThreadPool.hpp"
+#include "Exception.hpp"
+
+using tk::ThreadPool;
+
+ThreadPool::ThreadPool( std::size_t nthread ) :
+  m_worker(),
+  m_mutex(),
+  m_start(),
+  m_done(),
+  m_task( nullptr ),
+  m_gen( 0 ),
+  m_pending( 0 ),
+  m_stop( false ),
+  m_error()
+// *****************************************************************************
+//  Constructor
+//! \param[in] nthread Number of threads, including the calling thread
+// *****************************************************************************
+{
+  resize( nthread );
+}
+
+ThreadPool::~ThreadPool()
+// *****************************************************************************
+//  Destructor: join worker threads
+// *****************************************************************************
+{
+  stop();
+}
+
+void
+ThreadPool::resize( std::size_t nthread )
+// *****************************************************************************
+//  Set the number of threads, including the calling thread
+//! \param[in] nthread Number of threads, including the calling thread
+//! \details Does nothing if the pool already has the number of threads
+//!   requested, so it is cheap to call repeatedly with the same argument.
+// *****************************************************************************
+{
+  Assert( nthread > 0, "Number of threads must be positive" );
+
+  if (nthread == size()) return;
+
+  stop();
+
+  m_stop = false;
+  for (std::size_t t=1; t<nthread; ++t)
+    m_worker.emplace_back( &ThreadPool::work, this, t, m_gen );
+}
+
+void
+ThreadPool::stop()
+// *****************************************************************************
+//  Stop and join worker threads
+// *****************************************************************************
+{
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    m_stop = true;
+  }
+  m_start.notify_all();
+  for (auto& w : m_worker) w.join();
+  m_worker.clear();
+}
+
+void
+ThreadPool::run( const std::function< void(std::size_t) >& task )
+// *****************************************************************************
+//  Execute task on all threads and wait for their completion
+//! \param[in] task Task to execute, called with the thread id
+// *****************************************************************************
+{
+  {
+    std::lock_guard< std::mutex > lock( m_mutex );
+    m_task = &task;
+    m_pending = m_worker.size();
+    m_error = nullptr;
+    ++m_gen;
+  }
+  m_start.notify_all();
+
+  // execute share of the caller
+  std::exception_ptr error;
+  try {
+    task( 0 );
+  }
+  catch (...) {
+    error = std::current_exception();
+  }
+
+  // wait for the workers
+  std::unique_lock< std::mutex > lock( m_mutex );
+  m_done.wait( lock, [this]{ return m_pending == 0; } );
+  m_task = nullptr;
+  if (!error) error = m_error;
+  lock.unlock();
+
+  if (error) std::rethrow_exception( error );
+}
+
+void
+ThreadPool::work( std::size_t tid, std::size_t gen )
+// *****************************************************************************
+//  Worker thread main loop
+//! \param[in] tid Thread id
+//! \param[in] gen Task generation at the time the worker was created
+//! \details The generation is passed in by the creating thread, so a task
+//!   started before the worker first acquires the mutex is not missed.
+// *****************************************************************************
+{
+  for (;;) {
+    const std::function< void(std::size_t) >* task = nullptr;
+    {
+      std::unique_lock< std::mutex > lock( m_mutex );
+      m_start.wait( lock, [&]{ return m_stop || m_gen != gen; } );
+      if (m_stop) return;
+      gen = m_gen;
+      task = m_task;
+    }
+
+    std::exception_ptr error;
+    try {
+      (*task)( tid );
+    }
+    catch (...) {
+      error = std::current_exception();
+    }
+
+    {
+      std::lock_guard< std::mutex > lock( m_mutex );
+      if (error && !m_error) m_error = error;
+      if (--m_pending == 0) m_done.notify_one();
+    }
+  }
+}
+
+tk::ThreadPool&
+tk::threadpool()
+// *****************************************************************************
+//  Access the thread pool of the calling PE
+//! \return Reference to the thread pool of the calling PE
+//! \details The pool is thread-local, so in an SMP build of Charm++, in which
+//!   the PEs of a logical node are threads of the same process, each PE
+//!   owns a separate pool. The pool is created with a single thread on first
+//!   access, its size is set by tk::ThreadPool::resize().
+// *****************************************************************************
+{
+  thread_local ThreadPool pool;
+  return pool;
+}
@@ -0,0 +1,108 @@
+// *****************************************************************************
+/*!
+  \file      src/Base/ThreadPool.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Thread pool for shared-memory parallel loops inside a chare
+  \details   Thread pool for shared-memory parallel loops inside a chare. The
+    pool is a simple fork-join pool of persistent worker threads, used to split
+    the element, face, and edge loops of the computational kernels of a single
+    chare across the cores of a compute node. This allows running fewer but
+    larger chares per node without giving up on-node parallelism, which reduces
+    the volume of ghost and chare-boundary communication. The workers only
+    execute plain computational loops and never call into the Charm++ runtime
+    system. Each PE has its own pool, see tk::threadpool(), so the pool is only
+    ever used from the thread of the PE that owns it.
+*/
+// *****************************************************************************
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+#include <vector>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <exception>
+
+namespace tk {
+
+//! Fork-join pool of persistent worker threads for parallel loops
+class ThreadPool {
+
+  public:
+    //! Constructor
+    explicit ThreadPool( std::size_t nthread = 1 );
+
+    //! Destructor: join worker threads
+    ~ThreadPool();
+
+    //! Don't permit copy constructor
+    ThreadPool( const ThreadPool& ) = delete;
+    //! Don't permit copy assigment
+    ThreadPool& operator=( const ThreadPool& ) = delete;
+
+    //! Set the number of threads, including the calling thread
+    void resize( std::size_t nthread );
+
+    //! Query the number of threads, including the calling thread
+    std::size_t size() const { return m_worker.size() + 1; }
+
+    //! Execute a loop body on contiguous chunks of a range of indices
+    //! \param[in] n Execute f on the index range [0,n)
+    //! \param[in] f Loop body called as f(first,last,tid) for each chunk
+    //!   [first,last), where tid < size() is the id of the executing thread
+    //! \details Each thread executes at most a single chunk and the call
+    //!   returns after all chunks have been executed. The calling thread
+    //!   executes the chunk with tid 0, so with a single thread (the default)
+    //!   f is called directly without any synchronization. An exception
+    //!   thrown by f is rethrown on the calling thread.
+    template< class Fn >
+    void parallelFor( std::size_t n, const Fn& f ) {
+      auto nt = std::min( size(), n );
+      if (nt < 2)
+        f( std::size_t(0), n, std::size_t(0) );
+      else
+        run( [&]( std::size_t t ){
+               if (t < nt) f( n*t/nt, n*(t+1)/nt, t ); } );
+    }
+
+  private:
+    //! Worker threads
+    std::vector< std::thread > m_worker;
+    //! Mutex protecting the shared state below
+    std::mutex m_mutex;
+    //! Condition variable signaling the workers to start a task or stop
+    std::condition_variable m_start;
+    //! Condition variable signaling the caller that all workers are done
+    std::condition_variable m_done;
+    //! Task executed by all threads, called with the thread id
+    const std::function< void(std::size_t) >* m_task;
+    //! Task generation counter, incremented for every new task
+    std::size_t m_gen;
+    //! Number of workers still executing the current task
+    std::size_t m_pending;
+    //! True if the workers should stop
+    bool m_stop;
+    //! First exception thrown by a worker during the current task
+    std::exception_ptr m_error;
+
+    //! Execute task on all threads and wait for their completion
+    void run( const std::function< void(std::size_t) >& task );
+
+    //! Worker thread main loop
+    void work( std::size_t tid, std::size_t gen );
+
+    //! Stop and join worker threads
+    void stop();
+};
+
+//! Access the thread pool of the calling PE
+ThreadPool& threadpool();
+
+} // tk::
+
+#endif // ThreadPool_h
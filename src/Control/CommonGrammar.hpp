@@ -110,6 +110,7 @@ namespace grm {
     NORNG,              //!< No RNG selected
     NODT,               //!< No time-step-size policy selected
     MULDT,              //!< Multiple time-step-size policies selected
+    LTSMULTIMAT,        //!< Local time stepping with multi-material flow
     NOSAMPLES,          //!< PDF need a variable
     INVALIDSAMPLESPACE, //!< PDF sample space specification incorrect
     MALFORMEDSAMPLE,    //!< PDF sample space variable specification incorrect
@@ -229,6 +230,11 @@ namespace grm {
       "constant or 'cfl' to set an adaptive time step size calculation policy. "
       "Setting 'cfl' and 'dt' are mutually exclusive. If both 'cfl' and 'dt' "
       "are set, 'dt' wins." },
+    { MsgKey::LTSMULTIMAT, "Local time stepping has been configured together "
+      "with multi-material flow. The non-conservative terms of multi-material "
+      "flow use derivatives estimated from the Riemann fluxes over all faces "
+      "of an element in a single step, which local time stepping does not "
+      "support. Remove the keyword 'lts' or set it to 0." },
     { MsgKey::NOINIT, "No (or too many) initialization policy (or policies) "
       "has been specified within the block preceding this position. An "
       "initialization policy (and only one) is mandatory for the preceding "
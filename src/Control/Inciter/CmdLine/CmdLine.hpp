@@ -51,7 +51,8 @@ class CmdLine : public tk::Control<
                   tag::helpkw,         tk::ctr::HelpKw,
                   tag::error,          std::vector< std::string >,
                   tag::lbfreq,         kw::lbfreq::info::expect::type,
-                  tag::rsfreq,         kw::rsfreq::info::expect::type > {
+                  tag::rsfreq,         kw::rsfreq::info::expect::type,
+                  tag::threads,        kw::threads::info::expect::type > {
 
   public:
     //! \brief Inciter command-line keywords
@@ -73,6 +74,7 @@ class CmdLine : public tk::Control<
                                      , kw::quiescence
                                      , kw::lbfreq
                                      , kw::rsfreq
+                                     , kw::threads
                                      , kw::trace
                                      , kw::version
                                      , kw::license
@@ -122,6 +124,7 @@ class CmdLine : public tk::Control<
       set< tag::feedback >( false ); // No detailed feedback by default
       set< tag::lbfreq >( 1 ); // Load balancing every time-step by default
       set< tag::rsfreq >( 100 );// Checkpoint/restart after this many time steps
+      set< tag::threads >( 1 ); // Run kernels on a single thread by default
       set< tag::trace >( true ); // Output call and stack trace by default
       set< tag::version >( false ); // Do not display version info by default
       set< tag::license >( false ); // Do not display license info by default
@@ -153,7 +156,9 @@ class CmdLine : public tk::Control<
                    tag::helpkw,         tk::ctr::HelpKw,
                    tag::error,          std::vector< std::string >,
                    tag::lbfreq,         kw::lbfreq::info::expect::type,
-                   tag::rsfreq,        kw::rsfreq::info::expect::type >::pup(p);
+                   tag::rsfreq,         kw::rsfreq::info::expect::type,
+                   tag::threads,        kw::threads::info::expect::type
+                 >::pup(p);
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -107,6 +107,13 @@ namespace cmd {
                                tk::grm::number,
                                tag::rsfreq > {};
 
+  //! Match and set number of threads
+  struct threads :
+         tk::grm::process_cmd< use, kw::threads,
+                               tk::grm::Store< tag::threads >,
+                               tk::grm::number,
+                               tag::threads > {};
+
   //! Match switch on trace output
   struct trace :
          tk::grm::process_cmd_switch< use, kw::trace,
@@ -136,6 +143,7 @@ namespace cmd {
                      quiescence,
                      lbfreq,
                      rsfreq,
+                     threads,
                      trace,
                      version,
                      license,
@@ -358,6 +358,11 @@ namespace grm {
           std::abs(cfl - g_inputdeck_defaults.get< tag::discr, tag::cfl >()) >
             std::numeric_limits< tk::real >::epsilon() )
         Message< Stack, WARNING, MsgKey::MULDT >( stack, in );
+      // Error out if local time stepping is configured for multi-material
+      // flow, whose non-conservative terms do not support it
+      if ( stack.template get< tag::discr, tag::lts >() > 0 &&
+           neq.get< tag::multimat >() > 0 )
+        Message< Stack, ERROR, MsgKey::LTSMULTIMAT >( stack, in );
 
       // "ndof" are the degrees of freedom that are evolved in the numerical
       // method. For finite volume (or DGP0), these are the cell-averages. This
@@ -554,6 +559,7 @@ namespace deck {
            tk::grm::discrparam< use, kw::t0, tag::t0 >,
            tk::grm::discrparam< use, kw::dt, tag::dt >,
            tk::grm::discrparam< use, kw::cfl, tag::cfl >,
+           tk::grm::discrparam< use, kw::lts, tag::lts >,
            tk::grm::discrparam< use, kw::ctau, tag::ctau >,
            tk::grm::process< use< kw::fct >, 
                              tk::grm::Store< tag::discr, tag::fct >,
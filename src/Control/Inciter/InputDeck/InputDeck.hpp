@@ -110,6 +110,7 @@ class InputDeck :
                                    kw::pde_p0,
                                    kw::ctau,
                                    kw::cfl,
+                                   kw::lts,
                                    kw::mj,
                                    kw::depvar,
                                    kw::nl_energy_growth,
@@ -199,6 +200,7 @@ class InputDeck :
       set< tag::discr, tag::t0 >( 0.0 );
       set< tag::discr, tag::dt >( 0.0 );
       set< tag::discr, tag::cfl >( 0.0 );
+      set< tag::discr, tag::lts >( 0 );
       set< tag::discr, tag::fct >( true );
       set< tag::discr, tag::reorder >( false );
       set< tag::discr, tag::ctau >( 1.0 );
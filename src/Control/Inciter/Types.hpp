@@ -85,6 +85,7 @@ using discretization = tk::tuple::tagged_tuple<
   tag::t0,     kw::t0::info::expect::type,      //!< Starting time
   tag::dt,     kw::dt::info::expect::type,      //!< Size of time step
   tag::cfl,    kw::cfl::info::expect::type,     //!< CFL coefficient
+  tag::lts,    kw::lts::info::expect::type,     //!< Largest time step level
   tag::fct,    bool,                            //!< FCT on/off
   tag::reorder,bool,                            //!< reordering on/off
   tag::ctau,   kw::ctau::info::expect::type,    //!< FCT mass diffisivity
@@ -1682,6 +1682,30 @@ struct nstep_info {
 };
 using nstep = keyword< nstep_info, TAOCPP_PEGTL_STRING("nstep") >;
 
+struct lookahead_info {
+  static std::string name() { return "lookahead"; }
+  static std::string shortDescription() { return
+    "Set maximum number of time steps in flight"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to bound how many time steps particles may be
+    advanced ahead of the estimation of their statistics. If none of the
+    differential equations consumes statistical moments, particles are advanced
+    without waiting for the statistics of earlier time steps to be estimated
+    and written to disk. A time step is in flight from when its statistics are
+    sent for estimation until it has been evaluated. This keyword sets the
+    maximum number of time steps in flight, which also bounds the memory used
+    to store statistics of time steps not yet evaluated. Setting 1 makes time
+    stepping synchronous. Example: "lookahead 4".)";
+  }
+  struct expect {
+    using type = uint64_t;
+    static constexpr type lower = 1;
+    static std::string description() { return "uint"; }
+  };
+};
+using lookahead =
+  keyword< lookahead_info, TAOCPP_PEGTL_STRING("lookahead") >;
+
 struct term_info {
   static std::string name() { return "term"; }
   static std::string shortDescription() { return
@@ -1750,6 +1774,33 @@ struct cfl_info {
 };
 using cfl = keyword< cfl_info, TAOCPP_PEGTL_STRING("cfl") >;
 
+struct lts_info {
+  static std::string name() { return "lts"; }
+  static std::string shortDescription() { return
+    "Set the number of time step levels for local time stepping"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to enable local time stepping for discontinuous
+    Galerkin (DG) methods and to set the largest time step level, L. Each
+    element is then assigned a level, l <= L, based on its own allowable time
+    step size, and advances with a time step of 2^l times the smallest one, so
+    that a time step of the mesh consists of 2^L substeps. The default, 0,
+    disables local time stepping, i.e., all elements advance with the same
+    time step size. Local time stepping is only used if the time step size is
+    computed from the CFL coefficient, see also the keyword 'cfl'. Local time
+    stepping is not supported for multi-material flow. Example: "lts 3".)"; }
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 0;
+    static constexpr type upper = 10;
+    static std::string description() { return "uint"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using lts = keyword< lts_info, TAOCPP_PEGTL_STRING("lts") >;
+
 struct ncomp_info {
   static std::string name() { return "ncomp"; }
   static std::string shortDescription() { return
@@ -3546,6 +3597,35 @@ struct rsfreq_info {
 };
 using rsfreq = keyword< rsfreq_info, TAOCPP_PEGTL_STRING("rsfreq") >;
 
+struct threads_info {
+  static std::string name() { return "Number of threads"; }
+  static std::string shortDescription()
+  { return "Set number of threads per PE for loops inside chares"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to set the number of threads each PE uses to
+       split the element, face, and edge loops of the computational kernels
+       inside a chare. The default is 1, which means that all kernels run
+       serially on the thread of the PE. Using multiple threads allows running
+       fewer but larger chares per compute node, reducing the volume of
+       communication across chare boundaries, while still using all cores of
+       the node. Note that the threads are started in addition to the PEs, so
+       the number of PEs per node times the number of threads should not
+       exceed the number of cores per node.)";
+  }
+  using alias = Alias< j >;
+  struct expect {
+    using type = std::size_t;
+    static constexpr type lower = 1;
+    static constexpr type upper = 1024;
+    static std::string description() { return "int"; }
+    static std::string choices() {
+      return "integer between [" + std::to_string(lower) + "..." +
+             std::to_string(upper) + "] (both inclusive)";
+    }
+  };
+};
+using threads = keyword< threads_info, TAOCPP_PEGTL_STRING("threads") >;
+
 struct feedback_info {
   static std::string name() { return "feedback"; }
   static std::string shortDescription() { return "Enable on-screen feedback"; }
@@ -3807,9 +3887,10 @@ struct reorder_cmd_info {
   static std::string shortDescription() { return "Reorder mesh nodes"; }
   static std::string longDescription() { return
     R"(This keyword is used as a command line argument to instruct the mesh
-    converter to not only convert but also reorder the mesh nodes using the
-    advancing front technique. Reordering is optional in meshconv and
-    inciter.)";
+    converter to not only convert but also reorder the mesh nodes. The
+    reordering algorithm is selected by the ordering command line argument,
+    the default is the advancing front technique. Reordering is optional in
+    meshconv and inciter.)";
   }
   using alias = Alias< r >;
   struct expect {
@@ -3819,6 +3900,96 @@ struct reorder_cmd_info {
 };
 using reorder_cmd = keyword< reorder_cmd_info, TAOCPP_PEGTL_STRING("reorder") >;
 
+struct advancing_front_info {
+  static std::string name() { return "advancing front"; }
+  static std::string shortDescription() { return
+    "Select mesh reordering with the advancing front technique"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select reordering the mesh nodes using the
+    advancing front technique: starting from the first node, nodes are numbered
+    in the order they are reached from the nodes numbered in the previous
+    front. See Control/Options/MeshOrdering.hpp for other valid options.)"; }
+};
+using advancing_front =
+  keyword< advancing_front_info, TAOCPP_PEGTL_STRING("front") >;
+
+struct rcm_info {
+  static std::string name() { return "reverse Cuthill-McKee"; }
+  static std::string shortDescription() { return
+    "Select mesh reordering with the reverse Cuthill-McKee algorithm"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select reordering the mesh nodes using the
+    reverse Cuthill-McKee algorithm, which reduces the bandwidth and profile of
+    the matrix of a node-centered discretization. See
+    Control/Options/MeshOrdering.hpp for other valid options.)"; }
+};
+using rcm = keyword< rcm_info, TAOCPP_PEGTL_STRING("rcm") >;
+
+struct hilbert_info {
+  static std::string name() { return "Hilbert curve"; }
+  static std::string shortDescription() { return
+    "Select mesh reordering along a Hilbert space-filling curve"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select reordering the mesh nodes along a Hilbert
+    space-filling curve, which keeps nodes close in space close in memory. See
+    Control/Options/MeshOrdering.hpp for other valid options.)"; }
+};
+using hilbert = keyword< hilbert_info, TAOCPP_PEGTL_STRING("hilbert") >;
+
+struct morton_info {
+  static std::string name() { return "Morton curve"; }
+  static std::string shortDescription() { return
+    "Select mesh reordering along a Morton space-filling curve"; }
+  static std::string longDescription() { return
+    R"(This keyword is used to select reordering the mesh nodes along a Morton
+    (Z-order) space-filling curve, which keeps nodes close in space close in
+    memory. See Control/Options/MeshOrdering.hpp for other valid options.)"; }
+};
+using morton = keyword< morton_info, TAOCPP_PEGTL_STRING("morton") >;
+
+struct ordering_cmd_info {
+  static std::string name() { return "ordering"; }
+  static std::string shortDescription() { return
+    "Select mesh reordering algorithm"; }
+  static std::string longDescription() { return
+    R"(This keyword is used as a command line argument to select the algorithm
+    used to reorder the mesh nodes if reordering is enabled by the reorder
+    command line argument. See Control/Options/MeshOrdering.hpp for valid
+    options.)"; }
+  using alias = Alias< O >;
+  struct expect {
+    using type = std::string;
+    static std::string description() { return "string"; }
+    static std::string choices() {
+      return '\'' + advancing_front::string() + "\' | \'"
+                  + rcm::string() + "\' | \'"
+                  + hilbert::string() + "\' | \'"
+                  + morton::string() + '\'';
+    }
+  };
+};
+using ordering_cmd =
+  keyword< ordering_cmd_info, TAOCPP_PEGTL_STRING("ordering") >;
+
+struct elemorder_cmd_info {
+  static std::string name() { return "elemorder"; }
+  static std::string shortDescription() { return "Reorder mesh elements"; }
+  static std::string longDescription() { return
+    R"(This keyword is used as a command line argument to instruct the mesh
+    converter to also reorder the mesh elements following the order of their
+    nodes if reordering is enabled by the reorder command line argument.
+    Sweeping over the reordered elements gathers the element nodes in
+    approximately the order they are stored in memory.)";
+  }
+  using alias = Alias< E >;
+  struct expect {
+    using type = bool;
+    static std::string description() { return "string"; }
+  };
+};
+using elemorder_cmd =
+  keyword< elemorder_cmd_info, TAOCPP_PEGTL_STRING("elemorder") >;
+
 struct reorder_info {
   static std::string name() { return "reorder"; }
   static std::string shortDescription() { return "Reorder mesh nodes"; }
@@ -3845,10 +4016,12 @@ struct group_info {
     R"(This option can be used to select one or more test groups to run by
     specifying the full or a partial name of a test group. All tests of a
     selected group will be executed. If this option is not given, all test
-    groups are executed by default. Examples: '--group make_list' - run only
+    groups are executed by default, except benchmarks, i.e., groups that have
+    the string 'Benchmark' in their name, which are only executed if selected
+    by this option. Examples: '--group make_list' - run only
     the 'make_list' test group, '--group Parser' - run the test groups that have
     the string 'Parser' in their name, e.g., groups 'Control/FileParser' and
-    'Control/StringParser'.)";
+    'Control/StringParser', '--group Benchmark' - run all benchmarks.)";
   }
   using alias = Alias< g >;
   struct expect {
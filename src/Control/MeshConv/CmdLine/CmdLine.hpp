@@ -23,6 +23,7 @@
 #include "Keywords.hpp"
 #include "HelpFactory.hpp"
 #include "MeshConv/Types.hpp"
+#include "Options/MeshOrdering.hpp"
 
 namespace meshconv {
 //! Mesh converter control facilitating user input to internal data transfer
@@ -39,6 +40,8 @@ class CmdLine :
                       tag::verbose,    bool,
                       tag::chare,      bool,
                       tag::reorder,    bool,
+                      tag::ordering,   tk::ctr::MeshOrderingType,
+                      tag::elemorder,  bool,
                       tag::help,       bool,
                       tag::quiescence, bool,
                       tag::trace,      bool,
@@ -59,6 +62,8 @@ class CmdLine :
                                      , kw::input
                                      , kw::output
                                      , kw::reorder_cmd
+                                     , kw::ordering_cmd
+                                     , kw::elemorder_cmd
                                      , kw::quiescence
                                      , kw::trace
                                      , kw::version
@@ -75,6 +80,9 @@ class CmdLine :
       set< tag::verbose >( false ); // Use quiet output by default
       set< tag::chare >( false ); // No chare state output by default
       set< tag::reorder >( false ); // Do not reorder by default
+      // Reorder with the advancing front technique by default
+      set< tag::ordering >( tk::ctr::MeshOrderingType::FRONT );
+      set< tag::elemorder >( false ); // Do not reorder elements by default
       set< tag::trace >( true ); // Output call and stack trace by default
       set< tag::version >( false ); // Do not display version info by default
       set< tag::license >( false ); // Do not display license info by default
@@ -91,6 +99,8 @@ class CmdLine :
                    tag::verbose,    bool,
                    tag::chare,      bool,
                    tag::reorder,    bool,
+                   tag::ordering,   tk::ctr::MeshOrderingType,
+                   tag::elemorder,  bool,
                    tag::help,       bool,
                    tag::quiescence, bool,
                    tag::trace,      bool,
@@ -16,6 +16,38 @@
 
 #include "CommonGrammar.hpp"
 #include "Keywords.hpp"
+#include "Options/MeshOrdering.hpp"
+
+namespace tk {
+namespace grm {
+
+  // Note that PEGTL action specializations must be in the same namespace as the
+  // template being specialized. See http://stackoverflow.com/a/3052604.
+
+  // MeshConv's CmdLine actions
+
+  //! Rule used to trigger action
+  template< class Option, typename... tags >
+  struct store_meshconv_option : pegtl::success {};
+  //! \brief Put option in state at position given by tags
+  //! \details The option values are not command line keywords, so unlike
+  //!   tk::grm::store_option, this does not require them to be in the keywords
+  //!   pool of the command line grammar.
+  template< class Option, typename... tags >
+  struct action< store_meshconv_option< Option, tags... > > {
+    template< typename Input, typename Stack >
+    static void apply( const Input& in, Stack& stack ) {
+      Option opt;
+      if (opt.exist(in.string())) {
+        stack.template set< tags... >( opt.value( in.string() ) );
+      } else {
+        Message< Stack, ERROR, MsgKey::NOOPTION >( stack, in );
+      }
+    }
+  };
+
+} // ::grm
+} // ::tk
 
 namespace meshconv {
 //! Mesh converter command line grammar definition
@@ -44,6 +76,19 @@ namespace cmd {
   struct reorder :
          tk::grm::process_cmd_switch< use, kw::reorder_cmd, tag::reorder > {};
 
+  //! Match and set mesh reordering algorithm
+  struct ordering :
+         tk::grm::process_cmd< use, kw::ordering_cmd,
+                               tk::grm::store_meshconv_option<
+                                 tk::ctr::MeshOrdering, tag::ordering >,
+                               pegtl::alpha,
+                               tag::ordering > {};
+
+  //! Match and set element reorder switch (i.e., reorder elements or not)
+  struct elemorder :
+         tk::grm::process_cmd_switch< use, kw::elemorder_cmd,
+                                      tag::elemorder > {};
+
   //! \brief Match and set io parameter
   template< typename keyword, typename io_tag >
   struct io :
@@ -88,6 +133,8 @@ namespace cmd {
          pegtl::sor< verbose,
                      charestate,
                      reorder,
+                     ordering,
+                     elemorder,
                      help,
                      helpkw,
                      quiescence,
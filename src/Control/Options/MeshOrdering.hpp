@@ -0,0 +1,68 @@
+// *****************************************************************************
+/*!
+  \file      src/Control/Options/MeshOrdering.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Mesh reordering algorithm options
+  \details   Mesh reordering algorithm options
+*/
+// *****************************************************************************
+#ifndef MeshOrderingOptions_h
+#define MeshOrderingOptions_h
+
+#include <brigand/sequences/list.hpp>
+
+#include "Toggle.hpp"
+#include "Keywords.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+namespace ctr {
+
+//! Mesh reordering algorithm types
+enum class MeshOrderingType : uint8_t { FRONT=0,
+                                        RCM,
+                                        HILBERT,
+                                        MORTON };
+
+//! \brief Pack/Unpack MeshOrderingType: forward overload to generic enum class
+//!   packer
+inline void operator|( PUP::er& p, MeshOrderingType& e ) { PUP::pup( p, e ); }
+
+//! \brief MeshOrdering options: outsource searches to base templated on enum
+//!   type
+class MeshOrdering : public tk::Toggle< MeshOrderingType > {
+
+  public:
+    //! Valid expected choices to make them also available at compile-time
+    using keywords = brigand::list< kw::advancing_front
+                                  , kw::rcm
+                                  , kw::hilbert
+                                  , kw::morton
+                                  >;
+
+    //! \brief Options constructor
+    //! \details Simply initialize in-line and pass associations to base, which
+    //!    will handle client interactions
+    explicit MeshOrdering() :
+      tk::Toggle< MeshOrderingType >(
+        //! Group, i.e., options, name
+        "Mesh reordering algorithm",
+        //! Enums -> names
+        { { MeshOrderingType::FRONT, kw::advancing_front::name() },
+          { MeshOrderingType::RCM, kw::rcm::name() },
+          { MeshOrderingType::HILBERT, kw::hilbert::name() },
+          { MeshOrderingType::MORTON, kw::morton::name() } },
+        //! keywords -> Enums
+        { { kw::advancing_front::string(), MeshOrderingType::FRONT },
+          { kw::rcm::string(), MeshOrderingType::RCM },
+          { kw::hilbert::string(), MeshOrderingType::HILBERT },
+          { kw::morton::string(), MeshOrderingType::MORTON } } ) {}
+};
+
+} // ctr::
+} // tk:::
+
+#endif // MeshOrderingOptions_h
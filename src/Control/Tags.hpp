@@ -51,9 +51,12 @@ struct benchmark {};
 struct lboff {};
 struct feedback {};
 struct reorder {};
+struct ordering {};
+struct elemorder {};
 struct error {};
 struct lbfreq {};
 struct rsfreq {};
+struct threads {};
 struct dtfreq {};
 struct pdf {};
 struct ordpdf {};
@@ -107,10 +110,12 @@ struct initpolicy {};
 struct coeffpolicy {};
 struct montecarlo {};
 struct nstep {};
+struct lookahead {};
 struct term {};
 struct t0 {};
 struct dt {};
 struct cfl {};
+struct lts {};
 struct fct {};
 struct ctau {};
 struct npar {};
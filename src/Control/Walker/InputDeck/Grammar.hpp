@@ -625,6 +625,7 @@ namespace deck {
   struct discretization_parameters :
          pegtl::sor< tk::grm::discrparam< use, kw::npar, tag::npar >,
                      tk::grm::discrparam< use, kw::nstep, tag::nstep >,
+                     tk::grm::discrparam< use, kw::lookahead, tag::lookahead >,
                      tk::grm::discrparam< use, kw::term, tag::term >,
                      tk::grm::discrparam< use, kw::dt, tag::dt >,
                      tk::grm::interval< use< kw::ttyi >, tag::tty > > {};
@@ -60,6 +60,7 @@ class InputDeck :
                                      , kw::txt_float_format
                                      , kw::npar
                                      , kw::nstep
+                                     , kw::lookahead
                                      , kw::term
                                      , kw::dt
                                      , kw::ttyi
@@ -237,6 +238,7 @@ class InputDeck :
          ( std::numeric_limits< kw::nstep::info::expect::type >::max() );
       set< tag::discr, tag::term >( 1.0 );
       set< tag::discr, tag::dt >( 0.5 );
+      set< tag::discr, tag::lookahead >( 8 );
       // Default txt floating-point output precision in digits
       set< tag::prec, tag::stat >( std::cout.precision() );
       set< tag::prec, tag::pdf >( std::cout.precision() );
@@ -275,6 +277,21 @@ class InputDeck :
     //! \return True if there are any PDFs to estimate
     bool pdf() { return !get< tag::pdf >().empty(); }
 
+    //! Query if any differential equation consumes statistical moments
+    //! \return True if any of the differential equations selected may use
+    //!   estimated statistical moments to advance particles in time, i.e.,
+    //!   if the moments must have been estimated before the next time step
+    bool momentsUsed() {
+      for (auto d : get< tag::selected, tag::diffeq >())
+        if (d == ctr::DiffEqType::MIXNUMFRACBETA ||
+            d == ctr::DiffEqType::MIXMASSFRACBETA ||
+            d == ctr::DiffEqType::MIXDIRICHLET ||
+            d == ctr::DiffEqType::DISSIPATION ||
+            d == ctr::DiffEqType::VELOCITY)
+          return true;
+      return false;
+    }
+
     //! Pack/Unpack
     void pup( PUP::er& p ) {
       tk::Control< tag::title,      kw::title::info::expect::type,
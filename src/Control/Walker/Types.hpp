@@ -49,6 +49,7 @@ using selects = tk::tuple::tagged_tuple<
 using discretization = tk::tuple::tagged_tuple<
   tag::npar,      kw::npar::info::expect::type,   //!< Total number of particles
   tag::nstep,     kw::nstep::info::expect::type,  //!< Number of time steps
+  tag::lookahead, kw::lookahead::info::expect::type, //!< Time steps in flight
   tag::term,      kw::term::info::expect::type,   //!< Termination time
   tag::dt,        kw::dt::info::expect::type,     //!< Size of time step
   tag::binsize,   std::vector< std::vector< tk::real > >, //!< PDF binsizes
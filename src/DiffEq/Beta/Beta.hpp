@@ -48,6 +48,7 @@
 #include "InitPolicy.hpp"
 #include "BetaCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "BlockAdvance.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -109,20 +110,21 @@ class Beta {
                   tk::real,
                   const std::map< tk::ctr::Product, tk::real >& )
     {
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-
-        // Advance all m_ncomp scalars
-        for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          tk::real d = m_k[i] * par * (1.0 - par) * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          par += 0.5*m_b[i]*(m_S[i] - par)*dt + d*dW[i];
-        }
-      }
+      advanceBlocks( m_rng, stream, particles.nunk(), m_ncomp,
+        [&]( ncomp_t first, ncomp_t n, const tk::real* dW ) {
+          // Advance all m_ncomp scalars
+          for (ncomp_t i=0; i<m_ncomp; ++i) {
+            const auto x = particles.cptr( i, m_offset );
+            const auto w = dW + i*n;
+            const auto b = m_b[i], S = m_S[i], k = m_k[i];
+            for (ncomp_t q=0; q<n; ++q) {
+              tk::real& par = particles.var( x, first+q );
+              tk::real d = k * par * (1.0 - par) * dt;
+              d = (d > 0.0 ? std::sqrt(d) : 0.0);
+              par += 0.5*b*(S - par)*dt + d*w[q];
+            }
+          }
+        } );
     }
 
   private:
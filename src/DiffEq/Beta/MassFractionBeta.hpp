@@ -70,6 +70,7 @@
 #include "InitPolicy.hpp"
 #include "MassFractionBetaCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "BlockAdvance.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -142,22 +143,26 @@ class MassFractionBeta {
                   const std::map< tk::ctr::Product, tk::real >& )
     {
       // Advance particles
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-        // Advance all m_ncomp scalars
-        for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& Y = particles( p, i, m_offset );
-          tk::real d = m_k[i] * Y * (1.0 - Y) * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          Y += 0.5*m_b[i]*(m_S[i] - Y)*dt + d*dW[i];
-          // Compute instantaneous values derived from updated Y
-          particles( p, m_ncomp+i, m_offset ) = rho( Y, i );
-          particles( p, m_ncomp*2+i, m_offset ) = vol( Y, i );
-        }
-      }
+      advanceBlocks( m_rng, stream, particles.nunk(), m_ncomp,
+        [&]( ncomp_t first, ncomp_t n, const tk::real* dW ) {
+          // Advance all m_ncomp scalars
+          for (ncomp_t i=0; i<m_ncomp; ++i) {
+            const auto x = particles.cptr( i, m_offset );
+            const auto r = particles.cptr( m_ncomp+i, m_offset );
+            const auto v = particles.cptr( m_ncomp*2+i, m_offset );
+            const auto w = dW + i*n;
+            const auto b = m_b[i], S = m_S[i], k = m_k[i];
+            for (ncomp_t q=0; q<n; ++q) {
+              tk::real& Y = particles.var( x, first+q );
+              tk::real d = k * Y * (1.0 - Y) * dt;
+              d = (d > 0.0 ? std::sqrt(d) : 0.0);
+              Y += 0.5*b*(S - Y)*dt + d*w[q];
+              // Compute instantaneous values derived from updated Y
+              particles.var( r, first+q ) = rho( Y, i );
+              particles.var( v, first+q ) = vol( Y, i );
+            }
+          }
+        } );
     }
 
   private:
@@ -84,6 +84,7 @@
 #include "InitPolicy.hpp"
 #include "MixMassFractionBetaCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "BlockAdvance.hpp"
 #include "Particles.hpp"
 #include "Table.hpp"
 #include "CoupledEq.hpp"
@@ -214,31 +215,31 @@ class MixMassFractionBeta {
                     m_kprime, m_rho2, m_r, m_hts, m_hp, m_b, m_k, m_S, t );
 
       // Advance particles
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-
-        // Access coupled particle velocity
-        tk::real u = 0.0, v = 0.0, w = 0.0;
-        if (m_velocity_coupled) {
-          u = particles( p, 0, m_velocity_offset );
-          v = particles( p, 1, m_velocity_offset );
-          w = particles( p, 2, m_velocity_offset );
-        }
-
-        // Advance all m_ncomp scalars
-        for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& Y = particles( p, i, m_offset );
-          tk::real d = m_k[i] * Y * (1.0 - Y) * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          Y += 0.5*m_b[i]*(m_S[i] - Y)*dt + d*dW[i]
-             - (m_dY[0]*u - m_dY[1]*v - m_dY[2]*w)*dt;
-          // Compute instantaneous values derived from updated Y
-          derived( particles, p, i );
-        }
-      }
+      advanceBlocks( m_rng, stream, particles.nunk(), m_ncomp,
+        [&]( ncomp_t first, ncomp_t n, const tk::real* dW ) {
+          for (ncomp_t q=0; q<n; ++q) {
+            const auto p = first + q;
+
+            // Access coupled particle velocity
+            tk::real u = 0.0, v = 0.0, w = 0.0;
+            if (m_velocity_coupled) {
+              u = particles( p, 0, m_velocity_offset );
+              v = particles( p, 1, m_velocity_offset );
+              w = particles( p, 2, m_velocity_offset );
+            }
+
+            // Advance all m_ncomp scalars
+            for (ncomp_t i=0; i<m_ncomp; ++i) {
+              tk::real& Y = particles( p, i, m_offset );
+              tk::real d = m_k[i] * Y * (1.0 - Y) * dt;
+              d = (d > 0.0 ? std::sqrt(d) : 0.0);
+              Y += 0.5*m_b[i]*(m_S[i] - Y)*dt + d*dW[i*n+q]
+                 - (m_dY[0]*u - m_dY[1]*v - m_dY[2]*w)*dt;
+              // Compute instantaneous values derived from updated Y
+              derived( particles, p, i );
+            }
+          }
+        } );
     }
 
   private:
@@ -85,6 +85,7 @@
 #include "InitPolicy.hpp"
 #include "MixNumberFractionBetaCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "BlockAdvance.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -165,22 +166,26 @@ class MixNumberFractionBeta {
       // Update SDE coefficients
       coeff.update( m_depvar, m_ncomp, moments, m_bprime, m_kprime, m_b, m_k );
       // Advance particles
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-        // Advance all m_ncomp scalars
-        for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& X = particles( p, i, m_offset );
-          tk::real d = m_k[i] * X * (1.0 - X) * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          X += 0.5*m_b[i]*(m_S[i] - X)*dt + d*dW[i];
-          // Compute instantaneous values derived from updated X
-          particles( p, m_ncomp+i, m_offset ) = rho( X, i );
-          particles( p, m_ncomp*2+i, m_offset ) = vol( X, i );
-        }
-      }
+      advanceBlocks( m_rng, stream, particles.nunk(), m_ncomp,
+        [&]( ncomp_t first, ncomp_t n, const tk::real* dW ) {
+          // Advance all m_ncomp scalars
+          for (ncomp_t i=0; i<m_ncomp; ++i) {
+            const auto x = particles.cptr( i, m_offset );
+            const auto r = particles.cptr( m_ncomp+i, m_offset );
+            const auto v = particles.cptr( m_ncomp*2+i, m_offset );
+            const auto w = dW + i*n;
+            const auto b = m_b[i], S = m_S[i], k = m_k[i];
+            for (ncomp_t q=0; q<n; ++q) {
+              tk::real& X = particles.var( x, first+q );
+              tk::real d = k * X * (1.0 - X) * dt;
+              d = (d > 0.0 ? std::sqrt(d) : 0.0);
+              X += 0.5*b*(S - X)*dt + d*w[q];
+              // Compute instantaneous values derived from updated X
+              particles.var( r, first+q ) = rho( X, i );
+              particles.var( v, first+q ) = vol( X, i );
+            }
+          }
+        } );
     }
 
   private:
@@ -0,0 +1,73 @@
+// *****************************************************************************
+/*!
+  \file      src/DiffEq/BlockAdvance.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Advance particles of an SDE in blocks
+  \details   This file defines a helper used by the advance() member functions
+    of the SDEs to advance particles in blocks of a fixed number of particles.
+    All Gaussian random numbers required to advance a block are drawn with a
+    single call to the random number generator into a thread-local buffer
+    that is reused across calls, so no memory is allocated and the RNG call
+    overhead is amortized over a block of particles. The random numbers of a block are
+    stored component-major, so that the SDEs can update a component of all
+    particles of a block in a loop over contiguous random numbers that the
+    compiler can vectorize.
+*/
+// *****************************************************************************
+#ifndef BlockAdvance_h
+#define BlockAdvance_h
+
+#include <vector>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "RNG.hpp"
+#include "SystemComponents.hpp"
+
+namespace walker {
+
+//! Number of particles advanced together in a block by the SDEs
+const tk::ctr::ncomp_type npblock = 256;
+
+//! Access the buffer for the random numbers of a block of the calling thread
+//! \return Reference to the random number buffer of the calling thread
+//! \details The buffer is thread-local, since the SDEs, and thus anything they
+//!   own, are shared by the PEs, which are threads of the same process in an
+//!   SMP build of Charm++, and advance particles concurrently using different
+//!   random number streams.
+inline std::vector< tk::real >& blockBuffer() {
+  thread_local std::vector< tk::real > dW;
+  return dW;
+}
+
+//! Advance particles in blocks, drawing all random numbers of a block at once
+//! \param[in] rng Random number generator to draw Gaussian random numbers from
+//! \param[in] stream Thread (or more precisely stream) ID
+//! \param[in] npar Number of particles to advance
+//! \param[in] nrnd Number of Gaussian random numbers required per particle
+//! \param[in] advance Function advancing a block of particles, called as
+//!   advance( first, n, w ), where particles [first,first+n) are to be
+//!   advanced, and w[i*n+q] is the i-th random number of particle first+q
+template< class Advance >
+void advanceBlocks( const tk::RNG& rng,
+                    int stream,
+                    tk::ctr::ncomp_type npar,
+                    tk::ctr::ncomp_type nrnd,
+                    Advance advance )
+{
+  auto& dW = blockBuffer();
+  if (dW.size() < npblock*nrnd) dW.resize( npblock*nrnd );
+  for (tk::ctr::ncomp_type p=0; p<npar; p+=npblock) {
+    auto n = std::min( npblock, npar-p );
+    // Generate Gaussian random numbers with zero mean and unit variance
+    rng.gaussian( stream, n*nrnd, dW.data() );
+    advance( p, n, static_cast< const tk::real* >( dW.data() ) );
+  }
+}
+
+} // walker::
+
+#endif // BlockAdvance_h
@@ -55,6 +55,7 @@
 #include "InitPolicy.hpp"
 #include "DirichletCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "BlockAdvance.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -119,25 +120,29 @@ class Dirichlet {
                   tk::real,
                   const std::map< tk::ctr::Product, tk::real >& )
     {
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Compute Nth scalar
-        tk::real yn = 1.0 - particles(p, 0, m_offset);
-        for (ncomp_t i=1; i<m_ncomp; ++i)
-          yn -= particles( p, i, m_offset );
-
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-
-        // Advance first m_ncomp (K=N-1) scalars
-        for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          tk::real d = m_k[i] * par * yn * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          par += 0.5*m_b[i]*( m_S[i]*yn - (1.0-m_S[i]) * par )*dt + d*dW[i];
-        }
-      }
+      advanceBlocks( m_rng, stream, particles.nunk(), m_ncomp,
+        [&]( ncomp_t first, ncomp_t n, const tk::real* dW ) {
+          // Compute Nth scalar
+          tk::real yn[ npblock ];
+          for (ncomp_t q=0; q<n; ++q) yn[q] = 1.0;
+          for (ncomp_t i=0; i<m_ncomp; ++i) {
+            const auto x = particles.cptr( i, m_offset );
+            for (ncomp_t q=0; q<n; ++q) yn[q] -= particles.var( x, first+q );
+          }
+
+          // Advance first m_ncomp (K=N-1) scalars
+          for (ncomp_t i=0; i<m_ncomp; ++i) {
+            const auto x = particles.cptr( i, m_offset );
+            const auto w = dW + i*n;
+            const auto b = m_b[i], S = m_S[i], k = m_k[i];
+            for (ncomp_t q=0; q<n; ++q) {
+              tk::real& par = particles.var( x, first+q );
+              tk::real d = k * par * yn[q] * dt;
+              d = (d > 0.0 ? std::sqrt(d) : 0.0);
+              par += 0.5*b*( S*yn[q] - (1.0-S) * par )*dt + d*w[q];
+            }
+          }
+        } );
     }
 
   private:
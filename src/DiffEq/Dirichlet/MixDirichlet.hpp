@@ -57,6 +57,7 @@
 #include "InitPolicy.hpp"
 #include "MixDirichletCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "BlockAdvance.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -154,26 +155,28 @@ class MixDirichlet {
                     moments, m_rho, m_r, m_kprime, m_b, m_k, m_S );
 
       // Advance particles
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-
-        // Advance all m_ncomp (=N=K+1) scalars
-        auto& yn = particles( p, m_ncomp, m_offset );
-        for (ncomp_t i=0; i<m_ncomp; ++i) {
-          auto& y = particles( p, i, m_offset );
-          tk::real d = m_k[i] * y * yn * dt;
-          if (d < 0.0) d = 0.0;
-          d = std::sqrt( d );
-          auto dy = 0.5*m_b[i]*( m_S[i]*yn - (1.0-m_S[i])*y )*dt + d*dW[i];
-          y += dy;
-          yn -= dy;
-        }
-        // Compute derived instantaneous variables
-        derived( particles, p );
-      }
+      advanceBlocks( m_rng, stream, particles.nunk(), m_ncomp,
+        [&]( ncomp_t first, ncomp_t n, const tk::real* dW ) {
+          // Advance all m_ncomp (=N=K+1) scalars
+          const auto x = particles.cptr( m_ncomp, m_offset );
+          for (ncomp_t i=0; i<m_ncomp; ++i) {
+            const auto y = particles.cptr( i, m_offset );
+            const auto w = dW + i*n;
+            const auto b = m_b[i], S = m_S[i], k = m_k[i];
+            for (ncomp_t q=0; q<n; ++q) {
+              auto& yn = particles.var( x, first+q );
+              auto& yi = particles.var( y, first+q );
+              tk::real d = k * yi * yn * dt;
+              if (d < 0.0) d = 0.0;
+              d = std::sqrt( d );
+              auto dy = 0.5*b*( S*yn - (1.0-S)*yi )*dt + d*w[q];
+              yi += dy;
+              yn -= dy;
+            }
+          }
+          // Compute derived instantaneous variables
+          for (ncomp_t q=0; q<n; ++q) derived( particles, first+q );
+        } );
     }
 
   private:
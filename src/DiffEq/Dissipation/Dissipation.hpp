@@ -22,6 +22,7 @@
 #include "InitPolicy.hpp"
 #include "DissipationCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "BlockAdvance.hpp"
 #include "Particles.hpp"
 #include "CoupledEq.hpp"
 
@@ -126,17 +127,18 @@ class Dissipation {
       // Update source based on coefficients policy
       Coefficients::src( Som );
 
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate a Gaussian random number with zero mean and unit variance
-        tk::real dW;
-        m_rng.gaussian( stream, m_ncomp, &dW );
-        // Advance particle frequency
-        tk::real& Op = particles( p, 0, m_offset );
-        tk::real d = 2.0*m_c3*m_c4*O*O*Op*dt;
-        d = (d > 0.0 ? std::sqrt(d) : 0.0);
-        Op += (-m_c3*(Op-O) - Som*Op)*O*dt + d*dW;
-      }
+      const auto c3 = m_c3, c4 = m_c4;
+      advanceBlocks( m_rng, stream, particles.nunk(), m_ncomp,
+        [&]( ncomp_t first, ncomp_t n, const tk::real* dW ) {
+          // Advance particle frequency
+          const auto x = particles.cptr( 0, m_offset );
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& Op = particles.var( x, first+q );
+            tk::real d = 2.0*c3*c4*O*O*Op*dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            Op += (-c3*(Op-O) - Som*Op)*O*dt + d*dW[q];
+          }
+        } );
     }
 
   private:
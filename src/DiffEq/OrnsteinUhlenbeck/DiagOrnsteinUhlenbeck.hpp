@@ -83,6 +83,7 @@
 #include "InitPolicy.hpp"
 #include "DiagOrnsteinUhlenbeckCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "BlockAdvance.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -147,20 +148,21 @@ class DiagOrnsteinUhlenbeck {
                   tk::real,
                   const std::map< tk::ctr::Product, tk::real >& )
     {
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-
-        // Advance all m_ncomp scalars
-        for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          tk::real d = m_sigmasq[i] * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          par += m_theta[i]*(m_mu[i] - par)*dt + d*dW[i];
-        }
-      }
+      advanceBlocks( m_rng, stream, particles.nunk(), m_ncomp,
+        [&]( ncomp_t first, ncomp_t n, const tk::real* dW ) {
+          // Advance all m_ncomp scalars
+          for (ncomp_t i=0; i<m_ncomp; ++i) {
+            const auto x = particles.cptr( i, m_offset );
+            const auto w = dW + i*n;
+            const auto theta = m_theta[i], mu = m_mu[i];
+            tk::real d = m_sigmasq[i] * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            for (ncomp_t q=0; q<n; ++q) {
+              tk::real& par = particles.var( x, first+q );
+              par += theta*(mu - par)*dt + d*w[q];
+            }
+          }
+        } );
     }
 
   private:
@@ -88,6 +88,7 @@
 #include "InitPolicy.hpp"
 #include "OrnsteinUhlenbeckCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "BlockAdvance.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -160,22 +161,24 @@ class OrnsteinUhlenbeck {
                   tk::real,
                   const std::map< tk::ctr::Product, tk::real >& )
     {
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-
-        // Advance all m_ncomp scalars
-        for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& par = particles( p, i, m_offset );
-          par += m_theta[i]*(m_mu[i] - par)*dt;
-          for (ncomp_t j=0; j<m_ncomp; ++j) {
-            tk::real d = m_sigma[ j*m_ncomp+i ] * sqrt(dt);     // use transpose
-            par += d*dW[j];
+      advanceBlocks( m_rng, stream, particles.nunk(), m_ncomp,
+        [&]( ncomp_t first, ncomp_t n, const tk::real* dW ) {
+          // Advance all m_ncomp scalars
+          for (ncomp_t i=0; i<m_ncomp; ++i) {
+            const auto x = particles.cptr( i, m_offset );
+            const auto theta = m_theta[i], mu = m_mu[i];
+            for (ncomp_t q=0; q<n; ++q) {
+              tk::real& par = particles.var( x, first+q );
+              par += theta*(mu - par)*dt;
+            }
+            for (ncomp_t j=0; j<m_ncomp; ++j) {
+              const auto w = dW + j*n;
+              tk::real d = m_sigma[ j*m_ncomp+i ] * sqrt(dt); // use transpose
+              for (ncomp_t q=0; q<n; ++q)
+                particles.var( x, first+q ) += d*w[q];
+            }
           }
-        }
-      }
+        } );
     }
 
   private:
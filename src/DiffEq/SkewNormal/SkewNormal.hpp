@@ -74,6 +74,7 @@
 #include "InitPolicy.hpp"
 #include "SkewNormalCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "BlockAdvance.hpp"
 #include "Particles.hpp"
 
 namespace walker {
@@ -139,25 +140,26 @@ class SkewNormal {
                   tk::real,
                   const std::map< tk::ctr::Product, tk::real >& )
     {
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-
-        // Advance all m_ncomp scalars
-        for (ncomp_t i=0; i<m_ncomp; ++i) {
-          tk::real& x = particles( p, i, m_offset );
-          tk::real d = 2.0 * m_sigmasq[i] / m_T[i] * dt;
-          d = (d > 0.0 ? std::sqrt(d) : 0.0);
-          x += - ( x - m_lambda[i] * m_sigmasq[i]
-                       * std::sqrt( 2.0 / M_PI )
-                       * std::exp( - m_lambda[i] * m_lambda[i] * x * x / 2.0 )
-                       / ( 1.0 + std::erf( m_lambda[i] * x / std::sqrt(2.0) ) )
-                   ) / m_T[i] * dt
-                 + d*dW[i];
-        }
-      }
+      advanceBlocks( m_rng, stream, particles.nunk(), m_ncomp,
+        [&]( ncomp_t first, ncomp_t n, const tk::real* dW ) {
+          // Advance all m_ncomp scalars
+          for (ncomp_t i=0; i<m_ncomp; ++i) {
+            const auto p = particles.cptr( i, m_offset );
+            const auto w = dW + i*n;
+            const auto T = m_T[i], sigmasq = m_sigmasq[i], lambda = m_lambda[i];
+            tk::real d = 2.0 * sigmasq / T * dt;
+            d = (d > 0.0 ? std::sqrt(d) : 0.0);
+            for (ncomp_t q=0; q<n; ++q) {
+              tk::real& x = particles.var( p, first+q );
+              x += - ( x - lambda * sigmasq
+                           * std::sqrt( 2.0 / M_PI )
+                           * std::exp( - lambda * lambda * x * x / 2.0 )
+                           / ( 1.0 + std::erf( lambda * x / std::sqrt(2.0) ) )
+                       ) / T * dt
+                     + d*w[q];
+            }
+          }
+        } );
     }
 
   private:
@@ -24,6 +24,7 @@
 #include "InitPolicy.hpp"
 #include "VelocityCoeffPolicy.hpp"
 #include "RNG.hpp"
+#include "BlockAdvance.hpp"
 #include "Particles.hpp"
 #include "CoupledEq.hpp"
 
@@ -131,27 +132,32 @@ class Velocity {
       // Modify G with the mean velocity gradient
       for (std::size_t i=0; i<9; ++i) m_G[i] -= m_dU[i];
 
-      const auto npar = particles.nunk();
-      for (auto p=decltype(npar){0}; p<npar; ++p) {
-        // Generate Gaussian random numbers with zero mean and unit variance
-        std::vector< tk::real > dW( m_ncomp );
-        m_rng.gaussian( stream, m_ncomp, dW.data() );
-        // Acces particle velocity
-        tk::real& Up = particles( p, 0, m_offset );
-        tk::real& Vp = particles( p, 1, m_offset );
-        tk::real& Wp = particles( p, 2, m_offset );
-        // Compute diffusion
-        tk::real d = m_c0 * eps * dt;
-        d = (d > 0.0 ? std::sqrt(d) : 0.0);
-        // Compute velocity fluctuation
-        tk::real u = Up - U[0];
-        tk::real v = Vp - U[1];
-        tk::real w = Wp - U[2];
-        // Update particle velocity
-        Up += (m_G[0]*u + m_G[1]*v + m_G[2]*w)*dt + d*dW[0];
-        Vp += (m_G[3]*u + m_G[4]*v + m_G[5]*w)*dt + d*dW[1];
-        Wp += (m_G[6]*u + m_G[7]*v + m_G[8]*w)*dt + d*dW[2];
-      }
+      // Compute diffusion
+      tk::real d = m_c0 * eps * dt;
+      d = (d > 0.0 ? std::sqrt(d) : 0.0);
+      const auto G = m_G;
+
+      advanceBlocks( m_rng, stream, particles.nunk(), m_ncomp,
+        [&]( ncomp_t first, ncomp_t n, const tk::real* dW ) {
+          // Acces particle velocity
+          const auto x = particles.cptr( 0, m_offset );
+          const auto y = particles.cptr( 1, m_offset );
+          const auto z = particles.cptr( 2, m_offset );
+          const auto wx = dW, wy = dW + n, wz = dW + 2*n;
+          for (ncomp_t q=0; q<n; ++q) {
+            tk::real& Up = particles.var( x, first+q );
+            tk::real& Vp = particles.var( y, first+q );
+            tk::real& Wp = particles.var( z, first+q );
+            // Compute velocity fluctuation
+            tk::real u = Up - U[0];
+            tk::real v = Vp - U[1];
+            tk::real w = Wp - U[2];
+            // Update particle velocity
+            Up += (G[0]*u + G[1]*v + G[2]*w)*dt + d*wx[q];
+            Vp += (G[3]*u + G[4]*v + G[5]*w)*dt + d*wy[q];
+            Wp += (G[6]*u + G[7]*v + G[8]*w)*dt + d*wz[q];
+          }
+        } );
     }
 
   private:
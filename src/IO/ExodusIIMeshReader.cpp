@@ -11,6 +11,7 @@
 // *****************************************************************************
 
 #include <numeric>
+#include <algorithm>
 
 #include "NoWarning/exodusII.hpp"
 
@@ -130,8 +131,41 @@ ExodusIIMeshReader::readMeshPart(
   m_till = m_from + chunk;
   if (pe == npes-1) m_till += nel % npes;
 
-  // Read tetrahedron connectivity between from and till
-  readElements( {{m_from, m_till-1}}, tk::ExoElemType::TET, ginpoel );
+  // Read triangle element connectivity (all triangle blocks in file). This is
+  // read first, as it is usually much smaller than the tetrahedron
+  // connectivity, so the faces of tetrahedra can be matched against it while
+  // the tetrahedra are read.
+  auto ntri = nelem( tk::ExoElemType::TRI );
+  if ( ntri !=0 ) readElements( {{0,ntri-1}}, tk::ExoElemType::TRI, triinp );
+
+  // Associate a unique id to each distinct triangle in file
+  std::unordered_map< tk::UnsMesh::Face, std::size_t,
+                      tk::UnsMesh::Hash<3>, tk::UnsMesh::Eq<3> > tri;
+  std::vector< std::size_t > triid( triinp.size()/3 );
+  for (std::size_t e=0; e<triinp.size()/3; ++e)
+    triid[e] = tri.emplace( tk::UnsMesh::Face{{ triinp[e*3+0],
+                                                triinp[e*3+1],
+                                                triinp[e*3+2] }},
+                            tri.size() ).first->second;
+
+  // Read tetrahedron connectivity between from and till in blocks, and mark
+  // the triangles that are faces of the tetrahedra as each block arrives.
+  // This avoids building a set of all faces of all tetrahedra read.
+  std::vector< char > shared( tri.size(), 0 );
+  ginpoel.reserve( (m_till - m_from) * 4 );
+  for (auto from = m_from; from < m_till; from += m_tetblock) {
+    auto till = std::min( from + m_tetblock, m_till );
+    auto e = ginpoel.size()/4;
+    readElements( {{from, till-1}}, tk::ExoElemType::TET, ginpoel );
+    if (tri.empty()) continue;
+    for (; e<ginpoel.size()/4; ++e)
+      for (const auto& f : tk::expofa) {
+        auto i = tri.find( {{ ginpoel[ e*4+f[0] ],
+                              ginpoel[ e*4+f[1] ],
+                              ginpoel[ e*4+f[2] ] }} );
+        if (i != end(tri)) shared[ i->second ] = 1;
+      }
+  }
 
   // Compute local data from global mesh connectivity
   std::vector< std::size_t > gid;
@@ -140,26 +174,11 @@ ExodusIIMeshReader::readMeshPart(
   // Read this PE's chunk of the mesh node coordinates from file
   coord = readCoords( gid );
 
-  // Generate set of unique faces
-  tk::UnsMesh::FaceSet faces;
-  for (std::size_t e=0; e<ginpoel.size()/4; ++e)
-    for (std::size_t f=0; f<4; ++f) {
-      const auto& tri = tk::expofa[f];
-      faces.insert( {{{ ginpoel[ e*4+tri[0] ],
-                        ginpoel[ e*4+tri[1] ],
-                        ginpoel[ e*4+tri[2] ] }}} );
-    }
-
-  // Read triangle element connectivity (all triangle blocks in file)
-  auto ntri = nelem( tk::ExoElemType::TRI );
-  if ( ntri !=0 ) readElements( {{0,ntri-1}}, tk::ExoElemType::TRI, triinp );
-
   // Keep triangles shared in (partially-read) tetrahedron mesh
   std::vector< std::size_t > triinp_own;
   std::size_t ltrid = 0;        // local triangle id
   for (std::size_t e=0; e<triinp.size()/3; ++e) {
-    auto i = faces.find( {{ triinp[e*3+0], triinp[e*3+1], triinp[e*3+2] }} );
-    if (i != end(faces)) {
+    if (shared[ triid[e] ]) {
       m_tri[e] = ltrid++;       // generate global->local triangle ids
       triinp_own.push_back( triinp[e*3+0] );
       triinp_own.push_back( triinp[e*3+1] );
@@ -295,13 +314,55 @@ ExodusIIMeshReader::readNodes( const std::vector< std::size_t >& gid ) const
 // *****************************************************************************
 //  Read coordinates of a number of mesh nodes from ExodusII file
 //! \param[in] gid Node IDs whose coordinates to read
-//! \return Mesh node coordinates
+//! \return Mesh node coordinates in the order of gid
+//! \details Instead of reading the nodes one by one, the node IDs are sorted
+//!   and coalesced into contiguous ranges, each read from file with a single
+//!   call, then the coordinates are scattered back to the order requested.
+//!   Node IDs not farther than m_maxgap apart are read as part of the same
+//!   range, i.e., a few coordinates not needed are read to save a call, so a
+//!   dense set of IDs is read by a few large reads. A range is at most
+//!   m_maxrange nodes long to bound the memory of the read buffer.
 // *****************************************************************************
 {
   std::vector< tk::real > px( gid.size() ), py( gid.size() ), pz( gid.size() );
 
-  std::size_t i=0;
-  for (auto g : gid) readNode( g, i++, px, py, pz );
+  // Order positions of node IDs by node ID
+  std::vector< std::size_t > order( gid.size() );
+  std::iota( begin(order), end(order), 0 );
+  std::sort( begin(order), end(order),
+             [&]( std::size_t a, std::size_t b ){ return gid[a] < gid[b]; } );
+
+  std::vector< tk::real > x, y, z;
+  std::size_t k = 0;
+  while (k < order.size()) {
+    // Find range of node IDs to read starting from the k-th smallest
+    const auto first = gid[ order[k] ];
+    auto l = k;
+    while (l+1 < order.size() &&
+           gid[ order[l+1] ] - gid[ order[l] ] <= m_maxgap &&
+           gid[ order[l+1] ] - first < m_maxrange) ++l;
+    const auto last = gid[ order[l] ];
+    const auto n = last - first + 1;
+
+    // Read coordinates of node range
+    x.resize( n );
+    y.resize( n );
+    z.resize( n );
+    ErrChk(
+      ex_get_partial_coord( m_inFile, static_cast<int64_t>(first)+1,
+        static_cast<int64_t>(n), x.data(), y.data(), z.data() ) == 0,
+      "Failed to read coordinates of nodes " + std::to_string(first) + '-' +
+      std::to_string(last) + " from ExodusII file: " + m_filename );
+
+    // Scatter coordinates of node range to the order requested
+    for (; k<=l; ++k) {
+      const auto i = order[k];
+      const auto j = gid[i] - first;
+      px[i] = x[j];
+      py[i] = y[j];
+      pz[i] = z[j];
+    }
+  }
 
   return {{ std::move(px), std::move(py), std::move(pz) }};
 }
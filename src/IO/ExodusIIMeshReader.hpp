@@ -228,6 +228,13 @@ class ExodusIIMeshReader {
     //! Global->local triangle element ids on this PE
     std::unordered_map< std::size_t, std::size_t > m_tri;
 
+    //! Largest gap between node IDs read as part of the same range
+    static const std::size_t m_maxgap = 1024;
+    //! Largest number of nodes read with a single call
+    static const std::size_t m_maxrange = 1048576;
+    //! Number of tetrahedra read with a single call when reading a mesh part
+    static const std::size_t m_tetblock = 65536;
+
     //! Read ExodusII header without setting mesh size
     std::size_t readHeader();
 
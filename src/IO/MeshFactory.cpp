@@ -11,6 +11,7 @@
 // *****************************************************************************
 
 #include <string>
+#include <sstream>
 
 #include "MeshFactory.hpp"
 #include "MeshDetect.hpp"
@@ -80,16 +81,23 @@ std::vector< std::pair< std::string, tk::real > >
 writeUnsMesh( const tk::Print& print,
               const std::string& filename,
               UnsMesh& mesh,
-              bool reorder )
+              bool reorder,
+              ctr::MeshOrderingType ordering,
+              bool elemorder )
 // *****************************************************************************
 //  Write unstructured mesh to file
 //! \param[in] print Pretty printer
 //! \param[in] filename Filename to write mesh to
 //! \param[in] mesh Unstructured mesh object to write from
 //! \param[in] reorder Whether to also reorder mesh nodes
+//! \param[in] ordering Mesh reordering algorithm to use if reorder is true
+//! \param[in] elemorder Whether to also reorder elements following the order
+//!   of their nodes if reorder is true
 //! \return Vector of time stamps consisting of a timer label (a string), and a
 //!   time state (a tk::real in seconds) measuring the renumber and the mesh
 //!   write time
+//! \details If the mesh is reordered, the quality of the ordering, see
+//!   tk::orderingQuality(), is output before and after reordering.
 // *****************************************************************************
 {
   std::vector< std::pair< std::string, tk::real > > times;
@@ -122,36 +130,66 @@ writeUnsMesh( const tk::Print& print,
     t.zero();
   }
 
-  if (reorder) {
+  // If mesh has tetrahedra elements, reorder based on those, if it has no
+  // tetrahedra elements, reorder based on triangle mesh if any
+  const bool tet = !mesh.tetinpoel().empty();
+  auto& inpoel = tet ? mesh.tetinpoel() : mesh.triinpoel();
+  const std::size_t nnpe = tet ? 4 : 3;
+
+  if (reorder && !inpoel.empty()) {
+    const auto before = tk::orderingQuality( inpoel, nnpe );
+
     print.diagstart( "Reordering mesh nodes ..." );
 
-    // If mesh has tetrahedra elements, reorder based on those
-    if (!mesh.tetinpoel().empty()) {
-
-      auto& inpoel = mesh.tetinpoel();
-      const auto psup = tk::genPsup( inpoel, 4, tk::genEsup( inpoel, 4 ) );
-      auto map = tk::renumber( psup );
-      tk::remap( inpoel, map );
-      tk::remap( mesh.triinpoel(), map );
-      tk::remap( mesh.x(), map );
-      tk::remap( mesh.y(), map );
-      tk::remap( mesh.z(), map );
-
-    // If mesh has no tetrahedra elements, reorder based on triangle mesh if any
-    } else if (!mesh.triinpoel().empty()) {
-
-      auto& inpoel = mesh.triinpoel();
-      const auto psup = tk::genPsup( inpoel, 3, tk::genEsup( inpoel, 3 ) );
-      auto map = tk::renumber( psup );
-      tk::remap( inpoel, map );
-      tk::remap( mesh.x(), map );
-      tk::remap( mesh.y(), map );
-      tk::remap( mesh.z(), map );
-    }
+    std::vector< std::size_t > map;
+    if (ordering == ctr::MeshOrderingType::FRONT)
+      map = tk::renumber( tk::genPsup( inpoel, nnpe,
+                                       tk::genEsup( inpoel, nnpe ) ) );
+    else if (ordering == ctr::MeshOrderingType::RCM)
+      map = tk::rcm( tk::genPsup( inpoel, nnpe, tk::genEsup( inpoel, nnpe ) ) );
+    else if (ordering == ctr::MeshOrderingType::HILBERT)
+      map = tk::sfc( mesh.x(), mesh.y(), mesh.z(),
+                     tk::SpaceFillingCurve::HILBERT );
+    else if (ordering == ctr::MeshOrderingType::MORTON)
+      map = tk::sfc( mesh.x(), mesh.y(), mesh.z(),
+                     tk::SpaceFillingCurve::MORTON );
+
+    tk::remap( mesh.tetinpoel(), map );
+    tk::remap( mesh.triinpoel(), map );
+    tk::remap( mesh.x(), map );
+    tk::remap( mesh.y(), map );
+    tk::remap( mesh.z(), map );
 
     print.diagend( "done" );
     times.emplace_back( "Reorder mesh", t.dsec() );
     t.zero();
+
+    if (elemorder) {
+      print.diagstart( "Reordering mesh elements ..." );
+
+      auto emap = tk::renumberElements( inpoel, nnpe );
+      tk::remapElements( inpoel, nnpe, emap );
+      // Side sets refer to file-internal element ids, in which the elements
+      // reordered come first, see ExodusIIMeshWriter
+      for (auto& s : mesh.bface())
+        for (auto& e : s.second)
+          if (e < emap.size()) e = emap[e];
+
+      print.diagend( "done" );
+      times.emplace_back( "Reorder mesh elements", t.dsec() );
+      t.zero();
+    }
+
+    const auto after = tk::orderingQuality( inpoel, nnpe );
+    auto quality = []( const char* label, const tk::OrderingQuality& q ){
+      std::stringstream ss;
+      ss << label << " bandwidth: " << q.bandwidth << ", profile: "
+         << q.profile << ", average element span: " << q.span
+         << ", estimated cache miss rate: " << q.missrate;
+      return ss.str();
+    };
+    print.diag( quality( "Mesh ordering before", before ) );
+    print.diag( quality( "Mesh ordering after", after ) );
   }
 
   print.diagstart( "Writing mesh to file ..." );
@@ -18,6 +18,7 @@
 #include "Types.hpp"
 #include "UnsMesh.hpp"
 #include "Print.hpp"
+#include "Options/MeshOrdering.hpp"
 
 namespace tk {
 
@@ -32,7 +33,9 @@ std::vector< std::pair< std::string, tk::real > >
 writeUnsMesh( const tk::Print& print,
               const std::string& filename,
               UnsMesh& mesh,
-              bool reorder );
+              bool reorder,
+              ctr::MeshOrderingType ordering,
+              bool elemorder );
 
 } // tk::
 
@@ -55,13 +55,20 @@ ALECG::ALECG( const CProxy_Discretization& disc,
   m_nlhs( 0 ),
   m_nrhs( 0 ),
   m_bnode( bnode ),
+  m_inpoed(),
+  m_dfn(),
+  m_dfnc(),
+  m_edgech(),
+  m_ownpoed(),
+  m_owndfn(),
   m_u( m_disc[thisIndex].ckLocal()->Gid().size(),
        g_inputdeck.get< tag::component >().nprop() ),
   m_du( m_u.nunk(), m_u.nprop() ),
   m_lhs( m_u.nunk(), m_u.nprop() ),
   m_rhs( m_u.nunk(), m_u.nprop() ),
-  m_lhsc(),
-  m_rhsc(),
+  m_bc(),
+  m_lhsc( m_disc[thisIndex].ckLocal()->CommMap().size(), m_u.nprop() ),
+  m_rhsc( m_lhsc.nunk(), m_u.nprop() ),
   m_diag()
 // *****************************************************************************
 //  Constructor
@@ -72,6 +79,13 @@ ALECG::ALECG( const CProxy_Discretization& disc,
 {
   usesAtSync = true;    // enable migration at AtSync
 
+  // Generate edge data structures used by the right-hand side
+  edges();
+
+  // Match user-specified boundary conditions to side set nodes
+  auto d = Disc();
+  m_bc = DirichletBC( m_u.nprop(), d->Coord(), d->Gid(), d->Lid(), m_bnode );
+
   // Activate SDAG wait for initially computing the left-hand side
   thisProxy[ thisIndex ].wait4lhs();
 
@@ -108,6 +122,30 @@ ALECG::ResumeFromSync()
   if (!g_inputdeck.get< tag::cmd, tag::nonblocking >()) next();
 }
 
+void
+ALECG::edges()
+// *****************************************************************************
+// Generate edge connectivity and dual-face normals of edges
+//! \details The edge connectivity and the geometry of the edges only depend
+//!   on the mesh, so they are computed once and reused in every time step,
+//!   and regenerated after mesh refinement. The dual-face normals computed
+//!   here are partial sums on chare-boundary edges: they are completed by
+//!   those of the neighbor chares sharing the edge during computing the
+//!   left-hand side, see lhs(), comlhs(), and lhsmerge().
+// *****************************************************************************
+{
+  auto d = Disc();
+
+  const auto& inpoel = d->Inpoel();
+
+  m_inpoed = tk::genInpoed( inpoel, 4, tk::genEsup( inpoel, 4 ) );
+  m_dfn = tk::genDfnorm( inpoel, d->Coord(), m_inpoed );
+
+  // Size receive buffers for dual-face normals and edge owners
+  m_dfnc.assign( m_dfn.size(), 0.0 );
+  m_edgech.assign( m_inpoed.size()/2, thisIndex );
+}
+
 void
 ALECG::setup()
 // *****************************************************************************
@@ -157,17 +195,23 @@ ALECG::lhs()
 {
   auto d = Disc();
 
-  // Compute own portion of the lhs
-  // m_lhs = ...
+  // Compute own portion of the lhs: the lumped mass matrix is the volume of
+  // the median-dual cell associated to each mesh node
+  const auto& v = d->V();
+  for (std::size_t i=0; i<m_lhs.nunk(); ++i)
+    for (ncomp_t c=0; c<m_lhs.nprop(); ++c)
+      m_lhs(i,c,0) = v[i];
+
+  const auto& cmap = d->CommMap();
 
-  if (d->Msum().empty())        // in serial we are done
+  if (cmap.empty())        // in serial we are done
     comlhs_complete();
   else // send contributions of lhs to chare-boundary nodes to fellow chares
-    for (const auto& n : d->Msum()) {
-      std::vector< std::vector< tk::real > > l( n.second.size() );
-      std::size_t j = 0;
-      for (auto i : n.second) l[ j++ ] = m_lhs[ tk::cref_find(d->Lid(),i) ];
-      thisProxy[ n.first ].comlhs( n.second, l );
+    for (const auto& n : cmap.Lid()) {
+      // partial dual-face normals of edges whose both end-points are shared
+      auto ed = tk::bndDfnorm( m_inpoed, m_dfn, d->Gid(), n.second );
+      thisProxy[ n.first ].comlhs( thisIndex, cmap.gather( n.first, m_lhs ),
+                                   ed.first, ed.second );
     }
 
   ownlhs_complete();
@@ -176,31 +220,43 @@ ALECG::lhs()
 
 //! [Receive lhs on chare-boundary]
 void
-ALECG::comlhs( const std::vector< std::size_t >& gid,
-               const std::vector< std::vector< tk::real > >& L )
+ALECG::comlhs( int fromch,
+               const std::vector< tk::real >& L,
+               const std::vector< std::size_t >& ged,
+               const std::vector< tk::real >& dfn )
 // *****************************************************************************
 //  Receive contributions to left-hand side diagonal matrix on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive LHS contributions
-//! \param[in] L Partial contributions of LHS to chare-boundary nodes
+//! \param[in] fromch Sender chare id
+//! \param[in] L Partial contributions of LHS to chare-boundary nodes shared
+//!   with the sender, in slot order, see NodeCommMap
+//! \param[in] ged Edges of the sender whose both end-points are shared with
+//!   this chare, given by pairs of global node ids, see tk::bndDfnorm()
+//! \param[in] dfn Partial dual-face normals of the edges in ged
 //! \details This function receives contributions to m_lhs, which stores the
 //!   diagonal (lumped) mass matrix at mesh nodes. While m_lhs stores
 //!   own contributions, m_lhsc collects the neighbor chare contributions during
 //!   communication. This way work on m_lhs and m_lhsc is overlapped. The two
-//!   are combined in lhsmerge().
+//!   are combined in lhsmerge(). The partial dual-face normals of the edges
+//!   shared with the sender are collected in m_dfnc the same way, and the
+//!   lowest chare id having the edge is recorded as the owner of the edge.
 // *****************************************************************************
 {
-  Assert( L.size() == gid.size(), "Size mismatch" );
+  auto d = Disc();
+  const auto& cmap = d->CommMap();
+  const auto& bid = cmap.Bid( fromch );
+  const auto ncomp = m_lhsc.nprop();
 
-  using tk::operator+=;
+  Assert( L.size() == bid.size()*ncomp, "Size mismatch" );
 
-  auto d = Disc();
+  for (std::size_t i=0; i<bid.size(); ++i)
+    for (ncomp_t c=0; c<ncomp; ++c)
+      m_lhsc(bid[i],c,0) += L[i*ncomp+c];
 
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    m_lhsc[ gid[i] ] += L[i];
-  }
+  for (auto e : tk::addDfnorm( m_inpoed, d->Lid(), ged, dfn, m_dfnc ))
+    m_edgech[e] = std::min( m_edgech[e], fromch );
 
   // When we have heard from all chares we communicate with, this chare is done
-  if (++m_nlhs == d->Msum().size()) {
+  if (++m_nlhs == cmap.nchare()) {
     m_nlhs = 0;
     comlhs_complete();
   }
@@ -218,14 +274,31 @@ ALECG::lhsmerge()
   auto d = Disc();
 
   // Combine own and communicated contributions to LHS and ICs
-  for (const auto& b : m_lhsc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
+  const auto& blid = d->CommMap().Blid();
+  for (std::size_t b=0; b<blid.size(); ++b)
     for (ncomp_t c=0; c<m_lhs.nprop(); ++c)
-      m_lhs(lid,c,0) += b.second[c];
-  }
+      m_lhs(blid[b],c,0) += m_lhsc(b,c,0);
+
+  // Zero receive buffer
+  m_lhsc.fill( 0.0 );
+
+  // Collect edges owned by this chare with complete dual-face normals: the
+  // edges on chare-boundaries are only assigned to a single chare, the one
+  // with the lowest id among the chares that have the edge, so that the
+  // edge contributions to the rhs are summed exactly once
+  m_ownpoed.clear();
+  m_owndfn.clear();
+  for (std::size_t e=0; e<m_inpoed.size()/2; ++e)
+    if (m_edgech[e] == thisIndex) {
+      m_ownpoed.push_back( m_inpoed[e*2+0] );
+      m_ownpoed.push_back( m_inpoed[e*2+1] );
+      for (std::size_t j=0; j<6; ++j)
+        m_owndfn.push_back( m_dfn[e*6+j] + m_dfnc[e*6+j] );
+    }
 
-  // Clear receive buffer
-  tk::destroy(m_lhsc);
+  // Zero receive buffers of dual-face normals and edge owners
+  std::fill( begin(m_dfnc), end(m_dfnc), 0.0 );
+  std::fill( begin(m_edgech), end(m_edgech), thisIndex );
 
   // Continue after lhs is complete
   if (m_initial) start(); else lhs_complete();
@@ -294,29 +367,28 @@ ALECG::rhs()
   auto d = Disc();
 
   // Compute own portion of the right-hand side
-  // ...
+  for (const auto& eq : g_cgpde)
+    eq.rhs( d->T(), d->Coord(), m_ownpoed, m_owndfn, d->V(), m_u, m_rhs );
 
   // Communicate rhs to other chares on chare-boundary
-  if (d->Msum().empty())        // in serial we are done
+  const auto& cmap = d->CommMap();
+
+  if (cmap.empty())        // in serial we are done
     comrhs_complete();
   else // send contributions of rhs to chare-boundary nodes to fellow chares
-    for (const auto& n : d->Msum()) {
-      std::vector< std::vector< tk::real > > r( n.second.size() );
-      std::size_t j = 0;
-      for (auto i : n.second) r[ j++ ] = m_rhs[ tk::cref_find(d->Lid(),i) ];
-      thisProxy[ n.first ].comrhs( n.second, r );
-    }
+    for (const auto& n : cmap.Lid())
+      thisProxy[ n.first ].comrhs( thisIndex, cmap.gather( n.first, m_rhs ) );
 
   ownrhs_complete();
 }
 
 void
-ALECG::comrhs( const std::vector< std::size_t >& gid,
-                const std::vector< std::vector< tk::real > >& R )
+ALECG::comrhs( int fromch, const std::vector< tk::real >& R )
 // *****************************************************************************
 //  Receive contributions to right-hand side vector on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive RHS contributions
-//! \param[in] R Partial contributions of RHS to chare-boundary nodes
+//! \param[in] fromch Sender chare id
+//! \param[in] R Partial contributions of RHS to chare-boundary nodes shared
+//!   with the sender, in slot order, see NodeCommMap
 //! \details This function receives contributions to m_rhs, which stores the
 //!   right hand side vector at mesh nodes. While m_rhs stores own
 //!   contributions, m_rhsc collects the neighbor chare contributions during
@@ -324,16 +396,18 @@ ALECG::comrhs( const std::vector< std::size_t >& gid,
 //!   are combined in solve().
 // *****************************************************************************
 {
-  Assert( R.size() == gid.size(), "Size mismatch" );
+  const auto& cmap = Disc()->CommMap();
+  const auto& bid = cmap.Bid( fromch );
+  const auto ncomp = m_rhsc.nprop();
 
-  using tk::operator+=;
+  Assert( R.size() == bid.size()*ncomp, "Size mismatch" );
 
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    m_rhsc[ gid[i] ] += R[i];
-  }
+  for (std::size_t i=0; i<bid.size(); ++i)
+    for (ncomp_t c=0; c<ncomp; ++c)
+      m_rhsc(bid[i],c,0) += R[i*ncomp+c];
 
   // When we have heard from all chares we communicate with, this chare is done
-  if (++m_nrhs == Disc()->Msum().size()) {
+  if (++m_nrhs == cmap.nchare()) {
     m_nrhs = 0;
     comrhs_complete();
   }
@@ -350,16 +424,28 @@ ALECG::solve()
   auto d = Disc();
 
   // Combine own and communicated contributions to rhs
-  for (const auto& b : m_rhsc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
-    for (ncomp_t c=0; c<ncomp; ++c) m_rhs(lid,c,0) += b.second[c];
+  const auto& blid = d->CommMap().Blid();
+  for (std::size_t b=0; b<blid.size(); ++b)
+    for (ncomp_t c=0; c<ncomp; ++c) m_rhs(blid[b],c,0) += m_rhsc(b,c,0);
+
+  // Zero receive buffer
+  m_rhsc.fill( 0.0 );
+
+  // Solve sytem: the right-hand side is the volume-integrated time derivative
+  const auto dt = d->Dt();
+  tk::fused( [dt]( tk::real& du, tk::real r, tk::real m ){ du = dt*r/m; },
+             m_du, m_rhs, m_lhs );
+
+  // Set Dirichlet BCs: prescribe the solution increment at BC nodes
+  m_bc.update( d->T(), dt, d->Coord() );
+  for (ncomp_t c=0; c<ncomp; ++c) {
+    const auto& n = m_bc.Lid(c);
+    const auto& v = m_bc.Inc(c);
+    for (std::size_t i=0; i<n.size(); ++i) m_du( n[i], c, 0 ) = v[i];
   }
 
-  // clear receive buffer
-  tk::destroy(m_rhsc);  
-
-  // Solve sytem
-  // m_du = m_rhs / m_lhs;
+  // Update solution
+  tk::fused( []( tk::real& u, tk::real du ){ u += du; }, m_u, m_du );
 
   //! [Continue after solve]
   // Compute diagnostics, e.g., residuals
@@ -421,7 +507,8 @@ ALECG::resizePostAMR(
 //! \param[in] chunk New mesh chunk (connectivity and global<->local id maps)
 //! \param[in] coord New mesh node coordinates
 //! \param[in] addedNodes Newly added mesh nodes and their parents (local ids)
-//! \param[in] addedTets Newly added mesh cells and their parents (local ids)
+//! \param[in] addedTets Mesh cells whose id changed and the cells of the old
+//!   mesh they inherit their solution from (local ids)
 //! \param[in] msum New node communication map
 //! \param[in] bnode Boundary-node lists mapped to side set ids
 // *****************************************************************************
@@ -448,13 +535,21 @@ ALECG::resizePostAMR(
   m_lhs.resize( npoin, nprop );
   m_rhs.resize( npoin, nprop );
 
+  // Resize communication buffers to the new chare-boundary
+  m_lhsc = tk::Fields( d->CommMap().size(), nprop );
+  m_rhsc = tk::Fields( d->CommMap().size(), nprop );
+
   // Update solution on new mesh
   for (const auto& n : addedNodes)
     for (std::size_t c=0; c<nprop; ++c)
       m_u(n.first,c,0) = (m_u(n.second[0],c,0) + m_u(n.second[1],c,0))/2.0;
 
-  // Update physical-boundary node lists
+  // Update physical-boundary node lists and rematch boundary conditions
   m_bnode = bnode;
+  m_bc = DirichletBC( nprop, d->Coord(), d->Gid(), d->Lid(), m_bnode );
+
+  // Regenerate edge data structures on new mesh
+  edges();
 
   contribute( CkCallback(CkReductionTarget(Transporter,resized), d->Tr()) );
 }
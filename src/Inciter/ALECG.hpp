@@ -32,6 +32,7 @@
 #include "Fields.hpp"
 #include "DerivedData.hpp"
 #include "FluxCorrector.hpp"
+#include "NodeBC.hpp"
 #include "NodeDiagnostics.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
@@ -107,12 +108,13 @@ class ALECG : public CBase_ALECG {
     void lhs();
 
     //! Receive contributions to left-hand side matrix on chare-boundaries
-    void comlhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& L );
+    void comlhs( int fromch,
+                 const std::vector< tk::real >& L,
+                 const std::vector< std::size_t >& ged,
+                 const std::vector< tk::real >& dfn );
 
     //! Receive contributions to right-hand side vector on chare-boundaries
-    void comrhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& R );
+    void comrhs( int fromch, const std::vector< tk::real >& R );
 
     //! Update solution at the end of time step
     void update( const tk::Fields& a );
@@ -159,10 +161,17 @@ class ALECG : public CBase_ALECG {
       p | m_nlhs;
       p | m_nrhs;
       p | m_bnode;
+      p | m_inpoed;
+      p | m_dfn;
+      p | m_dfnc;
+      p | m_edgech;
+      p | m_ownpoed;
+      p | m_owndfn;
       p | m_u;
       p | m_du;
       p | m_lhs;
       p | m_rhs;
+      p | m_bc;
       p | m_lhsc;
       p | m_rhsc;
       p | m_diag;
@@ -188,6 +197,24 @@ class ALECG : public CBase_ALECG {
     std::size_t m_nrhs;
     //! Boundary node lists mapped to side set ids
     std::map< int, std::vector< std::size_t > > m_bnode;
+    //! Edge connectivity, see tk::genInpoed()
+    std::vector< std::size_t > m_inpoed;
+    //! Dual-face normals and boundary coefficients of edges
+    //! \details 6 reals per edge in the order of m_inpoed, see
+    //!   tk::genDfnorm(). Partial sums on chare-boundary edges.
+    std::vector< tk::real > m_dfn;
+    //! Receive buffer for dual-face normals of chare-boundary edges
+    //! \details 6 reals per edge in the order of m_inpoed
+    std::vector< tk::real > m_dfnc;
+    //! Lowest chare id having the edge, in the order of m_inpoed
+    std::vector< int > m_edgech;
+    //! Edge connectivity of edges owned by this chare
+    //! \details Chare-boundary edges are owned by the chare with the lowest id
+    //!   among the chares sharing the edge
+    std::vector< std::size_t > m_ownpoed;
+    //! Complete dual-face normals of edges owned by this chare
+    //! \details 6 reals per edge in the order of m_ownpoed
+    std::vector< tk::real > m_owndfn;
     //! Unknown/solution vector at mesh nodes
     tk::Fields m_u;
     //! Unknown/solution vector increment (high order)
@@ -196,12 +223,16 @@ class ALECG : public CBase_ALECG {
     tk::Fields m_lhs;
     //! Right-hand side vector (for the high order system)
     tk::Fields m_rhs;
+    //! Dirichlet boundary conditions matched to local mesh node IDs
+    //! \details Matched once and after mesh refinement, the BC values are
+    //!   evaluated every time step in solve()
+    DirichletBC m_bc;
     //! Receive buffer for communication of the left hand side
-    //! \details Key: chare id, value: lhs for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_lhsc;
+    //! \details Indexed by chare-boundary node IDs, see NodeCommMap
+    tk::Fields m_lhsc;
     //! Receive buffer for communication of the right hand side
-    //! \details Key: chare id, value: rhs for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_rhsc;
+    //! \details Indexed by chare-boundary node IDs, see NodeCommMap
+    tk::Fields m_rhsc;
     //! Diagnostics object
     NodeDiagnostics m_diag;
 
@@ -211,6 +242,9 @@ class ALECG : public CBase_ALECG {
       return m_disc[ thisIndex ].ckLocal();
     }
 
+    //! Generate edge connectivity and dual-face normals of edges
+    void edges();
+
     //! Output mesh and particle fields to files
     void out();
 
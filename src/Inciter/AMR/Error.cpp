@@ -51,6 +51,38 @@ Error::scalar( const tk::Fields& u,
     Throw( "No such AMR error indicator type" );
 }
 
+tk::real
+Error::scalar( const tk::Fields& u,
+               const edge_t& edge,
+               ncomp_t c,
+               const std::array< std::vector< tk::real >, 3 >& coord,
+               const tk::Fields& grad,
+               std::size_t g,
+               inciter::ctr::AMRErrorType err ) const
+// *****************************************************************************
+//  Estimate error for scalar quantity using node gradients
+//! \param[in] u Solution vector
+//! \param[in] edge Edge defined by its two end-point IDs
+//! \param[in] c Scalar component to compute error of
+//! \param[in] coord Mesh node coordinates
+//! \param[in] grad Gradients at mesh nodes, see tk::nodegrads()
+//! \param[in] g Index of the gradient of scalar component c in grad, i.e.,
+//!   the gradient of c is stored as components 3*g+j, j=0,1,2, of grad
+//! \param[in] err AMR Error indicator type
+//! \return Error indicator: a real number between [0...1] inclusive
+//! \details This overload should be used when evaluating the error in many
+//!   edges, since the gradients at nodes shared by edges are then only
+//!   computed once.
+// *****************************************************************************
+{
+  if (err == inciter::ctr::AMRErrorType::JUMP)
+    return error_jump( u, edge, c );
+  else if (err == inciter::ctr::AMRErrorType::HESSIAN)
+    return error_hessian( edge, coord, grad, g );
+  else
+    Throw( "No such AMR error indicator type" );
+}
+
 tk::real
 Error::error_jump( const tk::Fields& u,
                    const edge_t& edge,
@@ -95,6 +127,54 @@ const
 //!    tk::genEsup()
 //! \return Error indicator: a real number between [0...1] inclusive
 // *****************************************************************************
+{
+  // Compute gradients at edge-end points
+  auto ga = nodegrad( edge.first(), coord, inpoel, esup, u, c );
+  auto gb = nodegrad( edge.second(), coord, inpoel, esup, u, c );
+
+  return error_hessian( edge, coord, ga, gb );
+}
+
+tk::real
+Error::error_hessian( const edge_t& edge,
+                      const std::array< std::vector< tk::real >, 3 >& coord,
+                      const tk::Fields& grad,
+                      std::size_t g ) const
+// *****************************************************************************
+//  Estimate error for scalar quantity on edge based on node gradients
+//! \param[in] edge Edge defined by its two end-point IDs
+//! \param[in] coord Mesh node coordinates
+//! \param[in] grad Gradients at mesh nodes, see tk::nodegrads()
+//! \param[in] g Index of the gradient of the scalar in grad
+//! \return Error indicator: a real number between [0...1] inclusive
+// *****************************************************************************
+{
+  Assert( 3*g+2 < grad.nprop(), "Indexing out of gradient data" );
+
+  auto a = edge.first();
+  auto b = edge.second();
+
+  // Access gradients at edge-end points
+  std::array< tk::real, 3 >
+    ga{{ grad(a,3*g+0,0), grad(a,3*g+1,0), grad(a,3*g+2,0) }},
+    gb{{ grad(b,3*g+0,0), grad(b,3*g+1,0), grad(b,3*g+2,0) }};
+
+  return error_hessian( edge, coord, ga, gb );
+}
+
+tk::real
+Error::error_hessian( const edge_t& edge,
+                      const std::array< std::vector< tk::real >, 3 >& coord,
+                      const std::array< tk::real, 3 >& ga,
+                      const std::array< tk::real, 3 >& gb ) const
+// *****************************************************************************
+//  Estimate error on edge from gradients at its end points
+//! \param[in] edge Edge defined by its two end-point IDs
+//! \param[in] coord Mesh node coordinates
+//! \param[in] ga Gradient of the scalar at the first end point of edge
+//! \param[in] gb Gradient of the scalar at the second end point of edge
+//! \return Error indicator: a real number between [0...1] inclusive
+// *****************************************************************************
 {
   const tk::real small = std::numeric_limits< tk::real >::epsilon();
 
@@ -107,10 +187,6 @@ const
   // Compute edge vector
   std::array< tk::real, 3 > h {{ x[a]-x[b], y[a]-y[b], z[a]-z[b] }};
 
-  // Compute gradients at edge-end points
-  auto ga = nodegrad( a, coord, inpoel, esup, u, c );
-  auto gb = nodegrad( b, coord, inpoel, esup, u, c );
-
   // Compute dot products of gradients and edge vectors
   auto dua = tk::dot( ga, h );
   auto dub = tk::dot( gb, h );
@@ -36,6 +36,15 @@ class Error {
                                       std::vector< std::size_t > >& esup,
                      inciter::ctr::AMRErrorType err ) const;
 
+    //! Compute error estimate for a scalar quantity using node gradients
+    tk::real scalar( const tk::Fields& u,
+                     const edge_t& edge,
+                     ncomp_t c,
+                     const std::array< std::vector< tk::real >, 3 >& coord,
+                     const tk::Fields& grad,
+                     std::size_t g,
+                     inciter::ctr::AMRErrorType err ) const;
+
   private:
     //! Estimate error for scalar quantity on edge based on jump in solution
     tk::real
@@ -52,6 +61,20 @@ class Error {
                    const std::vector< std::size_t >& inpoel,
                    const std::pair< std::vector< std::size_t >,
                                     std::vector< std::size_t > >& esup ) const;
+
+    //! Estimate error for scalar quantity on edge based on node gradients
+    tk::real
+    error_hessian( const edge_t& edge,
+                   const std::array< std::vector< tk::real >, 3 >& coord,
+                   const tk::Fields& grad,
+                   std::size_t g ) const;
+
+    //! Estimate error on edge from gradients at its end points
+    tk::real
+    error_hessian( const edge_t& edge,
+                   const std::array< std::vector< tk::real >, 3 >& coord,
+                   const std::array< tk::real, 3 >& ga,
+                   const std::array< tk::real, 3 >& gb ) const;
 };
 
 } // AMR::
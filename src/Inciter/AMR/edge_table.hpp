@@ -0,0 +1,259 @@
+#ifndef AMR_edge_table_h
+#define AMR_edge_table_h
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <utility>
+#include <limits>
+
+#include "edge.hpp"
+
+namespace AMR {
+
+    /**
+     * @brief Hash table mapping edges, keyed by their sorted node pair, to
+     * values, stored in contiguous arrays
+     *
+     * This is a drop-in replacement for std::map<edge_t, T>. The entries are
+     * stored densely in a single array, in insertion order, and an open
+     * addressing index (linear probing, power-of-two size) maps the hash of
+     * an edge to the position of its entry. Lookup thus costs a hash and a
+     * few probes of a flat array, and iterating over all edges, as done
+     * several times per round of refinement, walks a contiguous array.
+     *
+     * Erasing an entry moves the last entry into its place, and removes its
+     * index using backward-shift deletion, so no tombstones accumulate. As a
+     * consequence, the order of iteration is not the order of the keys, and
+     * erasing invalidates iterators. Inserting also invalidates iterators.
+     * The key of an entry must not be modified via an iterator.
+     */
+    template<class T> class edge_table_t {
+        public:
+            using key_type = edge_t;
+            using mapped_type = T;
+            using value_type = std::pair<edge_t, T>;
+            using iterator = typename std::vector<value_type>::iterator;
+            using const_iterator =
+                typename std::vector<value_type>::const_iterator;
+
+        private:
+            //! Index of an empty slot
+            static constexpr std::size_t EMPTY =
+                std::numeric_limits<std::size_t>::max();
+
+            std::vector<value_type> entries;
+            std::vector<std::size_t> index;     // size: power of two or zero
+
+            /**
+             * @brief Home slot of an edge in the index
+             *
+             * @param key Edge to hash
+             *
+             * @return Index slot at which probing for key starts
+             */
+            std::size_t home(const edge_t& key) const
+            {
+                // Mix both node ids so that edges of neighboring nodes, i.e.,
+                // consecutive ids, spread over the table
+                std::uint64_t h = key.first() * 0x9E3779B97F4A7C15ull;
+                h ^= key.second() + 0x632BE59BD9B4E019ull + (h<<6) + (h>>2);
+                h ^= h >> 32;
+                h *= 0xD6E8FEB86659FD93ull;
+                h ^= h >> 32;
+                return static_cast<std::size_t>(h) & (index.size()-1);
+            }
+
+            /**
+             * @brief Find the index slot of an edge
+             *
+             * @param key Edge to find
+             *
+             * @return Slot holding the entry of key if present, otherwise the
+             * empty slot at which it would be inserted
+             */
+            std::size_t slot(const edge_t& key) const
+            {
+                const auto mask = index.size()-1;
+                auto i = home(key);
+                while (index[i] != EMPTY && !(entries[index[i]].first == key))
+                    i = (i+1) & mask;
+                return i;
+            }
+
+            /**
+             * @brief Rebuild the index with a given number of slots
+             *
+             * @param n Number of slots, must be a power of two
+             */
+            void rehash(std::size_t n)
+            {
+                index.assign(n, EMPTY);
+                for (std::size_t e=0; e<entries.size(); ++e)
+                    index[ slot(entries[e].first) ] = e;
+            }
+
+        public:
+            std::size_t size() const { return entries.size(); }
+            bool empty() const { return entries.empty(); }
+
+            /**
+             * @brief Reserve space for a number of edges
+             *
+             * @param n Number of edges to make room for without rehashing
+             */
+            void reserve(std::size_t n)
+            {
+                entries.reserve(n);
+                std::size_t cap = 16;
+                while (cap*3 < n*4) cap *= 2;
+                if (cap > index.size()) rehash(cap);
+            }
+
+            iterator find(const edge_t& key)
+            {
+                if (entries.empty()) return end();
+                auto i = slot(key);
+                if (index[i] == EMPTY) return end();
+                return entries.begin() +
+                    static_cast<std::ptrdiff_t>(index[i]);
+            }
+
+            const_iterator find(const edge_t& key) const
+            {
+                if (entries.empty()) return end();
+                auto i = slot(key);
+                if (index[i] == EMPTY) return end();
+                return entries.begin() +
+                    static_cast<std::ptrdiff_t>(index[i]);
+            }
+
+            std::size_t count(const edge_t& key) const
+            {
+                return find(key) == end() ? 0 : 1;
+            }
+
+            T& at(const edge_t& key)
+            {
+                auto it = find(key);
+                assert( it != end() );
+                return it->second;
+            }
+
+            const T& at(const edge_t& key) const
+            {
+                auto it = find(key);
+                assert( it != end() );
+                return it->second;
+            }
+
+            /**
+             * @brief Access the value of an edge, inserting a default value if
+             * the edge is not yet in the table
+             *
+             * @param key Edge whose value to access
+             *
+             * @return Reference to the value of the edge
+             */
+            T& operator[](const edge_t& key)
+            {
+                auto it = find(key);
+                if (it != end()) return it->second;
+                return insert( value_type(key, T()) ).first->second;
+            }
+
+            /**
+             * @brief Insert a value if its edge is not yet in the table
+             *
+             * @param v Edge and value to insert
+             *
+             * @return Iterator to the value of the edge and true if inserted
+             */
+            std::pair<iterator,bool> insert(const value_type& v)
+            {
+                // Keep the load factor at most 3/4
+                if ((entries.size()+1)*4 > index.size()*3)
+                    rehash(index.empty() ? 16 : 2*index.size());
+                auto i = slot(v.first);
+                if (index[i] != EMPTY)
+                    return { entries.begin() +
+                               static_cast<std::ptrdiff_t>(index[i]), false };
+                index[i] = entries.size();
+                entries.push_back(v);
+                return { entries.end()-1, true };
+            }
+
+            /**
+             * @brief Remove an edge from the table
+             *
+             * @param key Edge to remove
+             *
+             * @return Number of edges removed (0 or 1)
+             */
+            std::size_t erase(const edge_t& key)
+            {
+                if (entries.empty()) return 0;
+                const auto mask = index.size()-1;
+                auto i = slot(key);
+                const auto pos = index[i];
+                if (pos == EMPTY) return 0;
+
+                // Backward-shift deletion: move later entries of the probe
+                // sequence into the hole unless that would move them before
+                // their home slot
+                for (auto j = (i+1) & mask; index[j] != EMPTY; j = (j+1) & mask)
+                {
+                    auto k = home(entries[index[j]].first);
+                    if (((j - k) & mask) >= ((j - i) & mask)) {
+                        index[i] = index[j];
+                        i = j;
+                    }
+                }
+                index[i] = EMPTY;
+
+                // Fill the hole in the entries with the last entry
+                const auto last = entries.size()-1;
+                if (pos != last) {
+                    entries[pos] = std::move(entries[last]);
+                    index[ slot(entries[pos].first) ] = pos;
+                }
+                entries.pop_back();
+                return 1;
+            }
+
+            void clear()
+            {
+                entries.clear();
+                index.clear();
+            }
+
+            iterator begin() { return entries.begin(); }
+            iterator end() { return entries.end(); }
+            const_iterator begin() const { return entries.begin(); }
+            const_iterator end() const { return entries.end(); }
+    };
+
+    template<class T> constexpr std::size_t edge_table_t<T>::EMPTY;
+
+    //! Free begin/end, found via ADL, e.g., by tk::cref_find()
+    template<class T>
+    typename edge_table_t<T>::iterator begin(edge_table_t<T>& t) {
+        return t.begin();
+    }
+    template<class T>
+    typename edge_table_t<T>::iterator end(edge_table_t<T>& t) {
+        return t.end();
+    }
+    template<class T>
+    typename edge_table_t<T>::const_iterator begin(const edge_table_t<T>& t) {
+        return t.begin();
+    }
+    template<class T>
+    typename edge_table_t<T>::const_iterator end(const edge_table_t<T>& t) {
+        return t.end();
+    }
+
+}
+
+#endif // AMR_edge_table_h
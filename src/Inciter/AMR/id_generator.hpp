@@ -3,6 +3,7 @@
 
 #include <limits>
 #include <cassert>
+#include <vector>
 
 // TODO: make this have a base class to support multiple generator schemes
 // using the policy design pattern
@@ -17,6 +18,11 @@ namespace AMR {
             // many tets can be on the first level
             size_t next_tet_id;
 
+            // Ids of erased tets, handed out again before new ids so that
+            // the id-indexed tet stores stay dense across refinement and
+            // derefinement
+            std::vector<size_t> free_ids;
+
             // Constructor
             explicit id_generator_t(size_t start_tet_id = 0) :
                 start_id(start_tet_id),
@@ -27,13 +33,30 @@ namespace AMR {
             /**
              * @brief Helper function to generate tet ids
              *
-             * @return Id of the next tet
+             * @return Id of the next tet, a recycled one if available
              */
             size_t get_next_tet_id()
             {
+                if (!free_ids.empty())
+                {
+                    size_t id = free_ids.back();
+                    free_ids.pop_back();
+                    return id;
+                }
                 return next_tet_id++;
             }
 
+            /**
+             * @brief Return the id of an erased tet to the generator for reuse
+             *
+             * @param id Id of the erased tet
+             */
+            void release(size_t id)
+            {
+                assert( id < next_tet_id );
+                free_ids.push_back(id);
+            }
+
             /**
              * Helper function to get all the child ids for a given parent
              *
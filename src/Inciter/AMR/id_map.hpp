@@ -0,0 +1,197 @@
+#ifndef AMR_id_map_h
+#define AMR_id_map_h
+
+#include <cassert>
+#include <cstddef>
+#include <algorithm>
+#include <vector>
+#include <utility>
+#include <iterator>
+
+#include "id_set.hpp"
+
+namespace AMR {
+
+    /**
+     * @brief Map from dense ids to values, stored in a contiguous array
+     * indexed by id
+     *
+     * This is a drop-in replacement for the std::map<size_t, T> containers
+     * keyed by tet id: the value of id i lives at index i of a single array
+     * and the ids present are tracked by a bitset. Lookup is a single index,
+     * and iteration walks the array in ascending id order, as for a
+     * std::map. The ids are expected to be dense, which is the case as
+     * id_generator_t hands out ids sequentially and recycles erased ones.
+     *
+     * Iterators hold an index, not a pointer, and the end iterator is a
+     * sentinel. Thus inserting while iterating (as done when refining tets in
+     * a loop over all tets) does not invalidate iterators, and the iteration
+     * also visits entries inserted at larger ids, as for a std::map.
+     * References to values are invalidated by inserts, however.
+     */
+    template<class T> class id_map_t {
+        public:
+            using key_type = std::size_t;
+            using mapped_type = T;
+            using value_type = std::pair<std::size_t, T>;
+
+        private:
+            std::vector<value_type> slots;
+            id_set_t present;
+
+            /**
+             * @brief Iterator over the ids present in the map
+             *
+             * @tparam Map (Const) map type iterated over
+             * @tparam V (Const) value type referred to
+             */
+            template<class Map, class V> class iter {
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = typename id_map_t::value_type;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = V*;
+                    using reference = V&;
+
+                    iter() = default;
+                    iter(Map* m, std::size_t id) : map(m), cur(id) {}
+
+                    reference operator*() const { return map->slots[cur]; }
+                    pointer operator->() const { return &map->slots[cur]; }
+                    iter& operator++() {
+                        cur = map->present.next(cur+1);
+                        return *this;
+                    }
+                    iter operator++(int) {
+                        auto i = *this;
+                        ++(*this);
+                        return i;
+                    }
+                    bool operator==(const iter& rhs) const {
+                        return cur == rhs.cur;
+                    }
+                    bool operator!=(const iter& rhs) const {
+                        return cur != rhs.cur;
+                    }
+
+                private:
+                    Map* map = nullptr;
+                    std::size_t cur = id_set_t::npos;
+            };
+
+        public:
+            using iterator = iter<id_map_t, value_type>;
+            using const_iterator = iter<const id_map_t, const value_type>;
+
+            std::size_t size() const { return present.size(); }
+            bool empty() const { return present.empty(); }
+
+            /**
+             * @brief Query if an id is in the map
+             *
+             * @param id Id to check
+             *
+             * @return 1 if the id is in the map, 0 otherwise
+             */
+            std::size_t count(std::size_t id) const {
+                return present.count(id);
+            }
+
+            iterator find(std::size_t id) {
+                return count(id) ? iterator(this, id) : end();
+            }
+            const_iterator find(std::size_t id) const {
+                return count(id) ? const_iterator(this, id) : end();
+            }
+
+            T& at(std::size_t id) {
+                assert( count(id) );
+                return slots[id].second;
+            }
+            const T& at(std::size_t id) const {
+                assert( count(id) );
+                return slots[id].second;
+            }
+
+            /**
+             * @brief Access the value of an id, inserting a default value if
+             * the id is not yet in the map
+             *
+             * @param id Id whose value to access
+             *
+             * @return Reference to the value of the id
+             */
+            T& operator[](std::size_t id) {
+                if (!count(id)) insert( value_type(id, T()) );
+                return slots[id].second;
+            }
+
+            /**
+             * @brief Insert a value if its id is not yet in the map
+             *
+             * @param v Id and value to insert
+             *
+             * @return Iterator to the value of the id and true if inserted
+             */
+            std::pair<iterator,bool> insert(const value_type& v)
+            {
+                const auto id = v.first;
+                if (count(id)) return { iterator(this, id), false };
+                if (id >= slots.size()) {
+                    // Grow geometrically, as ids are mostly appended
+                    auto n = std::max(id+1, 2*slots.size());
+                    slots.resize(n);
+                }
+                slots[id] = v;
+                present.insert(id);
+                return { iterator(this, id), true };
+            }
+
+            /**
+             * @brief Remove an id from the map
+             *
+             * @param id Id to remove
+             *
+             * @return Number of ids removed (0 or 1)
+             */
+            std::size_t erase(std::size_t id)
+            {
+                if (!present.erase(id)) return 0;
+                // Release resources held by the value, e.g., heap memory
+                slots[id].second = T();
+                return 1;
+            }
+
+            void clear()
+            {
+                slots.clear();
+                present.clear();
+            }
+
+            iterator begin() { return iterator(this, present.next(0)); }
+            iterator end() { return iterator(this, id_set_t::npos); }
+            const_iterator begin() const {
+                return const_iterator(this, present.next(0));
+            }
+            const_iterator end() const {
+                return const_iterator(this, id_set_t::npos);
+            }
+    };
+
+    //! Free begin/end, found via ADL, e.g., by tk::cref_find()
+    template<class T>
+    typename id_map_t<T>::iterator begin(id_map_t<T>& m) { return m.begin(); }
+    template<class T>
+    typename id_map_t<T>::iterator end(id_map_t<T>& m) { return m.end(); }
+    template<class T>
+    typename id_map_t<T>::const_iterator begin(const id_map_t<T>& m) {
+        return m.begin();
+    }
+    template<class T>
+    typename id_map_t<T>::const_iterator end(const id_map_t<T>& m) {
+        return m.end();
+    }
+
+}
+
+#endif // AMR_id_map_h
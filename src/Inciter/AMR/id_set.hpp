@@ -0,0 +1,169 @@
+#ifndef AMR_id_set_h
+#define AMR_id_set_h
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <limits>
+#include <iterator>
+
+namespace AMR {
+
+    /**
+     * @brief Set of ids stored as a bitset, one bit per id
+     *
+     * Ids of tets and nodes are dense (handed out sequentially and
+     * recycled), so a bit per id is much smaller and faster to query than
+     * the nodes of a std::set. Iteration visits the ids in ascending order,
+     * as for a std::set.
+     */
+    class id_set_t {
+        private:
+            using word_t = std::uint64_t;
+            static constexpr std::size_t BITS = 64;
+
+            std::vector<word_t> words;
+            std::size_t count_ = 0;
+
+        public:
+            //! Id returned by next() if there is no id after the given one
+            static constexpr std::size_t npos =
+                std::numeric_limits<std::size_t>::max();
+
+            /**
+             * @brief Forward iterator visiting the ids in ascending order
+             */
+            class const_iterator {
+                public:
+                    using iterator_category = std::forward_iterator_tag;
+                    using value_type = std::size_t;
+                    using difference_type = std::ptrdiff_t;
+                    using pointer = const std::size_t*;
+                    using reference = const std::size_t&;
+
+                    const_iterator() = default;
+                    const_iterator(const id_set_t* s, std::size_t id) :
+                        set(s), cur(id) {}
+
+                    reference operator*() const { return cur; }
+                    const_iterator& operator++() {
+                        cur = set->next(cur+1);
+                        return *this;
+                    }
+                    const_iterator operator++(int) {
+                        auto i = *this;
+                        ++(*this);
+                        return i;
+                    }
+                    bool operator==(const const_iterator& rhs) const {
+                        return cur == rhs.cur;
+                    }
+                    bool operator!=(const const_iterator& rhs) const {
+                        return cur != rhs.cur;
+                    }
+
+                private:
+                    const id_set_t* set = nullptr;
+                    std::size_t cur = npos;
+            };
+            using iterator = const_iterator;
+
+            /**
+             * @brief Number of ids in the set
+             *
+             * @return Number of ids in the set
+             */
+            std::size_t size() const { return count_; }
+
+            bool empty() const { return count_ == 0; }
+
+            /**
+             * @brief Query if an id is in the set
+             *
+             * @param id Id to check
+             *
+             * @return 1 if the id is in the set, 0 otherwise
+             */
+            std::size_t count(std::size_t id) const
+            {
+                auto w = id / BITS;
+                if (w >= words.size()) return 0;
+                return (words[w] >> (id % BITS)) & 1u;
+            }
+
+            /**
+             * @brief Add an id to the set
+             *
+             * @param id Id to add
+             *
+             * @return True if the id was not yet in the set
+             */
+            bool insert(std::size_t id)
+            {
+                auto w = id / BITS;
+                if (w >= words.size()) words.resize(w+1, 0);
+                const word_t bit = word_t(1) << (id % BITS);
+                if (words[w] & bit) return false;
+                words[w] |= bit;
+                ++count_;
+                return true;
+            }
+
+            /**
+             * @brief Remove an id from the set
+             *
+             * @param id Id to remove
+             *
+             * @return Number of ids removed (0 or 1)
+             */
+            std::size_t erase(std::size_t id)
+            {
+                if (!count(id)) return 0;
+                words[id / BITS] &= ~(word_t(1) << (id % BITS));
+                --count_;
+                return 1;
+            }
+
+            void clear()
+            {
+                words.clear();
+                count_ = 0;
+            }
+
+            /**
+             * @brief Find the first id in the set not smaller than a given id
+             *
+             * @param id Id to start the search from
+             *
+             * @return Smallest id in the set >= id, npos if there is none
+             */
+            std::size_t next(std::size_t id) const
+            {
+                auto w = id / BITS;
+                if (w >= words.size()) return npos;
+                // Mask off the bits below id in its word, then skip empty words
+                word_t bits = words[w] & (~word_t(0) << (id % BITS));
+                while (!bits) {
+                    if (++w == words.size()) return npos;
+                    bits = words[w];
+                }
+                return w*BITS +
+                    static_cast<std::size_t>(__builtin_ctzll(bits));
+            }
+
+            /**
+             * @brief One past the largest id the set can hold without growing
+             *
+             * @return Capacity of the bitset in ids
+             */
+            std::size_t capacity() const { return words.size() * BITS; }
+
+            const_iterator begin() const {
+                return const_iterator(this, next(0));
+            }
+            const_iterator end() const { return const_iterator(this, npos); }
+    };
+
+}
+
+#endif // AMR_id_set_h
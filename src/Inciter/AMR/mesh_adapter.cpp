@@ -506,7 +506,8 @@ namespace AMR {
             //refiner.overwrite_children(tet_store, former_children, current_children);
 
             tet_store.unset_marked_children(i); // FIXME: This will not work well in parallel
-            element.refinement_case = AMR::Refinement_Case::one_to_eight;
+            // Refinement adds tets, which invalidates references to their data
+            tet_store.data(i).refinement_case = AMR::Refinement_Case::one_to_eight;
         }
 
         // Clean up dead edges
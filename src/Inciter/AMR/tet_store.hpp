@@ -11,6 +11,7 @@
 #include "edge_store.hpp"
 #include "util.hpp"
 #include "id_generator.hpp"
+#include "id_set.hpp"
 
 namespace AMR {
 
@@ -20,15 +21,15 @@ namespace AMR {
                 // This is a horrendous code abuse, and I'm sorry. I'm fairly
                 // certain we'll be re-writing how this detection is done and just
                 // wanted a quick-fix so I could move on :(
-            std::set<size_t> center_tets; // Store for 1:4 centers
+            id_set_t center_tets; // Store for 1:4 centers
 
-            std::set<size_t> delete_list; // For marking deletions in deref
+            id_set_t delete_list; // For marking deletions in deref
 
             AMR::active_element_store_t active_elements;
             AMR::master_element_store_t master_elements;
 
             std::vector< std::size_t > active_tetinpoel;
-            std::set< std::size_t > active_nodes;
+            id_set_t active_nodes;
 
             AMR::id_generator_t id_generator;
 
@@ -59,7 +60,7 @@ namespace AMR {
              *
              * @return active status of tet
              */
-            bool is_active(size_t id)
+            bool is_active(size_t id) const
             {
                 return active_elements.exists(id);
             }
@@ -139,7 +140,7 @@ namespace AMR {
             {
                 // cppcheck-suppress assertWithSideEffect
                 assert( !exists(id) );
-                tets.insert( std::pair<size_t, tet_t>(id, t));
+                tets.insert( tet_list_t::value_type(id, t) );
             }
 
             /**
@@ -167,8 +168,7 @@ namespace AMR {
              */
             bool exists(size_t id)
             {
-                auto f = tets.find(id);
-                if (f != tets.end())
+                if (tets.count(id))
                 {
                     //trace_out << "tet " << id << " exists." << std::endl;
                     return true;
@@ -300,7 +300,12 @@ namespace AMR {
             {
                 deactivate(id);
                 master_elements.erase(id);
-                tets.erase(id);
+                if (!tets.erase(id)) return;
+                // The id is recycled, so forget everything keyed by it
+                center_tets.erase(id);
+                marked_refinements.erase(id);
+                marked_derefinements.erase(id);
+                id_generator.release(id);
                 // TODO: Should this update the number of children here rather than at the call site?
             }
 
@@ -345,11 +350,7 @@ namespace AMR {
              */
             bool is_center(size_t id)
             {
-                if (center_tets.find(id) != center_tets.end())
-                {
-                    return true;
-                }
-                return false;
+                return center_tets.count(id);
             }
 
             /**
@@ -28,6 +28,7 @@
 #include "Limiter.hpp"
 #include "Reorder.hpp"
 #include "Vector.hpp"
+#include "Integrate/Surface.hpp"
 
 namespace inciter {
 
@@ -39,6 +40,18 @@ extern std::vector< DGPDE > g_dgpde;
 static const std::array< std::array< tk::real, 3 >, 2 >
   rkcoef{{ {{ 0.0, 3.0/4.0, 1.0/3.0 }}, {{ 1.0, 1.0/4.0, 2.0/3.0 }} }};
 
+//! Query if the time step size is configured to be constant
+//! \return True if a constant time step size is configured, false if it is
+//!   computed from the CFL coefficient
+static bool
+constdt()
+{
+  auto const_dt = g_inputdeck.get< tag::discr, tag::dt >();
+  auto def_const_dt = g_inputdeck_defaults.get< tag::discr, tag::dt >();
+  auto eps = std::numeric_limits< tk::real >::epsilon();
+  return std::abs(const_dt - def_const_dt) > eps;
+}
+
 } // inciter::
 
 using inciter::DG;
@@ -59,7 +72,9 @@ DG::DG( const CProxy_Discretization& disc,
        g_inputdeck.get< tag::component >().nprop() ),
   m_un( m_u.nunk(), m_u.nprop() ),
   m_geoFace( tk::genGeoFaceTri( m_fd.Nipfac(), m_fd.Inpofa(), Disc()->Coord()) ),
+  m_faceQuad(),
   m_geoElem( tk::genGeoElemTet( Disc()->Inpoel(), Disc()->Coord() ) ),
+  m_jacElem(),
   m_lhs( m_u.nunk(), m_u.nprop() ),
   m_rhs( m_u.nunk(), m_u.nprop() ),
   m_nfac( m_fd.Inpofa().size()/3 ),
@@ -75,9 +90,19 @@ DG::DG( const CProxy_Discretization& disc,
   m_diag(),
   m_stage( 0 ),
   m_ndof(),
-  m_bid(),
+  m_sendTet(),
+  m_recvOffset(),
+  m_ghostTet(),
   m_uc(),
   m_ndofc(),
+  m_sendu(),
+  m_sendndof(),
+  m_level( constdt() ? 0 : g_inputdeck.get< tag::discr, tag::lts >(),
+           m_u.nunk(), m_u.nunk() ),
+  m_eldt(),
+  m_dtsub( 0.0 ),
+  m_stridec(),
+  m_sendstride(),
   m_initial( 1 ),
   m_expChBndFace()
 // *****************************************************************************
@@ -908,27 +933,59 @@ DG::adj()
   m_lhs.resize( m_nunk );
   m_rhs.resize( m_nunk );
 
-  // Create a mapping between local ghost tet ids and zero-based boundary ids
-  std::vector< std::size_t > c( tk::sumvalsize( m_ghost ) );
-  std::size_t j = 0;
+  // Create lists of local tet ids to send to fellow chares. Tets are sent in
+  // order of increasing local tet id, so the receiver can unpack them without
+  // tet ids sent along.
+  m_sendTet.clear();
+  for (const auto& n : m_ghostData) {
+    auto& tets = m_sendTet[ n.first ];
+    tets.reserve( n.second.size() );
+    for (const auto& i : n.second) tets.push_back( i.first );
+    std::sort( begin(tets), end(tets) );
+  }
+
+  // Create lists of local ghost tet ids in the order they are received, i.e.,
+  // the ghosts of a fellow chare stored contiguously in order of increasing
+  // remote tet id
+  m_recvOffset.clear();
+  m_ghostTet.clear();
+  m_ghostTet.reserve( tk::sumvalsize( m_ghost ) );
   for (const auto& n : m_ghost) {
-    for(const auto& i : n.second) {
-      c[j++] = i.second;
+    m_recvOffset[ n.first ] = m_ghostTet.size();
+    std::vector< std::pair< std::size_t, std::size_t > >
+      g( begin(n.second), end(n.second) );
+    std::sort( begin(g), end(g) );
+    for (const auto& i : g) {
+      Assert( i.second >= m_fd.Esuel().size()/4, "Receiving non-ghost data" );
+      m_ghostTet.push_back( i.second );
     }
   }
-  m_bid = tk::assignLid( c );
 
-  // Size communication buffer that receives number of degrees of freedom
-  for (auto& n : m_ndofc) n.resize( m_bid.size() );
-  for (auto& u : m_uc) u.resize( m_bid.size() );
+  // Size communication buffers that receive solution and number of degrees of
+  // freedom
+  for (auto& n : m_ndofc) n.resize( m_ghostTet.size() );
+  for (auto& u : m_uc) u.resize( m_ghostTet.size() * m_u.nprop() );
+  if (!m_level.empty()) m_stridec.resize( m_ghostTet.size() );
 
   // Initialize number of degrees of freedom in mesh elements
   const auto ndof = inciter::g_inputdeck.get< tag::discr, tag::ndof >();
   m_ndof.resize( m_nunk, ndof );
 
+  // Start all elements, including ghosts, on the finest time step level
+  m_level.resize( m_fd.Esuel().size()/4, m_nunk );
+
+  // Precompute element Jacobians and quadrature data on internal and
+  // chare-boundary faces now that the connectivity and coordinates also
+  // contain those of ghosts
+  genQuad();
+
+  // Color faces so that face integrals can be split among threads
+  m_fd.color();
+
   // Ensure that we also have all the geometry and connectivity data 
   // (including those of ghosts)
   Assert( m_geoElem.nunk() == m_u.nunk(), "GeoElem unknowns size mismatch" );
+  Assert( m_jacElem.nunk() == m_u.nunk(), "JacElem unknowns size mismatch" );
   Assert( Disc()->Inpoel().size()/4 == m_u.nunk(), "Inpoel size mismatch" );
 
   // Basic error checking on ghost tet ID map
@@ -962,6 +1019,68 @@ DG::registerReducers()
   ElemDiagnostics::registerReducers();
 }
 
+void
+DG::genQuad()
+// *****************************************************************************
+// Generate element Jacobians and face-quadrature data
+//! \details Both depend only on the mesh (including ghosts) and the face data,
+//!   so they are regenerated instead of migrated, see genDerived().
+// *****************************************************************************
+{
+  auto d = Disc();
+
+  const auto ndof = inciter::g_inputdeck.get< tag::discr, tag::ndof >();
+  const auto rdof = inciter::g_inputdeck.get< tag::discr, tag::rdof >();
+
+  m_jacElem = tk::genJacElemTet( d->Inpoel(), d->Coord() );
+  m_faceQuad = tk::genFaceQuad( ndof, rdof, m_jacElem, d->Coord(), m_fd,
+                                m_geoFace );
+}
+
+void
+DG::genDerived()
+// *****************************************************************************
+//  Regenerate data derived from the mesh not migrated
+//! \details The element Jacobians, face-quadrature data, and the left-hand
+//!   side are regenerated from the mesh, face data, and geometry that were
+//!   migrated. This requires the Discretization element bound to this one,
+//!   so it is called only after all bound elements have been unpacked.
+// *****************************************************************************
+{
+  genQuad();
+
+  m_lhs = tk::Fields( m_u.nunk(), m_u.nprop() );
+  for (const auto& eq : g_dgpde) eq.lhs( m_geoElem, m_lhs );
+}
+
+void
+DG::ckJustMigrated()
+// *****************************************************************************
+//  Regenerate data not migrated after migration
+//! \details This is called by Charm++ after this chare array element and the
+//!   Discretization element bound to it have been unpacked on migration during
+//!   load balancing. Charm++ also calls this after restarting from a disk
+//!   checkpoint, as restarting from disk migrates elements in from the files.
+// *****************************************************************************
+{
+  CBase_DG::ckJustMigrated();
+  genDerived();
+}
+
+void
+DG::ckJustRestored()
+// *****************************************************************************
+//  Regenerate data not written to checkpoints after restart
+//! \details This is called by Charm++ after this chare array element and the
+//!   Discretization element bound to it have been restored from a checkpoint
+//!   without migration, e.g., from an in-memory checkpoint. Together with
+//!   ckJustMigrated() this covers every path on which elements are unpacked.
+// *****************************************************************************
+{
+  CBase_DG::ckJustRestored();
+  genDerived();
+}
+
 void
 DG::ResumeFromSync()
 // *****************************************************************************
@@ -1016,70 +1135,115 @@ DG::next()
 
   if (pref && m_stage == 0) eval_ndof();
 
+  // Time step levels of ghosts are sent at the start of a time step
+  const auto lts =
+    !m_level.empty() && m_stage == 0 && m_level.Substep() == 0;
+
   // communicate solution ghost data (if any)
-  if (m_ghostData.empty())
+  if (m_sendTet.empty())
     comsol_complete();
   else
-    for(const auto& n : m_ghostData) {
-      std::vector< std::size_t > tetid( n.second.size() );
-      std::vector< std::vector< tk::real > > u( n.second.size() );
-      std::vector< std::size_t > ndof;
-      std::size_t j = 0;
-      for(const auto& i : n.second) {
-        Assert( i.first < m_fd.Esuel().size()/4, "Sending solution ghost data" );
-        tetid[j] = i.first;
-        u[j] = m_u[i.first];
-        if (pref && m_stage == 0) ndof.push_back( m_ndof[i.first] );
-        ++j;
-      }
-      thisProxy[ n.first ].comsol( thisIndex, m_stage, tetid, u, ndof );
+    for(const auto& n : m_sendTet) {
+      packGhost( n.second, pref && m_stage == 0 );
+      m_sendstride.clear();
+      if (lts)
+        for (auto e : n.second) m_sendstride.push_back( m_level.stride(e) );
+      thisProxy[ n.first ].comsol( thisIndex, m_stage, m_sendu, m_sendndof,
+                                   m_sendstride );
     }
 
   ownsol_complete();
 }
 
+void
+DG::packGhost( const std::vector< std::size_t >& tets, bool ndof )
+// *****************************************************************************
+//  Pack solution (and number of degrees of freedom) into send buffers
+//! \param[in] tets Local tet ids whose data to pack
+//! \param[in] ndof True to also pack the number of degrees of freedom
+//! \details The send buffers are reused for all fellow chares, since the data
+//!   is copied into the message when the entry method is called.
+// *****************************************************************************
+{
+  const auto nprop = m_u.nprop();
+
+  m_sendu.resize( tets.size() * nprop );
+  for (std::size_t j=0; j<tets.size(); ++j) {
+    Assert( tets[j] < m_fd.Esuel().size()/4, "Sending ghost data" );
+    for (std::size_t c=0; c<nprop; ++c)
+      m_sendu[ j*nprop+c ] = m_u( tets[j], c, 0 );
+  }
+
+  m_sendndof.clear();
+  if (ndof) for (auto e : tets) m_sendndof.push_back( m_ndof[e] );
+}
+
+void
+DG::unpackGhost( std::size_t buf, bool ndof )
+// *****************************************************************************
+//  Unpack solution (and number of degrees of freedom) from receive buffers
+//! \param[in] buf Receive buffer to unpack: 0: solution, 1: limited solution
+//! \param[in] ndof True to also unpack the number of degrees of freedom
+// *****************************************************************************
+{
+  const auto nprop = m_u.nprop();
+  const auto& u = m_uc[buf];
+
+  Assert( u.size() == m_ghostTet.size() * nprop, "Size mismatch" );
+
+  for (std::size_t b=0; b<m_ghostTet.size(); ++b) {
+    auto e = m_ghostTet[b];
+    for (std::size_t c=0; c<nprop; ++c) m_u( e, c, 0 ) = u[ b*nprop+c ];
+    if (ndof) m_ndof[e] = m_ndofc[buf][b];
+  }
+}
+
 void
 DG::comsol( int fromch,
             std::size_t fromstage,
-            const std::vector< std::size_t >& tetid,
-            const std::vector< std::vector< tk::real > >& u,
-            const std::vector< std::size_t >& ndof )
+            const std::vector< tk::real >& u,
+            const std::vector< std::size_t >& ndof,
+            const std::vector< std::size_t >& stride )
 // *****************************************************************************
 //  Receive chare-boundary solution ghost data from neighboring chares
 //! \param[in] fromch Sender chare id
 //! \param[in] fromstage Sender chare time step stage
-//! \param[in] tetid Ghost tet ids we receive solution data for
-//! \param[in] u Solution ghost data
+//! \param[in] u Solution ghost data, all components of the ghosts in order of
+//!   increasing (sender-local) tet id
 //! \param[in] ndof Number of degrees of freedom for chare-boundary elements
+//! \param[in] stride Time step strides of chare-boundary elements, only sent
+//!   at the start of a time step with local time stepping
 //! \details This function receives contributions to the unlimited solution
 //!   from fellow chares.
 // *****************************************************************************
 {
-  Assert( u.size() == tetid.size(), "Size mismatch in DG::comsol()" );
-
   const auto pref = inciter::g_inputdeck.get< tag::pref, tag::pref >();
 
-  if (pref && fromstage == 0)
-    Assert( ndof.size() == tetid.size(), "Size mismatch in DG::comsol()" );
-
-  // Find local-to-ghost tet id map for sender chare
-  const auto& n = tk::cref_find( m_ghost, fromch );
-
-  for (std::size_t i=0; i<tetid.size(); ++i) {
-    auto j = tk::cref_find( n, tetid[i] );
-    Assert( j >= m_fd.Esuel().size()/4, "Receiving solution non-ghost data" );
-    auto b = tk::cref_find( m_bid, j );
-    Assert( b < m_uc[0].size(), "Indexing out of bounds" );
-    m_uc[0][b] = u[i];
-    if (pref && fromstage == 0) {
-      Assert( b < m_ndofc[0].size(), "Indexing out of bounds" );
-      m_ndofc[0][b] = ndof[i];
-    }
+  // Find offset of ghosts of sender chare in receive buffer
+  auto b = tk::cref_find( m_recvOffset, fromch );
+  auto n = u.size() / m_u.nprop();
+
+  Assert( u.size() % m_u.nprop() == 0, "Size mismatch in DG::comsol()" );
+  Assert( (b + n) * m_u.nprop() <= m_uc[0].size(), "Indexing out of bounds" );
+
+  std::copy( begin(u), end(u),
+             begin(m_uc[0]) + static_cast< long >( b * m_u.nprop() ) );
+
+  if (pref && fromstage == 0) {
+    Assert( ndof.size() == n, "Size mismatch in DG::comsol()" );
+    std::copy( begin(ndof), end(ndof),
+               begin(m_ndofc[0]) + static_cast< long >( b ) );
+  }
+
+  if (!stride.empty()) {
+    Assert( stride.size() == n, "Size mismatch in DG::comsol()" );
+    std::copy( begin(stride), end(stride),
+               begin(m_stridec) + static_cast< long >( b ) );
   }
 
   // if we have received all solution ghost contributions from those chares we
   // communicate along chare-boundary faces with, solve the system
-  if (++m_nsol == m_ghostData.size()) {
+  if (++m_nsol == m_recvOffset.size()) {
     m_nsol = 0;
     comsol_complete();
   }
@@ -1095,28 +1259,13 @@ DG::eval_ndof()
   const auto& esuel = m_fd.Esuel();
   const auto rdof = inciter::g_inputdeck.get< tag::discr, tag::rdof >();
   const auto ncomp = m_u.nprop()/rdof;
-  const auto& inpoel = Disc()->Inpoel();
-  const auto& coord = Disc()->Coord();
   const auto tolref = inciter::g_inputdeck.get< tag::pref, tag::tolref >();
 
-  const auto& cx = coord[0];
-  const auto& cy = coord[1];
-  const auto& cz = coord[2];
-
   for (std::size_t e=0; e<esuel.size()/4; ++e)
   {
     if(m_ndof[e] == 4)
     {
-      // Extract the element coordinates
-      std::array< std::array< tk::real, 3>, 4 > coordel {{
-        {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
-        {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
-        {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
-        {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }}
-      }};
-
-      auto jacInv =
-        tk::inverseJacobian( coordel[0], coordel[1], coordel[2], coordel[3] );
+      auto jacInv = tk::jacInvElem( m_jacElem, e );
 
       std::size_t sign(0);
 
@@ -1236,15 +1385,12 @@ DG::lim()
 
   // Combine own and communicated contributions of unlimited solution and
   // degrees of freedom in cells (if p-adaptive)
-  for (const auto& b : m_bid) {
-    Assert( m_uc[0][b.second].size() == m_u.nprop(), "ncomp size mismatch" );
-    for (std::size_t c=0; c<m_u.nprop(); ++c) {
-      m_u(b.first,c,0) = m_uc[0][b.second][c];
-    }
-    if (pref && m_stage == 0) {
-      m_ndof[ b.first ] = m_ndofc[0][ b.second ];
-    }
-  }
+  unpackGhost( 0, pref && m_stage == 0 );
+
+  // Set time step levels of ghosts received at the start of a time step
+  if (!m_level.empty() && m_stage == 0 && m_level.Substep() == 0)
+    for (std::size_t b=0; b<m_ghostTet.size(); ++b)
+      m_level.ghost( m_ghostTet[b], m_stridec[b] );
 
   if (pref && m_stage==0) propagate_ndof();
 
@@ -1256,31 +1402,74 @@ DG::lim()
     if (limiter == ctr::LimiterType::WENOP1)
       WENO_P1( m_fd.Esuel(), 0, m_u );
     else if (limiter == ctr::LimiterType::SUPERBEEP1)
-      Superbee_P1( m_fd.Esuel(), d->Inpoel(), m_ndof, 0, d->Coord(), m_u );
+      Superbee_P1( m_fd.Esuel(), d->Inpoel(), m_ndof, 0, d->Coord(),
+                   m_jacElem, m_u );
   }
 
+  const auto rdof = inciter::g_inputdeck.get< tag::discr, tag::rdof >();
+
+  if (pref && m_stage == 0)
+  {
+    // When the element are coarsened, high order term should be zero
+    for(std::size_t e = 0; e < m_nunk; e++)
+    {
+      const auto ncomp= m_u.nprop()/rdof;
+      if(m_ndof[e] == 1)
+      {
+        for (std::size_t c=0; c<ncomp; ++c)
+        {
+          auto mark = c*rdof;
+          m_u(e, mark+1, 0) = 0.0;
+          m_u(e, mark+2, 0) = 0.0;
+          m_u(e, mark+3, 0) = 0.0;
+        }
+      }
+    }
+  }
+
+  // Update Un
+  if (m_stage == 0) m_un = m_u;
+
   // Send limited solution to neighboring chares
-  if (m_ghostData.empty())
+  if (m_sendTet.empty())
     comlim_complete();
   else
-    for(const auto& n : m_ghostData) {
-      std::vector< std::size_t > tetid( n.second.size() );
-      std::vector< std::vector< tk::real > > u( n.second.size() );
-      std::vector< std::size_t > ndof;
-      std::size_t j = 0;
-      for(const auto& i : n.second) {
-        Assert( i.first < m_fd.Esuel().size()/4, "Sending limiter ghost data" );
-        tetid[j] = i.first;
-        u[j] = m_u[i.first];
-        if (pref && m_stage == 0) ndof.push_back( m_ndof[i.first] );
-        ++j;
-      }
-      thisProxy[ n.first ].comlim( thisIndex, tetid, u, ndof );
+    for(const auto& n : m_sendTet) {
+      packGhost( n.second, pref && m_stage == 0 );
+      thisProxy[ n.first ].comlim( thisIndex, m_sendu, m_sendndof );
     }
 
+  // Compute the interior part of the right-hand side, which only requires the
+  // limited solution in owned elements, while the ghost data is in flight
+  rhs( RhsPhase::INTERIOR );
+
   ownlim_complete();
 }
 
+void
+DG::rhs( RhsPhase phase )
+// *****************************************************************************
+// Compute a phase of the right-hand side of discrete transport equations
+//! \param[in] phase Right-hand side phase to compute
+//! \details The interior phase, computed in lim() while the limited solution
+//!   is communicated, zeros the right-hand side and adds all terms that only
+//!   require data of owned elements, i.e., volume and source integrals and the
+//!   surface integrals on physical-boundary and internal faces. The
+//!   chare-boundary phase, computed in dt() once the ghost data has arrived,
+//!   adds the surface integrals on chare-boundary faces. With local time
+//!   stepping only the terms active in the current substep are computed, see
+//!   TimeLevels.
+// *****************************************************************************
+{
+  auto d = Disc();
+
+  const auto t = d->T() + static_cast< tk::real >( m_level.Substep() )*m_dtsub;
+
+  for (const auto& eq : g_dgpde)
+    eq.rhs( phase, t, m_geoFace, m_faceQuad, m_geoElem, m_jacElem, m_fd,
+            d->Coord(), m_u, m_ndof, m_level, m_rhs );
+}
+
 void
 DG::propagate_ndof()
 // *****************************************************************************
@@ -1314,44 +1503,39 @@ DG::propagate_ndof()
 
 void
 DG::comlim( int fromch,
-            const std::vector< std::size_t >& tetid,
-            const std::vector< std::vector< tk::real > >& u,
+            const std::vector< tk::real >& u,
             const std::vector< std::size_t >& ndof )
 // *****************************************************************************
 //  Receive chare-boundary limiter ghost data from neighboring chares
 //! \param[in] fromch Sender chare id
-//! \param[in] tetid Ghost tet ids we receive solution data for
-//! \param[in] u Limited high-order solution
+//! \param[in] u Limited high-order solution, all components of the ghosts in
+//!   order of increasing (sender-local) tet id
 //! \param[in] ndof Number of degrees of freedom for chare-boundary elements
 //! \details This function receives contributions to the limited solution from
 //!   fellow chares.
 // *****************************************************************************
 {
-  Assert( u.size() == tetid.size(), "Size mismatch in DG::comlim()" );
-
   const auto pref = inciter::g_inputdeck.get< tag::pref, tag::pref >();
 
-  if (pref && m_stage == 0)
-    Assert( ndof.size() == tetid.size(), "Size mismatch in DG::comlim()" );
-
-  // Find local-to-ghost tet id map for sender chare
-  const auto& n = tk::cref_find( m_ghost, fromch );
-
-  for (std::size_t i=0; i<tetid.size(); ++i) {
-    auto j = tk::cref_find( n, tetid[i] );
-    Assert( j >= m_fd.Esuel().size()/4, "Receiving solution non-ghost data" );
-    auto b = tk::cref_find( m_bid, j );
-    Assert( b < m_uc[1].size(), "Indexing out of bounds" );
-    m_uc[1][b] = u[i];
-    if (pref && m_stage == 0) {
-      Assert( b < m_ndofc[1].size(), "Indexing out of bounds" );
-      m_ndofc[1][b] = ndof[i];
-    }
+  // Find offset of ghosts of sender chare in receive buffer
+  auto b = tk::cref_find( m_recvOffset, fromch );
+  auto n = u.size() / m_u.nprop();
+
+  Assert( u.size() % m_u.nprop() == 0, "Size mismatch in DG::comlim()" );
+  Assert( (b + n) * m_u.nprop() <= m_uc[1].size(), "Indexing out of bounds" );
+
+  std::copy( begin(u), end(u),
+             begin(m_uc[1]) + static_cast< long >( b * m_u.nprop() ) );
+
+  if (pref && m_stage == 0) {
+    Assert( ndof.size() == n, "Size mismatch in DG::comlim()" );
+    std::copy( begin(ndof), end(ndof),
+               begin(m_ndofc[1]) + static_cast< long >( b ) );
   }
 
   // if we have received all solution ghost contributions from those chares we
   // communicate along chare-boundary faces with, solve the system
-  if (++m_nlim == m_ghostData.size()) {
+  if (++m_nlim == m_recvOffset.size()) {
     m_nlim = 0;
     comlim_complete();
   }
@@ -1369,35 +1553,26 @@ DG::dt()
 
   // Combine own and communicated contributions of limited solution and degrees
   // of freedom in cells (if p-adaptive)
-  for (const auto& b : m_bid) {
-    Assert( m_uc[1][b.second].size() == m_u.nprop(), "ncomp size mismatch" );
-    for (std::size_t c=0; c<m_u.nprop(); ++c) {
-      m_u(b.first,c,0) = m_uc[1][b.second][c];
-    }
-    if (pref && m_stage == 0) {
-      m_ndof[ b.first ] = m_ndofc[1][ b.second ];
-    }
-  }
+  unpackGhost( 1, pref && m_stage == 0 );
 
   auto mindt = std::numeric_limits< tk::real >::max();
+  auto newdt = mindt;
 
-  if (m_stage == 0)
+  if (m_stage == 0 && m_level.Substep() == 0)
   {
-    auto const_dt = g_inputdeck.get< tag::discr, tag::dt >();
-    auto def_const_dt = g_inputdeck_defaults.get< tag::discr, tag::dt >();
-    auto eps = std::numeric_limits< tk::real >::epsilon();
-
     // use constant dt if configured
-    if (std::abs(const_dt - def_const_dt) > eps) {
+    if (constdt()) {
 
-      mindt = const_dt;
+      mindt = g_inputdeck.get< tag::discr, tag::dt >();
 
     } else {      // compute dt based on CFL
 
-      // find the minimum dt across all PDEs integrated
+      // find the minimum dt across all PDEs integrated, also collecting the
+      // allowable dt of each element
+      m_eldt.assign( m_u.nunk(), std::numeric_limits< tk::real >::max() );
       for (const auto& eq : g_dgpde) {
-        auto eqdt =
-          eq.dt( d->Coord(), d->Inpoel(), m_fd, m_geoFace, m_geoElem, m_ndof, m_u );
+        auto eqdt = eq.dt( d->Coord(), m_fd, m_geoFace, m_geoElem, m_jacElem,
+                           m_ndof, m_u, m_eldt );
         if (eqdt < mindt) mindt = eqdt;
       }
 
@@ -1415,25 +1590,50 @@ DG::dt()
 
       // Scale smallest dt with CFL coefficient and the CFL is scaled by (2*p+1)
       // where p is the order of the DG polynomial by linear stability theory.
-      mindt *= g_inputdeck.get< tag::discr, tag::cfl >() / (2.0*dgp + 1.0);
+      const auto cfl =
+        g_inputdeck.get< tag::discr, tag::cfl >() / (2.0*dgp + 1.0);
+      mindt *= cfl;
+      for (auto& t : m_eldt) t *= cfl;
+
+    }
+
+    newdt = mindt;
 
+    // With local time stepping the smallest time step size is the largest
+    // one with which all owned elements are stable advancing with their
+    // strides assigned for this time step
+    if (!m_level.empty()) {
+      newdt = std::numeric_limits< tk::real >::max();
+      for (std::size_t e=0; e<m_fd.Esuel().size()/4; ++e)
+        newdt = std::min( newdt,
+                  m_eldt[e] / static_cast< tk::real >( m_level.stride(e) ) );
     }
   }
   else
   {
-    mindt = d->Dt();
+    mindt = newdt = d->Dt();
   }
 
   // Contribute to minimum dt across all chares then advance to next step
-  contribute( sizeof(tk::real), &mindt, CkReduction::min_double,
+  std::array< tk::real, 2 > dts{{ newdt, mindt }};
+  contribute( 2*sizeof(tk::real), dts.data(), CkReduction::min_double,
               CkCallback(CkReductionTarget(DG,solve), thisProxy) );
+
+  // Complete the right-hand side with the chare-boundary faces while the
+  // reduction is in progress
+  rhs( RhsPhase::CHBND );
 }
 
 void
-DG::solve( tk::real newdt )
+DG::solve( tk::real newdt, tk::real mindt )
 // *****************************************************************************
-// Compute right-hand side of discrete transport equations
-//! \param[in] newdt Size of this new time step
+// Advance the solution with the right-hand side of discrete transport equations
+//! \param[in] newdt Size of this new time step, with local time stepping the
+//!   size of its substeps
+//! \param[in] mindt Smallest allowable time step size of all elements, used
+//!   to assign time step levels for the next time step
+//! \details The right-hand side has been computed in lim() and dt(), see
+//!   rhs().
 // *****************************************************************************
 {
   // Enable SDAG wait for building the solution vector during the next stage
@@ -1445,51 +1645,45 @@ DG::solve( tk::real newdt )
   const auto ndof = inciter::g_inputdeck.get< tag::discr, tag::ndof >();
   const auto neq = m_u.nprop()/rdof;
 
-  // Set new time step size
-  if (m_stage == 0) d->setdt( newdt );
+  // Set new time step size and assign time step levels for the next one
+  if (m_stage == 0 && m_level.Substep() == 0) {
+    const auto nsub = static_cast< tk::real >( m_level.nsubstep() );
+    d->setdt( newdt * nsub );
+    m_dtsub = d->Dt() / nsub;
+    if (!m_level.empty()) m_level.next( m_eldt, mindt );
+  }
 
-  const auto pref = inciter::g_inputdeck.get< tag::pref, tag::pref >();
-  if (pref && m_stage == 0)
-  {
-    // When the element are coarsened, high order term should be zero
-    for(std::size_t e = 0; e < m_nunk; e++)
-    {
-      const auto ncomp= m_u.nprop()/rdof;
-      if(m_ndof[e] == 1)
-      {
-        for (std::size_t c=0; c<ncomp; ++c)
+  // Explicit time-stepping using RK3 to discretize time-derivative
+  const auto a = rkcoef[0][m_stage];
+  const auto b = rkcoef[1][m_stage];
+  const auto dt = m_dtsub;
+  if (m_level.empty() && rdof == ndof) {
+    // Without reconstruction all degrees of freedom are updated, so the
+    // update is done in a single pass over the raw data
+    tk::fused( [a,b,dt]( tk::real& u, tk::real un, tk::real r, tk::real l )
+               { u = a*un + b*(u + dt*r/l); },
+               m_u, m_un, m_rhs, m_lhs );
+  } else {
+    // Elements whose right-hand side is zero in this substep are not updated,
+    // the others advance with their own time step size
+    for(std::size_t e=0; e<m_nunk; ++e) {
+      if (!m_level.touched( e, m_fd.Esuel() )) continue;
+      const auto dte = dt * static_cast< tk::real >( m_level.stride(e) );
+      for(std::size_t c=0; c<neq; ++c)
+        for (std::size_t k=0; k<ndof; ++k)
         {
-          auto mark = c*rdof;
-          m_u(e, mark+1, 0) = 0.0;
-          m_u(e, mark+2, 0) = 0.0;
-          m_u(e, mark+3, 0) = 0.0;
+          auto rmark = c*rdof+k;
+          auto mark = c*ndof+k;
+          m_u(e, rmark, 0) =  a * m_un(e, rmark, 0)
+            + b * ( m_u(e, rmark, 0)
+              + dte * m_rhs(e, mark, 0)/m_lhs(e, mark, 0) );
         }
-      }
     }
   }
 
-  // Update Un
-  if (m_stage == 0) m_un = m_u;
-
-  for (const auto& eq : g_dgpde)
-    eq.rhs( d->T(), m_geoFace, m_geoElem, m_fd, d->Inpoel(), d->Coord(), m_u,
-            m_ndof, m_rhs );
+  if (m_stage < 2 || !m_level.last()) {
 
-  // Explicit time-stepping using RK3 to discretize time-derivative
-  for(std::size_t e=0; e<m_nunk; ++e)
-    for(std::size_t c=0; c<neq; ++c)
-      for (std::size_t k=0; k<ndof; ++k)
-      {
-        auto rmark = c*rdof+k;
-        auto mark = c*ndof+k;
-        m_u(e, rmark, 0) =  rkcoef[0][m_stage] * m_un(e, rmark, 0)
-          + rkcoef[1][m_stage] * ( m_u(e, rmark, 0)
-            + d->Dt() * m_rhs(e, mark, 0)/m_lhs(e, mark, 0) );
-      }
-
-  if (m_stage < 2) {
-
-    // continue with next tims step stage
+    // continue with next tims step stage or substep
     stage();
 
   } else {
@@ -1548,7 +1742,8 @@ DG::resizePostAMR(
 //  Receive new mesh from refiner
 //! \param[in] chunk New mesh chunk (connectivity and global<->local id maps)
 //! \param[in] coord New mesh node coordinates
-//! \param[in] addedTets Newly added mesh cells and their parents (local ids)
+//! \param[in] addedTets Mesh cells whose id changed and the cells of the old
+//!   mesh they inherit their solution from (local ids)
 //! \param[in] msum New node communication map
 //! \param[in] bface Boundary-faces mapped to side set ids
 //! \param[in] triinpoel Boundary-face connectivity
@@ -1572,11 +1767,11 @@ DG::resizePostAMR(
   // Resize mesh data structures
   d->resizePostAMR( chunk, coord, msum );
 
-  // Update state
+  // Update state, saving the solution on the old mesh
   auto nelem = d->Inpoel().size()/4;
   auto nprop = m_u.nprop();
+  m_un = m_u;
   m_u.resize( nelem, nprop );
-  m_un.resize( nelem, nprop );
   m_lhs.resize( nelem, nprop );
   m_rhs.resize( nelem, nprop );
 
@@ -1595,7 +1790,6 @@ DG::resizePostAMR(
   m_ghost.clear();
 
   // Update solution on new mesh, P0 (cell center value) only for now
-  m_un = m_u;
   for (const auto& e : addedTets) {
     Assert( e.first < nelem, "Indexing out of new solution vector" );
     Assert( e.second < old_nelem, "Indexing out of old solution vector" );
@@ -1642,9 +1836,17 @@ DG::stage()
   // Increment Runge-Kutta stage counter
   ++m_stage;
 
-  // if not all Runge-Kutta stages complete, continue to next time stage,
-  // otherwise output field data to file(s)
-  if (m_stage < 3) next(); else out();
+  // if not all Runge-Kutta stages complete, continue to next time stage, if
+  // not all substeps complete, continue to next substep, otherwise output
+  // field data to file(s)
+  if (m_stage < 3) {
+    next();
+  } else if (m_level.advance()) {
+    m_stage = 0;
+    next();
+  } else {
+    out();
+  }
 }
 
 void
@@ -1706,6 +1908,8 @@ DG::step()
   d->status();
   // Reset Runge-Kutta stage counter
   m_stage = 0;
+  // Start time step with the time step levels assigned during the last one
+  m_level.start();
 
   const auto term = g_inputdeck.get< tag::discr, tag::term >();
   const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
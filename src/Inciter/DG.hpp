@@ -32,6 +32,7 @@
 #include "DerivedData.hpp"
 #include "FaceData.hpp"
 #include "ElemDiagnostics.hpp"
+#include "TimeLevels.hpp"
 
 #include "NoWarning/dg.decl.h"
 
@@ -81,6 +82,12 @@ class DG : public CBase_DG {
       #pragma clang diagnostic pop
     #endif
 
+    //! Regenerate data not migrated after migration
+    void ckJustMigrated() override;
+
+    //! Regenerate data not written to checkpoints after restart
+    void ckJustRestored() override;
+
     //! Return from migration
     void ResumeFromSync() override;
 
@@ -113,16 +120,15 @@ class DG : public CBase_DG {
 
     //! Receive chare-boundary limiter function data from neighboring chares
     void comlim( int fromch,
-                 const std::vector< std::size_t >& tetid,
-                 const std::vector< std::vector< tk::real > >& u,
+                 const std::vector< tk::real >& u,
                  const std::vector< std::size_t >& ndof );
 
     //! Receive chare-boundary ghost data from neighboring chares
     void comsol( int fromch,
                  std::size_t fromstage,
-                 const std::vector< std::size_t >& tetid,
-                 const std::vector< std::vector< tk::real > >& u,
-                 const std::vector< std::size_t >& ndof );
+                 const std::vector< tk::real >& u,
+                 const std::vector< std::size_t >& ndof,
+                 const std::vector< std::size_t >& stride );
 
     //! Optionally refine/derefine mesh
     void refine();
@@ -157,7 +163,7 @@ class DG : public CBase_DG {
     void resized() {}
 
     //! Compute right hand side and solve system
-    void solve( tk::real newdt );
+    void solve( tk::real newdt, tk::real mindt );
 
     //! Evaluate whether to continue with next time step
     void step();
@@ -166,6 +172,14 @@ class DG : public CBase_DG {
     ///@{
     //! \brief Pack/Unpack serialize member function
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \details Data derived from the mesh and the face data, i.e., element
+    //!   Jacobians, face-quadrature data, and the left-hand side, is not
+    //!   migrated nor written to checkpoints. It cannot be regenerated here,
+    //!   because when unpacking, the Discretization element bound to this one,
+    //!   holding the mesh, is not guaranteed to have been unpacked yet. It is
+    //!   regenerated by genDerived(), called from ckJustMigrated() and
+    //!   ckJustRestored(), which Charm++ only calls once all bound elements
+    //!   have been unpacked.
     void pup( PUP::er &p ) override {
       p | m_disc;
       p | m_ncomfac;
@@ -178,7 +192,6 @@ class DG : public CBase_DG {
       p | m_un;
       p | m_geoFace;
       p | m_geoElem;
-      p | m_lhs;
       p | m_rhs;
       p | m_nfac;
       p | m_nunk;
@@ -194,9 +207,18 @@ class DG : public CBase_DG {
       p | m_diag;
       p | m_stage;
       p | m_ndof;
-      p | m_bid;
+      p | m_sendTet;
+      p | m_recvOffset;
+      p | m_ghostTet;
       p | m_uc;
       p | m_ndofc;
+      p | m_sendu;
+      p | m_sendndof;
+      p | m_level;
+      p | m_eldt;
+      p | m_dtsub;
+      p | m_stridec;
+      p | m_sendstride;
       p | m_initial;
       p | m_expChBndFace;
       p | m_infaces;
@@ -239,8 +261,13 @@ class DG : public CBase_DG {
     tk::Fields m_un;
     //! Face geometry
     tk::Fields m_geoFace;
+    //! \brief Precomputed quadrature points, weights, and basis functions on
+    //!   internal and chare-boundary faces, see tk::genFaceQuad()
+    std::vector< tk::real > m_faceQuad;
     //! Element geometry
     tk::Fields m_geoElem;
+    //! Element Jacobian data, see tk::genJacElemTet()
+    tk::Fields m_jacElem;
     //! Left-hand side mass-matrix which is a diagonal matrix
     tk::Fields m_lhs;
     //! Vector of right-hand side
@@ -284,13 +311,35 @@ class DG : public CBase_DG {
     std::size_t m_stage;
     //! Vector of local number of degrees of freedom for each element
     std::vector< std::size_t > m_ndof;
-    //! Map local ghost tet ids (value) and zero-based boundary ids (key)
-    std::unordered_map< std::size_t, std::size_t > m_bid;
-    //! Solution receive buffers for ghosts only
-    std::array< std::vector< std::vector< tk::real > >, 2 > m_uc;
+    //! Local tet ids whose data is sent to fellow chares associated to chare ids
+    //! \details Tets are sent in order of increasing local tet id, which is
+    //!   the order the receiving chare expects them in, see m_ghostTet.
+    std::unordered_map< int, std::vector< std::size_t > > m_sendTet;
+    //! Offsets into the receive buffers of the ghosts of fellow chares
+    std::unordered_map< int, std::size_t > m_recvOffset;
+    //! Local ghost tet ids in the order of the receive buffers
+    //! \details The ghosts of a fellow chare are stored contiguously, starting
+    //!   at its offset in m_recvOffset, in order of increasing remote tet id.
+    std::vector< std::size_t > m_ghostTet;
+    //! Solution receive buffers for ghosts only, ghost-major, see m_ghostTet
+    std::array< std::vector< tk::real >, 2 > m_uc;
     //! \brief Number of degrees of freedom (for p-adaptive) receive buffers
-    //!   for ghosts only
+    //!   for ghosts only, see m_ghostTet
     std::array< std::vector< std::size_t >, 2 > m_ndofc;
+    //! Solution send buffer, reused for all fellow chares
+    std::vector< tk::real > m_sendu;
+    //! Number of degrees of freedom send buffer, reused for all fellow chares
+    std::vector< std::size_t > m_sendndof;
+    //! Time step levels of elements for local time stepping
+    TimeLevels m_level;
+    //! Allowable time step size of each element, used for local time stepping
+    std::vector< tk::real > m_eldt;
+    //! Size of a substep of the time step, the smallest time step size
+    tk::real m_dtsub;
+    //! Stride receive buffer for ghosts only, see m_ghostTet
+    std::vector< std::size_t > m_stridec;
+    //! Stride send buffer, reused for all fellow chares
+    std::vector< std::size_t > m_sendstride;
     //! 1 if starting time stepping, 0 if during time stepping
     int m_initial;
     //! Unique set of chare-boundary faces this chare is expected to receive
@@ -333,6 +382,18 @@ class DG : public CBase_DG {
     //! Continue after face adjacency communication map completed on this chare
     void adj();
 
+    //! Generate element Jacobians and face-quadrature data
+    void genQuad();
+
+    //! Regenerate data derived from the mesh not migrated
+    void genDerived();
+
+    //! Pack solution (and number of degrees of freedom) into send buffers
+    void packGhost( const std::vector< std::size_t >& tets, bool ndof );
+
+    //! Unpack solution (and number of degrees of freedom) from receive buffers
+    void unpackGhost( std::size_t buf, bool ndof );
+
     //! Fill elements surrounding a face along chare boundary
     void addEsuf( const std::array< std::size_t, 2 >& id, std::size_t ghostid );
 
@@ -354,6 +415,9 @@ class DG : public CBase_DG {
     //! Compute time step size
     void dt();
 
+    //! Compute a phase of the right-hand side of discrete transport equations
+    void rhs( RhsPhase phase );
+
     //! Evaluate whether to continue with next time step stage
     void stage();
 
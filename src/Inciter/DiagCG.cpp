@@ -61,9 +61,9 @@ DiagCG::DiagCG( const CProxy_Discretization& disc,
   m_lhs( m_u.nunk(), m_u.nprop() ),
   m_rhs( m_u.nunk(), m_u.nprop() ),
   m_bc(),
-  m_lhsc(),
-  m_rhsc(),
-  m_difc(),
+  m_lhsc( m_disc[thisIndex].ckLocal()->CommMap().size(), m_u.nprop() ),
+  m_rhsc( m_lhsc.nunk(), m_u.nprop() ),
+  m_difc( m_lhsc.nunk(), m_u.nprop() ),
   m_diag()
 // *****************************************************************************
 //  Constructor
@@ -73,6 +73,10 @@ DiagCG::DiagCG( const CProxy_Discretization& disc,
 {
   usesAtSync = true;    // enable migration at AtSync
 
+  // Match user-specified boundary conditions to side set nodes
+  auto d = Disc();
+  m_bc = DirichletBC( m_u.nprop(), d->Coord(), d->Gid(), d->Lid(), m_bnode );
+
   // Activate SDAG wait for initially computing the left-hand side
   thisProxy[ thisIndex ].wait4lhs();
 
@@ -165,26 +169,24 @@ DiagCG::lhs()
   // Compute lumped mass lhs required for both high and low order solutions
   m_lhs = d->FCT()->lump( *d );
 
-  if (d->Msum().empty())
+  const auto& cmap = d->CommMap();
+
+  if (cmap.empty())
     comlhs_complete();
   else // send contributions of lhs to chare-boundary nodes to fellow chares
-    for (const auto& n : d->Msum()) {
-      std::vector< std::vector< tk::real > > l( n.second.size() );
-      std::size_t j = 0;
-      for (auto i : n.second) l[ j++ ] = m_lhs[ tk::cref_find(d->Lid(),i) ];
-      thisProxy[ n.first ].comlhs( n.second, l );
-    }
+    for (const auto& n : cmap.Lid())
+      thisProxy[ n.first ].comlhs( thisIndex, cmap.gather( n.first, m_lhs ) );
 
   ownlhs_complete();
 }
 
 void
-DiagCG::comlhs( const std::vector< std::size_t >& gid,
-                const std::vector< std::vector< tk::real > >& L )
+DiagCG::comlhs( int fromch, const std::vector< tk::real >& L )
 // *****************************************************************************
 //  Receive contributions to left-hand side diagonal matrix on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive LHS contributions
-//! \param[in] L Partial contributions of LHS to chare-boundary nodes
+//! \param[in] fromch Sender chare id
+//! \param[in] L Partial contributions of LHS to chare-boundary nodes shared
+//!   with the sender, in slot order, see NodeCommMap
 //! \details This function receives contributions to m_lhs, which stores the
 //!   diagonal (lumped) mass matrix at mesh nodes. While m_lhs stores
 //!   own contributions, m_lhsc collects the neighbor chare contributions during
@@ -192,14 +194,17 @@ DiagCG::comlhs( const std::vector< std::size_t >& gid,
 //!   are combined in lhsmerge().
 // *****************************************************************************
 {
-  Assert( L.size() == gid.size(), "Size mismatch" );
+  const auto& cmap = Disc()->CommMap();
+  const auto& bid = cmap.Bid( fromch );
+  const auto ncomp = m_lhsc.nprop();
 
-  using tk::operator+=;
+  Assert( L.size() == bid.size()*ncomp, "Size mismatch" );
 
-  for (std::size_t i=0; i<gid.size(); ++i)
-    m_lhsc[ gid[i] ] += L[i];
+  for (std::size_t i=0; i<bid.size(); ++i)
+    for (ncomp_t c=0; c<ncomp; ++c)
+      m_lhsc(bid[i],c,0) += L[i*ncomp+c];
 
-  if (++m_nlhs == Disc()->Msum().size()) {
+  if (++m_nlhs == cmap.nchare()) {
     m_nlhs = 0;
     comlhs_complete();
   }
@@ -212,14 +217,13 @@ DiagCG::lhsmerge()
 // *****************************************************************************
 {
   // Combine own and communicated contributions to left hand side
-  for (const auto& b : m_lhsc) {
-    auto lid = tk::cref_find( Disc()->Lid(), b.first );
+  const auto& blid = Disc()->CommMap().Blid();
+  for (std::size_t b=0; b<blid.size(); ++b)
     for (ncomp_t c=0; c<m_lhs.nprop(); ++c)
-      m_lhs(lid,c,0) += b.second[c];
-  }
+      m_lhs(blid[b],c,0) += m_lhsc(b,c,0);
 
-  // Clear receive buffer
-  tk::destroy(m_lhsc);
+  // Zero receive buffer
+  m_lhsc.fill( 0.0 );
 
   // Continue after lhs is complete
   if (m_initial) start(); else lhs_complete();
@@ -300,38 +304,32 @@ DiagCG::rhs()
   // Compute mass diffusion rhs contribution required for the low order solution
   auto dif = d->FCT()->diff( *d, m_u );
 
-  // Query and match user-specified boundary conditions to side sets
-  m_bc = match( m_u.nprop(), d->T(), d->Dt(), d->Coord(), d->Gid(),
-                d->Lid(), m_bnode );
+  // Evaluate Dirichlet boundary conditions for this time step
+  m_bc.update( d->T(), d->Dt(), d->Coord() );
+
+  const auto& cmap = d->CommMap();
 
-  if (d->Msum().empty())
+  if (cmap.empty())
     comrhs_complete();
   else // send contributions of rhs to chare-boundary nodes to fellow chares
-    for (const auto& n : d->Msum()) {
-      std::vector< std::vector< tk::real > > r( n.second.size() );
-      std::vector< std::vector< tk::real > > D( n.second.size() );
-      std::size_t j = 0;
-      for (auto i : n.second) {
-        auto lid = tk::cref_find( d->Lid(), i );
-        r[ j ] = m_rhs[ lid ];
-        D[ j ] = dif[ lid ];
-        ++j;
-      }
-      thisProxy[ n.first ].comrhs( n.second, r, D );
-    }
+    for (const auto& n : cmap.Lid())
+      thisProxy[ n.first ].comrhs( thisIndex, cmap.gather( n.first, m_rhs ),
+                                   cmap.gather( n.first, dif ) );
 
   ownrhs_complete( dif );
 }
 
 void
-DiagCG::comrhs( const std::vector< std::size_t >& gid,
-                const std::vector< std::vector< tk::real > >& R,
-                const std::vector< std::vector< tk::real > >& D )
+DiagCG::comrhs( int fromch,
+                const std::vector< tk::real >& R,
+                const std::vector< tk::real >& D )
 // *****************************************************************************
 //  Receive contributions to right-hand side vector on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive RHS contributions
-//! \param[in] R Partial contributions of RHS to chare-boundary nodes
-//! \param[in] D Partial contributions to chare-boundary nodes
+//! \param[in] fromch Sender chare id
+//! \param[in] R Partial contributions of RHS to chare-boundary nodes shared
+//!   with the sender, in slot order, see NodeCommMap
+//! \param[in] D Partial contributions of mass diffusion to chare-boundary
+//!   nodes shared with the sender, in slot order
 //! \details This function receives contributions to m_rhs, which stores the
 //!   right hand side vector at mesh nodes. While m_rhs stores own
 //!   contributions, m_rhsc collects the neighbor chare contributions during
@@ -340,17 +338,20 @@ DiagCG::comrhs( const std::vector< std::size_t >& gid,
 //!   mass diffusion term of the right hand side vector at mesh nodes.
 // *****************************************************************************
 {
-  Assert( R.size() == gid.size(), "Size mismatch" );
-  Assert( D.size() == gid.size(), "Size mismatch" );
+  const auto& cmap = Disc()->CommMap();
+  const auto& bid = cmap.Bid( fromch );
+  const auto ncomp = m_rhsc.nprop();
 
-  using tk::operator+=;
+  Assert( R.size() == bid.size()*ncomp, "Size mismatch" );
+  Assert( D.size() == bid.size()*ncomp, "Size mismatch" );
 
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    m_rhsc[ gid[i] ] += R[i];
-    m_difc[ gid[i] ] += D[i];
-  }
+  for (std::size_t i=0; i<bid.size(); ++i)
+    for (ncomp_t c=0; c<ncomp; ++c) {
+      m_rhsc(bid[i],c,0) += R[i*ncomp+c];
+      m_difc(bid[i],c,0) += D[i*ncomp+c];
+    }
 
-  if (++m_nrhs == Disc()->Msum().size()) {
+  if (++m_nrhs == cmap.nchare()) {
     m_nrhs = 0;
     comrhs_complete();
   }
@@ -367,21 +368,17 @@ DiagCG::solve( tk::Fields& dif )
 
   auto d = Disc();
 
-  // Combine own and communicated contributions to rhs
-  for (const auto& b : m_rhsc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
-    for (ncomp_t c=0; c<ncomp; ++c) m_rhs(lid,c,0) += b.second[c];
-  }
-
-  // Combine own and communicated contributions to mass diffusion
-  for (const auto& b : m_difc) {
-    auto lid = tk::cref_find( d->Lid(), b.first );
-    for (ncomp_t c=0; c<ncomp; ++c) dif(lid,c,0) += b.second[c];
-  }
+  // Combine own and communicated contributions to rhs and mass diffusion
+  const auto& blid = d->CommMap().Blid();
+  for (std::size_t b=0; b<blid.size(); ++b)
+    for (ncomp_t c=0; c<ncomp; ++c) {
+      m_rhs(blid[b],c,0) += m_rhsc(b,c,0);
+      dif(blid[b],c,0) += m_difc(b,c,0);
+    }
 
-  // Clear receive buffers
-  tk::destroy(m_rhsc);
-  tk::destroy(m_difc);
+  // Zero receive buffers
+  m_rhsc.fill( 0.0 );
+  m_difc.fill( 0.0 );
 
   // Set Dirichlet BCs for lhs and both low and high order rhs vectors. Note
   // that the low order rhs (more prcisely the mass-diffusion term) is set to
@@ -390,23 +387,23 @@ DiagCG::solve( tk::Fields& dif )
   // hand side and mass diffusion so the low order system is L = R + D, where L
   // is the lumped mass matrix, R is the high order RHS, and D is
   // mass diffusion, and R already will have the Dirichlet BC set.
-  for (const auto& n : m_bc) {
-    auto b = d->Lid().find( n.first );
-    if (b != end(d->Lid())) {
-      auto id = b->second;
-      for (ncomp_t c=0; c<ncomp; ++c)
-        if (n.second[c].first) {
-          m_lhs( id, c, 0 ) = 1.0;
-          m_rhs( id, c, 0 ) = n.second[c].second;
-          dif( id, c, 0 ) = 0.0;
-        }
+  for (ncomp_t c=0; c<ncomp; ++c) {
+    const auto& n = m_bc.Lid(c);
+    const auto& v = m_bc.Inc(c);
+    for (std::size_t i=0; i<n.size(); ++i) {
+      m_lhs( n[i], c, 0 ) = 1.0;
+      m_rhs( n[i], c, 0 ) = v[i];
+      dif( n[i], c, 0 ) = 0.0;
     }
   }
 
   // Solve low and high order diagonal systems and update low order solution
-  auto dul = (m_rhs + dif) / m_lhs;
-  m_ul = m_u + dul;
-  m_du = m_rhs / m_lhs;
+  // in a single pass
+  tk::Fields dul( m_u.nunk(), m_u.nprop() );
+  tk::fused( []( tk::real& l, tk::real& ul, tk::real& du, tk::real u,
+                 tk::real r, tk::real df, tk::real m )
+             { l = (r + df) / m;  ul = u + l;  du = r / m; },
+             dul, m_ul, m_du, m_u, m_rhs, dif, m_lhs );
 
   // Continue with FCT
   d->FCT()->aec( *d, m_du, m_u, m_bc );
@@ -481,15 +478,16 @@ DiagCG::update( const tk::Fields& a, tk::Fields&& dul )
 
   // Verify that the change in the solution at those nodes where Dirichlet
   // boundary conditions are set is exactly the amount the BCs prescribe
-  Assert( correctBC( a, dul, m_bc, d->Lid() ),
+  Assert( correctBC( a, dul, m_bc ),
           "Dirichlet boundary condition incorrect" );
   IGNORE( dul );
 
   // Apply limited antidiffusive element contributions to low order solution
   if (g_inputdeck.get< tag::discr, tag::fct >())
-    m_u = m_ul + a;
+    tk::fused( []( tk::real& u, tk::real ul, tk::real au ){ u = ul + au; },
+               m_u, m_ul, a );
   else
-    m_u = m_u + m_du;
+    tk::fused( []( tk::real& u, tk::real du ){ u += du; }, m_u, m_du );
 
   // Compute diagnostics, e.g., residuals
   auto diag_computed = m_diag.compute( *d, m_u );
@@ -546,7 +544,8 @@ DiagCG::resizePostAMR(
 //! \param[in] chunk New mesh chunk (connectivity and global<->local id maps)
 //! \param[in] coord New mesh node coordinates
 //! \param[in] addedNodes Newly added mesh nodes and their parents (local ids)
-//! \param[in] addedTets Newly added mesh cells and their parents (local ids)
+//! \param[in] addedTets Mesh cells whose id changed and the cells of the old
+//!   mesh they inherit their solution from (local ids)
 //! \param[in] msum New node communication map
 //! \param[in] bnode Boundary-node lists mapped to side set ids
 // *****************************************************************************
@@ -576,6 +575,12 @@ DiagCG::resizePostAMR(
   m_lhs.resize( npoin, nprop );
   m_rhs.resize( npoin, nprop );
 
+  // Resize communication buffers to the new chare-boundary
+  auto nb = d->CommMap().size();
+  m_lhsc = tk::Fields( nb, nprop );
+  m_rhsc = tk::Fields( nb, nprop );
+  m_difc = tk::Fields( nb, nprop );
+
   // Update solution on new mesh
   for (const auto& n : addedNodes) {
     for (std::size_t c=0; c<nprop; ++c) {
@@ -583,11 +588,12 @@ DiagCG::resizePostAMR(
     }
   }
 
-  // Update physical-boundary node lists
+  // Update physical-boundary node lists and rematch boundary conditions
   m_bnode = bnode;
+  m_bc = DirichletBC( nprop, d->Coord(), d->Gid(), d->Lid(), m_bnode );
 
   // Resize FCT data structures
-  d->FCT()->resize( npoin, msum, d->Bid(), d->Lid(), d->Inpoel() );
+  d->FCT()->resize( npoin, d->CommMap(), d->Inpoel() );
 
   contribute( CkCallback(CkReductionTarget(Transporter,resized), d->Tr()) );
 }
@@ -37,6 +37,7 @@
 #include "Fields.hpp"
 #include "DerivedData.hpp"
 #include "FluxCorrector.hpp"
+#include "NodeBC.hpp"
 #include "NodeDiagnostics.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
@@ -112,13 +113,12 @@ class DiagCG : public CBase_DiagCG {
     void lhs();
 
     //! Receive contributions to left-hand side matrix on chare-boundaries
-    void comlhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& L );
+    void comlhs( int fromch, const std::vector< tk::real >& L );
 
     //! Receive contributions to right-hand side vector on chare-boundaries
-    void comrhs( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& R,
-                 const std::vector< std::vector< tk::real > >& D );
+    void comrhs( int fromch,
+                 const std::vector< tk::real >& R,
+                 const std::vector< tk::real >& D );
 
     //! Update solution at the end of time step
     void update( const tk::Fields& a, tk::Fields&& dul );
@@ -211,23 +211,19 @@ class DiagCG : public CBase_DiagCG {
     tk::Fields m_lhs;
     //! Right-hand side vector (for the high order system)
     tk::Fields m_rhs;
-    //! Boundary conditions evaluated and assigned to mesh node IDs
-    //! \details Vector of pairs of bool and boundary condition value associated
-    //!   to meshnode IDs at which the user has set Dirichlet boundary
-    //!   conditions for all PDEs integrated. The bool indicates whether the BC
-    //!   is set at the node for that component the if true, the real value is
-    //!   the increment (from t to dt) in the BC specified for a component.
-    std::unordered_map< std::size_t,
-      std::vector< std::pair< bool, tk::real > > > m_bc;
+    //! Dirichlet boundary conditions matched to local mesh node IDs
+    //! \details Matched once and after mesh refinement, the BC values are
+    //!   evaluated every time step in rhs()
+    DirichletBC m_bc;
     //! Receive buffer for communication of the left hand side
-    //! \details Key: chare id, value: lhs for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_lhsc;
+    //! \details Indexed by chare-boundary node IDs, see NodeCommMap
+    tk::Fields m_lhsc;
     //! Receive buffer for communication of the right hand side
-    //! \details Key: chare id, value: rhs for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_rhsc;
+    //! \details Indexed by chare-boundary node IDs, see NodeCommMap
+    tk::Fields m_rhsc;
     //! Receive buffer for communication of mass diffusion on the hand side
-    //! \details Key: chare id, value: dif for all scalar components per node
-    std::unordered_map< std::size_t, std::vector< tk::real > > m_difc;
+    //! \details Indexed by chare-boundary node IDs, see NodeCommMap
+    tk::Fields m_difc;
     //! Total mesh volume
     tk::real m_vol;
     //! Diagnostics object
@@ -19,6 +19,7 @@
 #include "Inciter/InputDeck/InputDeck.hpp"
 #include "Inciter/Options/Scheme.hpp"
 #include "Print.hpp"
+#include "ThreadPool.hpp"
 
 namespace inciter {
 
@@ -56,7 +57,7 @@ Discretization::Discretization(
   m_v( m_gid.size(), 0.0 ),
   m_vol( m_gid.size(), 0.0 ),
   m_volc(),
-  m_bid(),
+  m_cmap(),
   m_timer(),
   m_refined( 0 ),
   m_prevstatus( std::chrono::high_resolution_clock::now() )
@@ -86,16 +87,15 @@ Discretization::Discretization(
     v.insert( end(v), begin(n.second), end(n.second) );
   }
 
+  // Size the thread pool used by the computational kernels on this PE
+  threads();
+
   // Get ready for computing/communicating nodal volumes
   startvol();
 
-  // Count the number of mesh nodes at which we receive data from other chares
-  // and compute map associating boundary-chare node ID associated to global ID
-  std::vector< std::size_t > c( tk::sumvalsize( m_msum ) );
-  std::size_t j = 0;
-  for (const auto& n : m_msum) for (auto i : n.second) c[j++] = i;
-  tk::unique( c );
-  m_bid = tk::assignLid( c );
+  // Assign dense chare-boundary IDs and message slots to nodes shared with
+  // other chares
+  m_cmap = NodeCommMap( m_msum, m_lid );
 
   // Insert DistFCT chare array element if FCT is needed. Note that even if FCT
   // is configured false in the input deck, at this point, we still need the FCT
@@ -103,8 +103,8 @@ Discretization::Discretization(
   const auto sch = g_inputdeck.get< tag::discr, tag::scheme >();
   const auto nprop = g_inputdeck.get< tag::component >().nprop();
   if (sch == ctr::SchemeType::DiagCG)
-    m_fct[ thisIndex ].insert( m_nchare, m_gid.size(), nprop,
-                               m_msum, m_bid, m_lid, m_inpoel );
+    m_fct[ thisIndex ].insert( m_nchare, m_gid.size(), nprop, m_cmap,
+                               m_inpoel );
 
   contribute( CkCallback(CkReductionTarget(Transporter,disccreated),
               m_transporter) );
@@ -126,12 +126,8 @@ Discretization::resizePostAMR(
   m_coord = coord;      // update mesh node coordinates
   m_msum = msum;        // update node communication map
 
-  // Generate local ids for new chare boundary global ids
-  std::size_t lid = m_bid.size();
-  for (const auto& c : m_msum)
-    for (auto g : c.second)
-      if (m_bid.find( g ) == end(m_bid))
-        m_bid[ g ] = lid++;
+  // Update chare-boundary node communication map
+  m_cmap = NodeCommMap( m_msum, m_lid );
 
   // Clear receive buffer that will be used for collecting nodal volumes
   m_volc.clear();
@@ -193,6 +189,18 @@ Discretization::setCoord( const tk::UnsMesh::CoordMap& coordmap )
   return coord;
 }
 
+void
+Discretization::threads() const
+// *****************************************************************************
+//  Size the thread pool of the PE as configured by the user
+//! \details The thread pool is owned by the PE, see tk::threadpool(), so this
+//!   is called on construction as well as after migration to another PE.
+//!   Resizing the pool to the size it already has is a no-op.
+// *****************************************************************************
+{
+  tk::threadpool().resize( g_inputdeck.get< tag::cmd, tag::threads >() );
+}
+
 void
 Discretization::setRefiner( const CProxy_Refiner& ref )
 // *****************************************************************************
@@ -20,6 +20,7 @@
 #include "PUPUtil.hpp"
 #include "PDFReducer.hpp"
 #include "UnsMesh.hpp"
+#include "NodeCommMap.hpp"
 
 #include "NoWarning/discretization.decl.h"
 #include "NoWarning/refiner.decl.h"
@@ -181,11 +182,8 @@ class Discretization : public CBase_Discretization {
       return m_fct[ thisIndex ].ckLocal();
     }
 
-    //! Boundary node ids accessor as const-ref
-    const std::unordered_map< std::size_t, std::size_t >& Bid() const
-    { return m_bid; }
-    //! Boundary node ids accessor as non-const-ref
-    std::unordered_map< std::size_t, std::size_t >& Bid() { return m_bid; }
+    //! Chare-boundary node communication map accessor as const-ref
+    const NodeCommMap& CommMap() const { return m_cmap; }
 
     //! Nodal communication map accessor as const-ref
     const std::unordered_map< int, std::vector< std::size_t > >& Msum() const
@@ -258,10 +256,11 @@ class Discretization : public CBase_Discretization {
       p | m_v;
       p | m_vol;
       p | m_volc;
-      p | m_bid;
+      p | m_cmap;
       p | m_timer;
       p | m_refined;
       p( reinterpret_cast<char*>(&m_prevstatus), sizeof(Clock::time_point) );
+      if (p.isUnpacking()) threads();
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -345,10 +344,9 @@ class Discretization : public CBase_Discretization {
     //!   cell volumes / 4) with contributions from other chares on
     //!   chare-boundaries.
     std::unordered_map< std::size_t, tk::real > m_volc;
-    //! \brief Local chare-boundary mesh node IDs at which we receive
-    //!   contributions associated to global mesh node IDs of mesh elements we
-    //!   contribute to
-    std::unordered_map< std::size_t, std::size_t > m_bid;
+    //! \brief Chare-boundary node communication map assigning dense
+    //!   chare-boundary IDs and message slots to nodes shared with other chares
+    NodeCommMap m_cmap;
     //! Timer measuring a time step
     tk::Timer m_timer;
     //! 1 if mesh was refined in a time step, 0 if it was not
@@ -358,6 +356,9 @@ class Discretization : public CBase_Discretization {
 
     //! Set mesh coordinates based on coordinates map
     tk::UnsMesh::Coords setCoord( const tk::UnsMesh::CoordMap& coordmap );
+
+    //! Size the thread pool of the PE as configured by the user
+    void threads() const;
 };
 
 } // inciter::
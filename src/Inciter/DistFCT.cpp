@@ -34,18 +34,13 @@ using inciter::DistFCT;
 DistFCT::DistFCT( int nchare,
                   std::size_t nu,
                   std::size_t np,
-                  const std::unordered_map< int,
-                    std::vector< std::size_t > >& msum,
-                  const std::unordered_map< std::size_t, std::size_t >& bid,
-                  const std::unordered_map< std::size_t, std::size_t >& lid,
+                  const NodeCommMap& cmap,
                   const std::vector< std::size_t >& inpoel ) :
   m_naec( 0 ),
   m_nalw( 0 ),
   m_nlim( 0 ),
   m_nchare( static_cast< std::size_t >( nchare ) ),
-  m_msum( msum ),
-  m_bid( bid ),
-  m_lid( lid ),
+  m_cmap( cmap ),
   m_inpoel( inpoel ),
   m_fluxcorrector( m_inpoel.size() ),
   m_p( nu, np*2 ),
@@ -63,13 +58,7 @@ DistFCT::DistFCT( int nchare,
 //! \param[in] nu Number of unknowns in solution vector
 //! \param[in] np Total number of properties, i.e., scalar variables or
 //!   components, per unknown in solution vector
-//! \param[in] msum Global mesh node IDs associated to chare IDs bordering the
-//!   mesh chunk we operate on
-//! \param[in] bid Local chare-boundary mesh node IDs at which we receive
-//!   contributions associated to global mesh node IDs of mesh elements we
-//!   contribute to
-//! \param[in] lid Local mesh node ids associated to the global ones of owned
-//!   elements
+//! \param[in] cmap Chare-boundary node communication map
 //! \param[in] inpoel Mesh connectivity of our chunk of the mesh
 // *****************************************************************************
 {
@@ -82,43 +71,29 @@ DistFCT::resizeComm()
 // *****************************************************************************
 //  Size FCT communication buffers
 //! \details The size of the communication buffers are determined based on
-//!    m_bid.size() and m_a.nprop().
+//!    m_cmap.size() and m_a.nprop().
 // *****************************************************************************
 {
-  auto bs = m_bid.size();
+  auto bs = m_cmap.size();
   auto np = m_a.nprop();
 
-  m_pc.resize( bs );
-  for (auto& b : m_pc) b.resize( np*2 );
-  m_qc.resize( bs );
-  for (auto& b : m_qc) b.resize( np*2 );
-  m_ac.resize( bs );
-  for (auto& b : m_ac) b.resize( np );
+  m_pc = tk::Fields( bs, np*2 );
+  m_qc = tk::Fields( bs, np*2 );
+  m_ac = tk::Fields( bs, np );
 }
 
 void
 DistFCT::resize( std::size_t nu,
-                 const std::unordered_map< int,
-                   std::vector< std::size_t > >& msum,
-                 const std::unordered_map< std::size_t, std::size_t >& bid,
-                 const std::unordered_map< std::size_t, std::size_t >& lid,
+                 const NodeCommMap& cmap,
                  const std::vector< std::size_t >& inpoel )
 // *****************************************************************************
 //  Resize FCT data structures (e.g., after mesh refinement)
 //! \param[in] nu New number of unknowns in solution vector
-//! \param[in] msum New global mesh node IDs associated to chare IDs bordering
-//!   the mesh chunk we operate on
-//! \param[in] bid New local chare-boundary mesh node IDs at which we receive
-//!   contributions associated to global mesh node IDs of mesh elements we
-//!   contribute to
-//! \param[in] lid New local mesh node ids associated to the global ones of
-//!   owned elements
+//! \param[in] cmap New chare-boundary node communication map
 //! \param[in] inpoel Mesh connectivity of our chunk of the mesh
 // *****************************************************************************
 {
-  m_msum = msum;
-  m_bid = bid;
-  m_lid = lid;
+  m_cmap = cmap;
   m_inpoel = inpoel;
 
   auto np = m_a.nprop();
@@ -171,12 +146,12 @@ DistFCT::next()
       m_q(p,c*2+1,0) = std::numeric_limits< tk::real >::max();
     }
 
-  for (auto& b : m_pc) std::fill( begin(b), end(b), 0.0 );
-  for (auto& b : m_ac) std::fill( begin(b), end(b), 0.0 );
-  for (auto& b : m_qc)
+  m_pc.fill( 0.0 );
+  m_ac.fill( 0.0 );
+  for (std::size_t b=0; b<m_qc.nunk(); ++b)
     for (ncomp_t c=0; c<m_a.nprop(); ++c) {
-      b[c*2+0] = -std::numeric_limits< tk::real >::max();
-      b[c*2+1] = std::numeric_limits< tk::real >::max();
+      m_qc(b,c*2+0,0) = -std::numeric_limits< tk::real >::max();
+      m_qc(b,c*2+1,0) = std::numeric_limits< tk::real >::max();
     }
 }
 
@@ -184,17 +159,13 @@ void
 DistFCT::aec( const Discretization& d,
               const tk::Fields& dUh,
               const tk::Fields& Un,
-              const std::unordered_map< std::size_t,
-                      std::vector< std::pair< bool, tk::real > > >& bc )
+              const DirichletBC& bc )
 // *****************************************************************************
 //  Compute and sum antidiffusive element contributions (AEC) to mesh nodes
 //! \param[in] d Discretization proxy to read mesh data from
 //! \param[in] dUh Increment of the high order solution
 //! \param[in] Un Solution at the previous time step
-//! \param[in] bc Vector of pairs of bool and boundary condition value
-//!   associated to mesh node IDs at which to set Dirichlet boundary conditions.
-//!   Note that this BC data structure must include boundary conditions set
-//!   across all PEs, not just the ones need to be set on this PE.
+//! \param[in] bc Dirichlet boundary conditions matched to local nodes
 //! \details This function computes and starts communicating m_p, which stores
 //!    the sum of all positive (negative) antidiffusive element contributions to
 //!    nodes (Lohner: P^{+,-}_i), see also FluxCorrector::aec().
@@ -206,29 +177,25 @@ DistFCT::aec( const Discretization& d,
   // Compute and sum antidiffusive element contributions to mesh nodes. Note
   // that the sums are complete on nodes that are not shared with other chares
   // and only partial sums on chare-boundary nodes.
-  m_fluxcorrector.aec(d.Coord(), m_inpoel, d.Vol(), bc, d.Gid(), dUh, Un, m_p);
+  m_fluxcorrector.aec( d.Coord(), m_inpoel, d.Vol(), bc, dUh, Un, m_p );
 
-  if (d.Msum().empty())
+  if (m_cmap.empty())
     comaec_complete();
   else // send contributions to chare-boundary nodes to fellow chares
-    for (const auto& n : d.Msum()) {
-      std::vector< std::vector< tk::real > > p( n.second.size() );
-      std::size_t j = 0;
-      for (auto i : n.second) p[ j++ ] = m_p[ tk::cref_find(m_lid,i) ];
-      thisProxy[ n.first ].comaec( n.second, p );
-    }
+    for (const auto& n : m_cmap.Lid())
+      thisProxy[ n.first ].comaec( thisIndex, m_cmap.gather( n.first, m_p ) );
 
   ownaec_complete();
 }
 
 void
-DistFCT::comaec( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& P )
+DistFCT::comaec( int fromch, const std::vector< tk::real >& P )
 // *****************************************************************************
 //  Receive sums of antidiffusive element contributions on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive AEC contributions
+//! \param[in] fromch Sender chare id
 //! \param[in] P Partial sums of positive (negative) antidiffusive element
-//!   contributions to chare-boundary nodes
+//!   contributions to chare-boundary nodes shared with the sender, in slot
+//!   order, see NodeCommMap
 //! \details This function receives contributions to m_p, which stores the
 //!   sum of all positive (negative) antidiffusive element contributions to
 //!   nodes (Lohner: P^{+,-}_i), see also FluxCorrector::aec(). While m_p stores
@@ -237,17 +204,17 @@ DistFCT::comaec( const std::vector< std::size_t >& gid,
 //!   combined in lim().
 // *****************************************************************************
 {
-  Assert( P.size() == gid.size(), "Size mismatch" );
+  const auto& bid = m_cmap.Bid( fromch );
+  const auto np = m_pc.nprop();
 
-  using tk::operator+=;
+  Assert( P.size() == bid.size()*np, "Size mismatch" );
 
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    auto bid = tk::cref_find( m_bid, gid[i] );
-    Assert( bid < m_pc.size(), "Indexing out of bounds" );
-    m_pc[ bid ] += P[i];
+  for (std::size_t i=0; i<bid.size(); ++i) {
+    Assert( bid[i] < m_pc.nunk(), "Indexing out of bounds" );
+    for (std::size_t c=0; c<np; ++c) m_pc(bid[i],c,0) += P[i*np+c];
   }
 
-  if (++m_naec == m_msum.size()) {
+  if (++m_naec == m_cmap.nchare()) {
     m_naec = 0;
     comaec_complete();
   }
@@ -282,28 +249,24 @@ DistFCT::alw( const tk::Fields& Un,
   // nodes.
   m_fluxcorrector.alw( m_inpoel, Un, Ul, m_q );
 
-  if (m_msum.empty())
+  if (m_cmap.empty())
     comalw_complete();
   else // send contributions at chare-boundary nodes to fellow chares
-    for (const auto& n : m_msum) {
-      std::vector< std::vector< tk::real > > q( n.second.size() );
-      std::size_t j = 0;
-      for (auto i : n.second) q[ j++ ] = m_q[ tk::cref_find(m_lid,i) ];
-      thisProxy[ n.first ].comalw( n.second, q );
-    }
+    for (const auto& n : m_cmap.Lid())
+      thisProxy[ n.first ].comalw( thisIndex, m_cmap.gather( n.first, m_q ) );
 
   ownalw_complete();
 }
 
 void
-DistFCT::comalw( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& Q )
+DistFCT::comalw( int fromch, const std::vector< tk::real >& Q )
 // *****************************************************************************
 // Receive contributions to the maxima and minima of unknowns of all elements
 // surrounding mesh nodes on chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive contributions
+//! \param[in] fromch Sender chare id
 //! \param[in] Q Partial contributions to maximum and minimum unknowns of all
-//!   elements surrounding nodes to chare-boundary nodes
+//!   elements surrounding nodes to chare-boundary nodes shared with the
+//!   sender, in slot order, see NodeCommMap
 //! \details This function receives contributions to m_q, which stores the
 //!   maximum and mimimum unknowns of all elements surrounding each node
 //!   (Lohner: u^{max,min}_i), see also FluxCorrector::alw(). While m_q stores
@@ -312,20 +275,22 @@ DistFCT::comalw( const std::vector< std::size_t >& gid,
 //!   combined in lim().
 // *****************************************************************************
 {
-  Assert( Q.size() == gid.size(), "Size mismatch" );
+  const auto& bid = m_cmap.Bid( fromch );
+  const auto np = m_qc.nprop();
+
+  Assert( Q.size() == bid.size()*np, "Size mismatch" );
 
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    auto bid = tk::cref_find( m_bid, gid[i] );
-    Assert( bid < m_qc.size(), "Indexing out of bounds" );
-    auto& o = m_qc[ bid ];
-    const auto& q = Q[i];
+  for (std::size_t i=0; i<bid.size(); ++i) {
+    auto b = bid[i];
+    Assert( b < m_qc.nunk(), "Indexing out of bounds" );
+    const auto q = Q.data() + i*np;
     for (ncomp_t c=0; c<m_a.nprop(); ++c) {
-      if (q[c*2+0] > o[c*2+0]) o[c*2+0] = q[c*2+0];
-      if (q[c*2+1] < o[c*2+1]) o[c*2+1] = q[c*2+1];
+      if (q[c*2+0] > m_qc(b,c*2+0,0)) m_qc(b,c*2+0,0) = q[c*2+0];
+      if (q[c*2+1] < m_qc(b,c*2+1,0)) m_qc(b,c*2+1,0) = q[c*2+1];
     }
   }
 
-  if (++m_nalw == m_msum.size()) {
+  if (++m_nalw == m_cmap.nchare()) {
     m_nalw = 0;
     comalw_complete();
   }
@@ -343,42 +308,38 @@ DistFCT::lim()
   m_fluxcorrector.verify( m_nchare, m_inpoel, m_du, m_dul );
 
   // Combine own and communicated contributions to P and Q
-  for (const auto& b : m_bid) {
-    auto lid = tk::cref_find( m_lid, b.first );
-    const auto& bpc = m_pc[ b.second ];
-    const auto& bqc = m_qc[ b.second ];
+  const auto& blid = m_cmap.Blid();
+  for (std::size_t b=0; b<blid.size(); ++b) {
+    auto lid = blid[b];
     for (ncomp_t c=0; c<m_p.nprop()/2; ++c) {
-      m_p(lid,c*2+0,0) += bpc[c*2+0];
-      m_p(lid,c*2+1,0) += bpc[c*2+1];
-      if (bqc[c*2+0] > m_q(lid,c*2+0,0)) m_q(lid,c*2+0,0) = bqc[c*2+0];
-      if (bqc[c*2+1] < m_q(lid,c*2+1,0)) m_q(lid,c*2+1,0) = bqc[c*2+1];
+      m_p(lid,c*2+0,0) += m_pc(b,c*2+0,0);
+      m_p(lid,c*2+1,0) += m_pc(b,c*2+1,0);
+      auto qmax = m_qc(b,c*2+0,0), qmin = m_qc(b,c*2+1,0);
+      if (qmax > m_q(lid,c*2+0,0)) m_q(lid,c*2+0,0) = qmax;
+      if (qmin < m_q(lid,c*2+1,0)) m_q(lid,c*2+1,0) = qmin;
     }
   }
 
   m_fluxcorrector.lim( m_inpoel, m_p, m_ul, m_q, m_a );
 
-  if (m_msum.empty())
+  if (m_cmap.empty())
     comlim_complete();
   else // send contributions to chare-boundary nodes to fellow chares
-    for (const auto& n : m_msum) {
-      std::vector< std::vector< tk::real > > a( n.second.size() );
-      std::size_t j = 0;
-      for (auto i : n.second) a[ j++ ] = m_a[ tk::cref_find(m_lid,i) ];
-      thisProxy[ n.first ].comlim( n.second, a );
-    }
+    for (const auto& n : m_cmap.Lid())
+      thisProxy[ n.first ].comlim( thisIndex, m_cmap.gather( n.first, m_a ) );
 
   ownlim_complete();
 }
 
 void
-DistFCT::comlim( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& A )
+DistFCT::comlim( int fromch, const std::vector< tk::real >& A )
 // *****************************************************************************
 //  Receive contributions of limited antidiffusive element contributions on
 //  chare-boundaries
-//! \param[in] gid Global mesh node IDs at which we receive contributions
+//! \param[in] fromch Sender chare id
 //! \param[in] A Partial contributions to antidiffusive element contributions to
-//!   chare-boundary nodes
+//!   chare-boundary nodes shared with the sender, in slot order, see
+//!   NodeCommMap
 //! \details This function receives contributions to m_a, which stores the
 //!   limited antidiffusive element contributions assembled to nodes (Lohner:
 //!   AEC^c), see also FluxCorrector::limit(). While m_a stores own
@@ -387,17 +348,17 @@ DistFCT::comlim( const std::vector< std::size_t >& gid,
 //!   combined in apply().
 // *****************************************************************************
 {
-  Assert( A.size() == gid.size(), "Size mismatch" );
+  const auto& bid = m_cmap.Bid( fromch );
+  const auto np = m_ac.nprop();
 
-  using tk::operator+=;
+  Assert( A.size() == bid.size()*np, "Size mismatch" );
 
-  for (std::size_t i=0; i<gid.size(); ++i) {
-    auto bid = tk::cref_find( m_bid, gid[i] );
-    Assert( bid < m_ac.size(), "Indexing out of bounds" );
-    m_ac[ bid ] += A[i];
+  for (std::size_t i=0; i<bid.size(); ++i) {
+    Assert( bid[i] < m_ac.nunk(), "Indexing out of bounds" );
+    for (std::size_t c=0; c<np; ++c) m_ac(bid[i],c,0) += A[i*np+c];
   }
- 
-  if (++m_nlim == m_msum.size()) {
+
+  if (++m_nlim == m_cmap.nchare()) {
     m_nlim = 0;
     comlim_complete();
   }
@@ -410,11 +371,9 @@ DistFCT::apply()
 // *****************************************************************************
 {
   // Combine own and communicated contributions to A
-  for (const auto& b : m_bid) {
-    auto lid = tk::cref_find( m_lid, b.first );
-    const auto& bac = m_ac[ b.second ];
-    for (ncomp_t c=0; c<m_a.nprop(); ++c) m_a(lid,c,0) += bac[c];
-  }
+  const auto& blid = m_cmap.Blid();
+  for (std::size_t b=0; b<blid.size(); ++b)
+    for (ncomp_t c=0; c<m_a.nprop(); ++c) m_a(blid[b],c,0) += m_ac(b,c,0);
 
   // Update solution in host
   m_host[ thisIndex ].ckLocal()->update( m_a, std::move(m_dul) );
@@ -40,6 +40,7 @@
 #include "Fields.hpp"
 #include "DerivedData.hpp"
 #include "FluxCorrector.hpp"
+#include "NodeCommMap.hpp"
 #include "Discretization.hpp"
 #include "DiagCG.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
@@ -80,9 +81,7 @@ class DistFCT : public CBase_DistFCT {
     DistFCT( int nchare,
              std::size_t nu,
              std::size_t np,
-             const std::unordered_map< int, std::vector< std::size_t > >& msum,
-             const std::unordered_map< std::size_t, std::size_t >& bid,
-             const std::unordered_map< std::size_t, std::size_t >& lid,
+             const NodeCommMap& cmap,
              const std::vector< std::size_t >& inpoel );
 
     #if defined(__clang__)
@@ -107,25 +106,21 @@ class DistFCT : public CBase_DistFCT {
     void next();
 
     //! Receive sums of antidiffusive element contributions on chare-boundaries
-    void comaec( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& P );
+    void comaec( int fromch, const std::vector< tk::real >& P );
 
     //! \brief Receive contributions to the maxima and minima of unknowns of all
     //!   elements surrounding mesh nodes on chare-boundaries
-    void comalw( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& Q );
+    void comalw( int fromch, const std::vector< tk::real >& Q );
 
     //! \brief Receive contributions of limited antidiffusive element
     //!   contributions on chare-boundaries
-    void comlim( const std::vector< std::size_t >& gid,
-                 const std::vector< std::vector< tk::real > >& A );
+    void comlim( int fromch, const std::vector< tk::real >& A );
 
     //! Compute and sum antidiffusive element contributions (AEC) to mesh nodes
     void aec( const Discretization& d,
               const tk::Fields& dUh,
               const tk::Fields& Un,
-              const std::unordered_map< std::size_t,
-                      std::vector< std::pair< bool, tk::real > > >& bc );
+              const DirichletBC& bc );
 
     //! \brief Compute the maximum and minimum unknowns of all elements
     //!   surrounding nodes
@@ -136,10 +131,7 @@ class DistFCT : public CBase_DistFCT {
 
     //! Resize FCT data structures (e.g., after mesh refinement)
     void resize( std::size_t nu,
-                 const std::unordered_map< int,
-                   std::vector< std::size_t > >& msum,
-                 const std::unordered_map< std::size_t, std::size_t >& bid,
-                 const std::unordered_map< std::size_t, std::size_t >& lid,
+                 const NodeCommMap& cmap,
                  const std::vector< std::size_t >& inpoel );
 
     /** @name Pack/unpack (Charm++ serialization) routines */
@@ -151,9 +143,7 @@ class DistFCT : public CBase_DistFCT {
       p | m_nalw;
       p | m_nlim;
       p | m_nchare;
-      p | m_msum;
-      p | m_bid;
-      p | m_lid;
+      p | m_cmap;
       p | m_inpoel;
       p | m_fluxcorrector;
       p | m_p;
@@ -187,20 +177,9 @@ class DistFCT : public CBase_DistFCT {
     std::size_t m_nlim;
     //! Total number of worker chares
     std::size_t m_nchare;
-    //! \brief Global mesh node IDs bordering the mesh chunk held by fellow
-    //!   chares associated to their chare IDs
-    //! \details msum: mesh chunks surrounding mesh chunks and their neighbor
-    //!   points
+    //! Chare-boundary node communication map
     //! \note This is a copy. Original in (bound) Discretization
-    std::unordered_map< int, std::vector< std::size_t > > m_msum;
-    //! \brief Local chare-boundary mesh node IDs at which we receive
-    //!   contributions associated to global mesh node IDs of mesh elements we
-    //!   contribute to
-    //! \note This is a copy. Original in (bound) Discretization
-    std::unordered_map< std::size_t, std::size_t > m_bid;
-    //! Local mesh node ids associated to the global ones of owned elements
-    //! \note This is a copy. Original in (bound) Discretization
-    std::unordered_map< std::size_t, std::size_t > m_lid;
+    NodeCommMap m_cmap;
     //! Mesh connectivity of our chunk of the mesh
     //! \note This is a copy. Original in (bound) Discretization
     std::vector< std::size_t > m_inpoel;
@@ -208,8 +187,8 @@ class DistFCT : public CBase_DistFCT {
     FluxCorrector m_fluxcorrector;
     //! Flux-corrected transport data structures
     tk::Fields m_p, m_q, m_a;
-    //! Receive buffers for FCT
-    std::vector< std::vector< tk::real > > m_pc, m_qc, m_ac;
+    //! Receive buffers for FCT indexed by chare-boundary node IDs
+    tk::Fields m_pc, m_qc, m_ac;
     //! Pointer to low order solution vector and increment
     //! \note These are copies. Original in (bound) Discretization
     tk::Fields m_ul, m_dul, m_du;
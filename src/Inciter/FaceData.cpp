@@ -39,3 +39,55 @@ FaceData::FaceData(
   Assert( m_belem.size() == nbfac,
          "Number of boundary-elements and number of boundary-faces unequal" );
 }
+
+void
+FaceData::color()
+// *****************************************************************************
+//  Color internal and boundary faces for concurrent face loops
+//! \details Internal and chare-boundary faces are colored so that no two faces
+//!   of a color share a left or right element, and the boundary faces of each
+//!   side set are colored so that no two faces of a color share their (left)
+//!   element. The faces of a single color can then be integrated concurrently,
+//!   scatter-adding to the right-hand side of their elements without
+//!   conflicts. Internal faces, whose both elements are owned, and
+//!   chare-boundary faces, whose right element is a ghost, are colored
+//!   separately, so that their integrals can be computed in different phases,
+//!   see inciter::RhsPhase. Must be called after the face connectivity is
+//!   complete, i.e., after the ghost layer has been added.
+// *****************************************************************************
+{
+  auto nbfac = tk::sumvalsize( m_bface );
+  auto nfac = m_esuf.size()/2;
+
+  Assert( m_nipfac >= nbfac && m_nipfac <= nfac, "Face ranges inconsistent" );
+
+  // color the faces in [first,last) by their left and right elements
+  auto colorFaces = [&]( std::size_t first, std::size_t last ){
+    if (last == first) return;
+    std::vector< std::size_t > el( m_esuf.begin() + 2*first,
+                                   m_esuf.begin() + 2*last );
+    auto fc = tk::genColors( el, 2 );
+    for (auto& c : fc) {
+      for (auto& f : c) f += first;
+      m_fcolor.push_back( std::move(c) );
+    }
+  };
+
+  // color internal faces, then chare-boundary faces
+  m_fcolor.clear();
+  colorFaces( nbfac, m_nipfac );
+  m_nicolor = m_fcolor.size();
+  colorFaces( m_nipfac, nfac );
+
+  // color boundary faces of each side set by their left elements
+  m_bcolor.clear();
+  for (const auto& s : m_bface) {
+    if (s.second.empty()) continue;
+    std::vector< std::size_t > el( s.second.size() );
+    for (std::size_t i=0; i<s.second.size(); ++i)
+      el[i] = static_cast< std::size_t >( m_esuf[ 2*s.second[i] ] );
+    auto& b = m_bcolor[ s.first ];
+    b = tk::genColors( el, 1 );
+    for (auto& c : b) for (auto& f : c) f = s.second[f];
+  }
+}
@@ -37,6 +37,12 @@ using GhostData =
                         // inpoel of said tet
                         std::array< std::size_t, 4 > > >;
 
+//! \brief Phases of computing the DG right-hand side, allowing the work that
+//!   only requires data of owned elements to overlap ghost communication
+enum class RhsPhase : uint8_t {
+  INTERIOR,     //!< Volume, source, physical- and internal-face terms
+  CHBND };      //!< Chare-boundary-face terms, requiring ghost data
+
 //! FaceData class holding face-connectivity data useful for DG discretization
 class FaceData {
 
@@ -51,6 +57,9 @@ class FaceData {
               const std::map< int, std::vector< std::size_t > >& bface,
               const std::vector< std::size_t >& triinpoel );
 
+    //! Color internal and boundary faces for concurrent face loops
+    void color();
+
     /** @name Accessors
       * */
     ///@{
@@ -66,6 +75,11 @@ class FaceData {
     const std::vector< std::size_t >& Belem() const { return m_belem; }
     const std::vector< int >& Esuf() const { return m_esuf; }
     std::vector< int >& Esuf() { return m_esuf; }
+    const std::vector< std::vector< std::size_t > >& Fcolor() const
+    { return m_fcolor; }
+    std::size_t Nicolor() const { return m_nicolor; }
+    const std::map< int, std::vector< std::vector< std::size_t > > >&
+    Bcolor() const { return m_bcolor; }
     //@}
 
     /** @name Charm++ pack/unpack (serialization) routines
@@ -81,6 +95,9 @@ class FaceData {
       p | m_inpofa;
       p | m_belem;
       p | m_esuf;
+      p | m_fcolor;
+      p | m_nicolor;
+      p | m_bcolor;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -103,6 +120,13 @@ class FaceData {
     std::vector< std::size_t > m_belem;
     //! Element surrounding faces
     std::vector< int > m_esuf;
+    //! Internal and chare-boundary face ids grouped by colors
+    std::vector< std::vector< std::size_t > > m_fcolor;
+    //! \brief Number of colors of internal faces, leading m_fcolor, followed
+    //!   by the colors of chare-boundary faces
+    std::size_t m_nicolor = 0;
+    //! Boundary face ids of side sets grouped by colors
+    std::map< int, std::vector< std::vector< std::size_t > > > m_bcolor;
 };
 
 } // inciter::
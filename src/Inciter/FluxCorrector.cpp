@@ -30,9 +30,7 @@ void
 FluxCorrector::aec( const std::array< std::vector< tk::real >, 3 >& coord,
                     const std::vector< std::size_t >& inpoel,
                     const std::vector< tk::real >& vol,
-                    const std::unordered_map< std::size_t,
-                            std::vector< std::pair< bool, tk::real > > >& bc,
-                    const std::vector< std::size_t >& gid,
+                    const DirichletBC& bc,
                     const tk::Fields& dUh,
                     const tk::Fields& Un,
                     tk::Fields& P )
@@ -41,11 +39,7 @@ FluxCorrector::aec( const std::array< std::vector< tk::real >, 3 >& coord,
 //! \param[in] coord Mesh node coordinates
 //! \param[in] inpoel Mesh element connectivity
 //! \param[in] vol Volume associated to mesh nodes
-//! \param[in] bc Vector of pairs of bool and boundary condition value
-//!   associated to mesh node IDs at which to set Dirichlet boundary conditions.
-//!   Note that this BC data structure must include boundary conditions set
-//!   across all PEs, not just the ones need to be set on this PE.
-//! \param[in] gid Local to global node ID mapping
+//! \param[in] bc Dirichlet boundary conditions matched to local nodes
 //! \param[in] dUh Increment of the high order solution
 //! \param[in] Un Solution at the previous time step
 //! \param[in,out] P The sums of positive (negative) AECs to nodes
@@ -139,17 +133,14 @@ FluxCorrector::aec( const std::array< std::vector< tk::real >, 3 >& coord,
   // to zero. This is because if the (same) BCs are correctly set for both the
   // low and the high order solution, there should be no difference between the
   // low and high order increments, thus AEC = dUh - dUl = 0.
-  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-    const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                           inpoel[e*4+2], inpoel[e*4+3] }};
+  const auto& bcmask = bc.Mask();
+  Assert( bcmask.size() == vol.size()*ncomp, "BC mask size mismatch" );
+  for (std::size_t e=0; e<inpoel.size()/4; ++e)
     for (std::size_t j=0; j<4; ++j) {
-      auto b = bc.find( gid[ N[j] ] );
-      if (b != end(bc))
-        for (ncomp_t c=0; c<ncomp; ++c)
-          if (b->second[c].first)
-            m_aec(e*4+j,c,0) = 0.0;
+      const auto m = bcmask.data() + inpoel[e*4+j]*ncomp;
+      for (ncomp_t c=0; c<ncomp; ++c)
+        if (m[c]) m_aec(e*4+j,c,0) = 0.0;
     }
-  }
 
   // sum all positive (negative) antidiffusive element contributions to nodes
   // (Lohner: P^{+,-}_i)
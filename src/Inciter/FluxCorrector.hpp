@@ -22,6 +22,7 @@
 
 #include "Keywords.hpp"
 #include "Fields.hpp"
+#include "NodeBC.hpp"
 #include "Inciter/InputDeck/InputDeck.hpp"
 
 namespace inciter {
@@ -50,9 +51,7 @@ class FluxCorrector {
     void aec( const std::array< std::vector< tk::real >, 3 >& coord,
               const std::vector< std::size_t >& inpoel,
               const std::vector< tk::real >& vol,
-              const std::unordered_map< std::size_t,
-                      std::vector< std::pair< bool, tk::real > > >& bc,
-              const std::vector< std::size_t >& gid,
+              const DirichletBC& bc,
               const tk::Fields& dUh,
               const tk::Fields& Un,
               tk::Fields& P );
@@ -15,10 +15,13 @@
 #include <map>
 #include <unordered_map>
 #include <algorithm>
+#include <limits>
+#include <cmath>
 
 #include "NodeBC.hpp"
 #include "CGPDE.hpp"
 #include "Fields.hpp"
+#include "ContainerUtil.hpp"
 
 namespace inciter {
 
@@ -152,27 +155,94 @@ match( tk::ctr::ncomp_type ncomp,
   return dirbc;
 }
 
+DirichletBC::DirichletBC(
+  tk::ctr::ncomp_type ncomp,
+  const tk::UnsMesh::Coords& coord,
+  const std::vector< std::size_t >& gid,
+  const std::unordered_map< std::size_t, std::size_t >& lid,
+  const std::map< int, std::vector< std::size_t > >& sidenodes ) :
+  m_node(),
+  m_lid( ncomp ),
+  m_idx( ncomp ),
+  m_mask( coord[0].size()*ncomp, 0 ),
+  m_inc(),
+  m_val( ncomp )
+// *****************************************************************************
+//  Constructor: match user-specified boundary conditions to nodes
+//! \param[in] ncomp Number of scalar components in PDE system
+//! \param[in] coord Mesh node coordinates
+//! \param[in] gid Global node IDs
+//! \param[in] lid Local node IDs associated to global node IDs
+//! \param[in] sidenodes Map storing global mesh node IDs mapped to side set ids
+//! \details Which nodes and components BCs are set at does not depend on time,
+//!   so match() is only called here, and its result converted to flat lists
+//!   of local node IDs. The BC values are evaluated by update().
+// *****************************************************************************
+{
+  const auto bc = match( ncomp, 0.0, 0.0, coord, gid, lid, sidenodes );
+
+  // Collect local node IDs at which BCs are set for any component
+  m_node.reserve( bc.size() );
+  for (const auto& n : bc) m_node.push_back( tk::cref_find( lid, n.first ) );
+  std::sort( begin(m_node), end(m_node) );
+
+  // Generate lists of nodes, in increasing order, for each component
+  for (std::size_t i=0; i<m_node.size(); ++i) {
+    const auto p = m_node[i];
+    const auto& b = tk::cref_find( bc, gid[p] );
+    for (std::size_t c=0; c<ncomp; ++c)
+      if (b[c].first) {
+        m_lid[c].push_back( p );
+        m_idx[c].push_back( i );
+        m_mask[ p*ncomp+c ] = 1;
+      }
+  }
+
+  m_inc = tk::Fields( m_node.size(), ncomp );
+  for (std::size_t c=0; c<ncomp; ++c) m_val[c].resize( m_lid[c].size() );
+}
+
+void
+DirichletBC::update( tk::real t,
+                     tk::real dt,
+                     const tk::UnsMesh::Coords& coord )
+// *****************************************************************************
+//  Evaluate boundary condition values for the next time step
+//! \param[in] t Physical time at which to evaluate boundary conditions
+//! \param[in] dt Time step size (for evaluating BC increments in time)
+//! \param[in] coord Mesh node coordinates
+//! \details All PDE systems evaluate the solution increments of their
+//!   components at all nodes at which any BC is set, then the increments are
+//!   gathered to the contiguous per-component arrays returned by Inc().
+// *****************************************************************************
+{
+  using inciter::g_cgpde;
+
+  if (m_node.empty()) return;
+
+  for (const auto& eq : g_cgpde) eq.solinc( t, dt, m_node, coord, m_inc );
+
+  for (std::size_t c=0; c<m_val.size(); ++c) {
+    const auto& idx = m_idx[c];
+    auto& v = m_val[c];
+    for (std::size_t i=0; i<idx.size(); ++i) v[i] = m_inc( idx[i], c, 0 );
+  }
+}
+
 bool
 correctBC( const tk::Fields& a,
            const tk::Fields& dul,
-           const std::unordered_map< std::size_t,
-                   std::vector< std::pair< bool, tk::real > > >& bc,
-           const std::unordered_map< std::size_t, std::size_t >& lid )
+           const DirichletBC& bc )
 // *****************************************************************************
 //  Verify that the change in the solution at those nodes where Dirichlet
 //  boundary conditions are set is exactly the amount the BCs prescribe
 //! \param[in] a Limited antidiffusive element contributions (from FCT)
 //! \param[in] dul Low order solution increment
-//! \param[in] bc Vector of boundary conditions (true/false + BC value) for all
-//!   scalar components integrated associated of all systems to global node ID
-//! \param[in] lid Local node IDs associated to global node IDs
+//! \param[in] bc Dirichlet boundary conditions matched to local nodes
 //! \return True if solution is correct at Dirichlet boundary condition nodes
-//! \details We loop through the map that associates a vector of of boundary
-//!   conditions (true/false, indicating whether the BC is set + BC value if
-//!   true) for all scalar components integrated associated of all systems to
-//!   global node IDs. Then for all scalar components of all systems of systems
-//!   of PDEs integrated if a BC is to be set for a given component, we compute
-//!   the low order solution increment + the anti-diffusive element
+//! \details For all scalar components of all systems of PDEs integrated, we
+//!   loop through the nodes at which a BC is set for the given component and
+//!   compute the low order solution increment + the anti-diffusive element
 //!   contributions (in FCT), which is the current solution increment (to be
 //!   used to update the solution at time n in FCT) at that node. This solution
 //!   increment must equal the BC prescribed at the given node as we solve for
@@ -180,21 +250,17 @@ correctBC( const tk::Fields& a,
 //!   error.
 // *****************************************************************************
 {
-  for (const auto& n : bc) {
-    auto k = lid.find(n.first);
-    if (k!=end(lid)) {
-      auto l = k->second;
-      const auto& b = n.second;
-      Assert( b.size() == dul.nprop(), "Size mismatch" );
-      for (std::size_t c=0; c<b.size(); ++c) {
-        if ( b[c].first &&
-             std::abs( dul(l,c,0) + a(l,c,0) - b[c].second ) >
-               std::numeric_limits< tk::real >::epsilon() )
-        {
-           return false;
-        }
+  Assert( bc.ncomp() == dul.nprop(), "Size mismatch" );
+
+  for (std::size_t c=0; c<bc.ncomp(); ++c) {
+    const auto& l = bc.Lid(c);
+    const auto& v = bc.Inc(c);
+    for (std::size_t i=0; i<l.size(); ++i)
+      if ( std::abs( dul(l[i],c,0) + a(l[i],c,0) - v[i] ) >
+             std::numeric_limits< tk::real >::epsilon() )
+      {
+         return false;
       }
-    }
   }
 
   return true;
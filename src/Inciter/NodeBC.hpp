@@ -20,6 +20,7 @@
 #include "SystemComponents.hpp"
 #include "UnsMesh.hpp"
 #include "Fields.hpp"
+#include "PUPUtil.hpp"
 
 namespace inciter {
 
@@ -33,15 +34,98 @@ match( tk::ctr::ncomp_type ncomp,
        const std::unordered_map< std::size_t, std::size_t >& lid,
        const std::map< int, std::vector< std::size_t > >& sidenodes );
 
+//! Dirichlet boundary conditions matched to mesh nodes
+//! \details User-specified Dirichlet boundary conditions are matched to the
+//!   nodes of side sets once, at construction, and stored as flat lists of
+//!   local node IDs for each scalar component. Only the values, the solution
+//!   increments the BCs prescribe, depend on time, and are evaluated at those
+//!   nodes by update() every time step, so applying the BCs is a loop over
+//!   contiguous arrays instead of a search in a map of global node IDs. Since
+//!   the data refer to local node IDs, it must be regenerated after the mesh
+//!   changes, e.g., after mesh refinement.
+class DirichletBC {
+
+  public:
+    //! Empty constructor for Charm++
+    explicit DirichletBC() :
+      m_node(), m_lid(), m_idx(), m_mask(), m_inc(), m_val() {}
+
+    //! Constructor: match user-specified boundary conditions to nodes
+    explicit
+    DirichletBC( tk::ctr::ncomp_type ncomp,
+                 const tk::UnsMesh::Coords& coord,
+                 const std::vector< std::size_t >& gid,
+                 const std::unordered_map< std::size_t, std::size_t >& lid,
+                 const std::map< int, std::vector< std::size_t > >& sidenodes );
+
+    //! Evaluate boundary condition values for the next time step
+    void update( tk::real t, tk::real dt, const tk::UnsMesh::Coords& coord );
+
+    //! Number of scalar components
+    //! \return Number of scalar components of all PDE systems integrated
+    std::size_t ncomp() const { return m_lid.size(); }
+
+    /** @name Accessors
+      * */
+    ///@{
+    //! Local node IDs at which a BC is set for a scalar component
+    //! \param[in] c Scalar component index
+    //! \return Local node IDs, in increasing order, at which a BC is set for c
+    const std::vector< std::size_t >& Lid( std::size_t c ) const
+    { return m_lid[c]; }
+    //! Solution increments prescribed for a scalar component
+    //! \param[in] c Scalar component index
+    //! \return Increments of component c, from t to t+dt, prescribed at the
+    //!   nodes of Lid(c), in the same order, as evaluated by update()
+    const std::vector< tk::real >& Inc( std::size_t c ) const
+    { return m_val[c]; }
+    //! Flags indicating whether a BC is set at a node for a component
+    //! \return 1 at index p*ncomp()+c if a BC is set at local node p for
+    //!   scalar component c, 0 otherwise
+    const std::vector< char >& Mask() const { return m_mask; }
+    ///@}
+
+    /** @name Charm++ pack/unpack (serialization) routines
+      * */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er &p ) {
+      p | m_node;
+      p | m_lid;
+      p | m_idx;
+      p | m_mask;
+      p | m_inc;
+      p | m_val;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] b DirichletBC object reference
+    friend void operator|( PUP::er& p, DirichletBC& b ) { b.pup(p); }
+    //@}
+
+  private:
+    //! Local node IDs at which a BC is set for any component
+    std::vector< std::size_t > m_node;
+    //! Local node IDs at which a BC is set for each scalar component
+    std::vector< std::vector< std::size_t > > m_lid;
+    //! Indices of the nodes in m_lid into m_node for each scalar component
+    std::vector< std::vector< std::size_t > > m_idx;
+    //! Flags, one per local node and scalar component, see Mask()
+    std::vector< char > m_mask;
+    //! Solution increments of all components at the nodes in m_node
+    tk::Fields m_inc;
+    //! Solution increments at the nodes in m_lid for each scalar component
+    std::vector< std::vector< tk::real > > m_val;
+};
+
 //! \brief Verify that the change in the solution at those nodes where
 //!   Dirichlet boundary conditions are set is exactly the amount the BCs
 //!   prescribe
 bool
 correctBC( const tk::Fields& a,
            const tk::Fields& dul,
-           const std::unordered_map< std::size_t,
-                   std::vector< std::pair< bool, tk::real > > >& bc,
-           const std::unordered_map< std::size_t, std::size_t >& lid );
+           const DirichletBC& bc );
 
 } // inciter::
 
@@ -0,0 +1,76 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/NodeCommMap.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Chare-boundary node communication map using dense local ids
+  \see       NodeCommMap.h for more info.
+*/
+// *****************************************************************************
+
+#include <algorithm>
+
+#include "NodeCommMap.hpp"
+
+using inciter::NodeCommMap;
+
+NodeCommMap::NodeCommMap(
+  const std::unordered_map< int, std::vector< std::size_t > >& msum,
+  const std::unordered_map< std::size_t, std::size_t >& lid )
+  : m_blid(), m_lid(), m_bid()
+// *****************************************************************************
+//  Constructor: assign chare-boundary IDs and message slots
+//! \param[in] msum Global mesh node IDs associated to chare IDs bordering the
+//!   mesh chunk we operate on
+//! \param[in] lid Local mesh node IDs associated to global ones
+// *****************************************************************************
+{
+  // Assign chare-boundary IDs in order of increasing global node ID
+  std::vector< std::size_t > gid;
+  for (const auto& n : msum)
+    gid.insert( end(gid), begin(n.second), end(n.second) );
+  tk::unique( gid );
+
+  m_blid.resize( gid.size() );
+  for (std::size_t b=0; b<gid.size(); ++b)
+    m_blid[b] = tk::cref_find( lid, gid[b] );
+
+  // Assign message slots of nodes shared with each neighbor chare in order of
+  // increasing global node ID, which the neighbor assigns the same way
+  for (const auto& n : msum) {
+    auto g = n.second;
+    std::sort( begin(g), end(g) );
+    auto& l = m_lid[ n.first ];
+    auto& b = m_bid[ n.first ];
+    l.resize( g.size() );
+    b.resize( g.size() );
+    for (std::size_t j=0; j<g.size(); ++j) {
+      l[j] = tk::cref_find( lid, g[j] );
+      b[j] = static_cast< std::size_t >(
+               std::lower_bound( begin(gid), end(gid), g[j] ) - begin(gid) );
+    }
+  }
+}
+
+std::vector< tk::real >
+NodeCommMap::gather( int c, const tk::Fields& f ) const
+// *****************************************************************************
+//  Gather values at nodes shared with a neighbor chare for sending
+//! \param[in] c Neighbor chare ID
+//! \param[in] f Nodal field to gather values of all components from
+//! \return Values of all components of f at the nodes shared with chare c, in
+//!   slot order, components running fastest
+// *****************************************************************************
+{
+  const auto& l = tk::cref_find( m_lid, c );
+  const auto nprop = f.nprop();
+
+  std::vector< tk::real > v( l.size() * nprop );
+  for (std::size_t j=0; j<l.size(); ++j)
+    for (std::size_t i=0; i<nprop; ++i)
+      v[ j*nprop+i ] = f( l[j], i, 0 );
+
+  return v;
+}
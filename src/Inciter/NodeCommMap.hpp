@@ -0,0 +1,105 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/NodeCommMap.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Chare-boundary node communication map using dense local ids
+  \details   Chare-boundary node communication map using dense local ids. The
+    map is built once from the node communication map (msum), associating
+    global mesh node IDs to neighbor chare IDs, and the global->local node ID
+    map of a chare. Each node shared with other chares is assigned a dense
+    chare-boundary ID, and each node shared with a given neighbor chare a fixed
+    slot in the messages exchanged with that neighbor. The slots of the nodes
+    shared by two chares are in order of increasing global node ID, so both
+    sides agree on the order without sending node IDs. Sending partial sums at
+    chare-boundary nodes then gathers from a list of local node IDs and
+    receiving them adds to a dense receive buffer indexed by chare-boundary IDs,
+    neither requiring hashing of global node IDs.
+*/
+// *****************************************************************************
+#ifndef NodeCommMap_h
+#define NodeCommMap_h
+
+#include <vector>
+#include <unordered_map>
+
+#include "Types.hpp"
+#include "Fields.hpp"
+#include "PUPUtil.hpp"
+#include "ContainerUtil.hpp"
+
+namespace inciter {
+
+//! Chare-boundary node communication map using dense local ids
+class NodeCommMap {
+
+  public:
+    //! Empty constructor for Charm++
+    explicit NodeCommMap() : m_blid(), m_lid(), m_bid() {}
+
+    //! Constructor: assign chare-boundary IDs and message slots
+    explicit
+    NodeCommMap(
+      const std::unordered_map< int, std::vector< std::size_t > >& msum,
+      const std::unordered_map< std::size_t, std::size_t >& lid );
+
+    //! Number of chare-boundary nodes
+    //! \return Number of nodes shared with other chares
+    std::size_t size() const { return m_blid.size(); }
+
+    //! Query if there are no chare-boundary nodes
+    //! \return True if no nodes are shared with other chares
+    bool empty() const { return m_lid.empty(); }
+
+    //! Number of neighbor chares
+    //! \return Number of chares sharing nodes with this chare
+    std::size_t nchare() const { return m_lid.size(); }
+
+    /** @name Accessors
+      * */
+    ///@{
+    //! Local node IDs of chare-boundary nodes indexed by chare-boundary IDs
+    const std::vector< std::size_t >& Blid() const { return m_blid; }
+    //! Local node IDs of nodes shared with neighbor chares in slot order
+    const std::unordered_map< int, std::vector< std::size_t > >& Lid() const
+    { return m_lid; }
+    //! Chare-boundary IDs of nodes shared with a neighbor chare in slot order
+    //! \param[in] c Neighbor chare ID
+    //! \return Chare-boundary IDs of the nodes shared with chare c
+    const std::vector< std::size_t >& Bid( int c ) const
+    { return tk::cref_find( m_bid, c ); }
+    ///@}
+
+    //! Gather values at nodes shared with a neighbor chare for sending
+    std::vector< tk::real > gather( int c, const tk::Fields& f ) const;
+
+    /** @name Charm++ pack/unpack (serialization) routines
+      * */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er &p ) {
+      p | m_blid;
+      p | m_lid;
+      p | m_bid;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] m NodeCommMap object reference
+    friend void operator|( PUP::er& p, NodeCommMap& m ) { m.pup(p); }
+    //@}
+
+  private:
+    //! Local node IDs of chare-boundary nodes indexed by chare-boundary IDs
+    std::vector< std::size_t > m_blid;
+    //! Local node IDs of nodes shared with neighbor chares in slot order
+    std::unordered_map< int, std::vector< std::size_t > > m_lid;
+    //! Chare-boundary IDs of nodes shared with neighbor chares in slot order
+    std::unordered_map< int, std::vector< std::size_t > > m_bid;
+};
+
+} // inciter::
+
+#endif // NodeCommMap_h
@@ -69,19 +69,15 @@ NodeDiagnostics::compute( Discretization& d, const tk::Fields& u ) const
 
   if ( !((d.It()+1) % diagfreq) ) {     // if remainder, don't dump
 
-    // Store the local IDs of those mesh nodes to which we contribute but do not
-    // own, i.e., slave nodes. Ownership here is defined by having a lower chare
-    // ID than any other chare that also contributes to the node.
-
-    // Slave mesh node local IDs. Local IDs of those mesh nodes to which we
-    // contribute to but do not own. Ownership here is defined by having a lower
-    // chare ID than any other chare that also contributes to the node.
-    std::unordered_set< std::size_t > slave;
+    // Flag those mesh nodes to which we contribute but do not own, i.e., slave
+    // nodes. Ownership here is defined by having a lower chare ID than any
+    // other chare that also contributes to the node.
+    std::vector< char > slave( u.nunk(), 0 );
 
     for (const auto& c : d.Msum())      // for all chares that neighbor our mesh
       if (d.thisIndex > c.first)        // if our chare ID is larger than theirs
-        for (auto i : c.second)         // store local ID in set
-          slave.insert( tk::cref_find( d.Lid(), i ) );
+        for (auto i : c.second)         // flag local ID
+          slave[ tk::cref_find( d.Lid(), i ) ] = 1;
 
     // Diagnostics vector (of vectors) during aggregation. See
     // Inciter/Diagnostics.h.
@@ -92,32 +88,35 @@ NodeDiagnostics::compute( Discretization& d, const tk::Fields& u ) const
     const auto& x = coord[0];
     const auto& y = coord[1];
     const auto& z = coord[2];
+    const auto& vol = d.Vol();
+
+    // Analytic solution of all components of all PDEs at a node
+    std::vector< tk::real > a;
+    a.reserve( u.nprop() );
 
     // Put in norms sweeping our mesh chunk
     for (std::size_t i=0; i<u.nunk(); ++i)
-      if (slave.find(i) == end(slave)) {    // ignore non-owned nodes
-
-        // Compute sum for L2 norm of the numerical solution
-        for (std::size_t c=0; c<u.nprop(); ++c)
-          diag[L2SOL][c] += u(i,c,0) * u(i,c,0) * d.Vol()[i];
+      if (!slave[i]) {    // ignore non-owned nodes
 
         // Query and collect analytic solution for all components of all PDEs
         // integrated at cell centroids
-        std::vector< tk::real > a;
+        a.clear();
         for (const auto& eq : g_cgpde) {
           auto s = eq.analyticSolution( x[i], y[i], z[i], d.T()+d.Dt() );
           std::move( begin(s), end(s), std::back_inserter(a) );
         }
         Assert( a.size() == u.nprop(), "Size mismatch" );
 
-        // Compute sum for L2 norm of the numerical-analytic solution
-        for (std::size_t c=0; c<u.nprop(); ++c)
-          diag[L2ERR][c] +=
-            (u(i,c,0)-a[c]) * (u(i,c,0)-a[c]) * d.Vol()[i];
-        // Compute max for Linf norm of the numerical-analytic solution
+        // Compute sums for L2 norms of the numerical and the
+        // numerical-analytic solution and max for Linf norm of the
+        // numerical-analytic solution in a single pass over the components
         for (std::size_t c=0; c<u.nprop(); ++c) {
-          auto err = std::abs( u(i,c,0) - a[c] );
-          if (err > diag[LINFERR][c]) diag[LINFERR][c] = err;
+          const auto v = u(i,c,0);
+          const auto err = v - a[c];
+          diag[L2SOL][c] += v * v * vol[i];
+          diag[L2ERR][c] += err * err * vol[i];
+          if (std::abs(err) > diag[LINFERR][c])
+            diag[LINFERR][c] = std::abs(err);
         }
 
       }
@@ -65,6 +65,28 @@ void PUP::pup( PUP::er &p, AMR::edge_t& e )
   p | e.get_data();
 }
 
+void PUP::pup( PUP::er &p, AMR::id_set_t& s )
+// *****************************************************************************
+//  Pack/Unpack id_set_t
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in,out] s id_set_t object reference
+//! \details The ids in the set are packed, instead of the bits, in ascending
+//!   order.
+// *****************************************************************************
+{
+  auto size = PUP_stl_container_size( p, s );
+  if (p.isUnpacking()) {
+    s.clear();
+    for (decltype(size) i=0; i<size; ++i) {
+      std::size_t id;
+      p | id;
+      s.insert( id );
+    }
+  } else {
+    for (auto id : s) p | id;
+  }
+}
+
 void PUP::pup( PUP::er &p, AMR::active_element_store_t& a )
 // *****************************************************************************
 //  Pack/Unpack active_element_store_t
@@ -94,6 +116,7 @@ void PUP::pup( PUP::er &p, AMR::id_generator_t& i )
 {
   p | i.start_id;
   p | i.next_tet_id;
+  p | i.free_ids;
 }
 
 void PUP::pup( PUP::er &p, AMR::tet_store_t& t )
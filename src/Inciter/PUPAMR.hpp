@@ -17,6 +17,9 @@
 
 #include "AMR/edge_store.hpp"
 #include "AMR/edge.hpp"
+#include "AMR/id_set.hpp"
+#include "AMR/id_map.hpp"
+#include "AMR/edge_table.hpp"
 #include "AMR/marked_refinements_store.hpp"
 #include "AMR/tet_store.hpp"
 #include "AMR/mesh_adapter.hpp"
@@ -69,6 +72,69 @@ void pup( PUP::er &p, AMR::edge_t& e );
 inline void operator|( PUP::er& p, AMR::edge_t& e ) { pup(p,e); }
 //@}
 
+/** @name Charm++ pack/unpack serializer member functions for id_set_t */
+///@{
+//! Pack/Unpack id_set_t
+void pup( PUP::er &p, AMR::id_set_t& s );
+//! Pack/Unpack serialize operator|
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \param[in,out] s id_set_t object reference
+inline void operator|( PUP::er& p, AMR::id_set_t& s ) { pup(p,s); }
+//@}
+
+/** @name Charm++ pack/unpack serializer member functions for id_map_t */
+///@{
+//! Pack/Unpack id_map_t
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in,out] m id_map_t object reference
+template< class T >
+void pup( PUP::er &p, AMR::id_map_t< T >& m ) {
+  auto size = PUP_stl_container_size( p, m );
+  if (p.isUnpacking()) {
+    m.clear();
+    for (decltype(size) s=0; s<size; ++s) {
+      typename AMR::id_map_t< T >::value_type node;
+      p | node;
+      m.insert( node );
+    }
+  } else {
+    for (auto& t : m) p | t;
+  }
+}
+//! Pack/Unpack serialize operator|
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \param[in,out] m id_map_t object reference
+template< class T >
+inline void operator|( PUP::er& p, AMR::id_map_t< T >& m ) { pup(p,m); }
+//@}
+
+/** @name Charm++ pack/unpack serializer member functions for edge_table_t */
+///@{
+//! Pack/Unpack edge_table_t
+//! \param[in] p Charm++'s pack/unpack object
+//! \param[in,out] t edge_table_t object reference
+template< class T >
+void pup( PUP::er &p, AMR::edge_table_t< T >& t ) {
+  auto size = PUP_stl_container_size( p, t );
+  if (p.isUnpacking()) {
+    t.clear();
+    t.reserve( size );
+    for (decltype(size) s=0; s<size; ++s) {
+      typename AMR::edge_table_t< T >::value_type node;
+      p | node;
+      t.insert( node );
+    }
+  } else {
+    for (auto& e : t) p | e;
+  }
+}
+//! Pack/Unpack serialize operator|
+//! \param[in,out] p Charm++'s PUP::er serializer object reference
+//! \param[in,out] t edge_table_t object reference
+template< class T >
+inline void operator|( PUP::er& p, AMR::edge_table_t< T >& t ) { pup(p,t); }
+//@}
+
 /** @name Charm++ pack/unpack serializer member functions for marked_refinements_store_t */
 ///@{
 //! Pack/Unpack marked_refinements_store_t
@@ -521,12 +521,17 @@ Partitioner::distribute( std::unordered_map< int, MeshData >&& mesh )
         std::unordered_map< int, std::vector< std::size_t > >
       > > > exp;
 
-  for (const auto& c : mesh)
+  // The mesh data is moved into the export map, not copied, as it is not
+  // needed here after it is sent.
+  for (auto& c : mesh) {
+    auto cm = coordmap( std::get<0>(c.second) );
     exp[ node(c.first) ][ c.first ] =
-      std::make_tuple( std::get<0>(c.second),
-                       coordmap(std::get<0>(c.second)),
-                       std::get<1>(c.second),
-                       std::get<2>(c.second) );
+      std::make_tuple( std::move( std::get<0>(c.second) ),
+                       std::move( cm ),
+                       std::move( std::get<1>(c.second) ),
+                       std::move( std::get<2>(c.second) ) );
+  }
+  tk::destroy( mesh );
 
   // Export chare IDs and mesh we do not own to fellow compute nodes
   if (exp.empty()) {
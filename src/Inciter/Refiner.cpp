@@ -24,6 +24,7 @@
 #include "UnsMesh.hpp"
 #include "Centering.hpp"
 #include "Around.hpp"
+#include "Gradients.hpp"
 #include "Sorter.hpp"
 #include "HashMapReducer.hpp"
 #include "Discretization.hpp"
@@ -77,10 +78,8 @@ Refiner::Refiner( const CProxy_Transporter& transporter,
   m_remoteEdgeData(),
   m_bndEdges(),
   m_msumset(),
-  m_oldTets(),
   m_addedNodes(),
   m_addedTets(),
-  m_oldntets( 0 ),
   m_coarseBndFaces(),
   m_coarseBndNodes(),
   m_rid( ginpoel.size() ),
@@ -625,19 +624,15 @@ Refiner::refinementFields() const
   Assert( u.nunk() == npoin, "Solution uninitialized or wrong size" );
 
   // Compute error in edges on current mesh
-  auto edgeError = errorsInEdges( npoin, esup, u );
+  auto inpoed = tk::genInpoed( m_inpoel, 4, esup );
+  auto edgeError = errorsInEdges( inpoed, u );
 
   // Transfer error from edges to cells for field output
+  auto inedel = tk::genInedel( m_inpoel, 4, inpoed );
   std::vector< tk::real > error( m_inpoel.size()/4, 0.0 );
   for (std::size_t e=0; e<m_inpoel.size()/4; ++e) {
-    auto A = m_inpoel[e*4+0];
-    auto B = m_inpoel[e*4+1];
-    auto C = m_inpoel[e*4+2];
-    auto D = m_inpoel[e*4+3];
-    std::array<Edge,6> edges{{ {{A,B}}, {{B,C}}, {{A,C}},
-                               {{A,D}}, {{B,D}}, {{C,D}} }};
     // sum error from edges to elements
-    for (const auto& ed : edges) error[e] += tk::cref_find( edgeError, ed );
+    for (std::size_t i=0; i<6; ++i) error[e] += edgeError[ inedel[e*6+i] ];
     error[e] /= 6.0;    // assign edge-average error to element
   }
 
@@ -744,12 +739,6 @@ Refiner::perform()
 //!   (Discretization).
 // *****************************************************************************
 {
-  // Save old tets and their ids before performing refinement
-  m_oldntets = m_oldTets.size();
-  m_oldTets.clear();
-  for (const auto& t : m_refiner.tet_store.tets)
-    m_oldTets.insert( t.second );
-
   //auto& tet_store = m_refiner.tet_store;
   //std::cout << "before ref: " << tet_store.marked_refinements.size() << ", " << tet_store.marked_derefinements.size() << ", " << tet_store.size() << ", " << tet_store.get_active_inpoel().size() << '\n';
   m_refiner.perform_refinement();
@@ -874,18 +863,19 @@ Refiner::uniformDeRefine()
   m_extra = 0;
 }
 
-Refiner::EdgeError
-Refiner::errorsInEdges(
-  std::size_t npoin,
-  const std::pair< std::vector<std::size_t>, std::vector<std::size_t> >& esup,
-  const tk::Fields& u ) const
+std::vector< tk::real >
+Refiner::errorsInEdges( const std::vector< std::size_t >& inpoed,
+                        const tk::Fields& u ) const
 // *****************************************************************************
 //  Compute errors in edges
-//! \param[in] npoint Number nodes in current mesh (partition)
-//! \param[in] esup Elements surrounding points linked vectors
+//! \param[in] inpoed Edge connectivity of the current mesh (partition), see
+//!   tk::genInpoed()
 //! \param[in] u Solution evaluated at mesh nodes for all scalar components
-//! \return A map associating errors (real values between 0.0 and 1.0 incusive)
-//!   to edges (2 local node IDs)
+//! \return Errors (real values between 0.0 and 1.0 inclusive) in all unique
+//!   edges, in the order of the edges in inpoed
+//! \details The gradients of all refinement variables, required by the
+//!   Hessian-based error indicator, are computed at all nodes in a single
+//!   pass over the elements, then the error in each edge is evaluated once.
 // *****************************************************************************
 {
   // Get the indices (in the system of systems) of refinement variables and the
@@ -893,23 +883,23 @@ Refiner::errorsInEdges(
   const auto& refidx = g_inputdeck.get< tag::amr, tag::id >();
   auto errtype = g_inputdeck.get< tag::amr, tag::error >();
 
-  // Compute points surrounding points
-  auto psup = tk::genPsup( m_inpoel, 4, esup );
+  // Compute gradients of refinement variables at mesh nodes if needed
+  tk::Fields grad;
+  if (errtype == ctr::AMRErrorType::HESSIAN)
+    grad = tk::nodegrads( m_coord, m_inpoel, u, refidx );
 
   // Compute errors in ICs and define refinement criteria for edges
   AMR::Error error;
-  EdgeError edgeError;
-
-  for (std::size_t p=0; p<npoin; ++p) { // for all mesh nodes on this chare
-    for (auto q : tk::Around(psup,p)) { // for all nodes surrounding p
-      tk::real cmax = 0.0;
-      AMR::edge_t e(p,q);
-      for (auto i : refidx) {          // for all refinement variables
-        auto c = error.scalar( u, e, i, m_coord, m_inpoel, esup, errtype );
-        if (c > cmax) cmax = c;        // find max error at edge
-      }
-      edgeError[ {{p,q}} ] = cmax;       // associate error to edge
+  std::vector< tk::real > edgeError( inpoed.size()/2, 0.0 );
+
+  for (std::size_t e=0; e<edgeError.size(); ++e) { // for all edges on chare
+    tk::real cmax = 0.0;
+    AMR::edge_t ed( inpoed[e*2], inpoed[e*2+1] );
+    for (std::size_t i=0; i<refidx.size(); ++i) { // for all refinement vars
+      auto c = error.scalar( u, ed, refidx[i], m_coord, grad, i, errtype );
+      if (c > cmax) cmax = c;        // find max error at edge
     }
+    edgeError[e] = cmax;             // associate error to edge
   }
 
   return edgeError;
@@ -977,14 +967,15 @@ Refiner::errorRefine()
   // derefinement tolerance.
   auto tolref = g_inputdeck.get< tag::amr, tag::tolref >();
   auto tolderef = g_inputdeck.get< tag::amr, tag::tolderef >();
+  auto inpoed = tk::genInpoed( m_inpoel, 4, esup );
+  auto edgeError = errorsInEdges( inpoed, u );
   std::vector< std::pair< edge_t, edge_tag > > tagged_edges;
-  for (const auto& e : errorsInEdges(npoin,esup,u)) {
-    if (e.second > tolref) {
-      tagged_edges.push_back( { edge_t( m_rid[e.first[0]], m_rid[e.first[1]] ),
-                                edge_tag::REFINE } );
-    } else if (e.second < tolderef) {
-      tagged_edges.push_back( { edge_t( m_rid[e.first[0]], m_rid[e.first[1]] ),
-                                edge_tag::DEREFINE } );
+  for (std::size_t e=0; e<edgeError.size(); ++e) {
+    edge_t ed( m_rid[ inpoed[e*2] ], m_rid[ inpoed[e*2+1] ] );
+    if (edgeError[e] > tolref) {
+      tagged_edges.push_back( { ed, edge_tag::REFINE } );
+    } else if (edgeError[e] < tolderef) {
+      tagged_edges.push_back( { ed, edge_tag::DEREFINE } );
     }
   }
 
@@ -1439,11 +1430,8 @@ Refiner::boundary()
     }
   }
 
-  // Generate child->parent tet and id maps after refinement/derefinement step
+  // Generate child->parent tet map after refinement/derefinement step
   decltype(m_parent) parent;
-  m_addedTets.clear();
-  std::size_t p = 0;
-  std::size_t c = 0;
   const auto& tet_store = m_refiner.tet_store;
   for (const auto& t : tet_store.tets) {
     // query number of children of tet
@@ -1452,25 +1440,63 @@ Refiner::boundary()
       // get child tet id
       auto childtet = tet_store.get_child_id( t.first, i );
       auto ct = tet_store.tets.find( childtet );
-      //auto cA = tk::cref_find( m_lref, ct->second[0] );
-      //auto cB = tk::cref_find( m_lref, ct->second[1] );
-      //auto cC = tk::cref_find( m_lref, ct->second[2] );
-      //auto cD = tk::cref_find( m_lref, ct->second[3] );
-      // get nodes of parent tet
-      //auto pA = tk::cref_find( m_lref, t.second[0] );
-      //auto pB = tk::cref_find( m_lref, t.second[1] );
-      //auto pC = tk::cref_find( m_lref, t.second[2] );
-      //auto pD = tk::cref_find( m_lref, t.second[3] );
       // assign parent tet to child tet
-      //parent[ {{cA,cB,cC,cD}} ] = {{pA,pB,pC,pD}};
-      parent[ ct->second ] = t.second; //{{pA,pB,pC,pD}};
-      if (m_oldTets.find(ct->second) == end(m_oldTets)) {
-        m_addedTets[ c++ ] = p - m_oldntets;
-      }
+      parent[ ct->second ] = t.second;
+    }
+  }
+
+  // Generate map associating tets of the old mesh to their (local) ids
+  std::unordered_map< Tet, std::size_t, Hash<4>, Eq<4> > oldid;
+  for (std::size_t e=0; e<m_inpoel.size()/4; ++e) {
+    auto m = e*4;
+    oldid[ {{ m_oldrid[ m_inpoel[m+0] ], m_oldrid[ m_inpoel[m+1] ],
+              m_oldrid[ m_inpoel[m+2] ], m_oldrid[ m_inpoel[m+3] ] }} ] = e;
+  }
+
+  // Generate map associating parents (of the previous step) whose children
+  // were in the old mesh to the smallest (local) id of those children
+  std::unordered_map< Tet, std::size_t, Hash<4>, Eq<4> > derefid;
+  for (const auto& c : m_parent) {
+    auto o = oldid.find( c.first );
+    if (o != end(oldid)) {
+      auto d = derefid.find( c.second );
+      if (d == end(derefid))
+        derefid[ c.second ] = o->second;
+      else
+        d->second = std::min( d->second, o->second );
+    }
+  }
+
+  // Find the id of the old-mesh cell a tet inherits its solution from: the
+  // tet itself if kept or one of its children if derefined. Returns false if
+  // there is no such cell, e.g., for added tets, found via their parent below.
+  auto source = [&]( const Tet& t, std::size_t& id ) {
+    auto o = oldid.find( t );
+    if (o != end(oldid)) { id = o->second; return true; }
+    auto d = derefid.find( t );
+    if (d != end(derefid)) { id = d->second; return true; }
+    return false;
+  };
+
+  // Associate cells of the new mesh to the cell of the old mesh they inherit
+  // their solution from if their id changed. New cell ids are assigned in the
+  // order of the tet store's active tets, the order of get_active_inpoel(),
+  // which, since tet ids are recycled, need not keep old cells in their
+  // original order nor put added cells after old ones.
+  m_addedTets.clear();
+  std::size_t e = 0;
+  for (const auto& t : tet_store.tets) {
+    if (!tet_store.is_active( t.first )) continue;
+    std::size_t id = 0;
+    bool found = source( t.second, id );
+    if (!found) {
+      auto p = parent.find( t.second );
+      if (p != end(parent)) found = source( p->second, id );
     }
-    ++p;
+    if (found && id != e) m_addedTets[ e ] = id;
+    ++e;
   }
-  m_parent = std::move( parent ); 
+  m_parent = std::move( parent );
 
   //std::cout << thisIndex << " added: " << m_addedTets.size() << '\n';
   //std::cout << thisIndex << " parent: " << m_parent.size() << '\n';
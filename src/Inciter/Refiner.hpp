@@ -151,10 +151,8 @@ class Refiner : public CBase_Refiner {
       p | m_intermediates;
       p | m_bndEdges;
       p | m_msumset;
-      p | m_oldTets;
       p | m_addedNodes;
       p | m_addedTets;
-      p | m_oldntets;
       p | m_coarseBndFaces;
       p | m_coarseBndNodes;
       p | m_rid;
@@ -186,9 +184,6 @@ class Refiner : public CBase_Refiner {
       std::unordered_map< int, FaceSet >
     >;
 
-    //! Used to associate error to edges
-    using EdgeError = std::unordered_map< Edge, tk::real, Hash<2>, Eq<2> >;
-
     //! Host proxy
     CProxy_Transporter m_host;
     //! Mesh sorter proxy
@@ -258,14 +253,14 @@ class Refiner : public CBase_Refiner {
     //!   points. This is the same data as in Discretization::m_msum, but the
     //!   nodelist is stored as a hash-set for faster searches.
     std::unordered_map< int, std::unordered_set< std::size_t > > m_msumset;
-    //! Tetrahedra before refinement/derefinement step
-    TetSet m_oldTets;
     //! Newly added mesh nodes (local id) and their parents (local ids)
     std::unordered_map< std::size_t, tk::UnsMesh::Edge > m_addedNodes;
-    //! Newly added mesh cells (local id) and their parent (local id)
+    //! \brief Mesh cells (local id) whose id changed in the last
+    //!   refinement/derefinement step and the cell of the old mesh (local id)
+    //!   they inherit their solution from
+    //! \details Added cells inherit from their parent, derefined parents from
+    //!   one of their children, and kept cells from themselves.
     std::unordered_map< std::size_t, std::size_t > m_addedTets;
-    //! Number of tetrahedra in the mesh before refinement/derefinement step
-    std::size_t m_oldntets;
     //! A unique set of faces associated to side sets of the coarsest mesh
     std::unordered_map< int, tk::UnsMesh::FaceSet > m_coarseBndFaces;
     //! A unique set of nodes associated to side sets of the coarsest mesh
@@ -306,10 +301,8 @@ class Refiner : public CBase_Refiner {
     void errorRefine();
 
     //! Compute errors in edges
-    EdgeError
-    errorsInEdges( std::size_t npoin,
-                   const std::pair< std::vector< std::size_t >,
-                                    std::vector< std::size_t > >& esup,
+    std::vector< tk::real >
+    errorsInEdges( const std::vector< std::size_t >& inpoed,
                    const tk::Fields& u ) const;
 
     //! Update (or evaluate) solution on current mesh
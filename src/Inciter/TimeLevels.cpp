@@ -0,0 +1,44 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/TimeLevels.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Time step levels of elements for local time stepping in DG
+  \see       TimeLevels.h for more info.
+*/
+// *****************************************************************************
+
+#include "TimeLevels.hpp"
+#include "Exception.hpp"
+
+using inciter::TimeLevels;
+
+void
+TimeLevels::next( const std::vector< tk::real >& eldt, tk::real mindt )
+// *****************************************************************************
+//  Assign levels of owned elements for the next time step
+//! \param[in] eldt Allowable time step size of each element, owned elements
+//!   first
+//! \param[in] mindt Smallest allowable time step size across the whole mesh
+//! \details Each element is assigned the largest level, l, not larger than the
+//!   largest level configured, for which 2^l mindt does not exceed its
+//!   allowable time step size. Since the levels are assigned from the state
+//!   at the start of a time step but are only used from the next one, the
+//!   time step size is then computed from the levels in use, see DG::dt(),
+//!   so that no element exceeds its allowable time step size.
+// *****************************************************************************
+{
+  if (empty()) return;
+
+  Assert( eldt.size() >= m_next.size(), "Size mismatch" );
+
+  for (std::size_t e=0; e<m_next.size(); ++e) {
+    std::size_t l = 0;
+    while (l < m_maxlevel &&
+           static_cast< tk::real >( std::size_t(2) << l ) * mindt <= eldt[e])
+      ++l;
+    m_next[e] = std::size_t(1) << l;
+  }
+}
@@ -0,0 +1,186 @@
+// *****************************************************************************
+/*!
+  \file      src/Inciter/TimeLevels.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Time step levels of elements for local time stepping in DG
+  \details   Time step levels of elements for local time stepping in DG. Each
+    element is assigned a level, l, from its own allowable time step size, so
+    that it advances with a time step of 2^l times the smallest one, dt0. A
+    time step of the mesh then consists of 2^L substeps of size dt0, where L
+    is the largest level configured, each substep consisting of all stages of
+    the Runge-Kutta scheme. An element of level l is active in those substeps,
+    k, for which k is a multiple of 2^l, i.e., when it starts its own time
+    step, and then it advances by 2^l dt0.
+
+    A face is integrated at the rate of its finer element, i.e., it is active
+    if its element with the smaller stride, 2^l, is active. The contributions
+    of the face to both of its elements are scaled by the ratio of the stride
+    of the face and that of the element, so that the flux across the face is
+    integrated with the same time step size, and as many times, on both of
+    its sides, which makes the scheme conservative. Volume and source terms are
+    integrated at the rate of the element.
+*/
+// *****************************************************************************
+#ifndef TimeLevels_h
+#define TimeLevels_h
+
+#include <array>
+#include <vector>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "PUPUtil.hpp"
+
+namespace inciter {
+
+//! Time step levels of elements for local time stepping in DG
+class TimeLevels {
+
+  public:
+    //! Empty constructor for Charm++, and disabling local time stepping
+    explicit TimeLevels() :
+      m_maxlevel( 0 ), m_substep( 0 ), m_stride(), m_next() {}
+
+    //! Constructor: start with all elements on the finest level
+    //! \param[in] maxlevel Largest time step level, 0 disables local time
+    //!   stepping
+    //! \param[in] nelem Number of elements owned
+    //! \param[in] nunk Number of elements, including ghost elements
+    explicit TimeLevels( std::size_t maxlevel,
+                         std::size_t nelem,
+                         std::size_t nunk ) :
+      m_maxlevel( maxlevel ),
+      m_substep( 0 ),
+      m_stride( maxlevel ? nunk : 0, 1 ),
+      m_next( maxlevel ? nelem : 0, 1 ) {}
+
+    //! Query if local time stepping is disabled
+    //! \return True if all elements advance with the same time step size
+    bool empty() const { return m_stride.empty(); }
+
+    //! Number of substeps of a time step
+    //! \return Number of substeps, with the smallest time step size, of a time
+    //!   step of the mesh
+    std::size_t nsubstep() const { return std::size_t(1) << m_maxlevel; }
+
+    //! Current substep
+    //! \return Index of the current substep of the time step
+    std::size_t Substep() const { return m_substep; }
+
+    //! Query if the current substep is the last one of the time step
+    //! \return True if the current substep is the last one
+    bool last() const { return m_substep+1 == nsubstep(); }
+
+    //! Advance to the next substep
+    //! \return True if the time step has more substeps, false if the time step
+    //!   is complete
+    bool advance() { return ++m_substep < nsubstep(); }
+
+    //! Start a new time step with the levels assigned for it by next()
+    void start() {
+      m_substep = 0;
+      std::copy( begin(m_next), end(m_next), begin(m_stride) );
+    }
+
+    //! Resize after the mesh or its ghost elements changed, all elements
+    //!   starting on the finest level
+    //! \param[in] nelem Number of elements owned
+    //! \param[in] nunk Number of elements, including ghost elements
+    void resize( std::size_t nelem, std::size_t nunk ) {
+      if (m_maxlevel == 0) return;
+      m_stride.assign( nunk, 1 );
+      m_next.assign( nelem, 1 );
+    }
+
+    //! Time step size of an element in units of the smallest time step size
+    //! \param[in] e Element id
+    //! \return Stride of element e, 2^l, with l its level
+    std::size_t stride( std::size_t e ) const
+    { return m_stride.empty() ? 1 : m_stride[e]; }
+
+    //! Set stride of a ghost element as received from its owner
+    //! \param[in] e Ghost element id
+    //! \param[in] s Stride of ghost element e
+    void ghost( std::size_t e, std::size_t s ) { m_stride[e] = s; }
+
+    //! Strides of owned elements assigned for the next time step
+    //! \return Strides assigned by next() and used from the next time step
+    const std::vector< std::size_t >& Next() const { return m_next; }
+
+    //! Query if an element is active in the current substep
+    //! \param[in] e Element id
+    //! \return True if element e starts its own time step in this substep
+    bool active( std::size_t e ) const
+    { return m_stride.empty() || m_substep % m_stride[e] == 0; }
+
+    //! Query if a face is active in the current substep
+    //! \param[in] el Left element id of the face
+    //! \param[in] er Right element id of the face
+    //! \return True if the finer element of the face is active
+    bool active( std::size_t el, std::size_t er ) const
+    { return active( stride(el) < stride(er) ? el : er ); }
+
+    //! Weights of the contributions of a face to its elements
+    //! \param[in] el Left element id of the face
+    //! \param[in] er Right element id of the face
+    //! \return Ratios of the stride of the face to those of its left and right
+    //!   elements
+    std::array< tk::real, 2 > weight( std::size_t el, std::size_t er ) const {
+      if (m_stride.empty()) return {{ 1.0, 1.0 }};
+      auto s =
+        static_cast< tk::real >( std::min( m_stride[el], m_stride[er] ) );
+      return {{ s / static_cast< tk::real >( m_stride[el] ),
+                s / static_cast< tk::real >( m_stride[er] ) }};
+    }
+
+    //! Query if the solution of an element changes in the current substep
+    //! \param[in] e Element id
+    //! \param[in] esuel Elements surrounding elements
+    //! \return True if element e or any of its face-neighbors is active
+    bool touched( std::size_t e, const std::vector< int >& esuel ) const {
+      if (active(e)) return true;
+      if (4*e >= esuel.size()) return false;
+      for (std::size_t f=0; f<4; ++f) {
+        auto n = esuel[4*e+f];
+        if (n > -1 && active( static_cast< std::size_t >(n) )) return true;
+      }
+      return false;
+    }
+
+    //! Assign levels of owned elements for the next time step
+    void next( const std::vector< tk::real >& eldt, tk::real mindt );
+
+    /** @name Charm++ pack/unpack (serialization) routines
+      * */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er &p ) {
+      p | m_maxlevel;
+      p | m_substep;
+      p | m_stride;
+      p | m_next;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] t TimeLevels object reference
+    friend void operator|( PUP::er& p, TimeLevels& t ) { t.pup(p); }
+    //@}
+
+  private:
+    //! Largest time step level, 0: local time stepping disabled
+    std::size_t m_maxlevel;
+    //! Current substep of the time step
+    std::size_t m_substep;
+    //! Strides, 2^level, of all elements, including ghosts
+    std::vector< std::size_t > m_stride;
+    //! Strides of owned elements assigned for the next time step
+    std::vector< std::size_t > m_next;
+};
+
+} // inciter::
+
+#endif // TimeLevels_h
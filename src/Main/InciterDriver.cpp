@@ -62,6 +62,16 @@ InciterDriver::InciterDriver( const InciterPrint& print,
   print.item( "Checkpoint/restart frequency, -" + *kw::rsfreq::alias(),
                std::to_string(cmdline.get< tag::rsfreq >()) );
 
+  auto threads = cmdline.get< tag::threads >();
+  if ( threads < kw::threads::info::expect::lower ||
+       threads > kw::threads::info::expect::upper ) {
+    Throw( "Number of threads should be between " +
+           std::to_string( kw::threads::info::expect::lower ) + " and " +
+           std::to_string( kw::threads::info::expect::upper ) + "." );
+  }
+  print.item( "Number of threads per PE, -" + *kw::threads::alias(),
+               std::to_string(cmdline.get< tag::threads >()) );
+
   // Parse input deck into g_inputdeck
   m_print.item( "Control file", cmdline.get< tag::io, tag::control >() );
   g_inputdeck = g_inputdeck_defaults;   // overwrite with defaults if restarted
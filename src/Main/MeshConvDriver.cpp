@@ -27,6 +27,8 @@ MeshConvDriver::MeshConvDriver( const tk::Print& print,
                                 const ctr::CmdLine& cmdline )
   : m_print( print ),
     m_reorder( cmdline.get< tag::reorder >() ),
+    m_ordering( cmdline.get< tag::ordering >() ),
+    m_elemorder( cmdline.get< tag::elemorder >() ),
     m_input(),
     m_output()
 // *****************************************************************************
@@ -56,7 +58,9 @@ MeshConvDriver::execute() const
   auto wtimes = tk::writeUnsMesh( m_print,
                                   m_output,
                                   mesh,
-                                  m_reorder );
+                                  m_reorder,
+                                  m_ordering,
+                                  m_elemorder );
 
   times.insert( end(times), begin(wtimes), end(wtimes) );
   mainProxy.timestamp( times );
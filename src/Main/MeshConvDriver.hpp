@@ -35,6 +35,9 @@ class MeshConvDriver {
   private:
     const tk::Print& m_print;           //!< Pretty printer
     const bool m_reorder;               //!< Whether to also reorder mesh nodes
+    //! Mesh reordering algorithm
+    const tk::ctr::MeshOrderingType m_ordering;
+    const bool m_elemorder;             //!< Whether to also reorder elements
     std::string m_input;                //!< Input file name
     std::string m_output;               //!< Output file name
 };
@@ -17,17 +17,20 @@ add_executable(${UNITTEST_EXECUTABLE}
                UnitTest.cpp
                ../../tests/unit/Base/TestContainerUtil.cpp
                ../../tests/unit/Base/TestData.cpp
+               ../../tests/unit/Base/TestDataLayout.cpp
                ../../tests/unit/Base/TestException.cpp
                ../../tests/unit/Base/TestExceptionMPI.cpp
                ../../tests/unit/Base/TestFactory.cpp
                ../../tests/unit/Base/TestFlip_map.cpp
                ../../tests/unit/Base/TestHas.cpp
+               ../../tests/unit/Base/TestParticleStore.cpp
                ../../tests/unit/Base/TestPrint.cpp
                ../../tests/unit/Base/TestProcessControl.cpp
                ../../tests/unit/Base/TestPUPUtil.cpp
                ../../tests/unit/Base/TestReader.cpp
                ../../tests/unit/Base/TestStrConvUtil.cpp
                ../../tests/unit/Base/TestTaggedTuple.cpp
+               ../../tests/unit/Base/TestThreadPool.cpp
                ../../tests/unit/Base/TestTimer.cpp
                ../../tests/unit/Base/TestVector.cpp
                ../../tests/unit/Base/TestWriter.cpp
@@ -43,6 +46,9 @@ add_executable(${UNITTEST_EXECUTABLE}
                ../../tests/unit/Control/TestToggle.cpp
                ../../tests/unit/${TestScheme}
                ../../tests/unit/${TestError}
+               ../../tests/unit/${TestContainers}
+               ../../tests/unit/${TestNodeBC}
+               ${NodeBC}
                ../../tests/unit/IO/TestExodusIIMeshReader.cpp
                ../../tests/unit/IO/TestMesh.cpp
                ../../tests/unit/IO/TestMeshReader.cpp
@@ -53,11 +59,16 @@ add_executable(${UNITTEST_EXECUTABLE}
                ../../tests/unit/Mesh/TestDerivedData.cpp
                ../../tests/unit/Mesh/TestDerivedData_MPISingle.cpp
                ../../tests/unit/Mesh/TestGradients.cpp
+               ../../tests/unit/Mesh/TestPointLocator.cpp
                ../../tests/unit/Mesh/TestReorder.cpp
+               ../../tests/unit/${TestRiemann}
                ../../tests/unit/${TestMKLRNG}
                ../../tests/unit/${TestRNGSSE}
                ../../tests/unit/RNG/TestRNG.cpp
-               ../../tests/unit/RNG/TestRandom123.cpp)
+               ../../tests/unit/RNG/TestRandom123.cpp
+               ../../tests/unit/Statistics/TestCentralMoments.cpp
+               ../../tests/unit/Statistics/TestDenseBins.cpp
+               ../../tests/unit/${TestLookahead})
 
 target_include_directories(${UNITTEST_EXECUTABLE} PUBLIC
                            ${QUINOA_SOURCE_DIR}
@@ -65,6 +76,8 @@ target_include_directories(${UNITTEST_EXECUTABLE} PUBLIC
                            ${QUINOA_SOURCE_DIR}/LoadBalance
                            ${QUINOA_SOURCE_DIR}/IO
                            ${QUINOA_SOURCE_DIR}/RNG
+                           ${QUINOA_SOURCE_DIR}/PDE
+                           ${QUINOA_SOURCE_DIR}/Statistics
                            ${TUT_INCLUDE_DIRS}
                            ${LAPACKE_INCLUDE_DIRS}
                            ${PROJECT_BINARY_DIR}/../UnitTest
@@ -77,6 +90,7 @@ target_link_libraries(${UNITTEST_EXECUTABLE}
                       Config
                       Init
                       RNG
+                      Statistics
                       ${MESHREFINEMENT}
                       UnitTest
                       UnitTestControl
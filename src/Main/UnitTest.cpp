@@ -42,6 +42,11 @@
 #include "ChareStateCollector.hpp"
 #include "QuietCerr.hpp"
 
+#ifdef ENABLE_INCITER
+  #include "Inciter/InputDeck/InputDeck.hpp"
+  #include "CGPDE.hpp"
+#endif
+
 #if defined(__clang__)
   #pragma clang diagnostic push
   #pragma clang diagnostic ignored "-Wmissing-variable-declarations"
@@ -111,6 +116,30 @@ inline void operator|( PUP::er& p, tut::test_runner_singleton& runner )
 
 } // unittest::
 
+#ifdef ENABLE_INCITER
+namespace inciter {
+
+#if defined(__clang__)
+  #pragma clang diagnostic push
+  #pragma clang diagnostic ignored "-Wmissing-variable-declarations"
+#endif
+
+//! Input deck shared by all Inciter unit tests, e.g., queried by the Riemann
+//! solvers for material parameters. Tests declare it extern, as Inciter's
+//! sources do, so it is defined once per executable, as in Main/Inciter.cpp.
+ctr::InputDeck g_inputdeck;
+
+//! Partial differential equations using continuous Galerkin, set up by the
+//! tests that need them, e.g., those of the node boundary conditions
+std::vector< CGPDE > g_cgpde;
+
+#if defined(__clang__)
+  #pragma clang diagnostic pop
+#endif
+
+} // inciter::
+#endif
+
 //! \brief Charm++ main chare for the unit test suite executable, unittest.
 //! \details Note that this object should not be in a namespace.
 // cppcheck-suppress noConstructor
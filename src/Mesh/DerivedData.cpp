@@ -20,7 +20,9 @@
 #include <cstddef>
 #include <array>
 #include <unordered_set>
+#include <unordered_map>
 #include <iostream>
+#include <string>
 
 #include "Exception.hpp"
 #include "DerivedData.hpp"
@@ -425,6 +427,203 @@ genInpoed( const std::vector< std::size_t >& inpoel,
   return inpoed;
 }
 
+std::vector< tk::real >
+genDfnorm( const std::vector< std::size_t >& inpoel,
+           const UnsMesh::Coords& coord,
+           const std::vector< std::size_t >& inpoed )
+// *****************************************************************************
+//  Generate dual-face normals and boundary coefficients of edges
+//! \param[in] inpoel Tetrahedron mesh connectivity
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoed Edge connectivity as linear vector, see tk::genInpoed
+//! \return Linear vector storing 6 reals for each edge in the order of
+//!   inpoed: the 3 components of the dual-face normal, d, followed by the 3
+//!   components of the boundary coefficient, s, of the edge
+//! \details For edge (p,q), p < q, the element contributions of a
+//!   linear-tetrahedron element with volume V and shapefunction gradients
+//!   grad(N) are
+//!   \f[
+//!     d_{pq} = \frac{V}{8}\left( \nabla N_q - \nabla N_p \right), \qquad
+//!     s_{pq} = \frac{V}{8}\left( \nabla N_q + \nabla N_p \right),
+//!   \f]
+//!   summed over all elements sharing the edge. The Galerkin integrals of the
+//!   shapefunctions times their gradients are then recovered as
+//!   \f$\int N_p \nabla N_q = d_{pq} + s_{pq}\f$ and
+//!   \f$\int N_q \nabla N_p = s_{pq} - d_{pq}\f$, so a node-centered
+//!   right-hand side can be assembled in a single loop over edges. d is the
+//!   (antisymmetric) normal of the median-dual face associated to the edge,
+//!   s is the (symmetric) part that only survives on boundary edges, once
+//!   all elements surrounding the edge have been summed.
+//! \note Only the elements given in inpoel contribute, so on a partitioned
+//!   mesh the edges on partition boundaries only store partial sums. These
+//!   can be completed using tk::bndDfnorm and tk::addDfnorm.
+//! \see Lohner, An Introduction to Applied CFD Techniques, Wiley, 2008
+// *****************************************************************************
+{
+  Assert( !inpoel.empty(), "Attempt to call genDfnorm() on empty container" );
+  Assert( inpoel.size()%4 == 0, "Size of inpoel must be divisible by 4" );
+  Assert( !inpoed.empty(), "Attempt to call genDfnorm() with empty inpoed" );
+  Assert( inpoed.size()%2 == 0, "Size of inpoed must be divisible by 2" );
+
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  // index of star centers into inpoed: the edges starting at point p are
+  // edges edsup2[p] <= i < edsup2[p+1], which requires inpoed to be sorted by
+  // star center, as generated by genInpoed()
+  std::vector< std::size_t > edsup2( x.size()+1, 0 );
+  for (std::size_t i=0; i<inpoed.size()/2; ++i) ++edsup2[ inpoed[i*2]+1 ];
+  for (std::size_t p=0; p<x.size(); ++p) edsup2[p+1] += edsup2[p];
+
+  // find edge id of edge (p,q), p < q
+  auto edgeid = [&]( std::size_t p, std::size_t q ) -> std::size_t {
+    for (auto i=edsup2[p]; i<edsup2[p+1]; ++i)
+      if (inpoed[i*2+1] == q) return i;
+    Throw( "Cannot find edge: " + std::to_string(p) + ',' +
+           std::to_string(q) );
+  };
+
+  // local node pairs of the six edges of a tetrahedron
+  const std::array< std::array< std::size_t, 2 >, 6 >
+    lpoed{{ {{0,1}}, {{1,2}}, {{0,2}}, {{0,3}}, {{1,3}}, {{2,3}} }};
+
+  std::vector< tk::real > dfn( inpoed.size()/2*6, 0.0 );
+
+  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+    const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
+                                           inpoel[e*4+2], inpoel[e*4+3] }};
+    // compute element Jacobi determinant
+    const std::array< tk::real, 3 >
+      ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
+      ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
+      da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
+    const auto J = triple( ba, ca, da );        // J = 6V
+    Assert( J > 0, "Element Jacobian non-positive" );
+
+    // shape function derivatives, nnode*ndim [4][3]
+    std::array< std::array< tk::real, 3 >, 4 > grad;
+    grad[1] = crossdiv( ca, da, J );
+    grad[2] = crossdiv( da, ba, J );
+    grad[3] = crossdiv( ba, ca, J );
+    for (std::size_t i=0; i<3; ++i)
+      grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+
+    // V/8
+    const auto v = J/48.0;
+
+    for (const auto& l : lpoed) {
+      auto a = l[0], b = l[1];
+      if (N[a] > N[b]) std::swap( a, b );
+      auto f = dfn.data() + edgeid( N[a], N[b] )*6;
+      for (std::size_t j=0; j<3; ++j) {
+        f[j]   += v * (grad[b][j] - grad[a][j]);
+        f[j+3] += v * (grad[b][j] + grad[a][j]);
+      }
+    }
+  }
+
+  return dfn;
+}
+
+std::pair< std::vector< std::size_t >, std::vector< tk::real > >
+bndDfnorm( const std::vector< std::size_t >& inpoed,
+           const std::vector< tk::real >& dfn,
+           const std::vector< std::size_t >& gid,
+           const std::vector< std::size_t >& nodes )
+// *****************************************************************************
+//  Extract dual-face normals of edges whose end-points are all in a node set
+//! \param[in] inpoed Edge connectivity as linear vector, see tk::genInpoed
+//! \param[in] dfn Dual-face normals and boundary coefficients of edges, see
+//!   tk::genDfnorm
+//! \param[in] gid Global node ids of local node ids
+//! \param[in] nodes Local node ids of the node set, e.g., the nodes shared
+//!   with a neighbor partition
+//! \return Edges whose both end-points are in the node set given by pairs of
+//!   global node ids in the orientation of inpoed, and their 6 reals of dfn
+//! \details This is used to send the partial dual-face normals of edges on
+//!   partition boundaries to the neighbor partitions sharing the edge, so that
+//!   the partial sums can be added up using tk::addDfnorm.
+// *****************************************************************************
+{
+  Assert( inpoed.size()/2*6 == dfn.size(), "Size mismatch" );
+
+  std::vector< char > shared( gid.size(), 0 );
+  for (auto p : nodes) shared[p] = 1;
+
+  std::pair< std::vector< std::size_t >, std::vector< tk::real > > bnd;
+  auto& ged = bnd.first;
+  auto& gdfn = bnd.second;
+
+  for (std::size_t e=0; e<inpoed.size()/2; ++e) {
+    auto p = inpoed[e*2+0], q = inpoed[e*2+1];
+    if (shared[p] && shared[q]) {
+      ged.push_back( gid[p] );
+      ged.push_back( gid[q] );
+      gdfn.insert( end(gdfn), begin(dfn)+e*6, begin(dfn)+e*6+6 );
+    }
+  }
+
+  return bnd;
+}
+
+std::vector< std::size_t >
+addDfnorm( const std::vector< std::size_t >& inpoed,
+           const std::unordered_map< std::size_t, std::size_t >& lid,
+           const std::vector< std::size_t >& ged,
+           const std::vector< tk::real >& gdfn,
+           std::vector< tk::real >& dfn )
+// *****************************************************************************
+//  Add dual-face normals of edges given by global node ids
+//! \param[in] inpoed Edge connectivity as linear vector, see tk::genInpoed
+//! \param[in] lid Local node ids associated to global node ids
+//! \param[in] ged Edges given by pairs of global node ids, see tk::bndDfnorm
+//! \param[in] gdfn Dual-face normals and boundary coefficients of edges in
+//!   ged, see tk::bndDfnorm
+//! \param[in,out] dfn Dual-face normals and boundary coefficients of edges in
+//!   the order of inpoed to add to
+//! \return Local edge ids of the edges in ged found in inpoed
+//! \details Edges in ged that are not in inpoed are skipped: both end-points
+//!   of an edge may be shared by two partitions without both partitions
+//!   having an element containing the edge. If the orientation of an edge in
+//!   ged is opposite to that of inpoed, the dual-face normal, d, is negated,
+//!   as it is antisymmetric, while the boundary coefficient, s, is symmetric.
+// *****************************************************************************
+{
+  Assert( inpoed.size()%2 == 0, "Size of inpoed must be divisible by 2" );
+  Assert( ged.size()/2*6 == gdfn.size(), "Size mismatch" );
+  Assert( inpoed.size()/2*6 == dfn.size(), "Size mismatch" );
+
+  // index of star centers into inpoed, see genDfnorm()
+  std::vector< std::size_t > edsup2( lid.size()+1, 0 );
+  for (std::size_t i=0; i<inpoed.size()/2; ++i) ++edsup2[ inpoed[i*2]+1 ];
+  for (std::size_t p=0; p<lid.size(); ++p) edsup2[p+1] += edsup2[p];
+
+  std::vector< std::size_t > found;
+
+  for (std::size_t g=0; g<ged.size()/2; ++g) {
+    auto i = lid.find( ged[g*2+0] );
+    auto j = lid.find( ged[g*2+1] );
+    if (i == end(lid) || j == end(lid)) continue;
+    auto p = i->second, q = j->second;
+    tk::real sign = 1.0;
+    if (p > q) { std::swap( p, q ); sign = -1.0; }
+    for (auto e=edsup2[p]; e<edsup2[p+1]; ++e)
+      if (inpoed[e*2+1] == q) {
+        auto f = dfn.data() + e*6;
+        const auto r = gdfn.data() + g*6;
+        for (std::size_t k=0; k<3; ++k) {
+          f[k]   += sign * r[k];
+          f[k+3] += r[k+3];
+        }
+        found.push_back( e );
+        break;
+      }
+  }
+
+  return found;
+}
+
 std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
 genEsupel( const std::vector< std::size_t >& inpoel,
            std::size_t nnpe,
@@ -824,6 +1023,55 @@ genEsued( const std::vector< std::size_t >& inpoel,
   return std::make_pair( std::move(esued1), std::move(esued2) );
 }
 
+std::vector< std::vector< std::size_t > >
+genColors( const std::vector< std::size_t >& inpoel, std::size_t nnpe )
+// *****************************************************************************
+//  Generate colors of items such that no two items of a color share a point
+//! \param[in] inpoel Inteconnectivity of points and items, e.g., elements,
+//!   edges, or faces, see tk::genEsup()
+//! \param[in] nnpe Number of points per item
+//! \return Item ids grouped by colors: no two items of the same color share a
+//!   point, so the items of a single color can be processed concurrently, even
+//!   if they scatter-add to their points. Within a color, item ids are in
+//!   increasing order.
+//! \details Colors are assigned greedily, in the order of the items, each item
+//!   getting the lowest color not yet used by any item that shares a point
+//!   with it. Note that "points" here can be any shared entity, e.g., passing
+//!   the ids of the left and right elements of faces with nnpe = 2 colors faces
+//!   so that no two faces of a color share an element.
+// *****************************************************************************
+{
+  Assert( !inpoel.empty(), "Attempt to call genColors() on empty container" );
+  Assert( nnpe > 0, "Attempt to call genColors() with zero points per item" );
+  Assert( inpoel.size()%nnpe == 0, "Size of inpoel must be divisible by nnpe" );
+
+  auto npoin = *std::max_element( begin(inpoel), end(inpoel) ) + 1;
+
+  // colors already used by items surrounding points
+  std::vector< std::vector< std::size_t > > used( npoin );
+  // color marks, stamped with the item id (+1) that forbids them
+  std::vector< std::size_t > forbid;
+
+  std::vector< std::vector< std::size_t > > colors;
+
+  for (std::size_t e=0; e<inpoel.size()/nnpe; ++e) {
+    // mark colors used by neighbor items
+    for (std::size_t n=0; n<nnpe; ++n)
+      for (auto c : used[ inpoel[e*nnpe+n] ]) {
+        if (c >= forbid.size()) forbid.resize( c+1, 0 );
+        forbid[c] = e+1;
+      }
+    // find lowest color not forbidden
+    std::size_t c = 0;
+    while (c < forbid.size() && forbid[c] == e+1) ++c;
+    if (c == colors.size()) colors.emplace_back();
+    colors[c].push_back( e );
+    for (std::size_t n=0; n<nnpe; ++n) used[ inpoel[e*nnpe+n] ].push_back( c );
+  }
+
+  return colors;
+}
+
 std::size_t
 genNbfacTet( std::size_t tnbfac,
              const std::vector< std::size_t >& inpoel,
@@ -1490,6 +1738,66 @@ genGeoElemTet( const std::vector< std::size_t >& inpoel,
   return geoElem;
 }
 
+tk::Fields
+genJacElemTet( const std::vector< std::size_t >& inpoel,
+               const tk::UnsMesh::Coords& coord )
+// *****************************************************************************
+//  Generate derived data, which stores the Jacobians of the transformation of
+//  tetrahedral elements from reference to physical space
+//! \param[in] inpoel Element-node connectivity.
+//! \param[in] coord Co-ordinates of nodes in this mesh-chunk.
+//! \return Element Jacobian data, the same for the lifetime of the mesh, so
+//!   that DG kernels need not gather node coordinates and recompute Jacobians
+//!   of elements at every quadrature point and stage. For element e:
+//!   determinant of the Jacobian: jacElem(e,0,0),
+//!   inverse Jacobian, jacInv[i][j]: jacElem(e,1+3*i+j,0), see
+//!     tk::inverseJacobian(),
+//!   coordinates of the first node: jacElem(e,10..12,0),
+//!   Jacobian, dx_i/dxi_j: jacElem(e,13+3*i+j,0), the edges from the first
+//!     node to the other three being its columns.
+//!   Use tk::jacInvElem(), tk::refCoordElem() and tk::physCoordElem() to
+//!   access them.
+// *****************************************************************************
+{
+  Assert( inpoel.size()%4 == 0, "Size of inpoel must be divisible by 4" );
+
+  auto nelem = inpoel.size()/4;
+
+  tk::Fields jacElem( nelem, 22 );
+
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  for (std::size_t e=0; e<nelem; ++e) {
+    const auto A = inpoel[4*e+0];
+    const auto B = inpoel[4*e+1];
+    const auto C = inpoel[4*e+2];
+    const auto D = inpoel[4*e+3];
+    std::array< std::array< tk::real, 3 >, 4 > v{{ {{ x[A], y[A], z[A] }},
+                                                  {{ x[B], y[B], z[B] }},
+                                                  {{ x[C], y[C], z[C] }},
+                                                  {{ x[D], y[D], z[D] }} }};
+
+    const auto detJ = tk::Jacobian( v[0], v[1], v[2], v[3] );
+    Assert( detJ > 0, "Element Jacobian non-positive" );
+    jacElem(e,0,0) = detJ;
+
+    const auto jacInv = tk::inverseJacobian( v[0], v[1], v[2], v[3] );
+    for (std::size_t i=0; i<3; ++i)
+      for (std::size_t j=0; j<3; ++j)
+        jacElem(e,1+3*i+j,0) = jacInv[i][j];
+
+    for (std::size_t i=0; i<3; ++i) {
+      jacElem(e,10+i,0) = v[0][i];
+      for (std::size_t j=0; j<3; ++j)
+        jacElem(e,13+3*i+j,0) = v[j+1][i] - v[0][i];
+    }
+  }
+
+  return jacElem;
+}
+
 bool
 leakyPartition( const std::vector< int >& esueltet,
                 const std::vector< std::size_t >& inpoel,
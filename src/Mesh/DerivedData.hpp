@@ -13,8 +13,10 @@
 #ifndef DerivedData_h
 #define DerivedData_h
 
+#include <array>
 #include <vector>
 #include <map>
+#include <unordered_map>
 #include <utility>
 #include <cstddef>
 #include "Types.hpp"
@@ -70,6 +72,27 @@ genInpoed( const std::vector< std::size_t >& inpoel,
            const std::pair< std::vector< std::size_t >,
                             std::vector< std::size_t > >& esup );
 
+//! Generate dual-face normals and boundary coefficients of edges
+std::vector< tk::real >
+genDfnorm( const std::vector< std::size_t >& inpoel,
+           const UnsMesh::Coords& coord,
+           const std::vector< std::size_t >& inpoed );
+
+//! Extract dual-face normals of edges whose end-points are all in a node set
+std::pair< std::vector< std::size_t >, std::vector< tk::real > >
+bndDfnorm( const std::vector< std::size_t >& inpoed,
+           const std::vector< tk::real >& dfn,
+           const std::vector< std::size_t >& gid,
+           const std::vector< std::size_t >& nodes );
+
+//! Add dual-face normals of edges given by global node ids
+std::vector< std::size_t >
+addDfnorm( const std::vector< std::size_t >& inpoed,
+           const std::unordered_map< std::size_t, std::size_t >& lid,
+           const std::vector< std::size_t >& ged,
+           const std::vector< tk::real >& gdfn,
+           std::vector< tk::real >& dfn );
+
 //! Generate derived data structure, elements surrounding points of elements
 std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
 genEsupel( const std::vector< std::size_t >& inpoel,
@@ -105,6 +128,10 @@ genEsued( const std::vector< std::size_t >& inpoel,
           const std::pair< std::vector< std::size_t >,
                            std::vector< std::size_t > >& esup );
 
+//! Generate colors of items such that no two items of a color share a point
+std::vector< std::vector< std::size_t > >
+genColors( const std::vector< std::size_t >& inpoel, std::size_t nnpe );
+
 //! Generate total number of boundary faces in this chunk
 std::size_t
 genNbfacTet( std::size_t tnbfac,
@@ -161,6 +188,64 @@ tk::Fields
 genGeoElemTet( const std::vector< std::size_t >& inpoel,
                const tk::UnsMesh::Coords& coord );
 
+//! Generate derived data structure, element Jacobians
+tk::Fields
+genJacElemTet( const std::vector< std::size_t >& inpoel,
+               const tk::UnsMesh::Coords& coord );
+
+//! Inverse Jacobian of a tetrahedron from its cached Jacobian data
+//! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
+//! \param[in] e Element id
+//! \return Inverse of the Jacobian of transformation of physical tetrahedron
+//!   e to reference (xi, eta, zeta) space, see tk::inverseJacobian()
+inline std::array< std::array< tk::real, 3 >, 3 >
+jacInvElem( const tk::Fields& jacElem, std::size_t e ) {
+  return {{ {{ jacElem(e,1,0), jacElem(e,2,0), jacElem(e,3,0) }},
+            {{ jacElem(e,4,0), jacElem(e,5,0), jacElem(e,6,0) }},
+            {{ jacElem(e,7,0), jacElem(e,8,0), jacElem(e,9,0) }} }};
+}
+
+//! Transform a point in physical space to the reference space of a tetrahedron
+//! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
+//! \param[in] e Element id
+//! \param[in] x Physical (x,y,z) coordinates of the point
+//! \return Reference (xi, eta, zeta) coordinates of the point in element e
+inline std::array< tk::real, 3 >
+refCoordElem( const tk::Fields& jacElem,
+              std::size_t e,
+              const std::array< tk::real, 3 >& x )
+{
+  const auto dx = x[0] - jacElem(e,10,0);
+  const auto dy = x[1] - jacElem(e,11,0);
+  const auto dz = x[2] - jacElem(e,12,0);
+  return {{ jacElem(e,1,0)*dx + jacElem(e,2,0)*dy + jacElem(e,3,0)*dz,
+            jacElem(e,4,0)*dx + jacElem(e,5,0)*dy + jacElem(e,6,0)*dz,
+            jacElem(e,7,0)*dx + jacElem(e,8,0)*dy + jacElem(e,9,0)*dz }};
+}
+
+//! Transform a point in the reference space of a tetrahedron to physical space
+//! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
+//! \param[in] e Element id
+//! \param[in] xi Reference xi coordinate of the point
+//! \param[in] eta Reference eta coordinate of the point
+//! \param[in] zeta Reference zeta coordinate of the point
+//! \return Physical (x,y,z) coordinates of the point in element e
+inline std::array< tk::real, 3 >
+physCoordElem( const tk::Fields& jacElem,
+               std::size_t e,
+               tk::real xi,
+               tk::real eta,
+               tk::real zeta )
+{
+  return {{
+    jacElem(e,10,0) + jacElem(e,13,0)*xi + jacElem(e,14,0)*eta
+                    + jacElem(e,15,0)*zeta,
+    jacElem(e,11,0) + jacElem(e,16,0)*xi + jacElem(e,17,0)*eta
+                    + jacElem(e,18,0)*zeta,
+    jacElem(e,12,0) + jacElem(e,19,0)*xi + jacElem(e,20,0)*eta
+                    + jacElem(e,21,0)*zeta }};
+}
+
 //! Perform leak-test on mesh (partition)
 bool
 leakyPartition( const std::vector< int >& esueltet,
@@ -92,6 +92,84 @@ nodegrad( std::size_t node,
    return g;
 }
 
+tk::Fields
+nodegrads( const std::array< std::vector< tk::real >, 3 >& coord,
+           const std::vector< std::size_t >& inpoel,
+           const tk::Fields& U,
+           const std::vector< std::size_t >& comp )
+// *****************************************************************************
+//  Compute gradients at all mesh nodes for a number of components
+//! \param[in] coord Mesh node coordinates
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] U Field vector whose component gradients to compute
+//! \param[in] comp Scalar components to compute gradients of
+//! \return Gradients of U(comp[i]) at all mesh nodes, the gradient of
+//!   component comp[i] stored as components 3*i+j, j=0,1,2
+//! \details This computes the same gradients as nodegrad() at all nodes but in
+//!   a single pass over the elements, scattering the contributions of each
+//!   element to its nodes, instead of rebuilding the gradient from the
+//!   elements surrounding each node and component separately.
+// *****************************************************************************
+{
+  for (auto c : comp) Assert( c < U.nprop(), "Indexing out of field data" );
+
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+  const auto ncomp = comp.size();
+
+  // storage for gradients and volumes at the mesh nodes
+  tk::Fields G( U.nunk(), ncomp*3 );
+  G.fill( 0.0 );
+  std::vector< tk::real > vol( U.nunk(), 0.0 );
+
+  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+     // access node IDs
+     const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
+                                            inpoel[e*4+2], inpoel[e*4+3] }};
+
+     // compute element Jacobi determinant
+     const std::array< tk::real, 3 >
+       ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
+       ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
+       da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
+     const auto J = tk::triple( ba, ca, da );        // J = 6V
+     Assert( J > 0, "Element Jacobian non-positive" );
+
+     // shape function derivatives, nnode*ndim [4][3]
+     std::array< std::array< tk::real, 3 >, 4 > grad;
+     grad[1] = tk::crossdiv( ca, da, J );
+     grad[2] = tk::crossdiv( da, ba, J );
+     grad[3] = tk::crossdiv( ba, ca, J );
+     for (std::size_t i=0; i<3; ++i)
+       grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+
+     // every element contributes their volume / 4 to their nodes
+     const auto w = 5.0*J/120.0;
+     for (std::size_t a=0; a<4; ++a) vol[ N[a] ] += w;
+
+     // compute gradients over element weighed by cell volume / 4
+     for (std::size_t k=0; k<ncomp; ++k) {
+       auto u = U.extract( comp[k], 0, N );
+       std::array< tk::real, 3 > g{{ 0.0, 0.0, 0.0 }};
+       for (std::size_t j=0; j<3; ++j)
+         for (std::size_t i=0; i<4; ++i)
+           g[j] += grad[i][j] * u[i] * w;
+       // sum to nodes
+       for (std::size_t a=0; a<4; ++a)
+         for (std::size_t j=0; j<3; ++j)
+           G( N[a], k*3+j, 0 ) += g[j];
+     }
+   }
+
+   // divide components of nodal gradients by nodal volume
+   for (std::size_t p=0; p<G.nunk(); ++p)
+     if (vol[p] > 0.0)
+       for (std::size_t k=0; k<ncomp*3; ++k) G(p,k,0) /= vol[p];
+
+   return G;
+}
+
 std::array< tk::real, 3 >
 edgegrad( std::size_t edge,
           const std::array< std::vector< tk::real >, 3 >& coord,
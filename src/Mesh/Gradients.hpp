@@ -36,6 +36,13 @@ nodegrad( std::size_t node,
           const tk::Fields& U,
           ncomp_t c );
 
+//! Compute gradients at all mesh nodes for a number of components
+tk::Fields
+nodegrads( const std::array< std::vector< tk::real >, 3 >& coord,
+           const std::vector< std::size_t >& inpoel,
+           const tk::Fields& U,
+           const std::vector< std::size_t >& comp );
+
 //! Compute gradient at a mesh edge
 std::array< tk::real, 3 >
 edgegrad( std::size_t edge,
@@ -0,0 +1,184 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/PointLocator.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Locate points in the elements of a tetrahedron mesh
+  \see       PointLocator.h for more info.
+*/
+// *****************************************************************************
+
+#include <cmath>
+#include <algorithm>
+#include <functional>
+
+#include "PointLocator.hpp"
+#include "DerivedData.hpp"
+#include "Exception.hpp"
+
+using tk::PointLocator;
+
+PointLocator::PointLocator( const std::vector< std::size_t >& inpoel,
+                            const tk::UnsMesh::Coords& coord ) :
+  m_jacElem( tk::genJacElemTet( inpoel, coord ) ),
+  m_esuel( tk::genEsuelTet( inpoel, tk::genEsup(inpoel,4) ) ),
+  m_min{{ 0.0, 0.0, 0.0 }},
+  m_dx{{ 1.0, 1.0, 1.0 }},
+  m_nbin{{ 1, 1, 1 }},
+  m_bin(),
+  m_binElem()
+// *****************************************************************************
+//  Constructor: build inverse maps, face adjacency, and bins
+//! \param[in] inpoel Mesh element connectivity
+//! \param[in] coord Mesh node coordinates
+//! \details The number of bins is about the number of elements, with bins
+//!   about the same size in all directions, so that a bin overlaps a few
+//!   elements on average.
+// *****************************************************************************
+{
+  const auto nelem = inpoel.size()/4;
+
+  // Bounding box of the mesh
+  std::array< tk::real, 3 > max;
+  for (std::size_t d=0; d<3; ++d) {
+    auto r = std::minmax_element( begin(coord[d]), end(coord[d]) );
+    m_min[d] = *r.first;
+    max[d] = *r.second;
+  }
+
+  // Bin size giving about as many bins as elements
+  tk::real vol = 1.0;
+  for (std::size_t d=0; d<3; ++d) vol *= max[d] - m_min[d];
+  const auto h = std::cbrt( vol / static_cast< tk::real >( nelem ) );
+  for (std::size_t d=0; d<3; ++d) {
+    const auto l = max[d] - m_min[d];
+    if (h > 0.0) m_nbin[d] = std::max< std::size_t >( 1,
+                   static_cast< std::size_t >( std::ceil( l/h ) ) );
+    m_dx[d] = l > 0.0 ? l / static_cast< tk::real >( m_nbin[d] ) : 1.0;
+  }
+
+  // Lambda to call a function for all bins overlapped by the bounding box of
+  // an element
+  auto overlap = [&]( std::size_t e, const std::function< void(std::size_t) >&
+                        f ) {
+    std::array< std::size_t, 3 > lo, hi;
+    for (std::size_t d=0; d<3; ++d) {
+      auto r = std::minmax( { coord[d][ inpoel[e*4+0] ],
+                              coord[d][ inpoel[e*4+1] ],
+                              coord[d][ inpoel[e*4+2] ],
+                              coord[d][ inpoel[e*4+3] ] } );
+      lo[d] = bin( d, r.first );
+      hi[d] = bin( d, r.second );
+    }
+    for (auto i=lo[0]; i<=hi[0]; ++i)
+      for (auto j=lo[1]; j<=hi[1]; ++j)
+        for (auto k=lo[2]; k<=hi[2]; ++k)
+          f( (k*m_nbin[1] + j)*m_nbin[0] + i );
+  };
+
+  // Count elements overlapping bins, then store them grouped by bins
+  m_bin.assign( m_nbin[0]*m_nbin[1]*m_nbin[2] + 1, 0 );
+  for (std::size_t e=0; e<nelem; ++e)
+    overlap( e, [&]( std::size_t b ){ ++m_bin[b+1]; } );
+  for (std::size_t b=1; b<m_bin.size(); ++b) m_bin[b] += m_bin[b-1];
+  m_binElem.resize( m_bin.back() );
+  auto pos = m_bin;
+  for (std::size_t e=0; e<nelem; ++e)
+    overlap( e, [&]( std::size_t b ){ m_binElem[ pos[b]++ ] = e; } );
+}
+
+std::size_t
+PointLocator::bin( std::size_t d, tk::real x ) const
+// *****************************************************************************
+//  Bin index of a coordinate in a direction
+//! \param[in] d Direction
+//! \param[in] x Coordinate in direction d
+//! \return Index of bin in direction d containing coordinate x, clamped to
+//!   the bins
+// *****************************************************************************
+{
+  const auto i = std::floor( (x - m_min[d]) / m_dx[d] );
+  if (i < 0.0) return 0;
+  const auto n = static_cast< tk::real >( m_nbin[d] - 1 );
+  return static_cast< std::size_t >( std::min( i, n ) );
+}
+
+std::array< tk::real, 4 >
+PointLocator::shapefn( std::size_t e, const std::array< tk::real, 3 >& p ) const
+// *****************************************************************************
+//  Evaluate the shapefunctions of an element at a point
+//! \param[in] e Element id
+//! \param[in] p Coordinates of the point
+//! \return Linear shapefunctions of the four nodes of element e evaluated at
+//!   point p, i.e., the barycentric coordinates of p in element e
+// *****************************************************************************
+{
+  const auto xi = tk::refCoordElem( m_jacElem, e, p );
+  return {{ 1.0 - xi[0] - xi[1] - xi[2], xi[0], xi[1], xi[2] }};
+}
+
+bool
+PointLocator::locate( const std::array< tk::real, 3 >& p,
+                      std::size_t& e,
+                      std::array< tk::real, 4 >& N ) const
+// *****************************************************************************
+//  Locate a point walking from an element, then searching the bins
+//! \param[in] p Coordinates of the point
+//! \param[in,out] e Element id to start the walk from, e.g., the element the
+//!   point has last been found in, on output the element id the point was
+//!   found in
+//! \param[in,out] N Shapefunctions of element e evaluated at point p
+//! \return True if the point was found
+//! \details The walk moves across the face opposite the node whose
+//!   shapefunction is the smallest, i.e., the face the point is farthest
+//!   outside of. Face f of an element is opposite its node f, see tk::lpofa.
+//!   The walk is cut short and the bins searched instead if it would leave
+//!   the mesh or if the point is not found after a few elements.
+// *****************************************************************************
+{
+  Assert( e < nelem(), "Element id out of bounds" );
+
+  auto w = e;
+  for (std::size_t s=0; s<m_maxwalk; ++s) {
+    N = shapefn( w, p );
+    if (inside(N)) { e = w; return true; }
+    auto f = static_cast< std::size_t >(
+               std::min_element( begin(N), end(N) ) - begin(N) );
+    auto n = m_esuel[ w*4+f ];
+    if (n < 0) break;
+    w = static_cast< std::size_t >( n );
+  }
+
+  return search( p, e, N );
+}
+
+bool
+PointLocator::search( const std::array< tk::real, 3 >& p,
+                      std::size_t& e,
+                      std::array< tk::real, 4 >& N ) const
+// *****************************************************************************
+//  Locate a point searching the elements of its bin
+//! \param[in] p Coordinates of the point
+//! \param[in,out] e Element id the point was found in, unchanged if not found
+//! \param[in,out] N Shapefunctions of element e evaluated at point p
+//! \return True if the point was found
+// *****************************************************************************
+{
+  if (m_bin.empty()) return false;
+
+  // A point outside of the bounding box of the mesh cannot be found
+  for (std::size_t d=0; d<3; ++d)
+    if (p[d] < m_min[d] ||
+        p[d] > m_min[d] + m_dx[d]*static_cast< tk::real >(m_nbin[d]))
+      return false;
+
+  const auto b = (bin(2,p[2])*m_nbin[1] + bin(1,p[1]))*m_nbin[0] + bin(0,p[0]);
+  for (auto i=m_bin[b]; i<m_bin[b+1]; ++i) {
+    N = shapefn( m_binElem[i], p );
+    if (inside(N)) { e = m_binElem[i]; return true; }
+  }
+
+  return false;
+}
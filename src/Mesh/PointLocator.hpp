@@ -0,0 +1,121 @@
+// *****************************************************************************
+/*!
+  \file      src/Mesh/PointLocator.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Locate points in the elements of a tetrahedron mesh
+  \details   Locate points in the elements of a tetrahedron mesh. The linear
+    shapefunctions of an element at a point are its barycentric coordinates,
+    evaluated using the inverse Jacobians of the elements, computed once, see
+    tk::genJacElemTet(). A point is located starting from an element, e.g.,
+    the one it has last been found in, by walking through the faces of the
+    elements toward the point: if the point is not in the element, the walk
+    continues with the neighbor element across the face opposite the node
+    whose shapefunction is the smallest. Points not found by a short walk,
+    e.g., since they have left the mesh or there is no element to start
+    from, are searched in the elements whose bounding boxes overlap a bin of
+    a uniform grid over the bounding box of the mesh. Since points moving
+    with a flow usually stay in or close to their elements, locating them
+    costs O(1) per point.
+*/
+// *****************************************************************************
+#ifndef PointLocator_h
+#define PointLocator_h
+
+#include <array>
+#include <vector>
+#include <cstddef>
+
+#include "Types.hpp"
+#include "Fields.hpp"
+#include "UnsMesh.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Locate points in the elements of a tetrahedron mesh
+class PointLocator {
+
+  public:
+    //! Empty constructor for Charm++
+    explicit PointLocator() :
+      m_jacElem(), m_esuel(), m_min{{0.0,0.0,0.0}}, m_dx{{1.0,1.0,1.0}},
+      m_nbin{{0,0,0}}, m_bin(), m_binElem() {}
+
+    //! Constructor: build inverse maps, face adjacency, and bins
+    explicit PointLocator( const std::vector< std::size_t >& inpoel,
+                           const tk::UnsMesh::Coords& coord );
+
+    //! Number of elements
+    //! \return Number of elements points are located in
+    std::size_t nelem() const { return m_jacElem.nunk(); }
+
+    //! Evaluate the shapefunctions of an element at a point
+    std::array< tk::real, 4 >
+    shapefn( std::size_t e, const std::array< tk::real, 3 >& p ) const;
+
+    //! Query if shapefunctions locate a point inside their element
+    //! \param[in] N Shapefunctions evaluated at a point
+    //! \return True if min( N^i, 1-N^i ) > 0 for all i
+    static bool inside( const std::array< tk::real, 4 >& N ) {
+      for (auto n : N) if (!(n > 0.0 && n < 1.0)) return false;
+      return true;
+    }
+
+    //! Locate a point walking from an element, then searching the bins
+    bool locate( const std::array< tk::real, 3 >& p,
+                 std::size_t& e,
+                 std::array< tk::real, 4 >& N ) const;
+
+    //! Locate a point searching the elements of its bin
+    bool search( const std::array< tk::real, 3 >& p,
+                 std::size_t& e,
+                 std::array< tk::real, 4 >& N ) const;
+
+    /** @name Charm++ pack/unpack serializer member functions */
+    ///@{
+    //! \brief Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) {
+      p | m_jacElem;
+      p | m_esuel;
+      p | m_min;
+      p | m_dx;
+      p | m_nbin;
+      p | m_bin;
+      p | m_binElem;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] l PointLocator object reference
+    friend void operator|( PUP::er& p, PointLocator& l ) { l.pup(p); }
+    //@}
+
+  private:
+    //! Maximum number of elements visited walking toward a point
+    static const std::size_t m_maxwalk = 32;
+
+    //! Element Jacobian data, see tk::genJacElemTet()
+    tk::Fields m_jacElem;
+    //! Elements surrounding elements, see tk::genEsuelTet()
+    std::vector< int > m_esuel;
+    //! Minimum coordinates of the bounding box of the mesh
+    std::array< tk::real, 3 > m_min;
+    //! Bin size in each direction
+    std::array< tk::real, 3 > m_dx;
+    //! Number of bins in each direction
+    std::array< std::size_t, 3 > m_nbin;
+    //! Offsets of bins into m_binElem, size: number of bins + 1
+    std::vector< std::size_t > m_bin;
+    //! Elements whose bounding box overlaps a bin, grouped by bins
+    std::vector< std::size_t > m_binElem;
+
+    //! Bin index of a coordinate in a direction
+    std::size_t bin( std::size_t d, tk::real x ) const;
+};
+
+} // tk::
+
+#endif // PointLocator_h
@@ -6,7 +6,12 @@
              2019 Triad National Security, LLC.
              All rights reserved. See the LICENSE file for details.
   \brief     Mesh reordering routines for unstructured meshes
-  \details   Mesh reordering routines for unstructured meshes.
+  \details   Mesh reordering routines for unstructured meshes. Mesh nodes can
+    be reordered using the advancing front technique, the reverse
+    Cuthill-McKee algorithm, or along a Morton or Hilbert space-filling curve.
+    Elements can be reordered following the order of their nodes. The quality
+    of an ordering is measured by its bandwidth, profile, and an estimate of
+    the cache miss rate of gathering element nodes.
 */
 // *****************************************************************************
 
@@ -16,6 +21,8 @@
 #include <map>
 #include <tuple>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 
 #include "Reorder.hpp"
 #include "Exception.hpp"
@@ -24,6 +31,107 @@
 
 namespace tk {
 
+namespace {
+
+//! Number of bits per coordinate direction of space-filling curve keys
+const unsigned int sfcbits = 21;
+
+//! Number of mesh nodes whose data fits into a cache line, assuming a 64-byte
+//! cache line and a single real number per node
+const std::size_t cachelinenodes = 8;
+
+//! Number of cache lines of the direct-mapped cache model used to estimate the
+//! cache miss rate of an ordering
+const std::size_t cachelines = 4096;
+
+std::size_t
+levels( const std::pair< std::vector< std::size_t >,
+                         std::vector< std::size_t > >& psup,
+        std::size_t root,
+        std::size_t stamp,
+        std::vector< std::size_t >& mark,
+        std::vector< std::size_t >& nodes,
+        std::size_t& last )
+// *****************************************************************************
+//  Generate the rooted level structure of a mesh graph component
+//! \param[in] psup Points surrounding points
+//! \param[in] root Point to root the level structure at
+//! \param[in] stamp Value to mark points visited with, must differ from all
+//!   values in mark
+//! \param[in,out] mark Marks of points visited
+//! \param[in,out] nodes Points of the component in breadth-first order
+//! \param[out] last Index into nodes of the first point of the last level
+//! \return Number of levels
+// *****************************************************************************
+{
+  nodes.clear();
+  nodes.push_back( root );
+  mark[ root ] = stamp;
+  std::size_t begin = 0, depth = 0;
+  while (begin < nodes.size()) {
+    last = begin;
+    auto end = nodes.size();
+    ++depth;
+    for (auto i=begin; i<end; ++i) {
+      auto p = nodes[i];
+      for (auto j=psup.second[p]+1; j<=psup.second[p+1]; ++j) {
+        auto q = psup.first[j];
+        if (mark[q] != stamp) {
+          mark[q] = stamp;
+          nodes.push_back( q );
+        }
+      }
+    }
+    begin = end;
+  }
+  return depth;
+}
+
+uint64_t
+sfckey( std::array< uint64_t, 3 > X, SpaceFillingCurve curve )
+// *****************************************************************************
+//  Compute the key of a point along a space-filling curve
+//! \param[in] X Integer coordinates of the point, each less than 2^sfcbits
+//! \param[in] curve Space-filling curve
+//! \return Key of the point along the curve
+//! \details For the Hilbert curve the coordinates are first transformed
+//!   following J. Skilling, Programming the Hilbert curve, AIP Conference
+//!   Proceedings 707, 381 (2004). The key is then formed by interleaving the
+//!   bits of the (transformed) coordinates.
+// *****************************************************************************
+{
+  const uint64_t M = uint64_t(1) << (sfcbits-1);
+
+  if (curve == SpaceFillingCurve::HILBERT) {
+    // Inverse undo
+    for (auto Q=M; Q>1; Q>>=1) {
+      auto P = Q - 1;
+      for (std::size_t i=0; i<3; ++i)
+        if (X[i] & Q) {
+          X[0] ^= P;                            // invert
+        } else {
+          auto t = (X[0] ^ X[i]) & P;           // exchange
+          X[0] ^= t;
+          X[i] ^= t;
+        }
+    }
+    // Gray encode
+    for (std::size_t i=1; i<3; ++i) X[i] ^= X[i-1];
+    uint64_t t = 0;
+    for (auto Q=M; Q>1; Q>>=1) if (X[2] & Q) t ^= Q-1;
+    for (std::size_t i=0; i<3; ++i) X[i] ^= t;
+  }
+
+  uint64_t key = 0;
+  for (auto b=sfcbits; b-->0; )
+    for (std::size_t i=0; i<3; ++i)
+      key = (key << 1) | ((X[i] >> b) & 1);
+
+  return key;
+}
+
+} // ::
+
 std::size_t
 shiftToZero( std::vector< std::size_t >& inpoel )
 // *****************************************************************************
@@ -216,47 +324,291 @@ renumber( const std::pair< std::vector< std::size_t >,
 //  Reorder mesh points with the advancing front technique
 //! \param[in] psup Points surrounding points
 //! \return Mapping created by renumbering (reordering)
+//! \details Starting from point 0, the points of each front are numbered in
+//!   the order they are reached from the points of the previous front. If the
+//!   mesh graph is not connected, numbering continues from the lowest point id
+//!   not yet reached. The fronts are stored in two buffers reused for all
+//!   fronts, so no memory is allocated per front.
 // *****************************************************************************
 {
   // Find out number of nodes in graph
   auto npoin = psup.second.size()-1;
 
   // Construct mapping using advancing front
-  std::vector< int > hpoin( npoin, -1 ), lpoin( npoin, 0 );
-  std::vector< std::size_t > map( npoin, 0 );
-  hpoin[0] = 0;
-  lpoin[0] = 1;
-  std::size_t num = 1;
+  std::vector< std::size_t > map( npoin, 0 ), front, next;
+  std::vector< char > counted( npoin, 0 );
+  front.reserve( npoin );
+  next.reserve( npoin );
+  front.push_back( 0 );
+  counted[0] = 1;
+  std::size_t num = 1, seed = 0;
   while (num < npoin) {
-    std::size_t cnt = 0;
-    std::size_t i = 0;
-    std::vector< int > kpoin( npoin, -1 );
-    int p;
-    while ((p = hpoin[i]) != -1) {
-      ++i;
-      auto P = static_cast< std::size_t >( p );
-      for (auto j=psup.second[P]+1; j<=psup.second[P+1]; ++j) {
+    next.clear();
+    for (auto p : front) {
+      for (auto j=psup.second[p]+1; j<=psup.second[p+1]; ++j) {
         auto q = psup.first[j];
-        if (lpoin[q] != 1) {    // consider points not yet counted
+        if (!counted[q]) {      // consider points not yet counted
           map[q] = num++;
-          kpoin[cnt] = static_cast< int >( q ); // register point as counted
-          lpoin[q] = 1;                         // register the point as counted
-          ++cnt;
+          next.push_back( q );
+          counted[q] = 1;       // register the point as counted
+        }
+      }
+    }
+    // continue with the lowest point not yet reached if front is exhausted
+    if (next.empty()) {
+      while (counted[seed]) ++seed;
+      map[seed] = num++;
+      next.push_back( seed );
+      counted[seed] = 1;
+    }
+    front.swap( next );
+  }
+
+  // Return old->new map
+  return map;
+}
+
+std::vector< std::size_t >
+rcm( const std::pair< std::vector< std::size_t >,
+                      std::vector< std::size_t > >& psup )
+// *****************************************************************************
+//  Reorder mesh points with the reverse Cuthill-McKee algorithm
+//! \param[in] psup Points surrounding points
+//! \return Mapping created by renumbering (reordering), old->new
+//! \details Each connected component of the mesh graph is numbered starting
+//!   from a pseudo-peripheral point, found using the algorithm of N.E. Gibbs,
+//!   W.G. Poole, P.K. Stockmeyer, An algorithm for reducing the bandwidth and
+//!   profile of a sparse matrix, SIAM J. Numer. Anal. 13(2), 1976, as modified
+//!   by A. George, J.W.H. Liu, Computer solution of large sparse positive
+//!   definite systems, 1981. Points are numbered in breadth-first order, the
+//!   neighbors of a point in order of increasing degree, and the order is
+//!   finally reversed, which reduces the profile.
+// *****************************************************************************
+{
+  // Find out number of nodes in graph
+  auto npoin = psup.second.size()-1;
+
+  std::vector< std::size_t > order, nodes, nbr, mark( npoin, 0 );
+  std::vector< char > numbered( npoin, 0 );
+  order.reserve( npoin );
+  nodes.reserve( npoin );
+  std::size_t stamp = 0;
+
+  auto degree = [&]( std::size_t p ){ return psup.second[p+1]-psup.second[p]; };
+  auto lower = [&]( std::size_t p, std::size_t q ){
+    return degree(p) < degree(q); };
+
+  for (std::size_t seed=0; seed<npoin; ++seed) {
+    if (numbered[seed]) continue;
+
+    // Find pseudo-peripheral point of the component of seed
+    std::size_t last = 0;
+    auto root = seed;
+    auto depth = levels( psup, root, ++stamp, mark, nodes, last );
+    while (true) {
+      auto c = *std::min_element( begin(nodes)+static_cast<long>(last),
+                                  end(nodes), lower );
+      auto d = levels( psup, c, ++stamp, mark, nodes, last );
+      if (d <= depth) break;
+      root = c;
+      depth = d;
+    }
+
+    // Number points of component breadth-first, neighbors by degree
+    auto head = order.size();
+    order.push_back( root );
+    numbered[ root ] = 1;
+    while (head < order.size()) {
+      auto p = order[ head++ ];
+      nbr.clear();
+      for (auto j=psup.second[p]+1; j<=psup.second[p+1]; ++j) {
+        auto q = psup.first[j];
+        if (!numbered[q]) {
+          numbered[q] = 1;
+          nbr.push_back( q );
         }
       }
+      std::stable_sort( begin(nbr), end(nbr), lower );
+      order.insert( end(order), begin(nbr), end(nbr) );
     }
-    hpoin = kpoin;
   }
 
-//   // Construct new->old id map
-//   std::size_t i = 0;
-//   std::vector< std::size_t > oldmap( npoin );
-//   for (auto n : map) oldmap[n] = i++;
+  Assert( order.size() == npoin, "Not all points numbered" );
 
-  // Return old->new and new->old maps
+  // Reverse order and return old->new map
+  std::vector< std::size_t > map( npoin );
+  for (std::size_t i=0; i<npoin; ++i) map[ order[i] ] = npoin-1-i;
   return map;
 }
 
+std::vector< std::size_t >
+sfc( const std::vector< real >& x,
+     const std::vector< real >& y,
+     const std::vector< real >& z,
+     SpaceFillingCurve curve )
+// *****************************************************************************
+//  Reorder mesh points along a space-filling curve
+//! \param[in] x Mesh point x coordinates
+//! \param[in] y Mesh point y coordinates
+//! \param[in] z Mesh point z coordinates
+//! \param[in] curve Space-filling curve to order points along
+//! \return Mapping created by renumbering (reordering), old->new
+//! \details The coordinates are quantized to sfcbits bits in each direction
+//!   in the bounding box of the points, using the same scale in all
+//!   directions, and the points are numbered in order of their keys along the
+//!   curve. Points with the same key keep their relative order.
+// *****************************************************************************
+{
+  Assert( x.size() == y.size() && x.size() == z.size(), "Size mismatch" );
+
+  auto npoin = x.size();
+  if (npoin == 0) return {};
+
+  // Find bounding box
+  const std::array< const std::vector< real >*, 3 > coord{{ &x, &y, &z }};
+  std::array< real, 3 > lo;
+  real extent = 0.0;
+  for (std::size_t d=0; d<3; ++d) {
+    auto m = std::minmax_element( begin(*coord[d]), end(*coord[d]) );
+    lo[d] = *m.first;
+    extent = std::max( extent, *m.second - *m.first );
+  }
+  if (extent <= 0.0) extent = 1.0;
+  const auto scale = static_cast< real >( (uint64_t(1) << sfcbits) - 1 ) /
+                     extent;
+
+  // Compute keys along curve
+  std::vector< uint64_t > key( npoin );
+  for (std::size_t p=0; p<npoin; ++p) {
+    std::array< uint64_t, 3 > X;
+    for (std::size_t d=0; d<3; ++d)
+      X[d] = static_cast< uint64_t >( ((*coord[d])[p] - lo[d]) * scale );
+    key[p] = sfckey( X, curve );
+  }
+
+  // Sort points by key
+  std::vector< std::size_t > order( npoin );
+  for (std::size_t p=0; p<npoin; ++p) order[p] = p;
+  std::stable_sort( begin(order), end(order),
+    [&]( std::size_t p, std::size_t q ){ return key[p] < key[q]; } );
+
+  // Return old->new map
+  std::vector< std::size_t > map( npoin );
+  for (std::size_t i=0; i<npoin; ++i) map[ order[i] ] = i;
+  return map;
+}
+
+std::vector< std::size_t >
+renumberElements( const std::vector< std::size_t >& inpoel, std::size_t nnpe )
+// *****************************************************************************
+//  Reorder mesh elements following the order of their nodes
+//! \param[in] inpoel Element connectivity
+//! \param[in] nnpe Number of nodes per element
+//! \return Mapping created by renumbering (reordering), old->new
+//! \details Elements are sorted lexicographically by their node ids, each
+//!   element's node ids taken in increasing order. Thus elements are traversed
+//!   in the order of their lowest node, so sweeping over the elements gathers
+//!   the nodes in approximately the order they are stored in. Elements with
+//!   the same nodes keep their relative order.
+// *****************************************************************************
+{
+  Assert( nnpe > 0 && inpoel.size() % nnpe == 0, "Size mismatch" );
+
+  auto nelem = inpoel.size() / nnpe;
+
+  // Sort node ids of each element
+  auto sorted = inpoel;
+  for (std::size_t e=0; e<nelem; ++e)
+    std::sort( begin(sorted) + static_cast< long >( e*nnpe ),
+               begin(sorted) + static_cast< long >( (e+1)*nnpe ) );
+
+  // Sort elements by their sorted node ids
+  std::vector< std::size_t > order( nelem );
+  for (std::size_t e=0; e<nelem; ++e) order[e] = e;
+  std::stable_sort( begin(order), end(order),
+    [&]( std::size_t a, std::size_t b ){
+      const auto n = sorted.data();
+      return std::lexicographical_compare( n+a*nnpe, n+(a+1)*nnpe,
+                                           n+b*nnpe, n+(b+1)*nnpe ); } );
+
+  // Return old->new map
+  std::vector< std::size_t > map( nelem );
+  for (std::size_t i=0; i<nelem; ++i) map[ order[i] ] = i;
+  return map;
+}
+
+void
+remapElements( std::vector< std::size_t >& inpoel,
+               std::size_t nnpe,
+               const std::vector< std::size_t >& map )
+// *****************************************************************************
+//  Apply new mapping to element connectivity
+//! \param[in,out] inpoel Element connectivity to remap
+//! \param[in] nnpe Number of nodes per element
+//! \param[in] map Array of element indices creating a new order
+//! \details The function moves the nodes of every element e to the position
+//!   of element map[e].
+// *****************************************************************************
+{
+  Assert( nnpe > 0 && inpoel.size() == map.size()*nnpe, "Size mismatch" );
+
+  auto old = inpoel;
+  for (std::size_t e=0; e<map.size(); ++e)
+    for (std::size_t n=0; n<nnpe; ++n)
+      inpoel[ map[e]*nnpe+n ] = old[ e*nnpe+n ];
+}
+
+OrderingQuality
+orderingQuality( const std::vector< std::size_t >& inpoel, std::size_t nnpe )
+// *****************************************************************************
+//  Compute the quality of the ordering of mesh nodes and elements
+//! \param[in] inpoel Element connectivity
+//! \param[in] nnpe Number of nodes per element
+//! \return Measures of the quality of the ordering
+//! \details The bandwidth and profile are those of the matrix of a
+//!   node-centered discretization on the mesh. The cache miss rate is
+//!   estimated by gathering the nodes of all elements, in element order, via
+//!   a direct-mapped cache of cachelines lines, each holding the data of
+//!   cachelinenodes consecutive nodes. Both the node and the element order
+//!   influence the miss rate.
+// *****************************************************************************
+{
+  Assert( nnpe > 0 && inpoel.size() % nnpe == 0, "Size mismatch" );
+
+  OrderingQuality q{ 0, 0, 0.0, 0.0 };
+  if (inpoel.empty()) return q;
+
+  auto nelem = inpoel.size() / nnpe;
+  auto npoin = *std::max_element( begin(inpoel), end(inpoel) ) + 1;
+
+  // Lowest node id of the elements each node is part of
+  const auto none = std::numeric_limits< std::size_t >::max();
+  std::vector< std::size_t > low( npoin, none ), tag( cachelines, none );
+  std::size_t span = 0, miss = 0;
+  for (std::size_t e=0; e<nelem; ++e) {
+    const auto n = inpoel.data() + e*nnpe;
+    auto m = std::minmax_element( n, n+nnpe );
+    auto s = *m.second - *m.first;
+    span += s;
+    q.bandwidth = std::max( q.bandwidth, s );
+    for (std::size_t i=0; i<nnpe; ++i) {
+      low[ n[i] ] = std::min( low[ n[i] ], *m.first );
+      auto line = n[i] / cachelinenodes;
+      auto& t = tag[ line % cachelines ];
+      if (t != line) { t = line; ++miss; }
+    }
+  }
+
+  for (std::size_t p=0; p<npoin; ++p)
+    if (low[p] <= p) q.profile += p - low[p];
+
+  q.span = static_cast< real >( span ) / static_cast< real >( nelem );
+  q.missrate = static_cast< real >( miss ) /
+               static_cast< real >( inpoel.size() );
+
+  return q;
+}
+
 std::unordered_map< std::size_t, std::size_t >
 assignLid( const std::vector< std::size_t >& gid )
 // *****************************************************************************
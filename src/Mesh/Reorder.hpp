@@ -6,7 +6,12 @@
              2019 Triad National Security, LLC.
              All rights reserved. See the LICENSE file for details.
   \brief     Mesh reordering routines for unstructured meshes
-  \details   Mesh reordering routines for unstructured meshes.
+  \details   Mesh reordering routines for unstructured meshes. Mesh nodes can
+    be reordered using the advancing front technique, the reverse
+    Cuthill-McKee algorithm, or along a Morton or Hilbert space-filling curve.
+    Elements can be reordered following the order of their nodes. The quality
+    of an ordering is measured by its bandwidth, profile, and an estimate of
+    the cache miss rate of gathering element nodes.
 */
 // *****************************************************************************
 #ifndef Reorder_h
@@ -19,11 +24,29 @@
 #include <map>
 #include <cstddef>
 #include <array>
+#include <cstdint>
 
 #include "Types.hpp"
 
 namespace tk {
 
+//! Space-filling curves to order mesh entities along
+enum class SpaceFillingCurve : uint8_t { MORTON,
+                                         HILBERT };
+
+//! Measures of the quality of an ordering of mesh nodes and elements
+struct OrderingQuality {
+  //! Maximum difference of node ids of an element
+  std::size_t bandwidth;
+  //! Sum over all nodes of the difference between the node id and the lowest
+  //! node id of the elements the node is part of
+  std::size_t profile;
+  //! Average difference of node ids of an element
+  real span;
+  //! Estimated cache miss rate of gathering element nodes in element order
+  real missrate;
+};
+
 //! Shift node IDs to start with zero in element connectivity
 std::size_t
 shiftToZero( std::vector< std::size_t >& inpoel );
@@ -61,6 +84,32 @@ std::vector< std::size_t >
 renumber( const std::pair< std::vector< std::size_t >,
                            std::vector< std::size_t > >& psup );
 
+//! Reorder mesh points with the reverse Cuthill-McKee algorithm
+std::vector< std::size_t >
+rcm( const std::pair< std::vector< std::size_t >,
+                      std::vector< std::size_t > >& psup );
+
+//! Reorder mesh points along a space-filling curve
+std::vector< std::size_t >
+sfc( const std::vector< real >& x,
+     const std::vector< real >& y,
+     const std::vector< real >& z,
+     SpaceFillingCurve curve );
+
+//! Reorder mesh elements following the order of their nodes
+std::vector< std::size_t >
+renumberElements( const std::vector< std::size_t >& inpoel, std::size_t nnpe );
+
+//! Apply new mapping to element connectivity
+void
+remapElements( std::vector< std::size_t >& inpoel,
+               std::size_t nnpe,
+               const std::vector< std::size_t >& map );
+
+//! Compute the quality of the ordering of mesh nodes and elements
+OrderingQuality
+orderingQuality( const std::vector< std::size_t >& inpoel, std::size_t nnpe );
+
 //! Assign local ids to global ids
 std::unordered_map< std::size_t, std::size_t >
 assignLid( const std::vector< std::size_t >& gid );
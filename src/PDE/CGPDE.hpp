@@ -101,6 +101,16 @@ class CGPDE {
               tk::Fields& R ) const
     { self->rhs( t, deltat, coord, inpoel, U, Ue, R ); }
 
+    //! Public interface to computing the edge-based right-hand side vector
+    void rhs( tk::real t,
+              const std::array< std::vector< tk::real >, 3 >& coord,
+              const std::vector< std::size_t >& inpoed,
+              const std::vector< tk::real >& dfn,
+              const std::vector< tk::real >& vol,
+              const tk::Fields& U,
+              tk::Fields& R ) const
+    { self->rhs( t, coord, inpoed, dfn, vol, U, R ); }
+
     //! Public interface for computing the minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                  const std::vector< std::size_t >& inpoel,
@@ -120,6 +130,15 @@ class CGPDE {
            const std::array< std::vector< tk::real >, 3 >& coord ) const
     { return self->dirbc( t, deltat, sides, coord ); }
 
+    //! \brief Public interface for evaluating the solution increments
+    //!   prescribed by Dirichlet boundary conditions at mesh nodes
+    void solinc( tk::real t,
+                 tk::real deltat,
+                 const std::vector< std::size_t >& nodes,
+                 const std::array< std::vector< tk::real >, 3 >& coord,
+                 tk::Fields& inc ) const
+    { self->solinc( t, deltat, nodes, coord, inc ); }
+
     //! Public interface to returning field output labels
     std::vector< std::string > fieldNames() const { return self->fieldNames(); }
 
@@ -173,6 +192,13 @@ class CGPDE {
                         const tk::Fields&,
                         tk::Fields&,
                         tk::Fields& ) const = 0;
+      virtual void rhs( tk::real,
+                        const std::array< std::vector< tk::real >, 3 >&,
+                        const std::vector< std::size_t >&,
+                        const std::vector< tk::real >&,
+                        const std::vector< tk::real >&,
+                        const tk::Fields&,
+                        tk::Fields& ) const = 0;
       virtual tk::real dt( const std::array< std::vector< tk::real >, 3 >&,
                            const std::vector< std::size_t >&,
                            const tk::Fields& ) const = 0;
@@ -183,6 +209,11 @@ class CGPDE {
              tk::real,
              const std::pair< const int, std::vector< std::size_t > >&,
              const std::array< std::vector< tk::real >, 3 >& ) const = 0;
+      virtual void solinc( tk::real,
+                           tk::real,
+                           const std::vector< std::size_t >&,
+                           const std::array< std::vector< tk::real >, 3 >&,
+                           tk::Fields& ) const = 0;
       virtual std::vector< std::string > fieldNames() const = 0;
       virtual std::vector< std::string > names() const = 0;
       virtual std::vector< std::vector< tk::real > > fieldOutput(
@@ -219,6 +250,14 @@ class CGPDE {
                 tk::Fields& Ue,
                 tk::Fields& R ) const override
       { data.rhs( t, deltat, coord, inpoel, U, Ue, R ); }
+      void rhs( tk::real t,
+                const std::array< std::vector< tk::real >, 3 >& coord,
+                const std::vector< std::size_t >& inpoed,
+                const std::vector< tk::real >& dfn,
+                const std::vector< tk::real >& vol,
+                const tk::Fields& U,
+                tk::Fields& R ) const override
+      { data.rhs( t, coord, inpoed, dfn, vol, U, R ); }
       tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
                    const std::vector< std::size_t >& inpoel,
                    const tk::Fields& U ) const override
@@ -231,6 +270,12 @@ class CGPDE {
              const std::pair< const int, std::vector< std::size_t > >& sides,
              const std::array< std::vector< tk::real >, 3 >& coord ) const
         override { return data.dirbc( t, deltat, sides, coord ); }
+      void solinc( tk::real t,
+                   tk::real deltat,
+                   const std::vector< std::size_t >& nodes,
+                   const std::array< std::vector< tk::real >, 3 >& coord,
+                   tk::Fields& inc ) const override
+      { data.solinc( t, deltat, nodes, coord, inc ); }
       std::vector< std::string > fieldNames() const override
       { return data.fieldNames(); }
       std::vector< std::string > names() const override
@@ -21,6 +21,7 @@
 #include "Macro.hpp"
 #include "Exception.hpp"
 #include "Vector.hpp"
+#include "ThreadPool.hpp"
 #include "EoS/EoS.hpp"
 
 namespace inciter {
@@ -206,144 +207,265 @@ class CompFlow {
       const auto& y = coord[1];
       const auto& z = coord[2];
 
-      // 1st stage: update element values from node values (gather-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+      // 1st stage: update element values from node values (gather-add),
+      // each element only writes its own value, so elements are split among
+      // threads without conflicts
+      tk::threadpool().parallelFor( inpoel.size()/4,
+        [&]( std::size_t first, std::size_t last, std::size_t ){
+        for (std::size_t e=first; e<last; ++e) {
+
+          // access node IDs
+          const std::array< std::size_t, 4 >
+            N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+          // compute element Jacobi determinant
+          const std::array< tk::real, 3 >
+            ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
+            ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
+            da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
+          const auto J = tk::triple( ba, ca, da );        // J = 6V
+          Assert( J > 0, "Element Jacobian non-positive" );
+
+          // shape function derivatives, nnode*ndim [4][3]
+          std::array< std::array< tk::real, 3 >, 4 > grad;
+          grad[1] = tk::crossdiv( ca, da, J );
+          grad[2] = tk::crossdiv( da, ba, J );
+          grad[3] = tk::crossdiv( ba, ca, J );
+          for (std::size_t i=0; i<3; ++i)
+            grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+
+          // access solution at element nodes
+          std::array< std::array< tk::real, 4 >, 5 > u;
+          for (ncomp_t c=0; c<5; ++c) u[c] = U.extract( c, m_offset, N );
+          // access solution at elements
+          std::array< const tk::real*, 5 > ue;
+          for (ncomp_t c=0; c<5; ++c) ue[c] = Ue.cptr( c, m_offset );
+
+          // pressure
+          std::array< tk::real, 4 > p;
+          for (std::size_t a=0; a<4; ++a)
+            p[a] = eos_pressure< tag::compflow >
+                     ( m_system, u[0][a], u[1][a]/u[0][a], u[2][a]/u[0][a],
+                       u[3][a]/u[0][a], u[4][a] );
+
+          // sum nodal averages to element
+          for (ncomp_t c=0; c<5; ++c) {
+            Ue.var(ue[c],e) = 0.0;
+            for (std::size_t a=0; a<4; ++a)
+              Ue.var(ue[c],e) += u[c][a]/4.0;
+          }
 
-        // access node IDs
-        const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                               inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
+          // sum flux contributions to element
+          tk::real d = deltat/2.0;
+          for (std::size_t j=0; j<3; ++j)
+            for (std::size_t a=0; a<4; ++a) {
+              // mass: advection
+              Ue.var(ue[0],e) -= d * grad[a][j] * u[j+1][a];
+              // momentum: advection
+              for (std::size_t i=0; i<3; ++i)
+                Ue.var(ue[i+1],e) -=
+                  d * grad[a][j] * u[j+1][a]*u[i+1][a]/u[0][a];
+              // momentum: pressure
+              Ue.var(ue[j+1],e) -= d * grad[a][j] * p[a];
+              // energy: advection and pressure
+              Ue.var(ue[4],e) -= d * grad[a][j] *
+                                (u[4][a] + p[a]) * u[j+1][a]/u[0][a];
+            }
 
-        // shape function derivatives, nnode*ndim [4][3]
-        std::array< std::array< tk::real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+          // add (optional) source to all equations
+          std::array< std::vector< tk::real >, 4 > s{{
+            Problem::src( m_system, m_ncomp, x[N[0]], y[N[0]], z[N[0]], t ),
+            Problem::src( m_system, m_ncomp, x[N[1]], y[N[1]], z[N[1]], t ),
+            Problem::src( m_system, m_ncomp, x[N[2]], y[N[2]], z[N[2]], t ),
+            Problem::src( m_system, m_ncomp, x[N[3]], y[N[3]], z[N[3]], t ) }};
+          for (std::size_t c=0; c<5; ++c)
+            for (std::size_t a=0; a<4; ++a)
+              Ue.var(ue[c],e) += d/4.0 * s[a][c];
 
-        // access solution at element nodes
-        std::array< std::array< tk::real, 4 >, 5 > u;
-        for (ncomp_t c=0; c<5; ++c) u[c] = U.extract( c, m_offset, N );
-        // access solution at elements
-        std::array< const tk::real*, 5 > ue;
-        for (ncomp_t c=0; c<5; ++c) ue[c] = Ue.cptr( c, m_offset );
-
-        // pressure
-        std::array< tk::real, 4 > p;
-        for (std::size_t a=0; a<4; ++a)
-          p[a] = eos_pressure< tag::compflow >
-                   ( m_system, u[0][a], u[1][a]/u[0][a], u[2][a]/u[0][a],
-                     u[3][a]/u[0][a], u[4][a] );
-
-        // sum nodal averages to element
-        for (ncomp_t c=0; c<5; ++c) {
-          Ue.var(ue[c],e) = 0.0;
-          for (std::size_t a=0; a<4; ++a)
-            Ue.var(ue[c],e) += u[c][a]/4.0;
         }
+      } );
 
-        // sum flux contributions to element
-        tk::real d = deltat/2.0;
-        for (std::size_t j=0; j<3; ++j)
-          for (std::size_t a=0; a<4; ++a) {
-            // mass: advection
-            Ue.var(ue[0],e) -= d * grad[a][j] * u[j+1][a];
-            // momentum: advection
-            for (std::size_t i=0; i<3; ++i)
-              Ue.var(ue[i+1],e) -= d * grad[a][j] * u[j+1][a]*u[i+1][a]/u[0][a];
-            // momentum: pressure
-            Ue.var(ue[j+1],e) -= d * grad[a][j] * p[a];
-            // energy: advection and pressure
-            Ue.var(ue[4],e) -= d * grad[a][j] *
-                              (u[4][a] + p[a]) * u[j+1][a]/u[0][a];
-          }
 
-        // add (optional) source to all equations
-        std::array< std::vector< tk::real >, 4 > s{{
-          Problem::src( m_system, m_ncomp, x[N[0]], y[N[0]], z[N[0]], t ),
-          Problem::src( m_system, m_ncomp, x[N[1]], y[N[1]], z[N[1]], t ),
-          Problem::src( m_system, m_ncomp, x[N[2]], y[N[2]], z[N[2]], t ),
-          Problem::src( m_system, m_ncomp, x[N[3]], y[N[3]], z[N[3]], t ) }};
-        for (std::size_t c=0; c<5; ++c)
-          for (std::size_t a=0; a<4; ++a)
-            Ue.var(ue[c],e) += d/4.0 * s[a][c];
+      // zero right hand side for all components
+      for (ncomp_t c=0; c<5; ++c) R.fill( c, m_offset, 0.0 );
 
-      }
+      // 2nd stage: form rhs from element values (scatter-add), elements are
+      // split among threads, each adding to its own copy of the rhs
+      scatter( inpoel.size()/4, R,
+        [&]( std::size_t first, std::size_t last, tk::Fields& Rt ){
+        for (std::size_t e=first; e<last; ++e) {
+
+          // access node IDs
+          const std::array< std::size_t, 4 >
+            N{{ inpoel[e*4+0], inpoel[e*4+1], inpoel[e*4+2], inpoel[e*4+3] }};
+          // compute element Jacobi determinant
+          const std::array< tk::real, 3 >
+            ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
+            ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
+            da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
+          const auto J = tk::triple( ba, ca, da );        // J = 6V
+          Assert( J > 0, "Element Jacobian non-positive" );
+
+          // shape function derivatives, nnode*ndim [4][3]
+          std::array< std::array< tk::real, 3 >, 4 > grad;
+          grad[1] = tk::crossdiv( ca, da, J );
+          grad[2] = tk::crossdiv( da, ba, J );
+          grad[3] = tk::crossdiv( ba, ca, J );
+          for (std::size_t i=0; i<3; ++i)
+            grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
+
+          // access solution at elements
+          std::array< tk::real, 5 > ue;
+          for (ncomp_t c=0; c<5; ++c) ue[c] = Ue( e, c, m_offset );
+          // access pointer to right hand side at component and offset
+          std::array< const tk::real*, 5 > r;
+          for (ncomp_t c=0; c<5; ++c) r[c] = Rt.cptr( c, m_offset );
+
+          // pressure
+          auto p = eos_pressure< tag::compflow >
+                     ( m_system, ue[0], ue[1]/ue[0], ue[2]/ue[0], ue[3]/ue[0],
+                       ue[4] );
+
+          // scatter-add flux contributions to rhs at nodes
+          tk::real d = deltat * J/6.0;
+          for (std::size_t j=0; j<3; ++j)
+            for (std::size_t a=0; a<4; ++a) {
+              // mass: advection
+              Rt.var(r[0],N[a]) += d * grad[a][j] * ue[j+1];
+              // momentum: advection
+              for (std::size_t i=0; i<3; ++i)
+                Rt.var(r[i+1],N[a]) += d * grad[a][j] * ue[j+1]*ue[i+1]/ue[0];
+              // momentum: pressure
+              Rt.var(r[j+1],N[a]) += d * grad[a][j] * p;
+              // energy: advection and pressure
+              Rt.var(r[4],N[a]) += d * grad[a][j] * (ue[4] + p) * ue[j+1]/ue[0];
+            }
 
+          // add (optional) source to all equations
+          auto xc = (x[N[0]] + x[N[1]] + x[N[2]] + x[N[3]]) / 4.0;
+          auto yc = (y[N[0]] + y[N[1]] + y[N[2]] + y[N[3]]) / 4.0;
+          auto zc = (z[N[0]] + z[N[1]] + z[N[2]] + z[N[3]]) / 4.0;
+          auto s = Problem::src( m_system, m_ncomp, xc, yc, zc, t+deltat/2 );
+          for (std::size_t c=0; c<5; ++c)
+            for (std::size_t a=0; a<4; ++a)
+              Rt.var(r[c],N[a]) += d/4.0 * s[c];
 
-      // zero right hand side for all components
-      for (ncomp_t c=0; c<5; ++c) R.fill( c, m_offset, 0.0 );
+        }
+      } );
+//         // add viscous stress contribution to momentum and energy rhs
+//         m_physics.viscousRhs( deltat, J, N, grad, u, r, R );
+//         // add heat conduction contribution to energy rhs
+//         m_physics.conductRhs( deltat, J, N, grad, u, r, R );
+    }
 
-      // 2nd stage: form rhs from element values (scatter-add)
-      for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+    //! Compute edge-based right hand side
+    //! \param[in] t Physical time
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] inpoed Edge connectivity, see tk::genInpoed()
+    //! \param[in] dfn Dual-face normals and boundary coefficients of edges,
+    //!   see tk::genDfnorm()
+    //! \param[in] vol Nodal volumes of the elements whose edges are in inpoed
+    //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] R Right-hand side vector computed
+    //! \details This computes the node-centered right-hand side, i.e., the
+    //!   volume-integrated time derivative of the solution, in a single loop
+    //!   over edges. The Galerkin advective term, -int N_p div F, where F is
+    //!   interpolated from the nodes, is assembled from the edge coefficients
+    //!   computed by tk::genDfnorm(). The flux is stabilized by local
+    //!   Lax-Friedrichs (Rusanov) dissipation across the dual faces.
+    //!   Since the dissipation is nonlinear in dfn, on a partitioned mesh dfn
+    //!   must store the complete sums of chare-boundary edges and each such
+    //!   edge must only be passed to a single partition, see ALECG::lhsmerge().
+    void rhs( tk::real t,
+              const std::array< std::vector< tk::real >, 3 >& coord,
+              const std::vector< std::size_t >& inpoed,
+              const std::vector< tk::real >& dfn,
+              const std::vector< tk::real >& vol,
+              const tk::Fields& U,
+              tk::Fields& R ) const
+    {
+      Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
+              "vector at recent time step incorrect" );
+      Assert( R.nunk() == coord[0].size(),
+              "Number of unknowns and/or number of components in right-hand "
+              "side vector incorrect" );
+      Assert( dfn.size() == inpoed.size()/2*6, "Size mismatch" );
+      Assert( vol.size() == coord[0].size(), "Size mismatch" );
 
-        // access node IDs
-        const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
-                                               inpoel[e*4+2], inpoel[e*4+3] }};
-        // compute element Jacobi determinant
-        const std::array< tk::real, 3 >
-          ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
-          ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
-          da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
-        const auto J = tk::triple( ba, ca, da );        // J = 6V
-        Assert( J > 0, "Element Jacobian non-positive" );
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+
+      // pressure and speed of sound at nodes
+      std::vector< tk::real > p( U.nunk() ), a( U.nunk() );
+      for (std::size_t i=0; i<U.nunk(); ++i) {
+        auto r = U(i,0,m_offset);
+        p[i] = eos_pressure< tag::compflow >
+                 ( m_system, r, U(i,1,m_offset)/r, U(i,2,m_offset)/r,
+                   U(i,3,m_offset)/r, U(i,4,m_offset) );
+        a[i] = eos_soundspeed< tag::compflow >
+                 ( m_system, r, std::max( p[i], 0.0 ) );
+      }
+
+      // zero right hand side for all components
+      for (ncomp_t c=0; c<5; ++c) R.fill( c, m_offset, 0.0 );
 
-        // shape function derivatives, nnode*ndim [4][3]
-        std::array< std::array< tk::real, 3 >, 4 > grad;
-        grad[1] = tk::crossdiv( ca, da, J );
-        grad[2] = tk::crossdiv( da, ba, J );
-        grad[3] = tk::crossdiv( ba, ca, J );
-        for (std::size_t i=0; i<3; ++i)
-          grad[0][i] = -grad[1][i]-grad[2][i]-grad[3][i];
-
-        // access solution at elements
-        std::array< tk::real, 5 > ue;
-        for (ncomp_t c=0; c<5; ++c) ue[c] = Ue( e, c, m_offset );
+      // assemble rhs in a loop over edges (scatter-add), edges are split among
+      // threads, each adding to its own copy of the rhs
+      scatter( inpoed.size()/2, R,
+        [&]( std::size_t first, std::size_t last, tk::Fields& Rt ){
         // access pointer to right hand side at component and offset
         std::array< const tk::real*, 5 > r;
-        for (ncomp_t c=0; c<5; ++c) r[c] = R.cptr( c, m_offset );
-
-        // pressure
-        auto p = eos_pressure< tag::compflow >
-                   ( m_system, ue[0], ue[1]/ue[0], ue[2]/ue[0], ue[3]/ue[0],
-                     ue[4] );
-
-        // scatter-add flux contributions to rhs at nodes
-        tk::real d = deltat * J/6.0;
-        for (std::size_t j=0; j<3; ++j)
-          for (std::size_t a=0; a<4; ++a) {
-            // mass: advection
-            R.var(r[0],N[a]) += d * grad[a][j] * ue[j+1];
-            // momentum: advection
-            for (std::size_t i=0; i<3; ++i)
-              R.var(r[i+1],N[a]) += d * grad[a][j] * ue[j+1]*ue[i+1]/ue[0];
-            // momentum: pressure
-            R.var(r[j+1],N[a]) += d * grad[a][j] * p;
-            // energy: advection and pressure
-            R.var(r[4],N[a]) += d * grad[a][j] * (ue[4] + p) * ue[j+1]/ue[0];
+        for (ncomp_t c=0; c<5; ++c) r[c] = Rt.cptr( c, m_offset );
+
+        for (std::size_t e=first; e<last; ++e) {
+          const auto P = inpoed[e*2];
+          const auto Q = inpoed[e*2+1];
+          const auto f = dfn.data() + e*6;
+
+          // Galerkin edge coefficients, int N_P grad N_Q and int N_Q grad N_P
+          const std::array< tk::real, 3 >
+            cpq{{ f[3]+f[0], f[4]+f[1], f[5]+f[2] }},
+            cqp{{ f[3]-f[0], f[4]-f[1], f[5]-f[2] }};
+
+          // fluxes at edge-end points
+          const auto fp = nodeflux( U, p[P], P );
+          const auto fq = nodeflux( U, p[Q], Q );
+
+          // dual-face area and unit normal
+          const auto n = std::sqrt( f[0]*f[0] + f[1]*f[1] + f[2]*f[2] );
+          Assert( n > 0.0, "Zero dual-face area" );
+          const std::array< tk::real, 3 > nh{{ f[0]/n, f[1]/n, f[2]/n }};
+
+          // maximum wave speed normal to dual face
+          auto vnp = (U(P,1,m_offset)*nh[0] + U(P,2,m_offset)*nh[1] +
+                      U(P,3,m_offset)*nh[2]) / U(P,0,m_offset);
+          auto vnq = (U(Q,1,m_offset)*nh[0] + U(Q,2,m_offset)*nh[1] +
+                      U(Q,3,m_offset)*nh[2]) / U(Q,0,m_offset);
+          auto l = std::max( std::abs(vnp) + a[P], std::abs(vnq) + a[Q] );
+
+          for (ncomp_t c=0; c<5; ++c) {
+            // advection
+            std::array< tk::real, 3 > df{{ fq[c][0]-fp[c][0], fq[c][1]-fp[c][1],
+                                           fq[c][2]-fp[c][2] }};
+            Rt.var(r[c],P) -= tk::dot( df, cpq );
+            Rt.var(r[c],Q) += tk::dot( df, cqp );
+            // dissipation
+            auto d = 0.5 * l * n * (U(Q,c,m_offset) - U(P,c,m_offset));
+            Rt.var(r[c],P) += d;
+            Rt.var(r[c],Q) -= d;
           }
+        }
+      } );
 
-        // add (optional) source to all equations
-        auto xc = (x[N[0]] + x[N[1]] + x[N[2]] + x[N[3]]) / 4.0;
-        auto yc = (y[N[0]] + y[N[1]] + y[N[2]] + y[N[3]]) / 4.0;
-        auto zc = (z[N[0]] + z[N[1]] + z[N[2]] + z[N[3]]) / 4.0;
-        auto s = Problem::src( m_system, m_ncomp, xc, yc, zc, t+deltat/2 );
-        for (std::size_t c=0; c<5; ++c)
-          for (std::size_t a=0; a<4; ++a)
-            R.var(r[c],N[a]) += d/4.0 * s[c];
+      // access pointer to right hand side at component and offset
+      std::array< const tk::real*, 5 > r;
+      for (ncomp_t c=0; c<5; ++c) r[c] = R.cptr( c, m_offset );
 
+      // add (optional) source to all equations
+      for (std::size_t i=0; i<U.nunk(); ++i) {
+        auto s = Problem::src( m_system, m_ncomp, x[i], y[i], z[i], t );
+        for (ncomp_t c=0; c<5; ++c) R.var(r[c],i) += vol[i] * s[c];
       }
-//         // add viscous stress contribution to momentum and energy rhs
-//         m_physics.viscousRhs( deltat, J, N, grad, u, r, R );
-//         // add heat conduction contribution to energy rhs
-//         m_physics.conductRhs( deltat, J, N, grad, u, r, R );
     }
 
     //! Compute the minimum time step size
@@ -474,6 +596,34 @@ class CompFlow {
       return bc;
     }
 
+    //! \brief Evaluate the solution increments prescribed by Dirichlet boundary
+    //!   conditions at mesh nodes for all components in this PDE system
+    //! \param[in] t Physical time
+    //! \param[in] deltat Time step size
+    //! \param[in] nodes Local node IDs at which to evaluate the increments
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in,out] inc Increments between t+dt and t, one row per node in
+    //!   the order of nodes, see inciter::DirichletBC
+    void solinc( tk::real t,
+                 tk::real deltat,
+                 const std::vector< std::size_t >& nodes,
+                 const std::array< std::vector< tk::real >, 3 >& coord,
+                 tk::Fields& inc ) const
+    {
+      if (g_inputdeck.get< tag::param, tag::compflow, tag::bcdir >().empty())
+        return;
+      Assert( inc.nunk() == nodes.size(), "Size mismatch" );
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+      for (std::size_t i=0; i<nodes.size(); ++i) {
+        auto n = nodes[i];
+        auto s = m_problem.solinc( m_system, m_ncomp, x[n], y[n], z[n],
+                                   t, deltat );
+        for (ncomp_t c=0; c<5; ++c) inc(i,c,m_offset) = s[c];
+      }
+    }
+
     //! Return field names to be output to file
     //! \return Vector of strings labelling fields output in file
     std::vector< std::string > fieldNames() const
@@ -508,6 +658,80 @@ class CompFlow {
     const ncomp_t m_system;             //!< Equation system index
     const ncomp_t m_ncomp;              //!< Number of components in this PDE
     const ncomp_t m_offset;             //!< Offset PDE operates from
+
+    //! Execute a scatter-add loop on threads into per-thread right-hand sides
+    //! \param[in] n Number of items, e.g., elements or edges, to loop over
+    //! \param[in,out] R Right-hand side vector to scatter-add to
+    //! \param[in] body Loop body called as body(first,last,Rt) for a chunk of
+    //!   items [first,last), with Rt the right-hand side vector to add to
+    //! \details The calling thread adds to R directly, the other threads of
+    //!   the thread pool to their own right-hand side buffers, which are summed
+    //!   into R after the loop. This avoids conflicts between threads adding to
+    //!   the same mesh node without requiring a coloring of the mesh. The
+    //!   buffers persist across calls, see rhsbuf(), and only the components
+    //!   of this PDE are zeroed, each by the thread that adds to the buffer.
+    template< class Body >
+    void scatter( std::size_t n, tk::Fields& R, const Body& body ) const {
+      auto& pool = tk::threadpool();
+      auto nt = std::min( pool.size(), n );
+      auto& Rt = rhsbuf();
+      if (nt > 1) {
+        if (Rt.size() < nt-1) Rt.resize( nt-1 );
+        // (re)allocate buffers whose size differs, e.g., after mesh refinement
+        for (std::size_t t=0; t<nt-1; ++t)
+          if (Rt[t].nunk() != R.nunk() || Rt[t].nprop() != R.nprop())
+            Rt[t] = tk::Fields( R.nunk(), R.nprop() );
+      }
+      pool.parallelFor( n,
+        [&]( std::size_t first, std::size_t last, std::size_t tid ){
+          if (tid == 0) { body( first, last, R ); return; }
+          auto& r = Rt[tid-1];
+          for (ncomp_t c=0; c<5; ++c) r.fill( c, m_offset, 0.0 );
+          body( first, last, r ); } );
+      if (nt < 2) return;
+      // sum contributions of threads
+      pool.parallelFor( R.nunk(),
+        [&]( std::size_t first, std::size_t last, std::size_t ){
+          for (std::size_t t=0; t<nt-1; ++t)
+            for (ncomp_t c=0; c<5; ++c)
+              for (auto i=first; i<last; ++i)
+                R(i,c,m_offset) += Rt[t](i,c,m_offset);
+        } );
+    }
+
+    //! Access the right-hand side buffers of scatter() of the calling PE
+    //! \return Reference to the right-hand side buffers of the calling PE
+    //! \details The buffers are thread-local, like the thread pool, see
+    //!   tk::threadpool(), so in an SMP build of Charm++ the PEs do not share
+    //!   them, while the chares of a PE, which do not execute concurrently, do.
+    //!   They are only reallocated if the size of the right-hand side changes.
+    static std::vector< tk::Fields >& rhsbuf() {
+      thread_local std::vector< tk::Fields > buf;
+      return buf;
+    }
+
+    //! Evaluate the Euler flux at a mesh node
+    //! \param[in] U Solution vector
+    //! \param[in] p Pressure at the node
+    //! \param[in] i Node id
+    //! \return Flux vectors in all three directions for all 5 components
+    std::array< std::array< tk::real, 3 >, 5 >
+    nodeflux( const tk::Fields& U, tk::real p, std::size_t i ) const {
+      std::array< tk::real, 5 > u{{ U(i,0,m_offset), U(i,1,m_offset),
+        U(i,2,m_offset), U(i,3,m_offset), U(i,4,m_offset) }};
+      std::array< std::array< tk::real, 3 >, 5 > fl;
+      for (std::size_t j=0; j<3; ++j) {
+        // mass: advection
+        fl[0][j] = u[j+1];
+        // momentum: advection
+        for (std::size_t k=0; k<3; ++k) fl[k+1][j] = u[j+1]*u[k+1]/u[0];
+        // momentum: pressure
+        fl[j+1][j] += p;
+        // energy: advection and pressure
+        fl[4][j] = (u[4] + p) * u[j+1]/u[0];
+      }
+      return fl;
+    }
 };
 
 } // cg::
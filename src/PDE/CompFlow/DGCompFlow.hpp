@@ -118,23 +118,29 @@ class CompFlow {
     }
 
     //! Compute right hand side
+    //! \param[in] phase Right-hand side phase to compute, see inciter::RhsPhase
     //! \param[in] t Physical time
     //! \param[in] geoFace Face geometry array
+    //! \param[in] faceQuad Precomputed face-quadrature data
     //! \param[in] geoElem Element geometry array
+    //! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
     //! \param[in] fd Face connectivity and boundary conditions object
-    //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in] U Solution vector at recent time step
     //! \param[in] ndofel Vector of local number of degrees of freedom
+    //! \param[in] lts Time step levels of elements, see inciter::TimeLevels
     //! \param[in,out] R Right-hand side vector computed
-    void rhs( tk::real t,
+    void rhs( inciter::RhsPhase phase,
+              tk::real t,
               const tk::Fields& geoFace,
+              const std::vector< tk::real >& faceQuad,
               const tk::Fields& geoElem,
+              const tk::Fields& jacElem,
               const inciter::FaceData& fd,
-              const std::vector< std::size_t >& inpoel,
               const tk::UnsMesh::Coords& coord,
               const tk::Fields& U,
               const std::vector< std::size_t >& ndofel,
+              const inciter::TimeLevels& lts,
               tk::Fields& R ) const
     {
       const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
@@ -145,13 +151,14 @@ class CompFlow {
       Assert( U.nprop() == ndof*5 && R.nprop() == ndof*5,
               "Number of components in solution and right-hand side vector "
               "must equal "+ std::to_string(ndof*5) );
-      Assert( inpoel.size()/4 == U.nunk(), "Connectivity inpoel has incorrect "
-              "size" );
+      Assert( jacElem.nunk() == U.nunk(), "Element Jacobian data has "
+              "incorrect size" );
       Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
               "Mismatch in inpofa size" );
 
-      // set rhs to zero
-      R.fill(0.0);
+      // set rhs to zero in the interior phase, the chare-boundary phase adds
+      // the fluxes across chare-boundary faces to it
+      if (phase == inciter::RhsPhase::INTERIOR) R.fill(0.0);
 
       // empty vector for non-conservative terms. This vector is unused for
       // single-material hydrodynamics since, there are no non-conservative
@@ -174,42 +181,49 @@ class CompFlow {
         { m_bcsym, Symmetry },
         { m_bcextrapolate, Extrapolate } }};
 
-      // compute internal surface flux integrals
-      tk::surfInt( m_system, m_ncomp, 1, m_offset, ndof, rdof, inpoel, coord,
-                   fd, geoFace, rieflxfn, velfn, U, ndofel, R, riemannDeriv );
+      // compute internal or chare-boundary surface flux integrals
+      tk::surfInt( m_system, m_ncomp, 1, m_offset, ndof, rdof, jacElem, coord,
+                   fd, phase, geoFace, faceQuad, m_riemann.type(), velfn, U,
+                   ndofel, lts, R, riemannDeriv );
+
+      // all other terms only require data of owned elements
+      if (phase == inciter::RhsPhase::CHBND) return;
 
       // compute source term intehrals
-      tk::srcInt( m_system, m_ncomp, m_offset, t, ndof, inpoel, coord, geoElem,
-                  Problem::src, ndofel, R );
+      tk::srcInt( m_system, m_ncomp, m_offset, t, ndof, geoElem, jacElem,
+                  Problem::src, ndofel, lts, R );
 
       if(ndof > 1)
         // compute volume integrals
-        tk::volInt( m_system, m_ncomp, m_offset, ndof, inpoel, coord, geoElem,
-                    flux, velfn, U, ndofel, R );
+        tk::volInt( m_system, m_ncomp, m_offset, ndof, geoElem, jacElem,
+                    flux, velfn, U, ndofel, lts, R );
 
       // compute boundary surface flux integrals
       for (const auto& b : bctypes)
         tk::bndSurfInt( m_system, m_ncomp, 1, m_offset, ndof, rdof, b.first, fd,
-                        geoFace, inpoel, coord, t, rieflxfn, velfn, b.second, U,
-                        ndofel, R, riemannDeriv );
+                        geoFace, jacElem, coord, t, rieflxfn, velfn, b.second,
+                        U, ndofel, lts, R, riemannDeriv );
     }
 
     //! Compute the minimum time step size
     //! \param[in] coord Mesh node coordinates
-    //! \param[in] inpoel Mesh element connectivity
     //! \param[in] fd Face connectivity and boundary conditions object
     //! \param[in] geoFace Face geometry array
     //! \param[in] geoElem Element geometry array
+    //! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
     //! \param[in] ndofel Vector of local number of degrees of freedom
     //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] eldt Allowable time step size of each element, lowered
+    //!   to that of this PDE system where smaller
     //! \return Minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
-                 const std::vector< std::size_t >& inpoel,
                  const inciter::FaceData& fd,
                  const tk::Fields& geoFace,
                  const tk::Fields& geoElem,
+                 const tk::Fields& jacElem,
                  const std::vector< std::size_t >& ndofel,
-                 const tk::Fields& U ) const
+                 const tk::Fields& U,
+                 std::vector< tk::real >& eldt ) const
     {
       const auto rdof = g_inputdeck.get< tag::discr, tag::rdof >();
 
@@ -260,17 +274,6 @@ class CompFlow {
         // get quadrature point weights and coordinates for triangle
         tk::GaussQuadratureTri( ng, coordgp, wgp );
 
-        // Extract the left element coordinates
-        std::array< std::array< tk::real, 3>, 4 > coordel_l {{
-          {{ cx[inpoel[4*el  ]], cy[inpoel[4*el  ]], cz[inpoel[4*el  ]] }},
-          {{ cx[inpoel[4*el+1]], cy[inpoel[4*el+1]], cz[inpoel[4*el+1]] }},
-          {{ cx[inpoel[4*el+2]], cy[inpoel[4*el+2]], cz[inpoel[4*el+2]] }},
-          {{ cx[inpoel[4*el+3]], cy[inpoel[4*el+3]], cz[inpoel[4*el+3]] }} }};
-
-        // Compute the determinant of Jacobian matrix
-        auto detT_l = 
-           tk::Jacobian(coordel_l[0], coordel_l[1], coordel_l[2], coordel_l[3]);
-
         // Extract the face coordinates
         std::array< std::array< tk::real, 3>, 3 > coordfa {{
           {{ cx[ inpofa[3*f  ] ], cy[ inpofa[3*f  ] ], cz[ inpofa[3*f  ] ] }},
@@ -288,10 +291,8 @@ class CompFlow {
           auto gp = tk::eval_gp( igp, coordfa, coordgp );
 
           // Compute the basis function for the left element
-          auto B_l = tk::eval_basis( ndofel[el],
-            tk::Jacobian(coordel_l[0], gp, coordel_l[2], coordel_l[3])/detT_l,
-            tk::Jacobian(coordel_l[0], coordel_l[1], gp, coordel_l[3])/detT_l,
-            tk::Jacobian(coordel_l[0], coordel_l[1], coordel_l[2], gp)/detT_l );
+          auto xi_l = tk::refCoordElem( jacElem, el, gp );
+          auto B_l = tk::eval_basis( ndofel[el], xi_l[0], xi_l[1], xi_l[2] );
 
           auto wt = wgp[igp] * geoFace(f,0,0);
 
@@ -336,26 +337,12 @@ class CompFlow {
             // nodal coordinates of the right element
             std::size_t eR = static_cast< std::size_t >( er );
 
-            // Extract the left element coordinates
-            std::array< std::array< tk::real, 3>, 4 > coordel_r {{
-              {{ cx[inpoel[4*eR  ]], cy[inpoel[4*eR  ]], cz[inpoel[4*eR  ]] }},
-              {{ cx[inpoel[4*eR+1]], cy[inpoel[4*eR+1]], cz[inpoel[4*eR+1]] }},
-              {{ cx[inpoel[4*eR+2]], cy[inpoel[4*eR+2]], cz[inpoel[4*eR+2]] }},
-              {{ cx[inpoel[4*eR+3]], cy[inpoel[4*eR+3]], cz[inpoel[4*eR+3]] }}
-            }};
-
-            // Compute the determinant of Jacobian matrix
-            auto detT_r =
-              tk::Jacobian(coordel_r[0],coordel_r[1],coordel_r[2],coordel_r[3]);
-
             // Compute the coordinates of quadrature point at physical domain
             gp = tk::eval_gp( igp, coordfa, coordgp );
 
             // Compute the basis function for the right element
-            auto B_r = tk::eval_basis( ndofel[eR],
-              tk::Jacobian(coordel_r[0],gp,coordel_r[2],coordel_r[3])/detT_r,
-              tk::Jacobian(coordel_r[0],coordel_r[1],gp,coordel_r[3])/detT_r,
-              tk::Jacobian(coordel_r[0],coordel_r[1],coordel_r[2],gp)/detT_r );
+            auto xi_r = tk::refCoordElem( jacElem, eR, gp );
+            auto B_r = tk::eval_basis( ndofel[eR], xi_r[0], xi_r[1], xi_r[2] );
  
             for (ncomp_t c=0; c<5; ++c)
             {
@@ -399,7 +386,9 @@ class CompFlow {
       // compute allowable dt
       for (std::size_t e=0; e<U.nunk(); ++e)
       {
-        mindt = std::min( mindt, geoElem(e,0,0)/delt[e] );
+        auto edt = geoElem(e,0,0)/delt[e];
+        mindt = std::min( mindt, edt );
+        eldt[e] = std::min( eldt[e], edt );
       }
 
       return mindt;
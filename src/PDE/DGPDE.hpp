@@ -28,6 +28,7 @@
 #include "Make_unique.hpp"
 #include "Fields.hpp"
 #include "FaceData.hpp"
+#include "TimeLevels.hpp"
 #include "UnsMesh.hpp"
 
 namespace inciter {
@@ -90,28 +91,35 @@ class DGPDE {
     { self->lhs( geoElem, l ); }
 
     //! Public interface to computing the P1 right-hand side vector
-    void rhs( tk::real t,
+    void rhs( inciter::RhsPhase phase,
+              tk::real t,
               const tk::Fields& geoFace,
+              const std::vector< tk::real >& faceQuad,
               const tk::Fields& geoElem,
+              const tk::Fields& jacElem,
               const inciter::FaceData& fd,
-              const std::vector< std::size_t >& inpoel,
               const tk::UnsMesh::Coords& coord,
               const tk::Fields& U,
               const std::vector< std::size_t >& ndofel,
+              const inciter::TimeLevels& lts,
               tk::Fields& R ) const
     {
-      self->rhs( t, geoFace, geoElem, fd, inpoel, coord, U, ndofel, R );
+      self->rhs( phase, t, geoFace, faceQuad, geoElem, jacElem, fd, coord, U,
+                 ndofel, lts, R );
     }
 
     //! Public interface for computing the minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
-                 const std::vector< std::size_t >& inpoel,
                  const inciter::FaceData& fd,
                  const tk::Fields& geoFace,
                  const tk::Fields& geoElem,
+                 const tk::Fields& jacElem,
                  const std::vector< std::size_t >& ndofel,
-                 const tk::Fields& U ) const
-    { return self->dt( coord, inpoel, fd, geoFace, geoElem, ndofel, U ); }
+                 const tk::Fields& U,
+                 std::vector< tk::real >& eldt ) const
+    {
+      return self->dt( coord, fd, geoFace, geoElem, jacElem, ndofel, U, eldt );
+    }
 
     //! \brief Public interface for collecting all side set IDs the user has
     //!   configured for all components of a PDE system
@@ -168,22 +176,26 @@ class DGPDE {
                                tk::real,
                                const std::size_t nielem ) const = 0;
       virtual void lhs( const tk::Fields&, tk::Fields& ) const = 0;
-      virtual void rhs( tk::real,
+      virtual void rhs( inciter::RhsPhase,
+                        tk::real,
+                        const tk::Fields&,
+                        const std::vector< tk::real >&,
                         const tk::Fields&,
                         const tk::Fields&,
                         const inciter::FaceData&,
-                        const std::vector< std::size_t >&,
                         const tk::UnsMesh::Coords&,
                         const tk::Fields&,
                         const std::vector< std::size_t >&,
+                        const inciter::TimeLevels&,
                         tk::Fields& ) const = 0;
       virtual tk::real dt( const std::array< std::vector< tk::real >, 3 >&,
-                           const std::vector< std::size_t >&,
                            const inciter::FaceData&,
                            const tk::Fields&,
                            const tk::Fields&,
+                           const tk::Fields&,
                            const std::vector< std::size_t >&,
-                           const tk::Fields& ) const = 0;
+                           const tk::Fields&,
+                           std::vector< tk::real >& ) const = 0;
       virtual void side( std::unordered_set< int >& conf ) const = 0;
       virtual std::vector< std::string > fieldNames() const = 0;
       virtual std::vector< std::string > names() const = 0;
@@ -215,26 +227,32 @@ class DGPDE {
       const override { data.initialize( L, inpoel, coord, unk, t, nielem ); }
       void lhs( const tk::Fields& geoElem, tk::Fields& l ) const override
       { data.lhs( geoElem, l ); }
-      void rhs( tk::real t,
+      void rhs( inciter::RhsPhase phase,
+                tk::real t,
                 const tk::Fields& geoFace,
+                const std::vector< tk::real >& faceQuad,
                 const tk::Fields& geoElem,
+                const tk::Fields& jacElem,
                 const inciter::FaceData& fd,
-                const std::vector< std::size_t >& inpoel,
                 const tk::UnsMesh::Coords& coord,
                 const tk::Fields& U,
                 const std::vector< std::size_t >& ndofel,
+                const inciter::TimeLevels& lts,
                 tk::Fields& R ) const override
       {
-        data.rhs( t, geoFace, geoElem, fd, inpoel, coord, U, ndofel, R );
+        data.rhs( phase, t, geoFace, faceQuad, geoElem, jacElem, fd, coord, U,
+                  ndofel, lts, R );
       }
       tk::real dt( const std::array< std::vector< tk::real >, 3 >& coord,
-                   const std::vector< std::size_t >& inpoel,
                    const inciter::FaceData& fd,
                    const tk::Fields& geoFace,
                    const tk::Fields& geoElem,
+                   const tk::Fields& jacElem,
                    const std::vector< std::size_t >& ndofel,
-                   const tk::Fields& U ) const override
-      { return data.dt( coord, inpoel, fd, geoFace, geoElem, ndofel, U ); }
+                   const tk::Fields& U,
+                   std::vector< tk::real >& eldt ) const override
+      { return data.dt( coord, fd, geoFace, geoElem, jacElem, ndofel, U, eldt );
+      }
       void side( std::unordered_set< int >& conf ) const override
       { data.side( conf ); }
       std::vector< std::string > fieldNames() const override
@@ -331,6 +331,37 @@ tk::eval_state ( ncomp_t ncomp,
   // Array of state variable for tetrahedron element
   std::vector< tk::real > state( ncomp );
 
+  eval_state( ncomp, offset, ndof, ndof_el, e, U, B.data(), state );
+
+  return state;
+}
+
+void
+tk::eval_state ( ncomp_t ncomp,
+                 ncomp_t offset,
+                 const std::size_t ndof,
+                 const std::size_t ndof_el,
+                 const std::size_t e,
+                 const Fields& U,
+                 const tk::real* B,
+                 std::vector< tk::real >& state )
+// *****************************************************************************
+//  Compute the state variables for the tetrahedron element into a given buffer
+//! \param[in] ncomp Number of scalar components in this PDE system
+//! \param[in] offset Offset this PDE system operates from
+//! \param[in] ndof Maximum number of degrees of freedom
+//! \param[in] ndof_el Number of degrees of freedom for the local element
+//! \param[in] e Index for the tetrahedron element
+//! \param[in] U Solution vector at recent time step
+//! \param[in] B Pointer to (at least ndof_el) basis functions
+//! \param[in,out] state State variables for tetrahedron element, must be
+//!   sized to at least ncomp by the caller
+//! \details This overload does not allocate and is used in hot loops where the
+//!   caller can reuse the state buffer across quadrature points.
+// *****************************************************************************
+{
+  Assert( state.size() >= ncomp, "Size mismatch" );
+
   for (ncomp_t c=0; c<ncomp; ++c)
   {
     auto mark = c*ndof;
@@ -353,6 +384,4 @@ tk::eval_state ( ncomp_t ncomp,
                 + U( e, mark+9, offset ) * B[9];
     }
   }
-
-  return state;
 }
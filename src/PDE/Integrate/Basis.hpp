@@ -72,6 +72,16 @@ eval_state ( ncomp_t ncomp,
              const Fields& U,
              const std::vector< tk::real >& B );
 
+void
+eval_state ( ncomp_t ncomp,
+             ncomp_t offset,
+             const std::size_t ndof,
+             const std::size_t ndof_el,
+             const std::size_t e,
+             const Fields& U,
+             const tk::real* B,
+             std::vector< tk::real >& state );
+
 } // tk::
 
 #endif // Basis_h
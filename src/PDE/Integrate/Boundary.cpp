@@ -19,6 +19,8 @@
 #include "Boundary.hpp"
 #include "Vector.hpp"
 #include "Quadrature.hpp"
+#include "ThreadPool.hpp"
+#include "DerivedData.hpp"
 
 void
 tk::bndSurfInt( ncomp_t system,
@@ -30,7 +32,7 @@ tk::bndSurfInt( ncomp_t system,
                 const std::vector< bcconf_t >& bcconfig,
                 const inciter::FaceData& fd,
                 const Fields& geoFace,
-                const std::vector< std::size_t >& inpoel,
+                const Fields& jacElem,
                 const UnsMesh::Coords& coord,
                 real t,
                 const RiemannFluxFn& flux,
@@ -38,6 +40,7 @@ tk::bndSurfInt( ncomp_t system,
                 const StateFn& state,
                 const Fields& U,
                 const std::vector< std::size_t >& ndofel,
+                const inciter::TimeLevels& lts,
                 Fields& R,
                 std::vector< std::vector< tk::real > >& riemannDeriv )
 // *****************************************************************************
@@ -54,7 +57,7 @@ tk::bndSurfInt( ncomp_t system,
 //! \param[in] bcconfig BC configuration vector for multiple side sets
 //! \param[in] fd Face connectivity and boundary conditions object
 //! \param[in] geoFace Face geometry array
-//! \param[in] inpoel Element-node connectivity
+//! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
 //! \param[in] coord Array of nodal coordinates
 //! \param[in] t Physical time
 //! \param[in] flux Riemann flux function to use
@@ -63,6 +66,8 @@ tk::bndSurfInt( ncomp_t system,
 //!   boundaries
 //! \param[in] U Solution vector at recent time step
 //! \param[in] ndofel Vector of local number of degrees of freedom
+//! \param[in] lts Time step levels of elements: only faces of elements active
+//!   in the current substep are integrated
 //! \param[in,out] R Right-hand side vector computed
 //! \param[in,out] riemannDeriv Derivatives of partial-pressures and velocities
 //!   computed from the Riemann solver for use in the non-conservative terms.
@@ -81,92 +86,93 @@ tk::bndSurfInt( ncomp_t system,
   Assert( (nmat==1 ? riemannDeriv.empty() : true), "Non-empty Riemann "
           "derivative vector for single material compflow" );
 
-  for (const auto& s : bcconfig) {       // for all bc sidesets
-    auto bc = bface.find( std::stoi(s) );// faces for side set
-    if (bc != end(bface))
+  const auto& bcolor = fd.Bcolor();
+
+  Assert( bface.empty() || !bcolor.empty(),
+          "Boundary faces not colored, see inciter::FaceData::color()" );
+
+  // integrate boundary face f
+  auto face = [&]( std::size_t f ) {
+    Assert( esuf[2*f+1] == -1, "outside boundary element not -1" );
+
+    std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+
+    if (!lts.active(el)) return;
+
+    auto ng = tk::NGfa(ndofel[el]);
+
+    // arrays for quadrature points
+    std::array< std::vector< real >, 2 > coordgp;
+    std::vector< real > wgp;
+
+    coordgp[0].resize( ng );
+    coordgp[1].resize( ng );
+    wgp.resize( ng );
+
+    // get quadrature point weights and coordinates for triangle
+    GaussQuadratureTri( ng, coordgp, wgp );
+
+    // Extract the face coordinates
+    std::array< std::array< tk::real, 3>, 3 > coordfa {{
+      {{ cx[ inpofa[3*f  ] ], cy[ inpofa[3*f  ] ], cz[ inpofa[3*f  ] ] }},
+      {{ cx[ inpofa[3*f+1] ], cy[ inpofa[3*f+1] ], cz[ inpofa[3*f+1] ] }},
+      {{ cx[ inpofa[3*f+2] ], cy[ inpofa[3*f+2] ], cz[ inpofa[3*f+2] ] }} }};
+
+    std::array< real, 3 >
+      fn{{ geoFace(f,1,0), geoFace(f,2,0), geoFace(f,3,0) }};
+
+    // Gaussian quadrature
+    for (std::size_t igp=0; igp<ng; ++igp)
     {
-      for (const auto& f : bc->second)
+      // Compute the coordinates of quadrature point at physical domain
+      auto gp = eval_gp( igp, coordfa, coordgp );
+
+      // If an rDG method is set up (P0P1), then, currently we compute the P1
+      // basis functions and solutions by default. This implies that P0P1 is
+      // unsupported in the p-adaptive DG (PDG).
+      std::size_t dof_el;
+      if (rdof > ndof)
       {
-        Assert( esuf[2*f+1] == -1, "outside boundary element not -1" );
-
-        std::size_t el = static_cast< std::size_t >(esuf[2*f]);
-
-        auto ng = tk::NGfa(ndofel[el]);
-
-        // arrays for quadrature points
-        std::array< std::vector< real >, 2 > coordgp;
-        std::vector< real > wgp;
-
-        coordgp[0].resize( ng );
-        coordgp[1].resize( ng );
-        wgp.resize( ng );
-
-        // get quadrature point weights and coordinates for triangle
-        GaussQuadratureTri( ng, coordgp, wgp );
-
-        // Extract the left element coordinates
-        std::array< std::array< tk::real, 3>, 4 > coordel_l {{
-        {{ cx[ inpoel[4*el  ] ], cy[ inpoel[4*el  ] ], cz[ inpoel[4*el  ] ] }},
-        {{ cx[ inpoel[4*el+1] ], cy[ inpoel[4*el+1] ], cz[ inpoel[4*el+1] ] }},
-        {{ cx[ inpoel[4*el+2] ], cy[ inpoel[4*el+2] ], cz[ inpoel[4*el+2] ] }},
-        {{ cx[ inpoel[4*el+3] ], cy[ inpoel[4*el+3] ], cz[ inpoel[4*el+3] ] }} }};
-
-        // Compute the determinant of Jacobian matrix
-        auto detT_l =
-          Jacobian( coordel_l[0], coordel_l[1], coordel_l[2], coordel_l[3] );
-
-        // Extract the face coordinates
-        std::array< std::array< tk::real, 3>, 3 > coordfa {{
-          {{ cx[ inpofa[3*f  ] ], cy[ inpofa[3*f  ] ], cz[ inpofa[3*f  ] ] }},
-          {{ cx[ inpofa[3*f+1] ], cy[ inpofa[3*f+1] ], cz[ inpofa[3*f+1] ] }},
-          {{ cx[ inpofa[3*f+2] ], cy[ inpofa[3*f+2] ], cz[ inpofa[3*f+2] ] }} }};
-
-        std::array< real, 3 >
-          fn{{ geoFace(f,1,0), geoFace(f,2,0), geoFace(f,3,0) }};
-
-        // Gaussian quadrature
-        for (std::size_t igp=0; igp<ng; ++igp)
-        {
-          // Compute the coordinates of quadrature point at physical domain
-          auto gp = eval_gp( igp, coordfa, coordgp );
-
-          // If an rDG method is set up (P0P1), then, currently we compute the P1
-          // basis functions and solutions by default. This implies that P0P1 is
-          // unsupported in the p-adaptive DG (PDG).
-          std::size_t dof_el;
-          if (rdof > ndof)
-          {
-            dof_el = rdof;
-          }
-          else
-          {
-            dof_el = ndofel[el];
-          }
-
-          //Compute the basis functions for the left element
-          auto B_l = eval_basis( dof_el,
-            Jacobian( coordel_l[0], gp, coordel_l[2], coordel_l[3] ) / detT_l,
-            Jacobian( coordel_l[0], coordel_l[1], gp, coordel_l[3] ) / detT_l,
-            Jacobian( coordel_l[0], coordel_l[1], coordel_l[2], gp ) / detT_l );
-
-          auto wt = wgp[igp] * geoFace(f,0,0);
-
-          // Compute the state variables at the left element
-          auto ugp = eval_state( ncomp, offset, rdof, dof_el, el, U, B_l );
-
-          Assert( ugp.size() == ncomp, "Size mismatch" );
-
-          // Compute the numerical flux
-          auto fl = flux( fn,
-                      state( system, ncomp, ugp, gp[0], gp[1], gp[2], t, fn ),
-                      vel( system, ncomp, gp[0], gp[1], gp[2] ) );
-
-          // Add the surface integration term to the rhs
-          update_rhs_bc( ncomp, nmat, offset, ndof, ndofel[el], wt, fn, el, fl,
-                         B_l, R, riemannDeriv );
-        }
+        dof_el = rdof;
       }
+      else
+      {
+        dof_el = ndofel[el];
+      }
+
+      //Compute the basis functions for the left element
+      auto xi_l = refCoordElem( jacElem, el, gp );
+      auto B_l = eval_basis( dof_el, xi_l[0], xi_l[1], xi_l[2] );
+
+      auto wt = wgp[igp] * geoFace(f,0,0);
+
+      // Compute the state variables at the left element
+      auto ugp = eval_state( ncomp, offset, rdof, dof_el, el, U, B_l );
+
+      Assert( ugp.size() == ncomp, "Size mismatch" );
+
+      // Compute the numerical flux
+      auto fl = flux( fn,
+                  state( system, ncomp, ugp, gp[0], gp[1], gp[2], t, fn ),
+                  vel( system, ncomp, gp[0], gp[1], gp[2] ) );
+
+      // Add the surface integration term to the rhs
+      update_rhs_bc( ncomp, nmat, offset, ndof, ndofel[el], wt, fn, el, fl,
+                     B_l, R, riemannDeriv );
     }
+  };
+
+  // The faces of a color do not share elements, see
+  // inciter::FaceData::color(), so they are split among threads
+  auto& pool = tk::threadpool();
+
+  for (const auto& s : bcconfig) {       // for all bc sidesets
+    auto bc = bcolor.find( std::stoi(s) );// faces for side set by colors
+    if (bc != end(bcolor))
+      for (const auto& faces : bc->second)
+        pool.parallelFor( faces.size(),
+          [&]( std::size_t first, std::size_t last, std::size_t ){
+            for (auto i=first; i<last; ++i) face( faces[i] ); } );
   }
 }
 
@@ -39,7 +39,7 @@ bndSurfInt( ncomp_t system,
             const std::vector< bcconf_t >& bcconfig,
             const inciter::FaceData& fd,
             const Fields& geoFace,
-            const std::vector< std::size_t >& inpoel,
+            const Fields& jacElem,
             const UnsMesh::Coords& coord,
             real t,
             const RiemannFluxFn& flux,
@@ -47,6 +47,7 @@ bndSurfInt( ncomp_t system,
             const StateFn& state,
             const Fields& U,
             const std::vector< std::size_t >& ndofel,
+            const inciter::TimeLevels& lts,
             Fields& R,
             std::vector< std::vector< tk::real > >& riemannDeriv );
 
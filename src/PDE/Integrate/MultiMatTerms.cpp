@@ -17,6 +17,7 @@
 #include "MultiMatTerms.hpp"
 #include "Vector.hpp"
 #include "Quadrature.hpp"
+#include "DerivedData.hpp"
 #include "EoS/EoS.hpp"
 #include "MultiMat/MultiMatIndexing.hpp"
 
@@ -27,13 +28,13 @@ tk::nonConservativeInt( ncomp_t system,
                         ncomp_t offset,
                         const std::size_t ndof,
                         const std::size_t rdof,
-                        const std::vector< std::size_t >& inpoel,
-                        const UnsMesh::Coords& coord,
                         const Fields& geoElem,
+                        const Fields& jacElem,
                         const Fields& U,
                         const std::vector< std::vector< tk::real > >&
                           riemannDeriv,
                         const std::vector< std::size_t >& ndofel,
+                        const inciter::TimeLevels& lts,
                         Fields& R )
 // *****************************************************************************
 //  Compute volume integrals for multi-material DG
@@ -49,13 +50,14 @@ tk::nonConservativeInt( ncomp_t system,
 //! \param[in] offset Offset this PDE system operates from
 //! \param[in] ndof Maximum number of degrees of freedom
 //! \param[in] rdof Maximum number of reconstructed degrees of freedom
-//! \param[in] inpoel Element-node connectivity
-//! \param[in] coord Array of nodal coordinates
 //! \param[in] geoElem Element geometry array
+//! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
 //! \param[in] U Solution vector at recent time step
 //! \param[in] riemannDeriv Derivatives of partial-pressures and velocities
 //!   computed from the Riemann solver for use in the non-conservative terms
 //! \param[in] ndofel Vector of local number of degrees of freedome
+//! \param[in] lts Time step levels of elements: only elements active in the
+//!   current substep are integrated
 //! \param[in,out] R Right-hand side vector added to
 // *****************************************************************************
 {
@@ -66,13 +68,11 @@ tk::nonConservativeInt( ncomp_t system,
 
   IGNORE(system);
 
-  const auto& cx = coord[0];
-  const auto& cy = coord[1];
-  const auto& cz = coord[2];
-
   // compute volume integrals
   for (std::size_t e=0; e<U.nunk(); ++e)
   {
+    if (!lts.active(e)) continue;
+
     auto ng = tk::NGvol(ndofel[e]);
 
     // arrays for quadrature points
@@ -86,16 +86,7 @@ tk::nonConservativeInt( ncomp_t system,
 
     GaussQuadratureTet( ng, coordgp, wgp );
 
-    // Extract the element coordinates
-    std::array< std::array< real, 3>, 4 > coordel {{
-      {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
-      {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
-      {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
-      {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }}
-    }};
-
-    auto jacInv =
-            inverseJacobian( coordel[0], coordel[1], coordel[2], coordel[3] );
+    auto jacInv = jacInvElem( jacElem, e );
 
     // Compute the derivatives of basis function for DG(P1)
     std::array< std::vector<tk::real>, 3 > dBdx;
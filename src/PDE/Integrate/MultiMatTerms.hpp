@@ -20,6 +20,7 @@
 #include "Types.hpp"
 #include "Fields.hpp"
 #include "UnsMesh.hpp"
+#include "TimeLevels.hpp"
 
 namespace tk {
 
@@ -33,12 +34,12 @@ nonConservativeInt( ncomp_t system,
                     ncomp_t offset,
                     const std::size_t ndof,
                     const std::size_t rdof,
-                    const std::vector< std::size_t >& inpoel,
-                    const UnsMesh::Coords& coord,
                     const Fields& geoElem,
+                    const Fields& jacElem,
                     const Fields& U,
                     const std::vector< std::vector< tk::real > >& riemannDeriv,
                     const std::vector< std::size_t >& ndofel,
+                    const inciter::TimeLevels& lts,
                     Fields& R );
 
 //! Update the rhs by adding the non-conservative term integrals
@@ -24,6 +24,7 @@
 #include "Inciter/Options/Flux.hpp"
 #include "EoS/EoS.hpp"
 #include "MultiMat/MultiMatIndexing.hpp"
+#include "RiemannBlock.hpp"
 
 namespace inciter {
 
@@ -184,6 +185,220 @@ struct AUSM {
     return flx;
   }
 
+  //! Configure a block of Riemann problems for the batched AUSM+up flux
+  //! \param[in] system Equation system index
+  //! \param[in,out] b Block of Riemann problems to configure
+  //! \details Besides copying the material parameters into the block, this
+  //!   sizes the scratch space used by the batched flux function: 16 arrays of
+  //!   per-point mixture quantities and 2 arrays of material pressures per
+  //!   material, each RiemannBlock::width long.
+  static void configure( ncomp_t system, RiemannBlock& b ) {
+    const auto nmat =
+      g_inputdeck.get< tag::param, tag::multimat, tag::nmat >()[ system ];
+    Assert( b.ncomp == 3*nmat+3, "Size of multi-material state incorrect" );
+    Assert( b.nflux == b.ncomp+nmat+1, "Size of multi-material flux "
+            "vector incorrect" );
+    b.nmat = nmat;
+    b.gamma =
+      g_inputdeck.get< tag::param, tag::multimat, tag::gamma >()[ system ];
+    b.pstiff =
+      g_inputdeck.get< tag::param, tag::multimat, tag::pstiff >()[ system ];
+    b.work.resize( (16 + 2*nmat) * RiemannBlock::width );
+  }
+
+  //! Batched AUSM+up approximate Riemann solver flux function
+  //! \param[in,out] b Block of Riemann problems, configured by configure(),
+  //!   whose fluxes to compute
+  //! \details This computes the same fluxes, appended by the Riemann-advected
+  //!   partial pressures and Riemann velocity, as the single-point flux()
+  //!   above for all b.n Riemann problems in the block. The computation is
+  //!   organized in passes with the loop over materials outside and the loop
+  //!   over the Riemann problems inside, with the per-material temporaries
+  //!   held in b.work, so that the inner loops have unit stride and no
+  //!   heap allocation.
+  static void flux( RiemannBlock& b ) {
+    Assert( b.n <= RiemannBlock::width, "Riemann block overflow" );
+    Assert( b.work.size() >= (16 + 2*b.nmat) * RiemannBlock::width,
+            "Riemann block not configured for AUSM" );
+
+    const std::size_t W = RiemannBlock::width;
+    const auto n = b.n;
+    const auto nmat = b.nmat;
+
+    const auto nx = b.fn[0].data();
+    const auto ny = b.fn[1].data();
+    const auto nz = b.fn[2].data();
+
+    // Per-point mixture quantities and per-material pressures in scratch
+    auto w = b.work.data();
+    auto rhol = w,       rhor = w + W,
+         ul = w + 2*W,   vl = w + 3*W,   wl = w + 4*W,
+         ur = w + 5*W,   vr = w + 6*W,   wr = w + 7*W,
+         pl = w + 8*W,   pr = w + 9*W,   ac12 = w + 10*W, rho12 = w + 11*W,
+         vriem = w + 12*W, p12 = w + 13*W, lp = w + 14*W, lm = w + 15*W;
+    auto pml = w + 16*W;
+    auto pmr = w + (16+nmat)*W;
+
+    // Mixture densities
+    for (std::size_t i=0; i<n; ++i) {
+      rhol[i] = 0.0;
+      rhor[i] = 0.0;
+    }
+    for (std::size_t k=0; k<nmat; ++k) {
+      const auto dl = b.left( densityIdx(nmat, k) );
+      const auto dr = b.right( densityIdx(nmat, k) );
+      for (std::size_t i=0; i<n; ++i) {
+        rhol[i] += dl[i];
+        rhor[i] += dr[i];
+      }
+    }
+
+    // Velocities
+    {
+      const auto mxl = b.left( momentumIdx(nmat, 0) );
+      const auto myl = b.left( momentumIdx(nmat, 1) );
+      const auto mzl = b.left( momentumIdx(nmat, 2) );
+      const auto mxr = b.right( momentumIdx(nmat, 0) );
+      const auto myr = b.right( momentumIdx(nmat, 1) );
+      const auto mzr = b.right( momentumIdx(nmat, 2) );
+      for (std::size_t i=0; i<n; ++i) {
+        ul[i] = mxl[i]/rhol[i];
+        vl[i] = myl[i]/rhol[i];
+        wl[i] = mzl[i]/rhol[i];
+        ur[i] = mxr[i]/rhor[i];
+        vr[i] = myr[i]/rhor[i];
+        wr[i] = mzr[i]/rhor[i];
+        pl[i] = 0.0;
+        pr[i] = 0.0;
+        ac12[i] = 0.0;
+      }
+    }
+
+    // Material pressures, mixture pressures, and the mixture speed of sound
+    // accumulated over materials, see eos_pressure and eos_soundspeed
+    for (std::size_t k=0; k<nmat; ++k) {
+      const auto g = b.gamma[k];
+      const auto p_c = b.pstiff[k];
+      const auto all = b.left( volfracIdx(nmat, k) );
+      const auto alr = b.right( volfracIdx(nmat, k) );
+      const auto dl = b.left( densityIdx(nmat, k) );
+      const auto dr = b.right( densityIdx(nmat, k) );
+      const auto el = b.left( energyIdx(nmat, k) );
+      const auto er = b.right( energyIdx(nmat, k) );
+      auto pmlk = pml + k*W;
+      auto pmrk = pmr + k*W;
+      for (std::size_t i=0; i<n; ++i) {
+        auto rhoml = dl[i]/all[i];
+        auto rhomr = dr[i]/alr[i];
+        pmlk[i] = (el[i]/all[i] - 0.5 * rhoml
+                   * (ul[i]*ul[i] + vl[i]*vl[i] + wl[i]*wl[i]) - p_c)
+                  * (g-1.0) - p_c;
+        pmrk[i] = (er[i]/alr[i] - 0.5 * rhomr
+                   * (ur[i]*ur[i] + vr[i]*vr[i] + wr[i]*wr[i]) - p_c)
+                  * (g-1.0) - p_c;
+        pl[i] += all[i] * pmlk[i];
+        pr[i] += alr[i] * pmrk[i];
+        auto amatl = std::sqrt( g * (pmlk[i]+p_c) / rhoml );
+        auto amatr = std::sqrt( g * (pmrk[i]+p_c) / rhomr );
+        // Average states for mixture speed of sound
+        auto al_12 = 0.5*(all[i]+alr[i]);
+        auto rhomat12 = 0.5*(rhoml + rhomr);
+        auto amat12 = 0.5*(amatl+amatr);
+        ac12[i] += (al_12*rhomat12*amat12*amat12);
+      }
+    }
+
+    // Riemann velocity and pressure
+    for (std::size_t i=0; i<n; ++i) {
+      rho12[i] = 0.5*(rhol[i]+rhor[i]);
+      ac12[i] = std::sqrt( ac12[i]/rho12[i] );
+
+      // Face-normal velocities
+      auto vnl = ul[i]*nx[i] + vl[i]*ny[i] + wl[i]*nz[i];
+      auto vnr = ur[i]*nx[i] + vr[i]*ny[i] + wr[i]*nz[i];
+
+      // Mach numbers
+      auto ml = vnl/ac12[i];
+      auto mr = vnr/ac12[i];
+
+      // All-speed parameters
+      tk::real k_u(0.0), k_p(0.0), f_a(1.0);
+
+      // Split Mach polynomials
+      auto msl = splitmach_ausm( f_a, ml );
+      auto msr = splitmach_ausm( f_a, mr );
+
+      // Riemann Mach number
+      auto m0 = 1.0 - (0.5*(vnl*vnl + vnr*vnr)/(ac12[i]*ac12[i]));
+      auto mp = -k_p* std::max(m0, 0.0) * (pr[i]-pl[i])
+                / (f_a*rho12[i]*ac12[i]*ac12[i]);
+      auto m12 = msl[0] + msr[1] + mp;
+      vriem[i] = ac12[i] * m12;
+
+      // Riemann pressure
+      auto pu = -k_u* msl[2] * msr[3] * f_a * rho12[i] * ac12[i] * (vnr-vnl);
+      p12[i] = msl[2]*pl[i] + msr[3]*pr[i] + pu;
+
+      // Flux vector splitting
+      lp[i] = 0.5 * (vriem[i] + std::fabs(vriem[i]));
+      lm[i] = 0.5 * (vriem[i] - std::fabs(vriem[i]));
+    }
+
+    // Conservative fluxes
+    for (std::size_t k=0; k<nmat; ++k) {
+      const auto all = b.left( volfracIdx(nmat, k) );
+      const auto alr = b.right( volfracIdx(nmat, k) );
+      const auto dl = b.left( densityIdx(nmat, k) );
+      const auto dr = b.right( densityIdx(nmat, k) );
+      const auto el = b.left( energyIdx(nmat, k) );
+      const auto er = b.right( energyIdx(nmat, k) );
+      const auto pmlk = pml + k*W;
+      const auto pmrk = pmr + k*W;
+      auto fal = b.flux( volfracIdx(nmat, k) );
+      auto fd = b.flux( densityIdx(nmat, k) );
+      auto fe = b.flux( energyIdx(nmat, k) );
+      for (std::size_t i=0; i<n; ++i) {
+        fal[i] = lp[i]*all[i] + lm[i]*alr[i];
+        fd[i] = lp[i]*dl[i] + lm[i]*dr[i];
+        fe[i] = lp[i]*(el[i] + all[i]*pmlk[i])
+              + lm[i]*(er[i] + alr[i]*pmrk[i]);
+      }
+    }
+
+    for (std::size_t idir=0; idir<3; ++idir) {
+      const auto ml = b.left( momentumIdx(nmat, idir) );
+      const auto mr = b.right( momentumIdx(nmat, idir) );
+      const auto fnd = b.fn[idir].data();
+      auto fm = b.flux( momentumIdx(nmat, idir) );
+      for (std::size_t i=0; i<n; ++i)
+        fm[i] = lp[i]*ml[i] + lm[i]*mr[i] + p12[i]*fnd[i];
+    }
+
+    // Store Riemann-advected partial pressures
+    for (std::size_t k=0; k<nmat; ++k) {
+      const auto all = b.left( volfracIdx(nmat, k) );
+      const auto alr = b.right( volfracIdx(nmat, k) );
+      const auto pmlk = pml + k*W;
+      const auto pmrk = pmr + k*W;
+      auto fp = b.flux( b.ncomp + k );
+      for (std::size_t i=0; i<n; ++i) {
+        auto lpn = lp[i]/( std::fabs(vriem[i]) + 1.0e-16 );
+        auto lmn = lm[i]/( std::fabs(vriem[i]) + 1.0e-16 );
+        fp[i] = std::fabs(lpn) > 1.0e-10 ? all[i]*pmlk[i] :
+                std::fabs(lmn) > 1.0e-10 ? alr[i]*pmrk[i] :
+                0.5*(all[i]*pmlk[i] + alr[i]*pmrk[i]);
+      }
+    }
+
+    // Store Riemann velocity
+    auto fv = b.flux( b.ncomp + nmat );
+    for (std::size_t i=0; i<n; ++i) fv[i] = vriem[i];
+  }
+
+  //! Query if the flux function uses a prescribed velocity
+  //! \return False: AUSM+up does not use a prescribed velocity
+  static constexpr bool prescribedVelocity() { return false; }
+
   //! Flux type accessor
   //! \return Flux type
   static ctr::FluxType type() noexcept { return ctr::FluxType::AUSM; }
@@ -0,0 +1,98 @@
+// *****************************************************************************
+/*!
+  \file      src/PDE/Integrate/Riemann/RiemannBlock.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Structure-of-arrays block of Riemann problems for batched fluxes
+  \details   This file defines a block of Riemann problems, i.e., left and
+    right states, face normals, and (optionally) prescribed velocities, stored
+    as structure of arrays, so that the batched flux functions of the Riemann
+    solvers can evaluate the fluxes for many quadrature points at once in loops
+    the compiler can inline and vectorize.
+*/
+// *****************************************************************************
+#ifndef RiemannBlock_h
+#define RiemannBlock_h
+
+#include <array>
+#include <vector>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+
+namespace inciter {
+
+//! Structure-of-arrays block of Riemann problems
+//! \details Component c of the i-th Riemann problem in the block is stored at
+//!   index c*width+i in the left and right states and in the fluxes, so that
+//!   a batched flux function, e.g., HLLC::flux( RiemannBlock& ), can sweep
+//!   over i with unit stride for every component. The material parameters of
+//!   the equation of state are copied into the block once (see the
+//!   configure() member functions of the Riemann solvers), so the flux loops
+//!   do not have to query the input deck.
+struct RiemannBlock {
+
+  //! Maximum number of Riemann problems in a block
+  static constexpr std::size_t width = 64;
+
+  //! Number of scalar components of the states
+  std::size_t ncomp;
+  //! Number of flux components computed, at least ncomp
+  std::size_t nflux;
+  //! Number of Riemann problems currently in the block, at most width
+  std::size_t n;
+  //! Number of materials
+  std::size_t nmat;
+  //! Ratio of specific heats for all materials
+  std::vector< tk::real > gamma;
+  //! Stiffness parameter for all materials
+  std::vector< tk::real > pstiff;
+  //! Face normals, x, y, z
+  std::array< std::array< tk::real, width >, 3 > fn;
+  //! Left states, ncomp*width
+  std::vector< tk::real > ul;
+  //! Right states, ncomp*width
+  std::vector< tk::real > ur;
+  //! Prescribed velocities, x, y, z, for all components, 3*ncomp*width
+  std::vector< tk::real > vel;
+  //! Fluxes computed, nflux*width
+  std::vector< tk::real > flx;
+  //! Scratch space for solvers that need per-material temporaries
+  std::vector< tk::real > work;
+
+  //! Constructor
+  //! \param[in] nc Number of scalar components of the states
+  //! \param[in] nf Number of flux components computed
+  explicit RiemannBlock( std::size_t nc, std::size_t nf ) :
+    ncomp( nc ), nflux( nf ), n( 0 ), nmat( 1 ), gamma(), pstiff(), fn(),
+    ul( nc*width, 0.0 ), ur( nc*width, 0.0 ), vel( 3*nc*width, 0.0 ),
+    flx( nf*width, 0.0 ), work()
+  {
+    Assert( nf >= nc, "Fewer flux than state components" );
+  }
+
+  //! Left state of component c for all Riemann problems in block
+  tk::real* left( std::size_t c ) { return ul.data() + c*width; }
+  //! Left state of component c for all Riemann problems in block
+  const tk::real* left( std::size_t c ) const { return ul.data() + c*width; }
+  //! Right state of component c for all Riemann problems in block
+  tk::real* right( std::size_t c ) { return ur.data() + c*width; }
+  //! Right state of component c for all Riemann problems in block
+  const tk::real* right( std::size_t c ) const { return ur.data() + c*width; }
+  //! Prescribed velocity direction d of component c for all Riemann problems
+  tk::real* velocity( std::size_t c, std::size_t d )
+  { return vel.data() + (3*c+d)*width; }
+  //! Prescribed velocity direction d of component c for all Riemann problems
+  const tk::real* velocity( std::size_t c, std::size_t d ) const
+  { return vel.data() + (3*c+d)*width; }
+  //! Flux of component c for all Riemann problems in block
+  tk::real* flux( std::size_t c ) { return flx.data() + c*width; }
+  //! Flux of component c for all Riemann problems in block
+  const tk::real* flux( std::size_t c ) const { return flx.data() + c*width; }
+};
+
+} // inciter::
+
+#endif // RiemannBlock_h
@@ -25,6 +25,7 @@
 #include "Make_unique.hpp"
 #include "Fields.hpp"
 #include "FunctionPrototypes.hpp"
+#include "Inciter/Options/Flux.hpp"
 
 namespace inciter {
 
@@ -77,6 +78,9 @@ class RiemannSolver {
           const std::vector< std::array< tk::real, 3 > >& v ) const
     { return self->flux( fn, u, v ); }
 
+    //! Public interface to querying the Riemann solver type
+    ctr::FluxType type() const { return self->type(); }
+
     //! Copy assignment
     RiemannSolver& operator=( const RiemannSolver& x )
     { RiemannSolver tmp(x); *this = std::move(tmp); return *this; }
@@ -100,6 +104,7 @@ class RiemannSolver {
         flux( const std::array< tk::real, 3 >&,
               const std::array< std::vector< tk::real >, 2 >&,
               const std::vector< std::array< tk::real, 3 > >& ) const = 0;
+      virtual ctr::FluxType type() const = 0;
     };
 
     //! \brief Model models the Concept above by deriving from it and overriding
@@ -113,6 +118,7 @@ class RiemannSolver {
               const std::array< std::vector< tk::real >, 2 >& u,
               const std::vector< std::array< tk::real, 3 > >& v ) const override
       { return data.flux( fn, u, v ); }
+      ctr::FluxType type() const override { return data.type(); }
       T data;
     };
 
@@ -18,6 +18,7 @@
 #include "Fields.hpp"
 #include "FunctionPrototypes.hpp"
 #include "Inciter/Options/Flux.hpp"
+#include "RiemannBlock.hpp"
 
 namespace inciter {
 
@@ -54,6 +55,52 @@ struct Upwind {
       return flx;
     }
   
+    //! Configure a block of Riemann problems for the batched upwind flux
+    //! \param[in,out] b Block of Riemann problems to configure
+    //! \details The upwind flux does not depend on material parameters.
+    static void configure( std::size_t, RiemannBlock& b )
+    { b.nmat = 1; }
+
+    //! Batched upwind Riemann solver flux function
+    //! \param[in,out] b Block of Riemann problems, with prescribed velocities
+    //!   filled in, whose fluxes to compute
+    //! \details This computes the same fluxes as the single-point flux() above
+    //!   for all b.n Riemann problems in the block.
+    static void flux( RiemannBlock& b ) {
+      Assert( b.n <= RiemannBlock::width, "Riemann block overflow" );
+
+      const auto n = b.n;
+      const auto nx = b.fn[0].data();
+      const auto ny = b.fn[1].data();
+      const auto nz = b.fn[2].data();
+
+      for (std::size_t c=0; c<b.ncomp; ++c)
+      {
+        const auto vx = b.velocity(c,0);
+        const auto vy = b.velocity(c,1);
+        const auto vz = b.velocity(c,2);
+        const auto l = b.left(c);
+        const auto r = b.right(c);
+        auto f = b.flux(c);
+
+        for (std::size_t i=0; i<n; ++i)
+        {
+          // wave speed based on prescribed velocity
+          auto swave = vx[i]*nx[i] + vy[i]*ny[i] + vz[i]*nz[i];
+
+          // upwinding
+          tk::real splus  = 0.5 * (swave + std::fabs(swave));
+          tk::real sminus = 0.5 * (swave - std::fabs(swave));
+
+          f[i] = splus * l[i] + sminus * r[i];
+        }
+      }
+    }
+
+    //! Query if the flux function uses a prescribed velocity
+    //! \return True: the upwind flux uses a prescribed velocity
+    static constexpr bool prescribedVelocity() { return true; }
+
     //! Flux type accessor
     //! \return Flux type
     static ctr::FluxType type() noexcept { return ctr::FluxType::UPWIND; }
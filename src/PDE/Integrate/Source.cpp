@@ -17,6 +17,7 @@
 
 #include "Source.hpp"
 #include "Quadrature.hpp"
+#include "DerivedData.hpp"
 
 void
 tk::srcInt( ncomp_t system,
@@ -24,11 +25,11 @@ tk::srcInt( ncomp_t system,
             ncomp_t offset,
             real t,
             const std::size_t ndof,
-            const std::vector< std::size_t >& inpoel,
-            const UnsMesh::Coords& coord,
             const Fields& geoElem,
+            const Fields& jacElem,
             const SrcFn& src,
             const std::vector< std::size_t >& ndofel,
+            const inciter::TimeLevels& lts,
             Fields& R )
 // *****************************************************************************
 //  Compute source term integrals for DG
@@ -37,20 +38,19 @@ tk::srcInt( ncomp_t system,
 //! \param[in] offset Offset this PDE system operates from
 //! \param[in] t Physical time
 //! \param[in] ndof Maximum number of degrees of freedom
-//! \param[in] inpoel Element-node connectivity
-//! \param[in] coord Array of nodal coordinates
 //! \param[in] geoElem Element geometry array
+//! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
 //! \param[in] src Source function to use
 //! \param[in] ndofel Vector of local number of degrees of freedome
+//! \param[in] lts Time step levels of elements: only elements active in the
+//!   current substep are integrated
 //! \param[in,out] R Right-hand side vector computed
 // *****************************************************************************
 {
-  const auto& cx = coord[0];
-  const auto& cy = coord[1];
-  const auto& cz = coord[2];
-
   for (std::size_t e=0; e<geoElem.nunk(); ++e)
   {
+    if (!lts.active(e)) continue;
+
     auto ng = tk::NGvol(ndofel[e]);
 
     // arrays for quadrature points
@@ -64,17 +64,11 @@ tk::srcInt( ncomp_t system,
 
     GaussQuadratureTet( ng, coordgp, wgp );
 
-    // Extract the element coordinates
-    std::array< std::array< real, 3>, 4 > coordel {{
-      {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
-      {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
-      {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
-      {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }} }};
-
     for (std::size_t igp=0; igp<ng; ++igp)
     {
       // Compute the coordinates of quadrature point at physical domain
-      auto gp = eval_gp( igp, coordel, coordgp );
+      auto gp = physCoordElem( jacElem, e, coordgp[0][igp], coordgp[1][igp],
+                               coordgp[2][igp] );
 
       // Compute the basis function
       auto B =
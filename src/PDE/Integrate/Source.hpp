@@ -19,6 +19,7 @@
 #include "Types.hpp"
 #include "Fields.hpp"
 #include "UnsMesh.hpp"
+#include "TimeLevels.hpp"
 #include "FunctionPrototypes.hpp"
 
 namespace tk {
@@ -32,11 +33,11 @@ srcInt( ncomp_t system,
         ncomp_t offset,
         real t,
         const std::size_t ndof,
-        const std::vector< std::size_t >& inpoel,
-        const UnsMesh::Coords& coord,
         const Fields& geoElem,
+        const Fields& jacElem,
         const SrcFn& src,
         const std::vector< std::size_t >& ndofel,
+        const inciter::TimeLevels& lts,
         Fields& R );
 
 //! Update the rhs by adding the source term integrals
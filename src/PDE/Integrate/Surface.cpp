@@ -14,70 +14,236 @@
 // *****************************************************************************
 
 #include <array>
+#include <algorithm>
 
 #include "Surface.hpp"
 #include "Vector.hpp"
 #include "Quadrature.hpp"
+#include "ThreadPool.hpp"
+#include "DerivedData.hpp"
+#include "Riemann/HLLC.hpp"
+#include "Riemann/LaxFriedrichs.hpp"
+#include "Riemann/AUSM.hpp"
+#include "Riemann/Upwind.hpp"
+
+std::vector< tk::real >
+tk::genFaceQuad( const std::size_t ndof,
+                 const std::size_t rdof,
+                 const Fields& jacElem,
+                 const UnsMesh::Coords& coord,
+                 const inciter::FaceData& fd,
+                 const Fields& geoFace )
+// *****************************************************************************
+//  Precompute quadrature data on internal faces for DG surface integrals
+//! \param[in] ndof Maximum number of degrees of freedom
+//! \param[in] rdof Maximum number of reconstructed degrees of freedom
+//! \param[in] jacElem Element Jacobian data (including ghosts), see
+//!   tk::genJacElemTet()
+//! \param[in] coord Array of nodal coordinates (including ghost nodes)
+//! \param[in] fd Face connectivity and boundary conditions object
+//! \param[in] geoFace Face geometry array
+//! \return Quadrature data for all internal and chare-boundary faces, i.e.,
+//!   faces whose ids are at least fd.Nbfac(), face after face. Each face stores
+//!   NGfa(ndof) quadrature points, each of which stores nfqgp(max(ndof,rdof))
+//!   reals: the quadrature weight multiplied by the face area, the physical
+//!   coordinates of the quadrature point, followed by the basis functions of
+//!   the left and right elements evaluated at the quadrature point.
+//! \details The quadrature points and their reference coordinates in the
+//!   left and right elements only depend on the mesh, so they are computed
+//!   here once and reused by tk::surfInt() in every Runge-Kutta
+//!   stage. Since the lower order Dubiner basis functions are the leading
+//!   entries of the higher order ones, storing max(ndof,rdof) basis functions
+//!   also serves elements with fewer (e.g., p-adaptive) degrees of freedom.
+//! \note Must be regenerated after the mesh or the ghost layer changes, e.g.,
+//!   after mesh refinement.
+// *****************************************************************************
+{
+  const auto& esuf = fd.Esuf();
+  const auto& inpofa = fd.Inpofa();
+  const auto nbfac = fd.Nbfac();
 
-void
-tk::surfInt( ncomp_t system,
-             ncomp_t ncomp,
-             std::size_t nmat,
-             ncomp_t offset,
-             const std::size_t ndof,
-             const std::size_t rdof,
-             const std::vector< std::size_t >& inpoel,
-             const UnsMesh::Coords& coord,
-             const inciter::FaceData& fd,
-             const Fields& geoFace,
-             const RiemannFluxFn& flux,
-             const VelFn& vel,
-             const Fields& U,
-             const std::vector< std::size_t >& ndofel,
-             Fields& R,
-             std::vector< std::vector< tk::real > >& riemannDeriv )
+  const auto& cx = coord[0];
+  const auto& cy = coord[1];
+  const auto& cz = coord[2];
+
+  const auto ng = NGfa( ndof );
+  const auto nb = std::max( ndof, rdof );
+  const auto nq = nfqgp( nb );
+
+  // get quadrature point weights and coordinates for triangle
+  std::array< std::vector< real >, 2 > coordgp;
+  std::vector< real > wgp( ng );
+  coordgp[0].resize( ng );
+  coordgp[1].resize( ng );
+  GaussQuadratureTri( ng, coordgp, wgp );
+
+  Assert( esuf.size()/2 >= nbfac, "Number of faces less than boundary faces" );
+  std::vector< real > fq( (esuf.size()/2 - nbfac) * ng * nq );
+
+  for (auto f=nbfac; f<esuf.size()/2; ++f)
+  {
+    Assert( esuf[2*f] > -1 && esuf[2*f+1] > -1, "Interior element detected "
+            "as -1" );
+
+    std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+    std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
+
+    // Extract the face coordinates
+    std::array< std::array< tk::real, 3>, 3 > coordfa {{
+      {{ cx[ inpofa[3*f  ] ], cy[ inpofa[3*f  ] ], cz[ inpofa[3*f  ] ] }},
+      {{ cx[ inpofa[3*f+1] ], cy[ inpofa[3*f+1] ], cz[ inpofa[3*f+1] ] }},
+      {{ cx[ inpofa[3*f+2] ], cy[ inpofa[3*f+2] ], cz[ inpofa[3*f+2] ] }} }};
+
+    for (std::size_t igp=0; igp<ng; ++igp)
+    {
+      auto q = fq.data() + ((f-nbfac)*ng + igp)*nq;
+
+      // Compute the coordinates of quadrature point at physical domain
+      auto gp = eval_gp( igp, coordfa, coordgp );
+
+      // Transform the quadrature point to the reference coordinates of the
+      // left and right elements and evaluate their basis functions there
+      auto xi_l = refCoordElem( jacElem, el, gp );
+      auto xi_r = refCoordElem( jacElem, er, gp );
+      auto B_l = eval_basis( nb, xi_l[0], xi_l[1], xi_l[2] );
+      auto B_r = eval_basis( nb, xi_r[0], xi_r[1], xi_r[2] );
+
+      q[0] = wgp[igp] * geoFace(f,0,0);
+      q[1] = gp[0];
+      q[2] = gp[1];
+      q[3] = gp[2];
+      std::copy( begin(B_l), end(B_l), q+4 );
+      std::copy( begin(B_r), end(B_r), q+4+nb );
+    }
+  }
+
+  return fq;
+}
+
+template< class Solver >
+static void
+surfIntFaces( tk::ncomp_t system,
+              tk::ncomp_t ncomp,
+              std::size_t nmat,
+              tk::ncomp_t offset,
+              const std::size_t ndof,
+              const std::size_t rdof,
+              const tk::Fields& jacElem,
+              const tk::UnsMesh::Coords& coord,
+              const inciter::FaceData& fd,
+              const tk::Fields& geoFace,
+              const std::vector< tk::real >& faceQuad,
+              const tk::VelFn& vel,
+              const tk::Fields& U,
+              const std::vector< std::size_t >& ndofel,
+              const inciter::TimeLevels& lts,
+              const std::vector< std::size_t >& faces,
+              std::size_t first,
+              std::size_t last,
+              tk::Fields& R,
+              std::vector< std::vector< tk::real > >& riemannDeriv )
 // *****************************************************************************
-//  Compute internal surface flux integrals
+//  Compute internal surface flux integrals on a range of faces with a given
+//  Riemann solver
+//! \tparam Solver Riemann solver type, e.g., inciter::HLLC
 //! \param[in] system Equation system index
 //! \param[in] ncomp Number of scalar components in this PDE system
 //! \param[in] nmat Number of materials in this PDE system
 //! \param[in] offset Offset this PDE system operates from
 //! \param[in] ndof Maximum number of degrees of freedom
 //! \param[in] rdof Maximum number of reconstructed degrees of freedom
-//! \param[in] inpoel Element-node connectivity
+//! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
 //! \param[in] coord Array of nodal coordinates
 //! \param[in] fd Face connectivity and boundary conditions object
 //! \param[in] geoFace Face geometry array
-//! \param[in] flux Riemann flux function to use
+//! \param[in] faceQuad Precomputed face-quadrature data, see tk::genFaceQuad()
 //! \param[in] vel Function to use to query prescribed velocity (if any)
 //! \param[in] U Solution vector at recent time step
 //! \param[in] ndofel Vector of local number of degrees of freedome
+//! \param[in] lts Time step levels of elements, selecting the faces active in
+//!   the current substep and weighting their contributions to their elements
+//! \param[in] faces Internal face ids
+//! \param[in] first Index of the first face in faces to integrate
+//! \param[in] last Index one past the last face in faces to integrate
 //! \param[in,out] R Right-hand side vector computed
 //! \param[in,out] riemannDeriv Derivatives of partial-pressures and velocities
 //!   computed from the Riemann solver for use in the non-conservative terms.
-//!   These derivatives are used only for multi-material hydro and unused for
-//!   single-material compflow and linear transport.
+//! \details The left and right states at the quadrature points of faces using
+//!   the precomputed face-quadrature data are gathered into a block of
+//!   inciter::RiemannBlock::width Riemann problems, whose fluxes are computed
+//!   by a single call to the batched flux function of the Riemann solver
+//!   before being scattered to the right-hand side. Since the Riemann solver
+//!   is a template argument, its flux functions are called directly, without
+//!   the indirection through std::function. The remaining faces, lowered in
+//!   order by p-adaptive DG, compute the quadrature data and fluxes on the fly
+//!   point by point.
 // *****************************************************************************
 {
+  using tk::real;
+
   const auto& esuf = fd.Esuf();
   const auto& inpofa = fd.Inpofa();
+  const auto nbfac = fd.Nbfac();
 
   const auto& cx = coord[0];
   const auto& cy = coord[1];
   const auto& cz = coord[2];
 
-  Assert( (nmat==1 ? riemannDeriv.empty() : true), "Non-empty Riemann "
-          "derivative vector for single material compflow" );
+  // number of quadrature points and basis functions in precomputed data
+  const auto ngq = tk::NGfa( ndof );
+  const auto nb = std::max( ndof, rdof );
+  const auto nq = tk::nfqgp( nb );
+
+  Assert( faceQuad.size() == (esuf.size()/2 - nbfac) * ngq * nq,
+          "Size mismatch in precomputed face-quadrature data" );
+
+  // block of Riemann problems, flux also includes the partial pressures and
+  // the Riemann velocity for multi-material flow
+  const auto nflux = nmat > 1 ? ncomp+nmat+1 : ncomp;
+  const std::size_t width = inciter::RiemannBlock::width;
+  inciter::RiemannBlock b( ncomp, nflux );
+  Solver::configure( system, b );
+
+  // faces and quadrature point data of the Riemann problems in the block
+  std::array< std::size_t, width > bf;
+  std::array< const real*, width > bq;
+
+  // left and right state buffers and flux reused for all quadrature points
+  std::array< std::vector< real >, 2 > state{{ std::vector< real >( ncomp ),
+                                               std::vector< real >( ncomp ) }};
+  std::vector< real > fl( nflux );
+
+  // compute fluxes of the Riemann problems in the block and scatter them
+  auto flush = [&]() {
+    Solver::flux( b );
+    for (std::size_t i=0; i<b.n; ++i) {
+      auto f = bf[i];
+      std::size_t el = static_cast< std::size_t >(esuf[2*f]);
+      std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
+      std::array< real, 3 >
+        fn{{ geoFace(f,1,0), geoFace(f,2,0), geoFace(f,3,0) }};
+      for (std::size_t c=0; c<nflux; ++c) fl[c] = b.flux(c)[i];
+      tk::update_rhs_fa( ncomp, nmat, offset, ndof, ndofel[el], ndofel[er],
+                         bq[i][0], lts.weight(el,er), fn, el, er, fl, bq[i]+4,
+                         bq[i]+4+nb, R, riemannDeriv );
+    }
+    b.n = 0;
+  };
 
   // compute internal surface flux integrals
-  for (auto f=fd.Nbfac(); f<esuf.size()/2; ++f)
+  for (auto i=first; i<last; ++i)
   {
+    auto f = faces[i];
+    Assert( f >= nbfac, "Boundary face in internal face list" );
     Assert( esuf[2*f] > -1 && esuf[2*f+1] > -1, "Interior element detected "
             "as -1" );
 
     std::size_t el = static_cast< std::size_t >(esuf[2*f]);
     std::size_t er = static_cast< std::size_t >(esuf[2*f+1]);
 
+    // skip faces whose finer element is not active in this substep
+    if (!lts.active( el, er )) continue;
+
     auto ng_l = tk::NGfa(ndofel[el]);
     auto ng_r = tk::NGfa(ndofel[er]);
 
@@ -85,107 +251,268 @@ tk::surfInt( ncomp_t system,
     // different, choose the larger ng
     auto ng = std::max( ng_l, ng_r );
 
-    // arrays for quadrature points
-    std::array< std::vector< real >, 2 > coordgp;
-    std::vector< real > wgp;
+    // If an rDG method is set up (P0P1), then, currently we compute the P1
+    // basis functions and solutions by default. This implies that P0P1 is
+    // unsupported in the p-adaptive DG (PDG).
+    std::size_t dof_el, dof_er;
+    if (rdof > ndof)
+    {
+      dof_el = rdof;
+      dof_er = rdof;
+    }
+    else
+    {
+      dof_el = ndofel[el];
+      dof_er = ndofel[er];
+    }
 
-    coordgp[0].resize( ng );
-    coordgp[1].resize( ng );
-    wgp.resize( ng );
+    std::array< real, 3 >
+      fn{{ geoFace(f,1,0), geoFace(f,2,0), geoFace(f,3,0) }};
 
-    // get quadrature point weights and coordinates for triangle
-    GaussQuadratureTri( ng, coordgp, wgp );
+    if (ng == ngq) {
 
-    // Extract the element coordinates
-    std::array< std::array< tk::real, 3>, 4 > coordel_l {{ 
-      {{ cx[ inpoel[4*el  ] ], cy[ inpoel[4*el  ] ], cz[ inpoel[4*el  ] ] }},
-      {{ cx[ inpoel[4*el+1] ], cy[ inpoel[4*el+1] ], cz[ inpoel[4*el+1] ] }},
-      {{ cx[ inpoel[4*el+2] ], cy[ inpoel[4*el+2] ], cz[ inpoel[4*el+2] ] }},
-      {{ cx[ inpoel[4*el+3] ], cy[ inpoel[4*el+3] ], cz[ inpoel[4*el+3] ] }} }};
+      // Gather Riemann problems at precomputed quadrature points into block
+      for (std::size_t igp=0; igp<ng; ++igp)
+      {
+        const auto q = faceQuad.data() + ((f-nbfac)*ngq + igp)*nq;
+
+        tk::eval_state( ncomp, offset, rdof, dof_el, el, U, q+4, state[0] );
+        tk::eval_state( ncomp, offset, rdof, dof_er, er, U, q+4+nb, state[1] );
+
+        auto n = b.n;
+        for (std::size_t c=0; c<ncomp; ++c) {
+          b.left(c)[n] = state[0][c];
+          b.right(c)[n] = state[1][c];
+        }
+        for (std::size_t d=0; d<3; ++d) b.fn[d][n] = fn[d];
+
+        // evaluate prescribed velocity (if any)
+        if (Solver::prescribedVelocity()) {
+          auto v = vel( system, ncomp, q[1], q[2], q[3] );
+          for (std::size_t c=0; c<ncomp; ++c)
+            for (std::size_t d=0; d<3; ++d)
+              b.velocity(c,d)[n] = v[c][d];
+        }
+
+        bf[n] = f;
+        bq[n] = q;
+        if (++b.n == width) flush();
+      }
 
-    std::array< std::array< tk::real, 3>, 4 > coordel_r {{ 
-      {{ cx[ inpoel[4*er  ] ], cy[ inpoel[4*er  ] ], cz[ inpoel[4*er  ] ] }},
-      {{ cx[ inpoel[4*er+1] ], cy[ inpoel[4*er+1] ], cz[ inpoel[4*er+1] ] }},
-      {{ cx[ inpoel[4*er+2] ], cy[ inpoel[4*er+2] ], cz[ inpoel[4*er+2] ] }},
-      {{ cx[ inpoel[4*er+3] ], cy[ inpoel[4*er+3] ], cz[ inpoel[4*er+3] ] }} }};
+    } else {
 
-    // Compute the determinant of Jacobian matrix
-    auto detT_l = 
-      Jacobian( coordel_l[0], coordel_l[1], coordel_l[2], coordel_l[3] );
-    auto detT_r =
-      Jacobian( coordel_r[0], coordel_r[1], coordel_r[2], coordel_r[3] );
+      // arrays for quadrature points
+      std::array< std::vector< real >, 2 > coordgp;
+      std::vector< real > wgp;
 
-    // Extract the face coordinates
-    std::array< std::array< tk::real, 3>, 3 > coordfa {{
-      {{ cx[ inpofa[3*f  ] ], cy[ inpofa[3*f  ] ], cz[ inpofa[3*f  ] ] }},
-      {{ cx[ inpofa[3*f+1] ], cy[ inpofa[3*f+1] ], cz[ inpofa[3*f+1] ] }},
-      {{ cx[ inpofa[3*f+2] ], cy[ inpofa[3*f+2] ], cz[ inpofa[3*f+2] ] }} }};
+      coordgp[0].resize( ng );
+      coordgp[1].resize( ng );
+      wgp.resize( ng );
 
-    std::array< real, 3 >
-      fn{{ geoFace(f,1,0), geoFace(f,2,0), geoFace(f,3,0) }};
+      // get quadrature point weights and coordinates for triangle
+      tk::GaussQuadratureTri( ng, coordgp, wgp );
 
-    // Gaussian quadrature
-    for (std::size_t igp=0; igp<ng; ++igp)
-    {
-      // Compute the coordinates of quadrature point at physical domain
-      auto gp = eval_gp( igp, coordfa, coordgp );
+      // Extract the face coordinates
+      std::array< std::array< tk::real, 3>, 3 > coordfa {{
+        {{ cx[ inpofa[3*f  ] ], cy[ inpofa[3*f  ] ], cz[ inpofa[3*f  ] ] }},
+        {{ cx[ inpofa[3*f+1] ], cy[ inpofa[3*f+1] ], cz[ inpofa[3*f+1] ] }},
+        {{ cx[ inpofa[3*f+2] ], cy[ inpofa[3*f+2] ], cz[ inpofa[3*f+2] ] }} }};
 
-      // In order to determine the high-order solution from the left and right
-      // elements at the surface quadrature points, the basis functions from
-      // the left and right elements are needed. For this, a transformation to
-      // the reference coordinates is necessary, since the basis functions are
-      // defined on the reference tetrahedron only.
-      // The transformation relations are shown below:
-      //  xi   = Jacobian( coordel[0], gp, coordel[2], coordel[3] ) / detT
-      //  eta  = Jacobian( coordel[0], coordel[2], gp, coordel[3] ) / detT
-      //  zeta = Jacobian( coordel[0], coordel[2], coordel[3], gp ) / detT
-
-      // If an rDG method is set up (P0P1), then, currently we compute the P1
-      // basis functions and solutions by default. This implies that P0P1 is
-      // unsupported in the p-adaptive DG (PDG).
-      std::size_t dof_el, dof_er;
-      if (rdof > ndof)
+      // Gaussian quadrature
+      for (std::size_t igp=0; igp<ng; ++igp)
       {
-        dof_el = rdof;
-        dof_er = rdof;
-      }
-      else
-      {
-        dof_el = ndofel[el];
-        dof_er = ndofel[er];
+        // Compute the coordinates of quadrature point at physical domain
+        auto gp = tk::eval_gp( igp, coordfa, coordgp );
+
+        // In order to determine the high-order solution from the left and
+        // right elements at the surface quadrature points, the basis functions
+        // from the left and right elements are needed. For this, a
+        // transformation to the reference coordinates is necessary, since the
+        // basis functions are defined on the reference tetrahedron only. The
+        // transformation uses the inverse Jacobians cached per element, see
+        // tk::genJacElemTet().
+
+        //Compute the basis functions
+        auto xi_l = tk::refCoordElem( jacElem, el, gp );
+        auto xi_r = tk::refCoordElem( jacElem, er, gp );
+        auto B_l = tk::eval_basis( dof_el, xi_l[0], xi_l[1], xi_l[2] );
+        auto B_r = tk::eval_basis( dof_er, xi_r[0], xi_r[1], xi_r[2] );
+
+        auto wt = wgp[igp] * geoFace(f,0,0);
+
+        tk::eval_state( ncomp, offset, rdof, dof_el, el, U, B_l.data(),
+                        state[0] );
+        tk::eval_state( ncomp, offset, rdof, dof_er, er, U, B_r.data(),
+                        state[1] );
+
+        // evaluate prescribed velocity (if any)
+        auto v = vel( system, ncomp, gp[0], gp[1], gp[2] );
+
+        // compute flux
+        auto flx = Solver::flux( fn, state, v );
+
+        // Add the surface integration term to the rhs
+        tk::update_rhs_fa( ncomp, nmat, offset, ndof, ndofel[el], ndofel[er],
+                           wt, lts.weight(el,er), fn, el, er, flx, B_l.data(),
+                           B_r.data(), R, riemannDeriv );
       }
+    }
+  }
 
-      //Compute the basis functions
-      auto B_l = eval_basis( dof_el,
-            Jacobian( coordel_l[0], gp, coordel_l[2], coordel_l[3] ) / detT_l,
-            Jacobian( coordel_l[0], coordel_l[1], gp, coordel_l[3] ) / detT_l,
-            Jacobian( coordel_l[0], coordel_l[1], coordel_l[2], gp ) / detT_l );
-      auto B_r = eval_basis( dof_er,
-            Jacobian( coordel_r[0], gp, coordel_r[2], coordel_r[3] ) / detT_r,
-            Jacobian( coordel_r[0], coordel_r[1], gp, coordel_r[3] ) / detT_r,
-            Jacobian( coordel_r[0], coordel_r[1], coordel_r[2], gp ) / detT_r );
+  // compute fluxes of the remaining Riemann problems
+  if (b.n > 0) flush();
+}
 
-      auto wt = wgp[igp] * geoFace(f,0,0);
+template< class Solver >
+static void
+surfIntBlock( tk::ncomp_t system,
+              tk::ncomp_t ncomp,
+              std::size_t nmat,
+              tk::ncomp_t offset,
+              const std::size_t ndof,
+              const std::size_t rdof,
+              const tk::Fields& jacElem,
+              const tk::UnsMesh::Coords& coord,
+              const inciter::FaceData& fd,
+              inciter::RhsPhase phase,
+              const tk::Fields& geoFace,
+              const std::vector< tk::real >& faceQuad,
+              const tk::VelFn& vel,
+              const tk::Fields& U,
+              const std::vector< std::size_t >& ndofel,
+              const inciter::TimeLevels& lts,
+              tk::Fields& R,
+              std::vector< std::vector< tk::real > >& riemannDeriv )
+// *****************************************************************************
+//  Compute internal surface flux integrals with a given Riemann solver
+//! \tparam Solver Riemann solver type, e.g., inciter::HLLC
+//! \param[in] system Equation system index
+//! \param[in] ncomp Number of scalar components in this PDE system
+//! \param[in] nmat Number of materials in this PDE system
+//! \param[in] offset Offset this PDE system operates from
+//! \param[in] ndof Maximum number of degrees of freedom
+//! \param[in] rdof Maximum number of reconstructed degrees of freedom
+//! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
+//! \param[in] coord Array of nodal coordinates
+//! \param[in] fd Face connectivity and boundary conditions object
+//! \param[in] phase Right-hand side phase selecting the internal or the
+//!   chare-boundary faces to integrate over
+//! \param[in] geoFace Face geometry array
+//! \param[in] faceQuad Precomputed face-quadrature data, see tk::genFaceQuad()
+//! \param[in] vel Function to use to query prescribed velocity (if any)
+//! \param[in] U Solution vector at recent time step
+//! \param[in] ndofel Vector of local number of degrees of freedome
+//! \param[in] lts Time step levels of elements
+//! \param[in,out] R Right-hand side vector computed
+//! \param[in,out] riemannDeriv Derivatives of partial-pressures and velocities
+//!   computed from the Riemann solver for use in the non-conservative terms.
+//! \details The faces of a color do not share elements, see
+//!   inciter::FaceData::color(), so the faces of each color are split among
+//!   the threads of the thread pool, each scatter-adding to the right-hand
+//!   side of distinct elements.
+// *****************************************************************************
+{
+  const auto& fcolor = fd.Fcolor();
 
-      std::array< std::vector< real >, 2 > state;
+  Assert( !fcolor.empty() || fd.Esuf().size()/2 == fd.Nbfac(),
+          "Internal faces not colored, see inciter::FaceData::color()" );
 
-      state[0] = eval_state( ncomp, offset, rdof, dof_el, el, U, B_l );
-      state[1] = eval_state( ncomp, offset, rdof, dof_er, er, U, B_r );
+  auto& pool = tk::threadpool();
 
-      Assert( state[0].size() == ncomp, "Size mismatch" );
-      Assert( state[1].size() == ncomp, "Size mismatch" );
+  // internal faces are colored first, followed by chare-boundary faces
+  auto c = phase == inciter::RhsPhase::INTERIOR ? 0 : fd.Nicolor();
+  auto ncolor = phase == inciter::RhsPhase::INTERIOR ? fd.Nicolor()
+                                                     : fcolor.size();
 
-      // evaluate prescribed velocity (if any)
-      auto v = vel( system, ncomp, gp[0], gp[1], gp[2] );
+  for (; c<ncolor; ++c) {
+    const auto& faces = fcolor[c];
+    pool.parallelFor( faces.size(),
+      [&]( std::size_t first, std::size_t last, std::size_t ){
+        surfIntFaces< Solver >( system, ncomp, nmat, offset, ndof, rdof,
+          jacElem, coord, fd, geoFace, faceQuad, vel, U, ndofel, lts, faces,
+          first, last, R, riemannDeriv ); } );
+  }
+}
 
-      // compute flux
-      auto fl =
-         flux( fn, state, v );
+void
+tk::surfInt( ncomp_t system,
+             ncomp_t ncomp,
+             std::size_t nmat,
+             ncomp_t offset,
+             const std::size_t ndof,
+             const std::size_t rdof,
+             const Fields& jacElem,
+             const UnsMesh::Coords& coord,
+             const inciter::FaceData& fd,
+             inciter::RhsPhase phase,
+             const Fields& geoFace,
+             const std::vector< real >& faceQuad,
+             inciter::ctr::FluxType flux,
+             const VelFn& vel,
+             const Fields& U,
+             const std::vector< std::size_t >& ndofel,
+             const inciter::TimeLevels& lts,
+             Fields& R,
+             std::vector< std::vector< tk::real > >& riemannDeriv )
+// *****************************************************************************
+//  Compute internal surface flux integrals
+//! \param[in] system Equation system index
+//! \param[in] ncomp Number of scalar components in this PDE system
+//! \param[in] nmat Number of materials in this PDE system
+//! \param[in] offset Offset this PDE system operates from
+//! \param[in] ndof Maximum number of degrees of freedom
+//! \param[in] rdof Maximum number of reconstructed degrees of freedom
+//! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
+//! \param[in] coord Array of nodal coordinates
+//! \param[in] fd Face connectivity and boundary conditions object
+//! \param[in] phase Right-hand side phase: INTERIOR integrates over internal
+//!   faces, whose both elements are owned, CHBND integrates over chare-boundary
+//!   faces, whose right element is a ghost
+//! \param[in] geoFace Face geometry array
+//! \param[in] faceQuad Precomputed face-quadrature data, see tk::genFaceQuad()
+//! \param[in] flux Riemann solver to use
+//! \param[in] vel Function to use to query prescribed velocity (if any)
+//! \param[in] U Solution vector at recent time step
+//! \param[in] ndofel Vector of local number of degrees of freedome
+//! \param[in] lts Time step levels of elements: only faces whose finer element
+//!   is active in the current substep are integrated, see
+//!   inciter::TimeLevels
+//! \param[in,out] R Right-hand side vector computed
+//! \param[in,out] riemannDeriv Derivatives of partial-pressures and velocities
+//!   computed from the Riemann solver for use in the non-conservative terms.
+//!   These derivatives are used only for multi-material hydro and unused for
+//!   single-material compflow and linear transport.
+//! \details The Riemann solver is selected here, once per call, and the face
+//!   loop is instantiated for each Riemann solver type, see surfIntBlock().
+// *****************************************************************************
+{
+  Assert( (nmat==1 ? riemannDeriv.empty() : true), "Non-empty Riemann "
+          "derivative vector for single material compflow" );
 
-      // Add the surface integration term to the rhs
-      update_rhs_fa( ncomp, nmat, offset, ndof, ndofel[el], ndofel[er], wt, fn,
-                     el, er, fl, B_l, B_r, R, riemannDeriv );
-    }
+  using inciter::ctr::FluxType;
+
+  switch (flux) {
+    case FluxType::LaxFriedrichs:
+      surfIntBlock< inciter::LaxFriedrichs >( system, ncomp, nmat, offset,
+        ndof, rdof, jacElem, coord, fd, phase, geoFace, faceQuad, vel, U,
+        ndofel, lts, R, riemannDeriv );
+      break;
+    case FluxType::HLLC:
+      surfIntBlock< inciter::HLLC >( system, ncomp, nmat, offset, ndof, rdof,
+        jacElem, coord, fd, phase, geoFace, faceQuad, vel, U, ndofel, lts, R,
+        riemannDeriv );
+      break;
+    case FluxType::UPWIND:
+      surfIntBlock< inciter::Upwind >( system, ncomp, nmat, offset, ndof, rdof,
+        jacElem, coord, fd, phase, geoFace, faceQuad, vel, U, ndofel, lts, R,
+        riemannDeriv );
+      break;
+    case FluxType::AUSM:
+      surfIntBlock< inciter::AUSM >( system, ncomp, nmat, offset, ndof, rdof,
+        jacElem, coord, fd, phase, geoFace, faceQuad, vel, U, ndofel, lts, R,
+        riemannDeriv );
+      break;
+    default: Throw( "Riemann solver not implemented for surface integrals" );
   }
 }
 
@@ -197,12 +524,13 @@ tk::update_rhs_fa ( ncomp_t ncomp,
                     const std::size_t ndof_l,
                     const std::size_t ndof_r,
                     const tk::real wt,
+                    const std::array< tk::real, 2 >& fw,
                     const std::array< tk::real, 3 >& fn,
                     const std::size_t el,
                     const std::size_t er,
                     const std::vector< tk::real >& fl,
-                    const std::vector< tk::real >& B_l,
-                    const std::vector< tk::real >& B_r,
+                    const tk::real* B_l,
+                    const tk::real* B_r,
                     Fields& R,
                     std::vector< std::vector< tk::real > >& riemannDeriv )
 // *****************************************************************************
@@ -214,12 +542,14 @@ tk::update_rhs_fa ( ncomp_t ncomp,
 //! \param[in] ndof_l Number of degrees of freedom for left element
 //! \param[in] ndof_r Number of degrees of freedom for right element
 //! \param[in] wt Weight of gauss quadrature point
+//! \param[in] fw Weights of the contributions to the left and right elements,
+//!   see inciter::TimeLevels::weight()
 //! \param[in] fn Face/Surface normal
 //! \param[in] el Left element index
 //! \param[in] er Right element index
 //! \param[in] fl Surface flux
-//! \param[in] B_l Basis function for the left element
-//! \param[in] B_r Basis function for the right element
+//! \param[in] B_l Pointer to basis functions for the left element
+//! \param[in] B_r Pointer to basis functions for the right element
 //! \param[in,out] R Right-hand side vector computed
 //! \param[in,out] riemannDeriv Derivatives of partial-pressures and velocities
 //!   computed from the Riemann solver for use in the non-conservative terms.
@@ -227,53 +557,58 @@ tk::update_rhs_fa ( ncomp_t ncomp,
 //!   single-material compflow and linear transport.
 // *****************************************************************************
 {
-  Assert( B_l.size() == ndof_l, "Size mismatch" );
-  Assert( B_r.size() == ndof_r, "Size mismatch" );
+  const auto wl = wt * fw[0];
+  const auto wr = wt * fw[1];
 
   for (ncomp_t c=0; c<ncomp; ++c)
   {
     auto mark = c*ndof;
-    R(el, mark, offset) -= wt * fl[c];
-    R(er, mark, offset) += wt * fl[c];
+    R(el, mark, offset) -= wl * fl[c];
+    R(er, mark, offset) += wr * fl[c];
 
     if(ndof_l > 1)          //DG(P1)
     {
-      R(el, mark+1, offset) -= wt * fl[c] * B_l[1];
-      R(el, mark+2, offset) -= wt * fl[c] * B_l[2];
-      R(el, mark+3, offset) -= wt * fl[c] * B_l[3];
+      R(el, mark+1, offset) -= wl * fl[c] * B_l[1];
+      R(el, mark+2, offset) -= wl * fl[c] * B_l[2];
+      R(el, mark+3, offset) -= wl * fl[c] * B_l[3];
     }
 
     if(ndof_r > 1)          //DG(P1)
     {
-      R(er, mark+1, offset) += wt * fl[c] * B_r[1];
-      R(er, mark+2, offset) += wt * fl[c] * B_r[2];
-      R(er, mark+3, offset) += wt * fl[c] * B_r[3];
+      R(er, mark+1, offset) += wr * fl[c] * B_r[1];
+      R(er, mark+2, offset) += wr * fl[c] * B_r[2];
+      R(er, mark+3, offset) += wr * fl[c] * B_r[3];
     }
 
     if(ndof_l > 4)          //DG(P2)
     {
-      R(el, mark+4, offset) -= wt * fl[c] * B_l[4];
-      R(el, mark+5, offset) -= wt * fl[c] * B_l[5];
-      R(el, mark+6, offset) -= wt * fl[c] * B_l[6];
-      R(el, mark+7, offset) -= wt * fl[c] * B_l[7];
-      R(el, mark+8, offset) -= wt * fl[c] * B_l[8];
-      R(el, mark+9, offset) -= wt * fl[c] * B_l[9];
+      R(el, mark+4, offset) -= wl * fl[c] * B_l[4];
+      R(el, mark+5, offset) -= wl * fl[c] * B_l[5];
+      R(el, mark+6, offset) -= wl * fl[c] * B_l[6];
+      R(el, mark+7, offset) -= wl * fl[c] * B_l[7];
+      R(el, mark+8, offset) -= wl * fl[c] * B_l[8];
+      R(el, mark+9, offset) -= wl * fl[c] * B_l[9];
     }
 
     if(ndof_r > 4)          //DG(P2)
     {
-      R(er, mark+4, offset) += wt * fl[c] * B_r[4];
-      R(er, mark+5, offset) += wt * fl[c] * B_r[5];
-      R(er, mark+6, offset) += wt * fl[c] * B_r[6];
-      R(er, mark+7, offset) += wt * fl[c] * B_r[7];
-      R(er, mark+8, offset) += wt * fl[c] * B_r[8];
-      R(er, mark+9, offset) += wt * fl[c] * B_r[9];
+      R(er, mark+4, offset) += wr * fl[c] * B_r[4];
+      R(er, mark+5, offset) += wr * fl[c] * B_r[5];
+      R(er, mark+6, offset) += wr * fl[c] * B_r[6];
+      R(er, mark+7, offset) += wr * fl[c] * B_r[7];
+      R(er, mark+8, offset) += wr * fl[c] * B_r[8];
+      R(er, mark+9, offset) += wr * fl[c] * B_r[9];
     }
   }
 
-  // Prep for non-conservative terms in multimat
+  // Prep for non-conservative terms in multimat. These are estimates of the
+  // derivatives in an element, not increments of its rhs, so they are not
+  // weighted by fw, which is only correct without local time stepping,
+  // rejected for multimat by the input deck parser.
   if (fl.size() > ncomp)
   {
+    Assert( fw[0] == 1.0 && fw[1] == 1.0, "Local time stepping not set up "
+            "for the non-conservative terms of multi-material flow" );
     // Gradients of partial pressures
     for (std::size_t k=0; k<nmat; ++k)
     {
@@ -19,14 +19,32 @@
 #include "Types.hpp"
 #include "Fields.hpp"
 #include "FaceData.hpp"
+#include "TimeLevels.hpp"
 #include "UnsMesh.hpp"
 #include "FunctionPrototypes.hpp"
+#include "Inciter/Options/Flux.hpp"
 
 namespace tk {
 
 using ncomp_t = kw::ncomp::info::expect::type;
 using bcconf_t = kw::sideset::info::expect::type;
 
+//! \brief Number of reals stored per quadrature point in the precomputed
+//!   face-quadrature data
+//! \param[in] nb Number of basis functions stored for each side of a face
+//! \return Quadrature weight times face area, 3 physical coordinates, and the
+//!   basis functions of the left and right elements
+constexpr std::size_t nfqgp( std::size_t nb ) { return 4 + 2*nb; }
+
+//! Precompute quadrature data on internal faces for DG surface integrals
+std::vector< real >
+genFaceQuad( const std::size_t ndof,
+             const std::size_t rdof,
+             const Fields& jacElem,
+             const UnsMesh::Coords& coord,
+             const inciter::FaceData& fd,
+             const Fields& geoFace );
+
 //! Compute internal surface flux integrals for DG
 void
 surfInt( ncomp_t system,
@@ -35,14 +53,17 @@ surfInt( ncomp_t system,
          ncomp_t offset,
          const std::size_t ndof,
          const std::size_t rdof,
-         const std::vector< std::size_t >& inpoel,
+         const Fields& jacElem,
          const UnsMesh::Coords& coord,
          const inciter::FaceData& fd,
+         inciter::RhsPhase phase,
          const Fields& geoFace,
-         const RiemannFluxFn& flux,
+         const std::vector< real >& faceQuad,
+         inciter::ctr::FluxType flux,
          const VelFn& vel,
          const Fields& U,
          const std::vector< std::size_t >& ndofel,
+         const inciter::TimeLevels& lts,
          Fields& R,
          std::vector< std::vector< tk::real > >& riemannDeriv );
 
@@ -55,12 +76,13 @@ update_rhs_fa ( ncomp_t ncomp,
                 const std::size_t ndof_l,
                 const std::size_t ndof_r,
                 const tk::real wt,
+                const std::array< tk::real, 2 >& fw,
                 const std::array< tk::real, 3 >& fn,
                 const std::size_t el,
                 const std::size_t er,
                 const std::vector< tk::real >& fl,
-                const std::vector< tk::real >& B_l,
-                const std::vector< tk::real >& B_r,
+                const tk::real* B_l,
+                const tk::real* B_r,
                 Fields& R,
                 std::vector< std::vector< tk::real > >& riemannDeriv );
 
@@ -15,20 +15,22 @@
 
 #include "Volume.hpp"
 #include "Vector.hpp"
+#include "DerivedData.hpp"
 #include "Quadrature.hpp"
+#include "ThreadPool.hpp"
 
 void
 tk::volInt( ncomp_t system,
             ncomp_t ncomp,
             ncomp_t offset,
             const std::size_t ndof,
-            const std::vector< std::size_t >& inpoel,
-            const UnsMesh::Coords& coord,
             const Fields& geoElem,
+            const Fields& jacElem,
             const FluxFn& flux,
             const VelFn& vel,
             const Fields& U,
             const std::vector< std::size_t >& ndofel,
+            const inciter::TimeLevels& lts,
             Fields& R )
 // *****************************************************************************
 //  Compute volume integrals for DG
@@ -36,79 +38,72 @@ tk::volInt( ncomp_t system,
 //! \param[in] ncomp Number of scalar components in this PDE system
 //! \param[in] offset Offset this PDE system operates from
 //! \param[in] ndof Maximum number of degrees of freedom
-//! \param[in] inpoel Element-node connectivity
-//! \param[in] coord Array of nodal coordinates
 //! \param[in] geoElem Element geometry array
+//! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
 //! \param[in] flux Flux function to use
 //! \param[in] vel Function to use to query prescribed velocity (if any)
 //! \param[in] U Solution vector at recent time step
 //! \param[in] ndofel Vector of local number of degrees of freedome
+//! \param[in] lts Time step levels of elements: only elements active in the
+//!   current substep are integrated
 //! \param[in,out] R Right-hand side vector added to
 // *****************************************************************************
 {
-  const auto& cx = coord[0];
-  const auto& cy = coord[1];
-  const auto& cz = coord[2];
-
-  // compute volume integrals
-  for (std::size_t e=0; e<U.nunk(); ++e)
-  {
-    if(ndofel[e] > 1)
+  // compute volume integrals: each element only adds to its own rhs, so the
+  // elements are split among threads without conflicts
+  tk::threadpool().parallelFor( U.nunk(),
+    [&]( std::size_t first, std::size_t last, std::size_t ){
+    for (std::size_t e=first; e<last; ++e)
     {
-      auto ng = tk::NGvol(ndofel[e]);
-
-      // arrays for quadrature points
-      std::array< std::vector< real >, 3 > coordgp;
-      std::vector< real > wgp;
+      if(ndofel[e] > 1 && lts.active(e))
+      {
+        auto ng = tk::NGvol(ndofel[e]);
 
-      coordgp[0].resize( ng );
-      coordgp[1].resize( ng );
-      coordgp[2].resize( ng );
-      wgp.resize( ng );
+        // arrays for quadrature points
+        std::array< std::vector< real >, 3 > coordgp;
+        std::vector< real > wgp;
 
-      GaussQuadratureTet( ng, coordgp, wgp );
+        coordgp[0].resize( ng );
+        coordgp[1].resize( ng );
+        coordgp[2].resize( ng );
+        wgp.resize( ng );
 
-      // Extract the element coordinates
-      std::array< std::array< real, 3>, 4 > coordel {{
-        {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
-        {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
-        {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
-        {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }}
-      }};
+        GaussQuadratureTet( ng, coordgp, wgp );
 
-      auto jacInv =
-              inverseJacobian( coordel[0], coordel[1], coordel[2], coordel[3] );
+        auto jacInv = jacInvElem( jacElem, e );
 
-      // Compute the derivatives of basis function for DG(P1)
-      auto dBdx = eval_dBdx_p1( ndofel[e], jacInv );
+        // Compute the derivatives of basis function for DG(P1)
+        auto dBdx = eval_dBdx_p1( ndofel[e], jacInv );
 
-      // Gaussian quadrature
-      for (std::size_t igp=0; igp<ng; ++igp)
-      {
-        if (ndofel[e] > 4)
-          eval_dBdx_p2( igp, coordgp, jacInv, dBdx );
+        // Gaussian quadrature
+        for (std::size_t igp=0; igp<ng; ++igp)
+        {
+          if (ndofel[e] > 4)
+            eval_dBdx_p2( igp, coordgp, jacInv, dBdx );
 
-        // Compute the coordinates of quadrature point at physical domain
-        auto gp = eval_gp( igp, coordel, coordgp );
+          // Compute the coordinates of quadrature point at physical domain
+          auto gp = physCoordElem( jacElem, e, coordgp[0][igp],
+                                   coordgp[1][igp], coordgp[2][igp] );
 
-        // Compute the basis function
-        auto B =
-          eval_basis( ndofel[e], coordgp[0][igp], coordgp[1][igp], coordgp[2][igp] );
+          // Compute the basis function
+          auto B = eval_basis( ndofel[e], coordgp[0][igp], coordgp[1][igp],
+                               coordgp[2][igp] );
 
-        auto wt = wgp[igp] * geoElem(e, 0, 0);
+          auto wt = wgp[igp] * geoElem(e, 0, 0);
 
-        auto state = eval_state( ncomp, offset, ndof, ndofel[e], e, U, B );
+          auto state = eval_state( ncomp, offset, ndof, ndofel[e], e, U, B );
 
-        // evaluate prescribed velocity (if any)
-        auto v = vel( system, ncomp, gp[0], gp[1], gp[2] );
+          // evaluate prescribed velocity (if any)
+          auto v = vel( system, ncomp, gp[0], gp[1], gp[2] );
 
-        // comput flux
-        auto fl = flux( system, ncomp, state, v );
+          // comput flux
+          auto fl = flux( system, ncomp, state, v );
 
-        update_rhs( ncomp, offset, ndof, ndofel[e], wt, e, dBdx, fl, R );
+          update_rhs( ncomp, offset, ndof, ndofel[e], wt, e, dBdx, fl, R );
+        }
       }
     }
-  }
+  } );
 }
 
 void
@@ -19,6 +19,7 @@
 #include "Types.hpp"
 #include "Fields.hpp"
 #include "UnsMesh.hpp"
+#include "TimeLevels.hpp"
 #include "FunctionPrototypes.hpp"
 
 namespace tk {
@@ -31,13 +32,13 @@ volInt( ncomp_t system,
         ncomp_t ncomp,
         ncomp_t offset,
         const std::size_t ndof,
-        const std::vector< std::size_t >& inpoel,
-        const UnsMesh::Coords& coord,
         const Fields& geoElem,
+        const Fields& jacElem,
         const FluxFn& flux,
         const VelFn& vel,
         const Fields& U,
         const std::vector< std::size_t >& ndofel,
+        const inciter::TimeLevels& lts,
         Fields& R );
 
 //! Update the rhs by adding the source term integrals
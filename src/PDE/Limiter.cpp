@@ -158,6 +158,7 @@ Superbee_P1( const std::vector< int >& esuel,
              const std::vector< std::size_t >& ndofel,
              inciter::ncomp_t offset,
              const tk::UnsMesh::Coords& coord,
+             const tk::Fields& jacElem,
              tk::Fields& U )
 // *****************************************************************************
 //  Superbee limiter for DGP1
@@ -166,6 +167,7 @@ Superbee_P1( const std::vector< int >& esuel,
 //! \param[in] ndofel Vector of local number of degrees of freedom
 //! \param[in] offset Index for equation systems
 //! \param[in] coord Array of nodal coordinates
+//! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
 //! \param[in,out] U High-order solution vector which gets limited
 // *****************************************************************************
 {
@@ -236,17 +238,6 @@ Superbee_P1( const std::vector< int >& esuel,
       const auto& cy = coord[1];
       const auto& cz = coord[2];
 
-      // Extract the element coordinates
-      std::array< std::array< tk::real, 3>, 4 > coordel {{
-        {{ cx[ inpoel[4*e  ] ], cy[ inpoel[4*e  ] ], cz[ inpoel[4*e  ] ] }},
-        {{ cx[ inpoel[4*e+1] ], cy[ inpoel[4*e+1] ], cz[ inpoel[4*e+1] ] }},
-        {{ cx[ inpoel[4*e+2] ], cy[ inpoel[4*e+2] ], cz[ inpoel[4*e+2] ] }},
-        {{ cx[ inpoel[4*e+3] ], cy[ inpoel[4*e+3] ], cz[ inpoel[4*e+3] ] }} }};
-
-      // Compute the determinant of Jacobian matrix
-      auto detT =
-        tk::Jacobian( coordel[0], coordel[1], coordel[2], coordel[3] );
-
       // initialize limiter function
       std::vector< tk::real > phi(ncomp, 1.0);
       for (std::size_t lf=0; lf<4; ++lf)
@@ -268,10 +259,8 @@ Superbee_P1( const std::vector< int >& esuel,
           auto gp = tk::eval_gp( igp, coordfa, coordgp );
 
           //Compute the basis functions
-          auto B_l = tk::eval_basis( rdof,
-                tk::Jacobian( coordel[0], gp, coordel[2], coordel[3] ) / detT,
-                tk::Jacobian( coordel[0], coordel[1], gp, coordel[3] ) / detT,
-                tk::Jacobian( coordel[0], coordel[1], coordel[2], gp ) / detT );
+          auto xi = tk::refCoordElem( jacElem, e, gp );
+          auto B_l = tk::eval_basis( rdof, xi[0], xi[1], xi[2] );
 
           auto state = tk::eval_state( ncomp, offset, rdof, dof_el, e, U, B_l );
 
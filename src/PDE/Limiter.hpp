@@ -35,6 +35,7 @@ Superbee_P1( const std::vector< int >& esuel,
              const std::vector< std::size_t >& ndofel,
              inciter::ncomp_t offset,
              const tk::UnsMesh::Coords& coord,
+             const tk::Fields& jacElem,
              tk::Fields& U );
 
 } // inciter::
@@ -15,6 +15,7 @@
 
 #include <vector>
 #include <array>
+#include <algorithm>
 #include <limits>
 #include <cmath>
 #include <unordered_set>
@@ -317,6 +318,95 @@ class Transport {
       }
     }
 
+    //! Compute edge-based right hand side
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in] inpoed Edge connectivity, see tk::genInpoed()
+    //! \param[in] dfn Dual-face normals and boundary coefficients of edges,
+    //!   see tk::genDfnorm()
+    //! \param[in] U Solution vector at recent time step
+    //! \param[in,out] R Right-hand side vector computed
+    //! \details This computes the node-centered right-hand side, i.e., the
+    //!   volume-integrated time derivative of the solution, in a single loop
+    //!   over edges. The Galerkin advective term, -int N_p div(v u), where the
+    //!   flux is interpolated from the nodes, is assembled from the edge
+    //!   coefficients computed by tk::genDfnorm() and is stabilized by upwind
+    //!   dissipation across the dual faces.
+    //!   Since the dissipation is nonlinear in dfn, on a partitioned mesh dfn
+    //!   must store the complete sums of chare-boundary edges and each such
+    //!   edge must only be passed to a single partition, see ALECG::lhsmerge().
+    //! \note The (optional) diffusion of the Physics policy is not included.
+    void rhs( tk::real,
+              const std::array< std::vector< tk::real >, 3 >& coord,
+              const std::vector< std::size_t >& inpoed,
+              const std::vector< tk::real >& dfn,
+              const std::vector< tk::real >&,
+              const tk::Fields& U,
+              tk::Fields& R ) const
+    {
+      Assert( U.nunk() == coord[0].size(), "Number of unknowns in solution "
+              "vector at recent time step incorrect" );
+      Assert( R.nunk() == coord[0].size(),
+              "Number of unknowns in right-hand side vector incorrect" );
+      Assert( dfn.size() == inpoed.size()/2*6, "Size mismatch" );
+
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+
+      // prescribed velocity at nodes for all components
+      std::vector< tk::real > vel( U.nunk()*m_ncomp*3 );
+      for (std::size_t i=0; i<U.nunk(); ++i) {
+        auto v = Problem::prescribedVelocity( m_system, m_ncomp,
+                                              x[i], y[i], z[i] );
+        for (ncomp_t c=0; c<m_ncomp; ++c)
+          for (std::size_t j=0; j<3; ++j)
+            vel[(i*m_ncomp+c)*3+j] = v[c][j];
+      }
+
+      // zero right hand side for all components
+      for (ncomp_t c=0; c<m_ncomp; ++c) R.fill( c, m_offset, 0.0 );
+
+      // access pointer to right hand side at component and offset
+      std::vector< const tk::real* > r( m_ncomp );
+      for (ncomp_t c=0; c<m_ncomp; ++c) r[c] = R.cptr( c, m_offset );
+
+      for (std::size_t e=0; e<inpoed.size()/2; ++e) {
+        const auto P = inpoed[e*2];
+        const auto Q = inpoed[e*2+1];
+        const auto f = dfn.data() + e*6;
+
+        // Galerkin edge coefficients, int N_P grad N_Q and int N_Q grad N_P
+        const std::array< tk::real, 3 >
+          cpq{{ f[3]+f[0], f[4]+f[1], f[5]+f[2] }},
+          cqp{{ f[3]-f[0], f[4]-f[1], f[5]-f[2] }};
+
+        // dual-face area and unit normal
+        const auto n = std::sqrt( f[0]*f[0] + f[1]*f[1] + f[2]*f[2] );
+        Assert( n > 0.0, "Zero dual-face area" );
+        const std::array< tk::real, 3 > nh{{ f[0]/n, f[1]/n, f[2]/n }};
+
+        for (ncomp_t c=0; c<m_ncomp; ++c) {
+          const auto vp = vel.data() + (P*m_ncomp+c)*3;
+          const auto vq = vel.data() + (Q*m_ncomp+c)*3;
+          const auto up = U(P,c,m_offset);
+          const auto uq = U(Q,c,m_offset);
+          // advection
+          std::array< tk::real, 3 > df{{ vq[0]*uq - vp[0]*up,
+                                         vq[1]*uq - vp[1]*up,
+                                         vq[2]*uq - vp[2]*up }};
+          R.var(r[c],P) -= tk::dot( df, cpq );
+          R.var(r[c],Q) += tk::dot( df, cqp );
+          // dissipation
+          auto l = std::max(
+            std::abs( vp[0]*nh[0] + vp[1]*nh[1] + vp[2]*nh[2] ),
+            std::abs( vq[0]*nh[0] + vq[1]*nh[1] + vq[2]*nh[2] ) );
+          auto d = 0.5 * l * n * (uq - up);
+          R.var(r[c],P) += d;
+          R.var(r[c],Q) -= d;
+        }
+      }
+    }
+
     //! Compute the minimum time step size
     //! \param[in] U Solution vector at recent time step
     //! \param[in] coord Mesh node coordinates
@@ -424,6 +514,35 @@ class Transport {
       return bc;
     }
 
+    //! \brief Evaluate the solution increments prescribed by Dirichlet boundary
+    //!   conditions at mesh nodes for all components in this PDE system
+    //! \param[in] t Physical time
+    //! \param[in] deltat Time step size
+    //! \param[in] nodes Local node IDs at which to evaluate the increments
+    //! \param[in] coord Mesh node coordinates
+    //! \param[in,out] inc Increments between t+dt and t, one row per node in
+    //!   the order of nodes, see inciter::DirichletBC
+    void solinc( tk::real t,
+                 tk::real deltat,
+                 const std::vector< std::size_t >& nodes,
+                 const std::array< std::vector< tk::real >, 3 >& coord,
+                 tk::Fields& inc ) const
+    {
+      const auto& ubc = g_inputdeck.get< tag::param, tag::transport,
+                                         tag::bcdir >();
+      if (ubc.size() <= m_system || ubc[m_system].empty()) return;
+      Assert( inc.nunk() == nodes.size(), "Size mismatch" );
+      const auto& x = coord[0];
+      const auto& y = coord[1];
+      const auto& z = coord[2];
+      for (std::size_t i=0; i<nodes.size(); ++i) {
+        auto n = nodes[i];
+        const auto s = m_problem.solinc( m_system, m_ncomp,
+                                         x[n], y[n], z[n], t, deltat );
+        for (ncomp_t c=0; c<m_ncomp; ++c) inc(i,c,m_offset) = s[c];
+      }
+    }
+
     //! Return field names to be output to file
     //! \return Vector of strings labelling fields output in file
     //! \details This functions should be written in conjunction with
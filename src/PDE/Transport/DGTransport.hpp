@@ -117,23 +117,29 @@ class Transport {
     }
 
     //! Compute right hand side
+    //! \param[in] phase Right-hand side phase to compute, see inciter::RhsPhase
     //! \param[in] t Physical time
     //! \param[in] geoFace Face geometry array
+    //! \param[in] faceQuad Precomputed face-quadrature data
     //! \param[in] geoElem Element geometry array
+    //! \param[in] jacElem Element Jacobian data, see tk::genJacElemTet()
     //! \param[in] fd Face connectivity and boundary conditions object
-    //! \param[in] inpoel Element-node connectivity
     //! \param[in] coord Array of nodal coordinates
     //! \param[in] U Solution vector at recent time step
     //! \param[in] ndofel Vector of local number of degrees of freedom
+    //! \param[in] lts Time step levels of elements, see inciter::TimeLevels
     //! \param[in,out] R Right-hand side vector computed
-    void rhs( tk::real t,
+    void rhs( inciter::RhsPhase phase,
+              tk::real t,
               const tk::Fields& geoFace,
+              const std::vector< tk::real >& faceQuad,
               const tk::Fields& geoElem,
+              const tk::Fields& jacElem,
               const inciter::FaceData& fd,
-              const std::vector< std::size_t >& inpoel,
               const tk::UnsMesh::Coords& coord,
               const tk::Fields& U,
               const std::vector< std::size_t >& ndofel,
+              const inciter::TimeLevels& lts,
               tk::Fields& R ) const
     {
       const auto ndof = g_inputdeck.get< tag::discr, tag::ndof >();
@@ -144,13 +150,14 @@ class Transport {
       Assert( U.nprop() == ndof*m_ncomp && R.nprop() == ndof*m_ncomp,
               "Number of components in solution and right-hand side vector " 
               "must equal "+ std::to_string(ndof*m_ncomp) );
-      Assert( inpoel.size()/4 == U.nunk(), "Connectivity inpoel has incorrect "
-              "size" );
+      Assert( jacElem.nunk() == U.nunk(), "Element Jacobian data has "
+              "incorrect size" );
       Assert( fd.Inpofa().size()/3 == fd.Esuf().size()/2,
               "Mismatch in inpofa size" );
 
-      // set rhs to zero
-      R.fill(0.0);
+      // set rhs to zero in the interior phase, the chare-boundary phase adds
+      // the fluxes across chare-boundary faces to it
+      if (phase == inciter::RhsPhase::INTERIOR) R.fill(0.0);
 
       // empty vector for non-conservative terms. This vector is unused for
       // linear transport since, there are no non-conservative terms in the
@@ -164,35 +171,39 @@ class Transport {
         { m_bcoutlet, Outlet },
         { m_bcdir, Dirichlet } }};
 
-      // compute internal surface flux integrals
-      tk::surfInt( m_system, m_ncomp, 1, m_offset, ndof, rdof, inpoel, coord,
-                   fd, geoFace, Upwind::flux, Problem::prescribedVelocity, U,
-                   ndofel, R, riemannDeriv );
+      // compute internal or chare-boundary surface flux integrals
+      tk::surfInt( m_system, m_ncomp, 1, m_offset, ndof, rdof, jacElem, coord,
+                   fd, phase, geoFace, faceQuad, Upwind::type(),
+                   Problem::prescribedVelocity, U, ndofel, lts, R,
+                   riemannDeriv );
+
+      // all other terms only require data of owned elements
+      if (phase == inciter::RhsPhase::CHBND) return;
 
       if(ndof > 1)
         // compute volume integrals
-        tk::volInt( m_system, m_ncomp, m_offset, ndof, inpoel, coord, geoElem,
-                    flux, Problem::prescribedVelocity, U, ndofel, R );
+        tk::volInt( m_system, m_ncomp, m_offset, ndof, geoElem, jacElem,
+                    flux, Problem::prescribedVelocity, U, ndofel, lts, R );
 
       // compute boundary surface flux integrals
       for (const auto& b : bctypes)
         tk::bndSurfInt( m_system, m_ncomp, 1, m_offset, ndof, rdof, b.first, fd,
-          geoFace, inpoel, coord, t, Upwind::flux, Problem::prescribedVelocity,
-          b.second, U, ndofel, R, riemannDeriv );
+          geoFace, jacElem, coord, t, Upwind::flux, Problem::prescribedVelocity,
+          b.second, U, ndofel, lts, R, riemannDeriv );
     }
 
     //! Compute the minimum time step size
 //     //! \param[in] U Solution vector at recent time step
 //     //! \param[in] coord Mesh node coordinates
-//     //! \param[in] inpoel Mesh element connectivity
     //! \return Minimum time step size
     tk::real dt( const std::array< std::vector< tk::real >, 3 >& /*coord*/,
-                 const std::vector< std::size_t >& /*inpoel*/,
                  const inciter::FaceData& /*fd*/,
                  const tk::Fields& /*geoFace*/,
                  const tk::Fields& /*geoElem*/,
+                 const tk::Fields& /*jacElem*/,
                  const std::vector< std::size_t >& /*ndofel*/,
-                 const tk::Fields& /*U*/ ) const
+                 const tk::Fields& /*U*/,
+                 std::vector< tk::real >& /*eldt*/ ) const
     {
       tk::real mindt = std::numeric_limits< tk::real >::max();
       return mindt;
@@ -9,6 +9,14 @@
   \details   Tracker tracks Lagrangian particles in physical space. It works on
     a chunk of the Eulerian mesh, and tracks particles in elements and across
     mesh chunks held by different Charm++ chares.
+
+    Particles that leave our mesh chunk migrate to the chares that find them:
+    the coordinates of all missing particles are packed into a single flat
+    message sent to each neighbor chare, and to all chares for those not found
+    by the neighbors. Particles found elsewhere are only marked dead, since
+    their indices are referred to by the messages in flight, and dead
+    particles are compacted away in bulk once communication is complete, see
+    tk::ParticleStore.
 */
 // *****************************************************************************
 #ifndef Tracker_h
@@ -22,8 +30,8 @@
 #include "NoWarning/pup.hpp"
 
 #include "Keywords.hpp"
-#include "Particles.hpp"
-#include "DerivedData.hpp"
+#include "ParticleStore.hpp"
+#include "PointLocator.hpp"
 #include "ParticleWriter.hpp"
 #include "ContainerUtil.hpp"
 #include "PUPUtil.hpp"
@@ -43,12 +51,11 @@ class Tracker {
     explicit Tracker( bool feedback = false,
                       std::size_t npar = 0,
                       const std::vector< std::size_t >& inpoel = {} ) :
-      m_particles( npar * inpoel.size()/4, 3 ), // only the 3 spatial components
-      m_elp( m_particles.nunk() ),
+      m_particles( npar * inpoel.size()/4 ),
       m_parmiss(),
       m_parelse(),
       m_nchpar( 0 ),
-      m_esupel( tk::genEsupel( inpoel, 4, tk::genEsup(inpoel,4) ) ),
+      m_locator(),
       m_feedback( feedback )
     {}
 
@@ -68,8 +75,10 @@ class Tracker {
                          const ParticleWriterProxy& pw,
                          ChareArray* const array )
     {
+      // Remove dead particles so that only live ones are written
+      m_particles.compact();
       // Send number of partciles we will contribute to particle writer
-      pw.ckLocalBranch()->npar( m_particles.nunk() );
+      pw.ckLocalBranch()->npar( m_particles.size() );
       // Tell the host that we are done with sending our number of particles
       signal2host_nparcomplete( hostproxy, array );
     }
@@ -83,11 +92,9 @@ class Tracker {
                            uint64_t it,
                            std::size_t nchare )
     {
-      pw.ckLocalBranch()->writeCoords( nchare,
-                                       it,
-                                       m_particles.extract(0,0),
-                                       m_particles.extract(1,0),
-                                       m_particles.extract(2,0) );
+      Assert( m_particles.ndead() == 0, "Dead particles written" );
+      const auto& x = m_particles.coord();
+      pw.ckLocalBranch()->writeCoords( nchare, it, x[0], x[1], x[2] );
     }
 
     //! Advance particle based on velocity from mesh cell
@@ -107,12 +114,10 @@ class Tracker {
       // Extract the transport velocity at nodes
       auto v = array->velocity( e );
       // Advance particle coordinates using the interpolated velocity
-      m_particles(i,0,0) +=
-        dt*(Np[0]*v[0][0] + Np[1]*v[0][1] + Np[2]*v[0][2] + Np[3]*v[0][3]);
-      m_particles(i,1,0) +=
-        dt*(Np[0]*v[1][0] + Np[1]*v[1][1] + Np[2]*v[1][2] + Np[3]*v[1][3]);
-      m_particles(i,2,0) +=
-        dt*(Np[0]*v[2][0] + Np[1]*v[2][1] + Np[2]*v[2][2] + Np[3]*v[2][3]);
+      auto& x = m_particles.coord();
+      for (std::size_t d=0; d<3; ++d)
+        x[d][i] +=
+          dt*(Np[0]*v[d][0] + Np[1]*v[d][1] + Np[2]*v[d][2] + Np[3]*v[d][3]);
       // Apply boundary conditions to particle
       applyParBC( i );
     }
@@ -121,8 +126,6 @@ class Tracker {
     //! \param[in] hostproxy Charm++ host proxy to which address reductions
     //! \param[in] arrayProxy Charm++ array proxy to which address
     //!   point-to-point communications (this is the proxy that holds us)
-    //! \param[in] coord Mesh node coordinates
-    //! \param[in] inpoel Mesh element connectivity
     //! \param[in] msum Mesh chunks surrounding mesh chunks; we only use the
     //!   keys of this container to address fellow Charm++ chare array elements
     //!   via the arrayProxy
@@ -132,48 +135,23 @@ class Tracker {
     template< class HostProxy, class ChareArrayProxy, class ChareArray >
     void track( HostProxy& hostproxy,
                 const ChareArrayProxy& arrayProxy,
-                const std::array< std::vector< tk::real >, 3 >& coord,
-                const std::vector< std::size_t >& inpoel,
                 const std::unordered_map< int, std::vector<std::size_t> >& msum,
                 int chid,
                 ChareArray* const array,
                 tk::real dt )
     {
-      // Lambda to attempt to find and advance particle i in element e. Returns
-      // true if the particle was found (and advanced), false if was not found.
+      // Locate all live particles in cells of our mesh chunk, starting from
+      // the element where the particle has last been seen
       std::array< tk::real, 4 > N;
-      auto adv = [ this, array, &N, &dt, &coord, &inpoel ]
-                ( std::size_t i, std::size_t e ) -> bool
-      {
-        if (this->parinel( coord, inpoel, i, e, N )) {
+      for (std::size_t i=0; i<m_particles.size(); ++i) {
+        if (!m_particles.live(i)) continue;
+        auto& e = m_particles.elem(i);
+        if (m_locator.locate( m_particles.position(i), e, N ))
           advanceParticle( array, i, e, dt, N );
-          return true;
-        }
-        return false;
-      };
-      // Search cells of our mesh chunk for all particles
-      for (std::size_t i=0; i<m_particles.nunk(); ++i) {
-        // Get element ID where particle i has last been seen
-        bool found = adv( i, m_elp[i] );
-        // Next search in the elements surroundings the points of the element
-        // where the particle has last been found
-        if (!found) {
-          auto last = m_esupel.second[m_elp[i]+1];
-          for (auto j=m_esupel.second[m_elp[i]]+1; j<=last; ++j) {
-            found = adv( i, m_esupel.first[j] );
-            if (found) j = last+1;  // search for next particle
-          }
-        }
-        // Next search all cells in our chunk of the mesh
-        if (!found) {
-          for (std::size_t e=0; e<inpoel.size()/4; ++e) {
-            found = adv( i, e );
-            if (found) e = inpoel.size()/4;  // search for next particle
-          }
-          // If the particle still has not been found, it left our chunk of the
-          // mesh, mark as missing (will initiate communication to find it)
-          if (!found) m_parmiss.insert( i );
-        }
+        else
+          // If the particle has not been found, it left our chunk of the mesh,
+          // mark as missing (will initiate communication to find it)
+          m_parmiss.insert( i );
       }
       // If we have no missing particles, we are done, if we do, send out
       // requests to find them to those ChareArray chares which we neighbor
@@ -181,11 +159,9 @@ class Tracker {
       if (m_parmiss.empty()) {
         signal2host_parcomcomplete( hostproxy, array );
       } else {
-        std::vector< std::vector< tk::real > > pexp( m_parmiss.size() );
-        std::size_t j = 0;
-        for (auto i : m_parmiss) pexp[ j++ ] = m_particles[i];
         m_nchpar = 0;
         std::vector< std::size_t > miss( begin(m_parmiss), end(m_parmiss) );
+        auto pexp = m_particles.pack( miss );
         for (const auto& n : msum)
           arrayProxy[ n.first ].findpar( chid, miss, pexp );
       }
@@ -194,21 +170,18 @@ class Tracker {
     //! Find particles missing by the requestor and make those found ours
     //! \param[in] arrayProxy Charm++ array proxy to which address
     //!   point-to-point communications (this is the proxy that holds us)
-    //! \param[in] coord Mesh node coordinates
-    //! \param[in] inpoel Mesh element connectivity
     //! \param[in] fromch Chare ID the request originates from
     //! \param[in] miss Indices of particles to find
-    //! \param[in] ps Particle data associated to those particle indices to find
+    //! \param[in] ps Coordinates of the particles to find, three per particle,
+    //!   see tk::ParticleStore::pack()
     template< class ChareArrayProxy >
     void findpar( const ChareArrayProxy& arrayProxy,
-                  const std::array< std::vector< tk::real >, 3 >& coord,
-                  const std::vector< std::size_t >& inpoel,
                   int fromch,
                   const std::vector< std::size_t >& miss,
-                  const std::vector< std::vector< tk::real > >& ps )
+                  const std::vector< tk::real >& ps )
     {
       // Try to find particles missing by the requestor and own those found
-      auto found = addpar( coord, inpoel, miss, ps );
+      auto found = addpar( miss, ps );
       // Send the particle indices we found back to the requestor
       arrayProxy[ fromch ].foundpar( found );
     }
@@ -247,11 +220,9 @@ class Tracker {
         if (m_parmiss.empty()) {
           signal2host_parcomcomplete( hostproxy, array );
         } else {
-          std::vector< std::vector< tk::real > > pexp( m_parmiss.size() );
-          std::size_t j = 0;
-          for (auto i : m_parmiss) pexp[ j++ ] = m_particles[i];
           m_nchpar = 0;
           std::vector< std::size_t > miss( begin(m_parmiss), end(m_parmiss) );
+          auto pexp = m_particles.pack( miss );
           m_parelse.clear();
           arrayProxy.collectpar( chid, miss, pexp ); // broadcast to everyone
         }
@@ -261,21 +232,18 @@ class Tracker {
     //! Find particles missing by the requestor and make those found ours
     //! \param[in] arrayProxy Charm++ array proxy to which address
     //!   point-to-point communications (this is the proxy that holds us)
-    //! \param[in] coord Mesh node coordinates
-    //! \param[in] inpoel Mesh element connectivity
     //! \param[in] fromch Chare ID the request originates from
     //! \param[in] miss Indices of particles to find
-    //! \param[in] ps Particle data associated to those particle indices to find
+    //! \param[in] ps Coordinates of the particles to find, three per particle,
+    //!   see tk::ParticleStore::pack()
     template< class ChareArrayProxy >
     void collectpar( const ChareArrayProxy& arrayProxy,
-                     const std::array< std::vector< tk::real >, 3 >& coord,
-                     const std::vector< std::size_t >& inpoel,
                      int fromch,
                      const std::vector< std::size_t >& miss,
-                     const std::vector< std::vector< tk::real > >& ps )
+                     const std::vector< tk::real >& ps )
     {
       // Try to find particles missing by the requestor and own those found
-      auto found = addpar( coord, inpoel, miss, ps );
+      auto found = addpar( miss, ps );
       // Send the particle indices we found back to the requestor
       arrayProxy[ fromch ].collectedpar( found );
     }
@@ -306,10 +274,10 @@ class Tracker {
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
     void pup( PUP::er& p ) {
       p | m_particles;
-      p | m_elp;
       p | m_parmiss;
       p | m_parelse;
       p | m_nchpar;
+      p | m_locator;
     }
     //! \brief Pack/Unpack serialize operator|
     //! \param[in,out] p Charm++'s PUP::er serializer object reference
@@ -318,35 +286,26 @@ class Tracker {
     //@}
 
   private:
-    //! Particle properties
-    tk::Particles m_particles;
-    //! Element ID in which a particle has last been found for all particles
-    std::vector< std::size_t > m_elp;
+    //! Fraction of dead particles above which they are compacted away
+    static constexpr tk::real m_maxdead = 0.25;
+
+    //! Particle coordinates and elements they have last been found in
+    tk::ParticleStore m_particles;
     //! Indicies of particles not found here (missing)
     std::set< std::size_t > m_parmiss;
     //! Indicies of particles not found here but found by fellows
     std::set< std::size_t > m_parelse;
     //! Number of chares we received particles from
     std::size_t m_nchpar;
-    //! Elements surrounding points of elements of mesh chunk we operate on
-    std::pair< std::vector< std::size_t >, std::vector< std::size_t > >
-      m_esupel;
+    //! Point locator of mesh chunk we operate on
+    tk::PointLocator m_locator;
     //! Bool that determines whether to send sub-task feedback to host
     bool m_feedback;
 
     //! Try to find particles and add those found to the list of ours
     std::vector< std::size_t >
-    addpar( const std::array< std::vector< tk::real >, 3 >& coord,
-            const std::vector< std::size_t >& inpoel,
-            const std::vector< std::size_t >& miss,
-            const std::vector< std::vector< tk::real > >& ps );
-
-    //! Search particle in a single mesh cell
-    bool parinel( const std::array< std::vector< tk::real >, 3 >& coord,
-                  const std::vector< std::size_t >& inpoel,
-                  std::size_t p,
-                  std::size_t e,
-                  std::array< tk::real, 4 >& N );
+    addpar( const std::vector< std::size_t >& miss,
+            const std::vector< tk::real >& ps );
 
      //! Apply boundary conditions to particles
     void applyParBC( std::size_t i );
@@ -429,6 +388,8 @@ class Tracker {
       m_nchpar = 0;
       m_parmiss.clear();
       m_parelse.clear();
+      // no particle indices are in flight, remove dead particles if many
+      m_particles.compact( m_maxdead );
       using inciter::CkIndex_Transporter;
       array->contribute(
         CkCallback( CkIndex_Transporter::redn_wrapper_parcomcomplete(NULL),
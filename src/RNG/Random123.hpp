@@ -6,13 +6,19 @@
              2019 Triad National Security, LLC.
              All rights reserved. See the LICENSE file for details.
   \brief     Interface to Random123 random number generators
-  \details   Interface to Random123 random number generators
+  \details   Interface to Random123 random number generators. Every word of
+    the output of the counter-based bijection is used, i.e., for a 2x64 CBRNG
+    one call to the bijection yields two random numbers. Gaussian random
+    numbers are generated using the Box-Muller transform on a whole array of
+    uniform random numbers at a time, which the compiler can vectorize.
 */
 // *****************************************************************************
 #ifndef Random123_h
 #define Random123_h
 
+#include <cmath>
 #include <cstring>
+#include <algorithm>
 #include <random>
 #include <limits>
 #include <array>
@@ -24,7 +30,6 @@
 #include "Make_unique.hpp"
 #include "Exception.hpp"
 #include "Keywords.hpp"
-#include "Macro.hpp"
 
 namespace tk {
 
@@ -40,30 +45,42 @@ class Random123 {
     using value_type = typename CBRNG::ctr_type::value_type;
     using arg_type = std::vector< std::array< value_type, CBRNG_DATA_SIZE > >;
 
+    //! Number of random words generated by a single call to the bijection
+    static const std::size_t CBRNG_WIDTH = ctr_type::static_size;
+
     //! Adaptor to use a std distribution with the Random123 generator
+    //! \details The adaptor hands out all words of the output of the
+    //!   bijection before generating the next block. Words left unused when
+    //!   the adaptor goes out of scope are discarded.
     //! \see C++ concepts: UniformRandomNumberGenerator
     struct Adaptor {
       using result_type = unsigned long;
-      Adaptor( CBRNG& r, arg_type& d, int t ) : rng(r), data(d), tid(t) {}
+      Adaptor( CBRNG& r, arg_type& d, int t ) :
+        rng(r), data(d), tid(t), res(), pos(CBRNG_WIDTH) {}
       static constexpr result_type min() { return 0u; }
       static constexpr result_type max() {
         return std::numeric_limits< result_type >::max();
       }
       result_type operator()()
       {
-        auto& d = data[ static_cast< std::size_t >( tid ) ];
-        d[2] = static_cast< result_type >( tid );
-        ctr_type ctr = {{ d[0], d[1] }};      // assemble counter
-        key_type key = {{ d[2] }};            // assemble key
-        auto res = rng( ctr, key );           // generate
-        ctr.incr();
-        d[0] = ctr[0];
-        d[1] = ctr[1];
-        return res[0];
+        if (pos == CBRNG_WIDTH) {
+          auto& d = data[ static_cast< std::size_t >( tid ) ];
+          d[2] = static_cast< result_type >( tid );
+          ctr_type ctr = {{ d[0], d[1] }};      // assemble counter
+          key_type key = {{ d[2] }};            // assemble key
+          res = rng( ctr, key );                // generate
+          ctr.incr();
+          d[0] = ctr[0];
+          d[1] = ctr[1];
+          pos = 0;
+        }
+        return res[ pos++ ];
       }
       CBRNG& rng;
       arg_type& data;
       int tid;
+      ctr_type res;
+      std::size_t pos;
     };
 
   public:
@@ -79,41 +96,47 @@ class Random123 {
     //! \param[in] tid Thread (or more precisely) stream ID
     //! \param[in] num Number of RNGs to generate
     //! \param[in,out] r Pointer to memory to write the random numbers to
+    //! \details All words of each block generated by the bijection are used.
+    //!   If num is not divisible by the number of words in a block, the unused
+    //!   words of the last block are discarded.
     void uniform( int tid, ncomp_t num, double* r ) const {
       auto& d = m_data[ static_cast< std::size_t >( tid ) ];
-      for (ncomp_t i=0; i<num; ++i) {
-        d[2] = static_cast< unsigned long >( tid );
-        ctr_type ctr = {{ d[0], d[1] }};      // assemble counter
-        key_type key = {{ d[2] }};            // assemble key
+      d[2] = static_cast< unsigned long >( tid );
+      ctr_type ctr = {{ d[0], d[1] }};        // assemble counter
+      key_type key = {{ d[2] }};              // assemble key
+      for (ncomp_t i=0; i<num; i+=CBRNG_WIDTH) {
         auto res = m_rng( ctr, key );         // generate
-        r[i] = r123::u01fixedpt< double, value_type >( res[0] );
         ctr.incr();
-        d[0] = ctr[0];
-        d[1] = ctr[1];
+        auto n = std::min( static_cast< ncomp_t >( CBRNG_WIDTH ), num-i );
+        for (ncomp_t j=0; j<n; ++j)
+          r[i+j] = r123::u01fixedpt< double, value_type >( res[j] );
       }
+      d[0] = ctr[0];
+      d[1] = ctr[1];
     }
 
     //! Gaussian RNG: Generate Gaussian random numbers
     //! \param[in] tid Thread (or more precisely stream) ID
     //! \param[in] num Number of RNGs to generate
     //! \param[in,out] r Pointer to memory to write the random numbers to
-    //! \details Generating Gaussian random numbers is implemented via an
-    //!   adaptor, modeling std::UniformRandomNumberGenerator, outsourcing the
-    //!   transformation of uniform random numbers to Gaussian ones, to the
-    //!   standard library. The adaptor is instantiated here because a standard
-    //!   distribution, such as e.g., std::normal_distribution, generates
-    //!   numbers using operator() with no arguments, thus the RNG state and the
-    //!   thread ID (this latter only known here) must be stored in the adaptor
-    //!   functor's state. Even though creating the adaptor seems like a
-    //!   potentially costly operation for every call, using the standard
-    //!   library implementation is still faster than a hand-coded
-    //!   implementation of the Box-Muller algorithm. Note that libc++ uses a
-    //!   cache, as Box-Muller, implemented using the polar algorithm generates
-    //!   2 Gaussian numbers for each pair of uniform ones, caching every 2nd.
+    //! \details Gaussian random numbers are generated using the Box-Muller
+    //!   transform: first num uniform random numbers are generated into r
+    //!   using all words of the bijection, then the two halves of r are
+    //!   transformed in place, pairing r[i] with r[i+num/2]. This keeps the
+    //!   transform a loop over contiguous data without branches, which the
+    //!   compiler can vectorize, unlike std::normal_distribution, whose
+    //!   results also differ across standard library implementations. An odd
+    //!   last number is transformed from a separate pair of uniform numbers.
     void gaussian( int tid, ncomp_t num, double* r ) const {
-      Adaptor generator( m_rng, m_data, tid );
-      std::normal_distribution<> gauss_dist( 0.0, 1.0 );
-      for (ncomp_t i=0; i<num; ++i) r[i] = gauss_dist( generator );
+      const auto h = num/2;
+      uniform( tid, 2*h, r );
+      boxmuller( h, r, r+h );
+      if (num % 2) {
+        double u[2];
+        uniform( tid, 2, u );
+        boxmuller( 1, u, u+1 );
+        r[num-1] = u[0];
+      }
     }
 
     //! \brief Multi-variate Gaussian RNG: Generate multi-variate Gaussian
@@ -122,19 +145,30 @@ class Random123 {
     //! \param[in] num Number of RNGs to generate
     //! \param[in] d Dimension d ( d ≥ 1) of output random vectors
     //! \param[in] mean Mean vector of dimension d
-    //! \param[in] cov Lower triangle of covariance matrix, stored as a vector
-    //!   of length d(d+1)/2
+    //! \param[in] cov Cholesky factor of the covariance matrix, stored as a
+    //!   vector of length d(d+1)/2, as returned by LAPACKE_dpptrf() with
+    //!   LAPACK_ROW_MAJOR and 'U', i.e., the same input as expected by MKL
     //! \param[in,out] r Pointer to memory to write the random numbers to
-    //! \warning Not implemented!
+    //! \details The random vectors are computed as r = mean + U^T z, where U
+    //!   is the upper triangular Cholesky factor of the covariance matrix and
+    //!   z is a vector of d independent standard Gaussian random numbers. The
+    //!   num*d Gaussian numbers are generated with a single call to gaussian()
+    //!   and each vector is transformed in place, starting from its last
+    //!   component, as component i only depends on components 0...i of z.
     void gaussianmv( int tid, ncomp_t num, ncomp_t d, const double* const mean,
                      const double* const cov, double* r ) const
     {
-      IGNORE(tid);
-      IGNORE(num);
-      IGNORE(d);
-      IGNORE(mean);
-      IGNORE(cov);
-      IGNORE(r);
+      Assert( d > 0,
+              "Dimension of multi-variate Gaussian RNGs must be positive" );
+      gaussian( tid, num*d, r );
+      for (ncomp_t v=0; v<num; ++v) {
+        auto z = r + v*d;
+        for (ncomp_t i=d; i-->0; ) {
+          auto x = mean[i];
+          for (ncomp_t j=0; j<=i; ++j) x += cov[ j*(2*d-j+1)/2 + i-j ] * z[j];
+          z[i] = x;
+        }
+      }
     }
 
     //! Beta RNG: Generate beta random numbers
@@ -184,6 +218,21 @@ class Random123 {
     uint64_t nthreads() const noexcept { return m_data.size(); }
 
   private:
+    //! Box-Muller transform of pairs of uniform random numbers in (0,1)
+    //! \param[in] n Number of pairs to transform
+    //! \param[in,out] a First n uniform random numbers on input, first n
+    //!   Gaussian random numbers on output
+    //! \param[in,out] b Second n uniform random numbers on input, second n
+    //!   Gaussian random numbers on output
+    static void boxmuller( ncomp_t n, double* a, double* b ) {
+      for (ncomp_t i=0; i<n; ++i) {
+        auto rad = std::sqrt( -2.0 * std::log( a[i] ) );
+        auto phi = 2.0 * M_PI * b[i];
+        a[i] = rad * std::cos( phi );
+        b[i] = rad * std::sin( phi );
+      }
+    }
+
     mutable CBRNG m_rng;        //!< Random123 RNG object
     mutable arg_type m_data;    //!< RNG arguments
 };
@@ -8,9 +8,9 @@
   \brief     Joint bivariate PDF estimator
   \details   Joint bivariate PDF estimator. This class can be used to estimate a
     joint probability density function (PDF) of two scalar variables from an
-    ensemble. The implementation uses the standard container std::unordered_map,
-    which is a hash-based associative container with linear algorithmic
-    complexity for insertion of a new sample.
+    ensemble. The sample counters are stored in tk::DenseBins, a contiguous
+    array of bins whose range grows on demand, so that adding a sample requires
+    no hashing and no allocation.
 */
 // *****************************************************************************
 #ifndef BiPDF_h
@@ -22,6 +22,7 @@
 
 #include "Types.hpp"
 #include "PUPUtil.hpp"
+#include "DenseBins.hpp"
 
 namespace tk {
 
@@ -45,11 +46,11 @@ class BiPDF {
       }
     };
 
-    //! \brief Joint bivariate PDF
-    //! \details The underlying container type is an unordered_map where the key
-    //!   is two bin ids corresponding to the two sample space dimensions, and
-    //!   the mapped value is the sample counter. The hasher functor, defined by
-    //!   key_hash provides an XORed hash of the two bin ids.
+    //! \brief Joint bivariate PDF as an associative container
+    //! \details The associative container type returned by map(), where the
+    //!   key is two bin ids corresponding to the two sample space dimensions,
+    //!   and the mapped value is the sample counter. The hasher functor,
+    //!   defined by key_hash provides an XORed hash of the two bin ids.
     using map_type = std::unordered_map< key_type, tk::real, key_hash >;
 
     //! Empty constructor for Charm++
@@ -67,9 +68,9 @@ class BiPDF {
     //! Add sample to bivariate PDF
     //! \param[in] sample Sample to add
     void add( std::array< tk::real, dim > sample ) {
+      m_pdf.add( {{ binid( sample[0], m_binsize[0] ),
+                   binid( sample[1], m_binsize[1] ) }} );
       ++m_nsample;
-      ++m_pdf[ {{ std::lround( sample[0] / m_binsize[0] ),
-                  std::lround( sample[1] / m_binsize[1] ) }} ];
     }
 
     //! Add multiple samples from a PDF
@@ -77,15 +78,22 @@ class BiPDF {
     void addPDF( const BiPDF& p ) {
       m_binsize = p.binsize();
       m_nsample += p.nsample();
-      for (const auto& e : p.map()) m_pdf[ e.first ] += e.second;
+      m_pdf.add( p.m_pdf );
     }
 
     //! Zero bins
-    void zero() noexcept { m_nsample = 0; m_pdf.clear(); }
-
-    //! Constant accessor to underlying PDF map
-    //! \return Constant reference to underlying map
-    const map_type& map() const noexcept { return m_pdf; }
+    //! \details The range of bins is kept, as the same sample space is
+    //!   expected to be sampled again.
+    void zero() { m_nsample = 0; m_pdf.zero(); }
+
+    //! Return nonzero bins of PDF in an associative container
+    //! \return Associative container of the nonzero bins
+    //! \note This allocates and is intended for output only.
+    map_type map() const {
+      map_type m;
+      m_pdf.each( [&]( const key_type& k, tk::real c ){ m[k] = c; } );
+      return m;
+    }
 
     //! Constant accessor to bin sizes
     //! \return Constant reference to sample space bin sizes
@@ -95,17 +103,7 @@ class BiPDF {
     //! Return minimum and maximum bin ids of sample space in both dimensions
     //! \return {xmin,xmax,ymin,ymax} Minima and maxima of the bin ids in a
     //!    std::array
-    std::array< long, 2*dim > extents() const {
-      Assert( !m_pdf.empty(), "PDF empty" );
-      auto x = std::minmax_element( begin(m_pdf), end(m_pdf),
-                 []( const pair_type& a, const pair_type& b )
-                 { return a.first[0] < b.first[0]; } );
-      auto y = std::minmax_element( begin(m_pdf), end(m_pdf),
-                 []( const pair_type& a, const pair_type& b )
-                 { return a.first[1] < b.first[1]; } );
-      return {{ x.first->first[0], x.second->first[0],
-                y.first->first[1], y.second->first[1] }};
-    }
+    std::array< long, 2*dim > extents() const { return m_pdf.extents(); }
 
     /** @name Pack/Unpack: Serialize BiPDF object for Charm++ */
     ///@{
@@ -125,7 +123,7 @@ class BiPDF {
   private:
     std::array< tk::real, dim > m_binsize;  //!< Sample space bin sizes
     std::size_t m_nsample;                  //!< Number of samples collected
-    map_type m_pdf;                         //!< Probability density function
+    DenseBins< dim > m_pdf;                 //!< Probability density function
 };
 
 } // tk::
@@ -0,0 +1,257 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/CentralMoments.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Mergeable accumulator for central moments of products
+  \details   Mergeable accumulator for central moments of arbitrary-length
+    products. For each product the accumulator stores the number of samples,
+    and for each subset of the terms of the product, the sum of the product of
+    the subset's terms, each term taken about the mean of its variable over
+    the samples accumulated. Two accumulators of disjoint sets of samples can
+    be merged exactly (up to round-off) using the pairwise update formulas of
+    Pebay (Sandia Report SAND2008-6212), so central moments can be accumulated
+    in a single pass over the samples in blocks and partial results from
+    different chares and PEs merged during reduction, without requiring the
+    means to be known beforehand.
+
+    Let n be the number of samples, and C_S the sum over the samples of the
+    product of the terms in the set S, each about its mean, with C_{} = n.
+    Merging two accumulators, A and B, with means mu_A and mu_B, and delta =
+    mu_B - mu_A, yields for all subsets M of the terms of a product
+
+      C_M = sum_{S in M} [ C_{A,S} prod_{i in M\S} (-n_B delta_i / n) +
+                           C_{B,S} prod_{i in M\S} ( n_A delta_i / n) ],
+
+    with n = n_A + n_B. Terms of a product that are full variables, i.e., not
+    fluctuations, are only expanded about their means when the moment is
+    computed: the moment of a product P, whose terms in the set F are
+    fluctuations, is
+
+      1/n sum_{F in S in P} C_S prod_{i in P\S} mu_i.
+
+    Since all sums are kept about the means, merging does not suffer from
+    cancellation if variables have a large mean compared to their
+    fluctuations.
+*/
+// *****************************************************************************
+#ifndef CentralMoments_h
+#define CentralMoments_h
+
+#include <vector>
+#include <cstddef>
+#include <algorithm>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Mergeable accumulator for central moments of products
+class CentralMoments {
+
+  public:
+    //! Empty constructor for Charm++
+    explicit CentralMoments() :
+      m_n( 0.0 ), m_center(), m_mean(), m_var(), m_offset( 1, 0 ),
+      m_sumoff( 1, 0 ), m_sum(), m_shift() {}
+
+    //! Constructor
+    //! \param[in] center Flags, one for each variable, indicating whether the
+    //!   variable is a fluctuation about its mean (true) or a full variable
+    //!   (false)
+    //! \param[in] product List of products, each a list of variable ids,
+    //!   indexing into center
+    explicit CentralMoments( const std::vector< bool >& center,
+                             const std::vector< std::vector< std::size_t > >&
+                               product ) :
+      m_n( 0.0 ),
+      m_center( begin(center), end(center) ),
+      m_mean( center.size(), 0.0 ),
+      m_var(),
+      m_offset( 1, 0 ),
+      m_sumoff( 1, 0 ),
+      m_sum(),
+      m_shift()
+    {
+      for (const auto& p : product) {
+        Assert( p.size() < 8*sizeof(std::size_t), "Product too long" );
+        for (auto v : p) {
+          Assert( v < center.size(), "Variable id out of bounds" );
+          m_var.push_back( v );
+        }
+        m_offset.push_back( m_var.size() );
+        m_sumoff.push_back( m_sumoff.back() + (std::size_t(1) << p.size()) );
+      }
+      m_sum.resize( m_sumoff.back(), 0.0 );
+    }
+
+    //! Number of products
+    //! \return Number of products whose central moments are accumulated
+    std::size_t nprod() const noexcept { return m_offset.size() - 1; }
+
+    //! Number of variables
+    //! \return Number of variables the products are composed of
+    std::size_t nvar() const noexcept { return m_center.size(); }
+
+    //! Number of terms of a product
+    //! \param[in] i Product index
+    //! \return Number of terms of product i
+    std::size_t nterm( std::size_t i ) const noexcept
+    { return m_offset[i+1] - m_offset[i]; }
+
+    //! Variable id of a term of a product
+    //! \param[in] i Product index
+    //! \param[in] j Term index
+    //! \return Variable id of term j of product i
+    std::size_t var( std::size_t i, std::size_t j ) const noexcept
+    { return m_var[ m_offset[i] + j ]; }
+
+    //! Query if a variable is a fluctuation about its mean
+    //! \param[in] v Variable id
+    //! \return True if variable v is a fluctuation about its mean, false if it
+    //!   is a full variable
+    bool center( std::size_t v ) const noexcept { return m_center[v] != 0; }
+
+    //! Number of samples accumulated
+    //! \return Number of samples accumulated
+    tk::real count() const noexcept { return m_n; }
+
+    //! Zero accumulator, keeping the products
+    void zero() {
+      m_n = 0.0;
+      std::fill( begin(m_mean), end(m_mean), 0.0 );
+      std::fill( begin(m_sum), end(m_sum), 0.0 );
+    }
+
+    //! Set accumulator from a block of samples
+    //! \param[in] n Number of samples in the block
+    //! \param[in] mean Mean of each variable over the block
+    //! \param[in] sum Function called as sum( i, mask ), returning the sum over
+    //!   the block of the product of the terms of product i whose bit is set
+    //!   in mask, each about the block mean of its variable. Called for all
+    //!   nonempty masks of a product in increasing order.
+    template< class Sum >
+    void set( std::size_t n, const tk::real* mean, Sum sum ) {
+      m_n = static_cast< tk::real >( n );
+      for (std::size_t v=0; v<nvar(); ++v) m_mean[v] = mean[v];
+      for (std::size_t i=0; i<nprod(); ++i) {
+        auto s = m_sum.data() + m_sumoff[i];
+        s[0] = m_n;
+        const std::size_t nmask = std::size_t(1) << nterm(i);
+        for (std::size_t m=1; m<nmask; ++m) {
+          auto c = sum( i, m );
+          // The sum of a single term about its mean vanishes, only round-off
+          // would be stored, so store an exact zero
+          s[m] = m & (m-1) ? c : 0.0;
+        }
+      }
+    }
+
+    //! Merge another accumulator into this one
+    //! \param[in] b Accumulator to merge, must accumulate the same products
+    //!   over a disjoint set of samples
+    void merge( const CentralMoments& b ) {
+      if (m_n == 0.0) { *this = b; return; }
+      if (b.m_n == 0.0) return;
+      Assert( m_var == b.m_var && m_offset == b.m_offset,
+              "Cannot merge central moments of different products" );
+      const auto na = m_n, nb = b.m_n, n = na + nb;
+      // Shifts of the means of A and B to the merged mean
+      m_shift.assign( 2*nvar(), 0.0 );
+      auto da = m_shift.data(), db = da + nvar();
+      for (std::size_t v=0; v<nvar(); ++v) {
+        auto delta = b.m_mean[v] - m_mean[v];
+        da[v] = -nb*delta/n;
+        db[v] = na*delta/n;
+        m_mean[v] += nb*delta/n;
+      }
+      for (std::size_t i=0; i<nprod(); ++i) {
+        auto a = m_sum.data() + m_sumoff[i];
+        const auto bs = b.m_sum.data() + m_sumoff[i];
+        const auto t = m_var.data() + m_offset[i];
+        const std::size_t nmask = std::size_t(1) << nterm(i);
+        // Go from the largest subset down, so that the sums of the subsets of
+        // a mask, all of which are smaller, are still the ones of A when used
+        for (std::size_t m=nmask; m-->0; ) {
+          // The sum of a single term about its mean vanishes
+          if (m && !(m & (m-1))) { a[m] = 0.0; continue; }
+          tk::real c = 0.0;
+          // Sum over all subsets s of m, including m itself and the empty set
+          for (std::size_t s=m; ; s=(s-1)&m) {
+            tk::real pa = 1.0, pb = 1.0;
+            for (std::size_t r=m^s, j=0; r; r>>=1, ++j)
+              if (r & 1) { pa *= da[ t[j] ]; pb *= db[ t[j] ]; }
+            c += a[s]*pa + bs[s]*pb;
+            if (s == 0) break;
+          }
+          a[m] = c;
+        }
+      }
+      m_n = n;
+    }
+
+    //! Compute central moment of a product
+    //! \param[in] i Product index
+    //! \return Central moment of product i, i.e., the mean of the product of
+    //!   all of its terms, fluctuations taken about their means
+    tk::real moment( std::size_t i ) const {
+      Assert( i < nprod(), "Product index out of bounds" );
+      if (m_n == 0.0) return 0.0;
+      const auto c = m_sum.data() + m_sumoff[i];
+      const auto t = m_var.data() + m_offset[i];
+      const auto all = (std::size_t(1) << nterm(i)) - 1;
+      // Bit mask of the fluctuations and of the full variables of the product
+      std::size_t fluc = 0;
+      for (std::size_t j=0; j<nterm(i); ++j)
+        if (center( t[j] )) fluc |= std::size_t(1) << j;
+      const auto full = all ^ fluc;
+      // Sum over all subsets containing all fluctuations, the full variables
+      // not in the subset contribute their means
+      tk::real m = 0.0;
+      for (std::size_t r=full; ; r=(r-1)&full) {
+        tk::real p = c[ fluc | r ];
+        for (std::size_t f=full^r, j=0; f; f>>=1, ++j)
+          if (f & 1) p *= m_mean[ t[j] ];
+        m += p;
+        if (r == 0) break;
+      }
+      return m / m_n;
+    }
+
+    /** @name Pack/Unpack: Serialize CentralMoments object for Charm++ */
+    ///@{
+    //! Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    void pup( PUP::er& p ) {
+      p | m_n;
+      p | m_center;
+      p | m_mean;
+      p | m_var;
+      p | m_offset;
+      p | m_sumoff;
+      p | m_sum;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] c CentralMoments object reference
+    friend void operator|( PUP::er& p, CentralMoments& c ) { c.pup(p); }
+    ///@}
+
+  private:
+    tk::real m_n;                       //!< Number of samples
+    std::vector< char > m_center;       //!< 1: fluctuation, 0: full variable
+    std::vector< tk::real > m_mean;     //!< Mean of each variable
+    std::vector< std::size_t > m_var;   //!< Variable ids of all terms
+    std::vector< std::size_t > m_offset;//!< Offsets of products into m_var
+    std::vector< std::size_t > m_sumoff;//!< Offsets of products into m_sum
+    std::vector< tk::real > m_sum;      //!< Sums of all subsets of all products
+    std::vector< tk::real > m_shift;    //!< Mean shifts, scratch for merge()
+};
+
+} // tk::
+
+#endif // CentralMoments_h
@@ -0,0 +1,352 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/DenseBins.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Dense, adaptively growing sample space bins for PDF estimation
+  \details   Dense, adaptively growing sample space bins for PDF estimation.
+    The bin counters of a D-dimensional sample space are stored in a single
+    contiguous array covering a rectangular range of bin ids, with the bin id
+    of the last dimension running fastest. Adding a sample whose bin id falls
+    inside the range is a few integer operations and an increment, requiring
+    no hashing and no allocation. If a bin id falls outside of the range, the
+    range is grown to cover it, with some slack in the direction of growth, so
+    that growing is amortized over many samples. Merging two sets of bins and
+    serializing them both operate on flat arrays. The number of bins of the
+    range is capped, so that outliers do not cause huge allocations: bins that
+    would require growing the range beyond the cap are stored in a hash map
+    instead.
+*/
+// *****************************************************************************
+#ifndef DenseBins_h
+#define DenseBins_h
+
+#include <array>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <unordered_map>
+#include <cmath>
+#include <string>
+
+#include "Types.hpp"
+#include "Exception.hpp"
+#include "PUPUtil.hpp"
+
+namespace tk {
+
+//! Maximum number of bins of the dense range of tk::DenseBins
+const std::size_t maxDenseBins = 1UL << 22;
+
+//! Compute bin id of a sample
+//! \param[in] sample Sample
+//! \param[in] binsize Sample space bin size
+//! \return Bin id of the sample
+//! \details Non-finite samples and samples whose bin id is not representable
+//!   are rejected, as std::lround() would return an unspecified bin id.
+inline long binid( tk::real sample, tk::real binsize ) {
+  auto x = sample / binsize;
+  ErrChk( std::isfinite( x ), "Non-finite PDF sample: " +
+          std::to_string( sample ) );
+  ErrChk( std::abs( x ) < std::numeric_limits< long >::max() / 2,
+          "PDF sample out of range: " + std::to_string( sample ) );
+  return std::lround( x );
+}
+
+//! Dense, adaptively growing sample space bins for PDF estimation
+//! \tparam D Number of sample space dimensions
+template< std::size_t D >
+class DenseBins {
+
+  public:
+    //! Bin id type
+    using key_type = std::array< long, D >;
+
+    //! Hasher of bin ids for the bins outside of the dense range
+    struct key_hash {
+      //! Function call operator computing the hash of a bin id
+      //! \param[in] k Bin id
+      //! \return Hash of the bin id
+      std::size_t operator()( const key_type& k ) const {
+        std::size_t h = 0;
+        for (auto i : k) h = h*1000003 ^ std::hash< long >()( i );
+        return h;
+      }
+    };
+
+    //! Constructor: create empty bins
+    explicit DenseBins() :
+      m_lo(), m_n(), m_min(), m_max(), m_bins(), m_sparse()
+    {
+      m_lo.fill( 0 );
+      m_n.fill( 0 );
+      m_min.fill( std::numeric_limits< long >::max() );
+      m_max.fill( std::numeric_limits< long >::min() );
+    }
+
+    //! Add to counter of a bin, growing the range of bins if needed
+    //! \param[in] k Bin id
+    //! \param[in] w Value to add to the bin counter
+    void add( const key_type& k, tk::real w = 1.0 ) {
+      for (std::size_t d=0; d<D; ++d) {
+        if (k[d] < m_min[d]) m_min[d] = k[d];
+        if (k[d] > m_max[d]) m_max[d] = k[d];
+      }
+      addbin( k, w );
+    }
+
+    //! Add all bin counters of another set of bins
+    //! \param[in] b Bins whose counters to add
+    void add( const DenseBins& b ) {
+      if (b.empty()) return;
+      for (std::size_t d=0; d<D; ++d) {
+        m_min[d] = std::min( m_min[d], b.m_min[d] );
+        m_max[d] = std::max( m_max[d], b.m_max[d] );
+      }
+      if (!b.m_bins.empty()) {
+        key_type hi;
+        for (std::size_t d=0; d<D; ++d) hi[d] = b.m_lo[d] + b.m_n[d] - 1;
+        if (m_lo == b.m_lo && m_n == b.m_n) {
+          for (std::size_t i=0; i<m_bins.size(); ++i) m_bins[i] += b.m_bins[i];
+        } else if (grow( b.m_lo, hi )) {
+          b.eachDense( [&]( const key_type& k, tk::real c ){
+            m_bins[ index( k ) ] += c; } );
+        } else {
+          b.eachDense( [&]( const key_type& k, tk::real c ){
+            addbin( k, c ); } );
+        }
+      }
+      for (const auto& e : b.m_sparse) addbin( e.first, e.second );
+    }
+
+    //! Query if no sample has been added
+    //! \return True if no sample has been added
+    bool empty() const noexcept { return m_min[0] > m_max[0]; }
+
+    //! Remove all bins
+    void clear() { *this = DenseBins(); }
+
+    //! Zero all bin counters but keep the range of bins
+    //! \details This is useful if samples from a similar sample space are to
+    //!   be collected again, as no growth of the range is necessary then.
+    void zero() {
+      std::fill( begin(m_bins), end(m_bins), 0.0 );
+      m_sparse.clear();
+      m_min.fill( std::numeric_limits< long >::max() );
+      m_max.fill( std::numeric_limits< long >::min() );
+    }
+
+    //! Return minimum and maximum bin ids of bins added to
+    //! \return {xmin,xmax,ymin,ymax,...} Minima and maxima of the bin ids
+    std::array< long, 2*D > extents() const {
+      Assert( !empty(), "PDF empty" );
+      std::array< long, 2*D > e;
+      for (std::size_t d=0; d<D; ++d) {
+        e[2*d] = m_min[d];
+        e[2*d+1] = m_max[d];
+      }
+      return e;
+    }
+
+    //! Compute the sum of all bin counters
+    //! \return Sum of all bin counters
+    tk::real sum() const {
+      tk::real s = 0.0;
+      for (auto c : m_bins) s += c;
+      for (const auto& e : m_sparse) s += e.second;
+      return s;
+    }
+
+    //! Call a function for each nonzero bin
+    //! \param[in] f Function to call as f( k, c ), where k is the bin id and c
+    //!   is the bin counter
+    template< class F >
+    void each( F f ) const {
+      eachDense( f );
+      for (const auto& e : m_sparse)
+        if (e.second != 0.0) f( e.first, e.second );
+    }
+
+    /** @name Pack/Unpack: Serialize DenseBins object for Charm++ */
+    ///@{
+    //! Pack/Unpack serialize member function
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \details Before packing, the range of bins is shrunk to the bins added
+    //!   to, so only the used part of the range is sent.
+    void pup( PUP::er& p ) {
+      if (!p.isUnpacking()) shrink();
+      p | m_lo;
+      p | m_n;
+      p | m_min;
+      p | m_max;
+      auto n = m_bins.size();
+      p | n;
+      if (p.isUnpacking()) m_bins.resize( n );
+      PUParray( p, m_bins.data(), n );
+      p | m_sparse;
+    }
+    //! \brief Pack/Unpack serialize operator|
+    //! \param[in,out] p Charm++'s PUP::er serializer object reference
+    //! \param[in,out] b DenseBins object reference
+    friend void operator|( PUP::er& p, DenseBins& b ) { b.pup(p); }
+    ///@}
+
+  private:
+    key_type m_lo;                      //!< Lowest bin id of range
+    std::array< long, D > m_n;          //!< Number of bins of range
+    key_type m_min;                     //!< Minimum bin id added to
+    key_type m_max;                     //!< Maximum bin id added to
+    std::vector< tk::real > m_bins;     //!< Bin counters
+    //! Bin counters outside of the range, not fitting into maxDenseBins
+    std::unordered_map< key_type, tk::real, key_hash > m_sparse;
+
+    //! Call a function for each nonzero bin of the range
+    //! \param[in] f Function to call as f( k, c ), where k is the bin id and c
+    //!   is the bin counter
+    template< class F >
+    void eachDense( F f ) const {
+      key_type k = m_lo;
+      for (auto c : m_bins) {
+        if (c != 0.0) f( k, c );
+        // advance bin id, last dimension running fastest
+        for (std::size_t d=D; d-->0; ) {
+          if (++k[d] < m_lo[d] + m_n[d]) break;
+          k[d] = m_lo[d];
+        }
+      }
+    }
+
+    //! Add to counter of a bin without updating the extents
+    //! \param[in] k Bin id
+    //! \param[in] w Value to add to the bin counter
+    //! \details If the range cannot be grown to cover the bin without
+    //!   exceeding maxDenseBins, the bin is stored outside of the range.
+    void addbin( const key_type& k, tk::real w ) {
+      if (inside( k ) || grow( k, k ))
+        m_bins[ index( k ) ] += w;
+      else
+        m_sparse[ k ] += w;
+    }
+
+    //! Query if a bin id is inside the range
+    //! \param[in] k Bin id
+    //! \return True if k is inside the range
+    bool inside( const key_type& k ) const {
+      for (std::size_t d=0; d<D; ++d)
+        if (k[d] < m_lo[d] || k[d] >= m_lo[d] + m_n[d]) return false;
+      return true;
+    }
+
+    //! Compute index into bin counters of a bin id inside the range
+    //! \param[in] k Bin id
+    //! \return Index of bin k into m_bins
+    std::size_t index( const key_type& k ) const {
+      long i = k[0] - m_lo[0];
+      for (std::size_t d=1; d<D; ++d) i = i*m_n[d] + k[d] - m_lo[d];
+      return static_cast< std::size_t >( i );
+    }
+
+    //! Grow the range to cover the rectangle of bin ids given
+    //! \param[in] lo Lowest bin ids to cover
+    //! \param[in] hi Highest bin ids to cover
+    //! \return True if the rectangle is covered by the range after growing
+    //! \details Grow in each direction by at least half of the current number
+    //!   of bins, so that growing is amortized. If that would exceed
+    //!   maxDenseBins, grow without slack, and if that would still exceed it,
+    //!   leave the range as is and return false. If the rectangle is already
+    //!   covered, this is a no-op.
+    bool grow( const key_type& lo, const key_type& hi ) {
+      key_type nlo;
+      std::array< long, D > nn;
+      bool same = !m_bins.empty();
+      for (std::size_t d=0; d<D; ++d) {
+        if (m_bins.empty()) {
+          nlo[d] = lo[d];
+          nn[d] = hi[d] - lo[d] + 1;
+          continue;
+        }
+        auto l = m_lo[d], h = m_lo[d] + m_n[d];  // h: one past the last bin
+        if (lo[d] < l) l = std::min( lo[d], l - m_n[d]/2 );
+        if (hi[d] >= h) h = std::max( hi[d] + 1, h + m_n[d]/2 );
+        nlo[d] = l;
+        nn[d] = h - l;
+        if (l != m_lo[d] || nn[d] != m_n[d]) same = false;
+      }
+      if (same) return true;
+      if (!size( nn ) && !m_bins.empty()) {     // retry without slack
+        for (std::size_t d=0; d<D; ++d) {
+          nlo[d] = std::min( lo[d], m_lo[d] );
+          nn[d] = std::max( hi[d] + 1, m_lo[d] + m_n[d] ) - nlo[d];
+        }
+      }
+      if (!size( nn )) return false;
+      remap( nlo, nn );
+      return true;
+    }
+
+    //! Compute the number of bins of a range
+    //! \param[in] n Number of bins of range in each dimension
+    //! \return Number of bins, or zero if it would exceed maxDenseBins
+    static std::size_t size( const std::array< long, D >& n ) {
+      std::size_t s = 1;
+      for (std::size_t d=0; d<D; ++d) {
+        auto m = static_cast< std::size_t >( n[d] );
+        if (n[d] <= 0 || m > maxDenseBins / s) return 0;
+        s *= m;
+      }
+      return s;
+    }
+
+    //! Shrink the range to the nonzero bins of the range
+    void shrink() {
+      if (empty()) { clear(); return; }
+      key_type lo, hi;
+      lo.fill( std::numeric_limits< long >::max() );
+      hi.fill( std::numeric_limits< long >::min() );
+      eachDense( [&]( const key_type& k, tk::real ){
+        for (std::size_t d=0; d<D; ++d) {
+          lo[d] = std::min( lo[d], k[d] );
+          hi[d] = std::max( hi[d], k[d] );
+        } } );
+      if (lo[0] > hi[0]) {      // all bins added to are outside of the range
+        m_lo.fill( 0 );
+        m_n.fill( 0 );
+        m_bins.clear();
+        return;
+      }
+      std::array< long, D > nn;
+      for (std::size_t d=0; d<D; ++d) nn[d] = hi[d] - lo[d] + 1;
+      if (m_lo != lo || m_n != nn) remap( lo, nn );
+    }
+
+    //! Move bin counters to a new range
+    //! \param[in] lo Lowest bin id of new range
+    //! \param[in] n Number of bins of new range
+    //! \details All nonzero bins of the range must be inside the new range,
+    //!   whose number of bins must not exceed maxDenseBins.
+    void remap( const key_type& lo, const std::array< long, D >& n ) {
+      auto s = size( n );
+      Assert( s > 0, "Dense range of bins too large" );
+      std::vector< tk::real > bins( s, 0.0 );
+      auto l = m_lo;
+      auto m = m_n;
+      m_lo = lo;
+      m_n = n;
+      key_type k = l;
+      for (auto c : m_bins) {
+        if (c != 0.0) bins[ index( k ) ] = c;
+        for (std::size_t d=D; d-->0; ) {
+          if (++k[d] < l[d] + m[d]) break;
+          k[d] = l[d];
+        }
+      }
+      m_bins = std::move( bins );
+    }
+};
+
+} // tk::
+
+#endif // DenseBins_h
@@ -0,0 +1,79 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/MomentReducer.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Custom Charm++ reducer for merging central moments across PEs
+  \details   Custom Charm++ reducer for merging central moments across PEs.
+*/
+// *****************************************************************************
+
+#include "MomentReducer.hpp"
+#include "Make_unique.hpp"
+
+namespace tk {
+
+std::pair< int, std::unique_ptr<char[]> >
+serialize( const tk::CentralMoments& c )
+// *****************************************************************************
+// Serialize central moments accumulator to raw memory stream
+//! \param[in] c Central moments accumulator
+//! \return Pair of the length and the raw stream containing the serialized
+//!   central moments accumulator
+// *****************************************************************************
+{
+  // Prepare for serializing accumulator to a raw binary stream, compute size
+  PUP::sizer sizer;
+  sizer | const_cast< tk::CentralMoments& >( c );
+
+  // Create raw character stream to store the serialized accumulator
+  std::unique_ptr<char[]> flatData = tk::make_unique<char[]>( sizer.size() );
+
+  // Serialize accumulator
+  PUP::toMem packer( flatData.get() );
+  packer | const_cast< tk::CentralMoments& >( c );
+
+  // Return size of and raw stream
+  return { sizer.size(), std::move(flatData) };
+}
+
+CkReductionMsg*
+mergeCentralMoments( int nmsg, CkReductionMsg **msgs )
+// *****************************************************************************
+// Charm++ custom reducer for merging central moments during reduction across
+// PEs
+//! \param[in] nmsg Number of messages in msgs
+//! \param[in] msgs Charm++ reduction message containing the serialized central
+//!   moments accumulators
+//! \return Aggregated central moments accumulator built for further
+//!   aggregation if needed
+// *****************************************************************************
+{
+  // Will store deserialized central moments accumulator
+  tk::CentralMoments cen;
+
+  // Create PUP deserializer based on message passed in
+  PUP::fromMem creator( msgs[0]->getData() );
+
+  // Deserialize accumulator from raw stream
+  creator | cen;
+
+  for (int m=1; m<nmsg; ++m) {
+    // Unpack accumulator
+    tk::CentralMoments c;
+    PUP::fromMem curCreator( msgs[m]->getData() );
+    curCreator | c;
+    // Merge accumulators
+    cen.merge( c );
+  }
+
+  // Serialize merged accumulator to raw stream
+  auto stream = tk::serialize( cen );
+
+  // Forward serialized accumulator
+  return CkReductionMsg::buildNew( stream.first, stream.second.get() );
+}
+
+} // tk::
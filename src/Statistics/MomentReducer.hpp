@@ -0,0 +1,34 @@
+// *****************************************************************************
+/*!
+  \file      src/Statistics/MomentReducer.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Custom Charm++ reducer for merging central moments across PEs
+  \details   Custom Charm++ reducer for merging central moments across PEs.
+*/
+// *****************************************************************************
+#ifndef MomentReducer_h
+#define MomentReducer_h
+
+#include <memory>
+
+#include "NoWarning/charm++.hpp"
+
+#include "CentralMoments.hpp"
+
+namespace tk {
+
+//! Serialize central moments accumulator to raw memory stream
+std::pair< int, std::unique_ptr<char[]> >
+serialize( const tk::CentralMoments& c );
+
+//! \brief Charm++ custom reducer for merging central moments during reduction
+//!   across PEs
+CkReductionMsg*
+mergeCentralMoments( int nmsg, CkReductionMsg **msgs );
+
+} // tk::
+
+#endif // MomentReducer_h
@@ -33,20 +33,31 @@
 
 using tk::Statistics;
 
+namespace {
+
+//! Number of particles processed together in a block when accumulating moments
+const std::size_t npblock = 256;
+
+} // ::
+
 Statistics::Statistics( const tk::Particles& particles,
                         const ctr::OffsetMap& offset,
                         const std::vector< ctr::Product >& stat,
                         const std::vector< ctr::Probability >& pdf,
                         const std::vector< std::vector< tk::real > >& binsize )
   : m_particles( particles ),
+    m_var(),
     m_instOrd(),
     m_ordinary(),
     m_ordTerm(),
     m_nord( 0 ),
     m_instCen(),
-    m_central(),
-    m_ctr(),
-    m_ncen( 0 ),
+    m_cen(),
+    m_cenBlock(),
+    m_x(),
+    m_d(),
+    m_mu(),
+    m_prod(),
     m_instOrdUniPDF(),
     m_ordupdf(),
     m_instCenUniPDF(),
@@ -75,6 +86,17 @@ Statistics::Statistics( const tk::Particles& particles,
   setupOrdinary( offset, stat );
   setupCentral( offset, stat );
   setupPDF( offset, pdf, binsize );
+
+  // Allocate buffers for a block of particles, the longest product determines
+  // the number of subsets of its terms whose products are stored
+  std::size_t nterm = 0;
+  for (const auto& t : m_instOrd) nterm = std::max( nterm, t.size() );
+  for (std::size_t i=0; i<m_cen.nprod(); ++i)
+    nterm = std::max( nterm, m_cen.nterm(i) );
+  m_x.resize( m_var.size() * npblock );
+  m_d.resize( m_instCen.size() * npblock );
+  m_mu.resize( m_instCen.size() );
+  m_prod.resize( (std::size_t(1) << nterm) * npblock );
 }
 
 void
@@ -89,14 +111,15 @@ Statistics::setupOrdinary( const ctr::OffsetMap& offset,
   for (const auto& product : stat)
     if (ordinary(product)) {
 
-      m_instOrd.emplace_back( std::vector< const tk::real* >() );
+      m_instOrd.emplace_back( std::vector< std::size_t >() );
 
       int i = 0;
       for (const auto& term : product) {
         auto o = offset.find( term.var );
         Assert( o != end( offset ), "No such depvar" );
-        // Put in starting address of instantaneous variable
-        m_instOrd.back().push_back( m_particles.cptr( term.field, o->second ) );
+        // Put in index of instantaneous variable among those gathered
+        m_instOrd.back().push_back(
+          gather( m_particles.cptr( term.field, o->second ) ) );
         // Collect all means of estimated statistics in a linear vector; this
         // will be used to find means for fluctuations. Thus only collect single
         // terms, i.e., <Y1>, <Y2>, etc., but not <Y1Y2>, etc.
@@ -132,30 +155,33 @@ Statistics::setupCentral( const ctr::OffsetMap& offset,
 //! \param[in] stat List of requested statistical moments
 // *****************************************************************************
 {
-  // Central moments can only be estimated about ordinary moments
-  if (m_nord)
-    for (const auto& product : stat) {
-      if (central(product)) {
-
-        m_instCen.emplace_back( std::vector< const tk::real* >() );
-        m_ctr.emplace_back( std::vector< const tk::real* >() );
-
-        for (const auto& term : product) {
-          auto o = offset.find( term.var );
-          Assert( o != end( offset ), "No such depvar" );
-          // Put in starting address of instantaneous variable
-          m_instCen.back().push_back( m_particles.cptr(term.field, o->second) );
-          // Put in index of center for central, m_nord for ordinary moment
-          m_ctr.back().push_back(
-           m_ordinary.data() + (std::islower(term.var) ? mean(term) : m_nord) );
-        }
+  // Terms of central moments: a term is a variable gathered and whether it is
+  // taken about its mean (fluctuation) or zero (full variable)
+  std::vector< bool > center;
+  std::vector< std::vector< std::size_t > > products;
 
-        // Increase number of central moments by one
-        m_central.push_back( 0.0 );
-        // Count up central moments
-        ++m_ncen;
+  for (const auto& product : stat)
+    if (central(product)) {
+      products.emplace_back( std::vector< std::size_t >() );
+      for (const auto& term : product) {
+        auto o = offset.find( term.var );
+        Assert( o != end( offset ), "No such depvar" );
+        // Find or put in term among the terms of central moments
+        auto v = gather( m_particles.cptr( term.field, o->second ) );
+        bool c = std::islower( term.var );
+        std::size_t t = 0;
+        while (t < m_instCen.size() && (m_instCen[t] != v || center[t] != c))
+          ++t;
+        if (t == m_instCen.size()) {
+          m_instCen.push_back( v );
+          center.push_back( c );
+        }
+        products.back().push_back( t );
       }
     }
+
+  m_cen = tk::CentralMoments( center, products );
+  m_cenBlock = m_cen;
 }
 
 void
@@ -258,65 +284,109 @@ Statistics::mean( const tk::ctr::Term& term ) const
   Throw( std::string("Cannot find mean for variable ") + term );
 }
 
-void
-Statistics::accumulateOrd()
+std::size_t
+Statistics::gather( const tk::real* ptr )
 // *****************************************************************************
-//  Accumulate (i.e., only do the sum for) ordinary moments
+//  Return index of a variable in the block of variables gathered
+//! \param[in] ptr Instantaneous variable pointer as returned by cptr()
+//! \return Index of the variable among those gathered into a block, if the
+//!   variable is not yet gathered, it is added
 // *****************************************************************************
 {
-  if (m_nord) {
-    // Zero ordinary moment accumulators
-    std::fill( begin(m_ordinary), end(m_ordinary), 0.0 );
-
-    // Accumulate sum for ordinary moments. This is a partial sum, so no
-    // division by the number of samples.
-    const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
-      for (std::size_t i=0; i<m_nord; ++i) {
-       auto prod = m_particles.var( m_instOrd[i][0], p );
-        const auto s = m_instOrd[i].size();
-        for (auto j=decltype(s){1}; j<s; ++j) {
-          prod *= m_particles.var( m_instOrd[i][j], p );
-        }
-        m_ordinary[i] += prod;
-      }
-    }
-  }
+  auto it = std::find( begin(m_var), end(m_var), ptr );
+  if (it != end(m_var))
+    return static_cast< std::size_t >( std::distance( begin(m_var), it ) );
+  m_var.push_back( ptr );
+  return m_var.size() - 1;
 }
 
 void
-Statistics::accumulateCen( const std::vector< tk::real >& om )
+Statistics::accumulate()
 // *****************************************************************************
-//  Accumulate (i.e., only do the sum for) central moments
-//! \details The ordinary moments container, m_ordinary, is overwritten here
-//!   with the argument om, because each of multiple Statistics class objects
-//!   (residing on different PEs) only collect their partial sums when
-//!   accumulateOrd() is run. By the time the accumulation of the central
-//!   moments is started, the ordinary moments have been collected from all
-//!   PEs and thus are the same to be passed here on all PEs. For example
-//!   client-code, see walker::Distributor.
-//! \param[in] om Ordinary moments
+//  Accumulate (i.e., only do the sum for) ordinary moments and accumulate
+//  central moments in a single pass
+//! \details The particles are processed in blocks. All variables required by
+//!   the moments are gathered from a block of particles once, then the sums
+//!   of the products of all ordinary moments are accumulated and the central
+//!   moments of the block are computed about the means of the block, which
+//!   are then merged into the central moments accumulated over the previous
+//!   blocks, see tk::CentralMoments. This requires no prior knowledge of the
+//!   means, and is numerically stable, as the block's data are in cache when
+//!   they are centered. The ordinary moments are partial sums, so no division
+//!   by the number of samples. The central moments accumulator can be merged
+//!   with those of other Statistics objects, e.g., on other PEs.
 // *****************************************************************************
 {
-  if (m_ncen) {
-    // Overwrite ordinary moments by those computed across all PEs
-    for (std::size_t i=0; i<om.size(); ++i) m_ordinary[i] = om[i];
+  // Zero ordinary and central moment accumulators
+  std::fill( begin(m_ordinary), end(m_ordinary), 0.0 );
+  m_cen.zero();
 
-    // Zero central moment accumulators
-    std::fill( begin(m_central), end(m_central), 0.0 );
+  if (m_var.empty()) return;
 
-    // Accumulate sum for central moments. This is a partial sum, so no division
-    // by the number of samples.
-    const auto npar = m_particles.nunk();
-    for (auto p=decltype(npar){0}; p<npar; ++p) {
-      for (std::size_t i=0; i<m_ncen; ++i) {
-        auto prod = m_particles.var( m_instCen[i][0], p ) - *(m_ctr[i][0]);
-        const auto s = m_instCen[i].size();
-        for (auto j=decltype(s){1}; j<s; ++j) {
-          prod *= m_particles.var( m_instCen[i][j], p ) - *(m_ctr[i][j]);
-        }
-        m_central[i] += prod;
+  const auto npar = m_particles.nunk();
+  for (std::size_t p=0; p<npar; p+=npblock) {
+    const auto n = std::min( npblock, npar-p );
+
+    // Gather all variables required from a block of particles
+    for (std::size_t v=0; v<m_var.size(); ++v) {
+      auto x = m_x.data() + v*npblock;
+      for (std::size_t q=0; q<n; ++q) x[q] = m_particles.var( m_var[v], p+q );
+    }
+
+    // Accumulate sums for ordinary moments
+    auto prod = m_prod.data();
+    for (std::size_t i=0; i<m_nord; ++i) {
+      const auto& inst = m_instOrd[i];
+      const auto x0 = m_x.data() + inst[0]*npblock;
+      for (std::size_t q=0; q<n; ++q) prod[q] = x0[q];
+      for (std::size_t j=1; j<inst.size(); ++j) {
+        const auto x = m_x.data() + inst[j]*npblock;
+        for (std::size_t q=0; q<n; ++q) prod[q] *= x[q];
+      }
+      tk::real sum = 0.0;
+      for (std::size_t q=0; q<n; ++q) sum += prod[q];
+      m_ordinary[i] += sum;
+    }
+
+    if (m_cen.nprod()) {
+      // Compute terms of central moments about their means over the block
+      for (std::size_t t=0; t<m_instCen.size(); ++t) {
+        const auto x = m_x.data() + m_instCen[t]*npblock;
+        auto d = m_d.data() + t*npblock;
+        tk::real mu = 0.0;
+        for (std::size_t q=0; q<n; ++q) mu += x[q];
+        mu /= static_cast< tk::real >( n );
+        for (std::size_t q=0; q<n; ++q) d[q] = x[q] - mu;
+        m_mu[t] = mu;
       }
+      // Compute sums of products of all subsets of the terms of central
+      // moments over the block. Subsets are visited in increasing order of
+      // their bit masks, so the product of the subset without its lowest term
+      // has already been computed and is reused.
+      m_cenBlock.set( n, m_mu.data(),
+        [&]( std::size_t i, std::size_t m ) -> tk::real {
+          std::size_t j = 0;
+          while (!((m >> j) & 1)) ++j;
+          const auto d = m_d.data() + m_cenBlock.var(i,j)*npblock;
+          const auto r = m & (m-1);
+          auto pm = m_prod.data() + m*npblock;
+          tk::real sum = 0.0;
+          if (r == 0) {
+            for (std::size_t q=0; q<n; ++q) {
+              pm[q] = d[q];
+              sum += pm[q];
+            }
+          } else {
+            const auto pr = m_prod.data() + r*npblock;
+            for (std::size_t q=0; q<n; ++q) {
+              pm[q] = pr[q]*d[q];
+              sum += pm[q];
+            }
+          }
+          return sum;
+        } );
+      // Merge central moments of the block into those of all blocks
+      m_cen.merge( m_cenBlock );
     }
   }
 }
@@ -367,7 +437,7 @@ Statistics::accumulateCenPDF( const std::vector< tk::real >& om )
 //! \details The ordinary moments container, m_ordinary, is overwritten here
 //!   with the argument om, because each of multiple Statistics class objects
 //!   (residing on different PEs) only collect their partial sums when
-//!   accumulateOrd() is run. By the time the accumulation of the central
+//!   accumulate() is run. By the time the accumulation of the central
 //!   PDFs is started, the ordinary moments have been collected from all
 //!   PEs and thus are the same to be passed here on all PEs. For example
 //!   client-code, see walker::Distributor.
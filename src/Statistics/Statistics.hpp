@@ -57,6 +57,12 @@
       - g(X,y,Z2) denotes the trivariate joint PDF of variables X,
         y = Y - \<Y\>, and Z2.
 
+    - Ordinary and central moments are accumulated in a single pass over the
+      particles, processed in blocks. Central moments are accumulated about
+      the means of the blocks and merged across blocks (and across PEs) using
+      tk::CentralMoments, so they do not require the means to be estimated
+      beforehand.
+
   \see @ref statistics_output
 */
 // *****************************************************************************
@@ -73,6 +79,7 @@
 #include "UniPDF.hpp"
 #include "BiPDF.hpp"
 #include "TriPDF.hpp"
+#include "CentralMoments.hpp"
 
 namespace tk {
 
@@ -87,11 +94,9 @@ class Statistics {
                          const std::vector< ctr::Probability >& pdf,
                          const std::vector< std::vector< tk::real > >& binsize );
 
-    //! Accumulate (i.e., only do the sum for) ordinary moments
-    void accumulateOrd();
-
-    //! Accumulate (i.e., only do the sum for) central moments
-    void accumulateCen( const std::vector< tk::real >& om );
+    //! \brief Accumulate (i.e., only do the sum for) ordinary moments and
+    //!   accumulate central moments in a single pass
+    void accumulate();
 
     //! Accumulate (i.e., only do the sum for) ordinary PDFs
     void accumulateOrdPDF();
@@ -102,8 +107,8 @@ class Statistics {
     //! Ordinary moments accessor
     const std::vector< tk::real >& ord() const noexcept { return m_ordinary; }
 
-    //! Central moments accessor
-    const std::vector< tk::real >& ctr() const noexcept { return m_central; }
+    //! Central moments accumulator accessor
+    const tk::CentralMoments& cen() const noexcept { return m_cen; }
 
     //! Ordinary univariate PDFs accessor
     const std::vector< tk::UniPDF >& oupdf() const noexcept { return m_ordupdf; }
@@ -143,13 +148,19 @@ class Statistics {
     //! Return mean for fluctuation
     std::size_t mean(const tk::ctr::Term& term) const;
 
+    //! Return index of a variable in the block of variables gathered
+    std::size_t gather( const tk::real* ptr );
+
     //! Particle properties
     const tk::Particles& m_particles;
 
     /** @name Data for statistical moment estimation */
     ///@{
-    //! Instantaneous variable pointers for computing ordinary moments
-    std::vector< std::vector< const tk::real* > > m_instOrd;
+    //! \brief Instantaneous variable pointers of all variables gathered into a
+    //!   block for computing moments
+    std::vector< const tk::real* > m_var;
+    //! Variables (indexing m_var) of the products of ordinary moments
+    std::vector< std::vector< std::size_t > > m_instOrd;
     //! Ordinary moments
     std::vector< tk::real > m_ordinary;
     //! Ordinary moment Terms, used to find means for fluctuations
@@ -157,14 +168,21 @@ class Statistics {
     //! Number of ordinary moments
     std::size_t m_nord;
 
-    //! Instantaneous variable pointers for computing central moments
-    std::vector< std::vector< const tk::real* > > m_instCen;
-    //! Central moments
-    std::vector< tk::real > m_central;
-    //! Ordinary moments about which to compute central moments
-    std::vector< std::vector< const tk::real* > > m_ctr;
-    //! Number of central moments
-    std::size_t m_ncen;
+    //! Variables (indexing m_var) of the terms of central moments
+    std::vector< std::size_t > m_instCen;
+    //! Central moments accumulated over all blocks
+    tk::CentralMoments m_cen;
+    //! Central moments accumulated over a single block
+    tk::CentralMoments m_cenBlock;
+
+    //! Variables gathered for a block of particles
+    std::vector< tk::real > m_x;
+    //! Terms of central moments, about their mean, for a block of particles
+    std::vector< tk::real > m_d;
+    //! Means of the terms of central moments over a block of particles
+    std::vector< tk::real > m_mu;
+    //! Products of subsets of terms for a block of particles
+    std::vector< tk::real > m_prod;
     ///@}
 
     /** @name Data for univariate probability density function estimation */
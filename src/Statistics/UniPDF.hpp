@@ -8,9 +8,10 @@
   \brief     Univariate PDF estimator
   \details   Univariate PDF estimator. This class can be used to estimate a
     probability density function of (PDF) a scalar variable from an ensemble.
-    The implementation uses the standard container std::unordered_map, which is
-    a hash-based associative container with linear algorithmic complexity for
-    insertion of a new sample.
+    The sample counters are stored in tk::DenseBins, a contiguous array of bins
+    whose range grows on demand, so that adding a sample requires no hashing
+    and no allocation, and merging and serializing PDFs operate on flat
+    arrays.
 */
 // *****************************************************************************
 #ifndef UniPDF_h
@@ -23,6 +24,7 @@
 #include "Types.hpp"
 #include "Exception.hpp"
 #include "PUPUtil.hpp"
+#include "DenseBins.hpp"
 
 namespace tk {
 
@@ -39,11 +41,11 @@ class UniPDF {
     //! Pair type
     using pair_type = std::pair< const key_type, tk::real >;
 
-    //! \brief Univariate PDF
-    //! \details The underlying container type is an unordered_map where the key
-    //!   is one bin id corresponding to the single sample space dimension, and
-    //!   the mapped value is the sample counter. The hasher functor used here
-    //!   is the default for the key type provided by the standard library.
+    //! \brief Univariate PDF as an associative container
+    //! \details The associative container type returned by map(), where the
+    //!   key is one bin id corresponding to the single sample space dimension,
+    //!   and the mapped value is the sample counter. The hasher functor used
+    //!   here is the default for the key type provided by the standard library.
     using map_type = std::unordered_map< key_type, tk::real >;
 
     //! Empty constructor for Charm++
@@ -62,8 +64,8 @@ class UniPDF {
     //! \param[in] sample Sample to insert
     void add( tk::real sample ) {
       Assert( m_binsize > 0, "Bin size must be positive" );
+      m_pdf.add( {{ binid( sample, m_binsize ) }} );
       ++m_nsample;
-      ++m_pdf[ std::lround( sample / m_binsize ) ];
     }
 
     //! Add multiple samples from a PDF
@@ -71,15 +73,23 @@ class UniPDF {
     void addPDF( const UniPDF& p ) {
       m_binsize = p.binsize();
       m_nsample += p.nsample();
-      for (const auto& e : p.map()) m_pdf[ e.first ] += e.second;
+      m_pdf.add( p.m_pdf );
     }
 
     //! Zero bins
-    void zero() noexcept { m_nsample = 0; m_pdf.clear(); }
-
-    //! Constant accessor to underlying PDF map
-    //! \return Constant reference to underlying map
-    const map_type& map() const noexcept { return m_pdf; }
+    //! \details The range of bins is kept, as the same sample space is
+    //!   expected to be sampled again.
+    void zero() { m_nsample = 0; m_pdf.zero(); }
+
+    //! Return nonzero bins of PDF in an associative container
+    //! \return Associative container of the nonzero bins
+    //! \note This allocates and is intended for output only.
+    map_type map() const {
+      map_type m;
+      m_pdf.each( [&]( const DenseBins< dim >::key_type& k, tk::real c ){
+        m[ k[0] ] = c; } );
+      return m;
+    }
 
     //! Constant accessor to bin size
     //! \return Sample space bin size
@@ -87,20 +97,12 @@ class UniPDF {
 
     //! Return minimum and maximum bin ids of sample space
     //! \return {min,max} Minimum and maximum of the bin ids
-    std::array< long, 2*dim > extents() const {
-      Assert( !m_pdf.empty(), "PDF empty" );
-      auto x = std::minmax_element( begin(m_pdf), end(m_pdf),
-                 []( const pair_type& a, const pair_type& b )
-                 { return a.first < b.first; } );
-      return {{ x.first->first, x.second->first }};
-    }
+    std::array< long, 2*dim > extents() const { return m_pdf.extents(); }
 
     //! Compute integral of the distribution across the whole sample space
     //! \return Integral of the distribution
     tk::real integral() const {
-      return std::accumulate( m_pdf.cbegin(), m_pdf.cend(), 0.0,
-        [&]( tk::real i, const pair_type& p ){
-          return i + p.second; } ) / m_nsample;
+      return m_pdf.sum() / static_cast< tk::real >( m_nsample );
     }
 
     /** @name Pack/Unpack: Serialize UniPDF object for Charm++ */
@@ -121,7 +123,7 @@ class UniPDF {
   private:
     tk::real m_binsize;         //!< Sample space bin size
     std::size_t m_nsample;      //!< Number of samples collected
-    map_type m_pdf;             //!< Probability density function
+    DenseBins< dim > m_pdf;     //!< Probability density function
 };
 
 //! Output univariate PDF to output stream
@@ -64,12 +64,16 @@ TUTSuite::TUTSuite( const ctr::CmdLine& cmdline ) :
   // Get group name string passed in by -g
   const auto grp = cmdline.get< tag::group >();
 
+  // Benchmark groups are only run if selected via -g
+  const auto benchmark = []( const std::string& g )
+  { return g.find("Benchmark") != std::string::npos; };
+
   // If only select groups to be run, see if there is any that will run
   bool work = false;
-  if (grp.empty() ||
-      std::any_of( groups.cbegin(), groups.cend(),
-         [&grp]( const std::string& g )
-         { return g.find(grp) != std::string::npos; } ))
+  if ((grp.empty() && !std::all_of( groups.cbegin(), groups.cend(), benchmark ))
+      || std::any_of( groups.cbegin(), groups.cend(),
+           [&grp]( const std::string& g )
+           { return g.find(grp) != std::string::npos; } ))
     work = true;
 
   // Quit if there is no work to be done
@@ -90,8 +94,8 @@ TUTSuite::TUTSuite( const ctr::CmdLine& cmdline ) :
 
     // Fire up all tests in all groups using the Charm++ runtime system
     for (const auto& g : groups) {
-      if (grp.empty()) {                        // consider all test groups
-        spawngrp( g );
+      if (grp.empty()) {          // consider all but benchmark test groups
+        if (!benchmark( g )) spawngrp( g );
       } else if (g.find(grp) != std::string::npos) {
         // spawn only the groups that match the string specified via -g string
         spawngrp( g );
@@ -27,55 +27,84 @@ namespace walker {
 //!   formatting the internet ...
 CkReduction::reducerType PDFMerger;
 
+//! \brief Charm++ central moments merger reducer
+//! \details This variable is defined here in the .C file and declared as extern
+//!   in Collector.h, for the same reason as PDFMerger.
+CkReduction::reducerType MomentMerger;
+
 }
 
 using walker::Collector;
 
 void
-Collector::chareOrd( const std::vector< tk::real >& ord,
+Collector::chareOrd( uint64_t it,
+                     const std::vector< tk::real >& ord,
+                     const tk::CentralMoments& cen,
                      const std::vector< tk::UniPDF >& updf,
                      const std::vector< tk::BiPDF >& bpdf,
                      const std::vector< tk::TriPDF >& tpdf )
 // *****************************************************************************
-// Chares contribute ordinary moments and ordinary PDFs
+// Chares contribute ordinary and central moments and ordinary PDFs
+//! \param[in] it Iteration count of the time step the contribution is from
 //! \param[in] ord Vector of partial sums for the estimation of ordinary moments
+//! \param[in] cen Partial accumulator for the estimation of central moments
 //! \param[in] updf Vector of partial sums for the estimation of univariate
 //!   ordinary PDFs
 //! \param[in] bpdf Vector of partial sums for the estimation of bivariate
 //!   ordinary PDFs
 //! \param[in] tpdf Vector of partial sums for the estimation of trivariate
 //!   ordinary PDFs
+//! \details Since a chare contributes its time steps in order, the partial
+//!   sums of a time step are complete on my PE only after all chares on my PE
+//!   have contributed all earlier time steps, thus partial sums are sent to
+//!   the host in the order of the time steps, also in pipelined mode.
 //! \note This function does not have to be declared as a Charm++ entry
 //!   method since it is always called by chares on the same PE.
 // *****************************************************************************
 {
-  ++m_nord;
+  // Find partial sums of time step, start with zeros if first contribution
+  auto s = m_ord.find( it );
+  if (s == end(m_ord)) s = m_ord.emplace( it, m_zero ).first;
+  auto& p = s->second;
+
+  ++p.nord;
 
-  for (std::size_t i=0; i<m_ordinary.size(); ++i) m_ordinary[i] += ord[i];
+  for (std::size_t i=0; i<p.ordinary.size(); ++i) p.ordinary[i] += ord[i];
+
+  p.central.merge( cen );
 
   // Add contribution from worker chares to partial sums on my PE
   std::size_t i = 0;
-  for (const auto& p : updf) m_ordupdf[i++].addPDF( p );
+  for (const auto& q : updf) p.ordupdf[i++].addPDF( q );
   i = 0;
-  for (const auto& p : bpdf) m_ordbpdf[i++].addPDF( p );
+  for (const auto& q : bpdf) p.ordbpdf[i++].addPDF( q );
   i = 0;
-  for (const auto& p : tpdf) m_ordtpdf[i++].addPDF( p );
+  for (const auto& q : tpdf) p.ordtpdf[i++].addPDF( q );
 
   // If all chares on my PE have contributed, send partial sums to host
-  if (m_nord == m_nchare) {
+  if (p.nord == m_nchare) {
 
     // Create Charm++ callback function for reduction
     CkCallback c1( CkReductionTarget( Distributor, estimateOrd ), m_hostproxy );
 
     // Contribute partial sums to host via Charm++ reduction
-    contribute( static_cast< int >( m_ordinary.size() * sizeof(tk::real) ),
-                m_ordinary.data(), CkReduction::sum_double, c1 );
+    contribute( static_cast< int >( p.ordinary.size() * sizeof(tk::real) ),
+                p.ordinary.data(), CkReduction::sum_double, c1 );
 
-    // Zero counters for next collection operation
-    std::fill( begin(m_ordinary), end(m_ordinary), 0.0 );
+    // Serialize central moments accumulator to raw stream
+    auto cstream = tk::serialize( p.central );
+
+    // Create Charm++ callback function for reduction.
+    // Distributor::estimateCen() will be the final target of the reduction
+    // where the results of the reduction will appear.
+    CkCallback c3( CkIndex_Distributor::estimateCen(nullptr), m_hostproxy );
+
+    // Contribute serialized central moments accumulator to host via Charm++
+    // reduction, merging partial accumulators on the way
+    contribute( cstream.first, cstream.second.get(), MomentMerger, c3 );
 
     // Serialize vector of PDFs to raw stream
-    auto stream = tk::serialize( m_ordupdf, m_ordbpdf, m_ordtpdf );
+    auto stream = tk::serialize( p.ordupdf, p.ordbpdf, p.ordtpdf );
 
     // Create Charm++ callback function for reduction.
     // Distributor::estimateOrdPDF() will be the final target of the reduction
@@ -85,23 +114,17 @@ Collector::chareOrd( const std::vector< tk::real >& ord,
     // Contribute serialized PDFs of partial sums to host via Charm++ reduction
     contribute( stream.first, stream.second.get(), PDFMerger, c2 );
 
-    // Zero counters for next collection operation
-    for (auto& p : m_ordupdf) p.zero();
-    for (auto& p : m_ordbpdf) p.zero();
-    for (auto& p : m_ordtpdf) p.zero();
-
-    m_nord = 0;
+    // Done with collecting this time step on my PE
+    m_ord.erase( s );
   }
 }
 
 void
-Collector::chareCen( const std::vector< tk::real >& cen,
-                     const std::vector< tk::UniPDF >& updf,
-                     const std::vector< tk::BiPDF >& bpdf,
-                     const std::vector< tk::TriPDF >& tpdf )
+Collector::chareCenPDF( const std::vector< tk::UniPDF >& updf,
+                        const std::vector< tk::BiPDF >& bpdf,
+                        const std::vector< tk::TriPDF >& tpdf )
 // *****************************************************************************
-// Chares contribute central moments and central PDFs
-//! \param[in] cen Vector of partial sums for the estimation of central moments
+// Chares contribute central PDFs
 //! \param[in] updf Vector of partial sums for the estimation of univariate
 //!   central PDFs
 //! \param[in] bpdf Vector of partial sums for the estimation of bivariate
@@ -114,8 +137,6 @@ Collector::chareCen( const std::vector< tk::real >& cen,
 {
   ++m_ncen;
 
-  for (std::size_t i=0; i<m_central.size(); ++i) m_central[i] += cen[i];
-
   // Add contribution from worker chares to partial sums on my PE
   std::size_t i = 0;
   for (const auto& p : updf) m_cenupdf[i++].addPDF( p );
@@ -127,16 +148,6 @@ Collector::chareCen( const std::vector< tk::real >& cen,
   // If all chares on my PE have contributed, send partial sums to host
   if (m_ncen == m_nchare) {
 
-    // Create Charm++ callback function for reduction
-    CkCallback c1( CkReductionTarget( Distributor, estimateCen ), m_hostproxy );
-
-    // Contribute partial sums to host via Charm++ reduction
-    contribute( static_cast< int >( m_central.size() * sizeof(tk::real) ),
-                m_central.data(), CkReduction::sum_double, c1 );
-
-    // Zero counters for next collection operation
-    std::fill( begin(m_central), end(m_central), 0.0 );
-
     // Serialize vector of PDFs to raw stream
     auto stream = tk::serialize( m_cenupdf, m_cenbpdf, m_centpdf );
 
@@ -14,10 +14,14 @@
 #ifndef Collector_h
 #define Collector_h
 
+#include <map>
+#include <vector>
 #include <cstddef>
+#include <cstdint>
 
 #include "Types.hpp"
 #include "PDFReducer.hpp"
+#include "MomentReducer.hpp"
 #include "Make_unique.hpp"
 #include "Distributor.hpp"
 #include "Walker/InputDeck/InputDeck.hpp"
@@ -26,6 +30,7 @@ namespace walker {
 
 extern ctr::InputDeck g_inputdeck;
 extern CkReduction::reducerType PDFMerger;
+extern CkReduction::reducerType MomentMerger;
 
 #if defined(__clang__)
   #pragma clang diagnostic push
@@ -47,22 +52,21 @@ class Collector : public CBase_Collector {
     explicit Collector( CProxy_Distributor hostproxy ) :
       m_hostproxy( hostproxy ),
       m_nchare( 0 ),
-      m_nord( 0 ),
       m_ncen( 0 ),
-      m_ordinary( g_inputdeck.momentNames( tk::ctr::ordinary ).size(), 0.0 ),
-      m_central( g_inputdeck.momentNames( tk::ctr::central ).size(), 0.0 ),
-      m_ordupdf(
+      m_zero{ 0,
+        std::vector< tk::real >(
+          g_inputdeck.momentNames( tk::ctr::ordinary ).size(), 0.0 ),
+        tk::CentralMoments(),
         tk::ctr::numPDF< 1 >( g_inputdeck.get< tag::discr, tag::binsize >(),
                               g_inputdeck.get< tag::pdf >(),
-                              tk::ctr::Moment::ORDINARY ) ),
-      m_ordbpdf(
+                              tk::ctr::Moment::ORDINARY ),
         tk::ctr::numPDF< 2 >( g_inputdeck.get< tag::discr, tag::binsize >(),
                               g_inputdeck.get< tag::pdf >(),
-                              tk::ctr::Moment::ORDINARY ) ),
-      m_ordtpdf(
+                              tk::ctr::Moment::ORDINARY ),
         tk::ctr::numPDF< 3 >( g_inputdeck.get< tag::discr, tag::binsize >(),
                               g_inputdeck.get< tag::pdf >(),
-                              tk::ctr::Moment::ORDINARY ) ),
+                              tk::ctr::Moment::ORDINARY ) },
+      m_ord(),
       m_cenupdf(
         tk::ctr::numPDF< 1 >( g_inputdeck.get< tag::discr, tag::binsize >(),
                               g_inputdeck.get< tag::pdf >(),
@@ -87,33 +91,55 @@ class Collector : public CBase_Collector {
     static void registerPDFMerger()
     { PDFMerger = CkReduction::addReducer( tk::mergePDF ); }
 
+    //! \brief Configure Charm++ reduction types for collecting central moments
+    //! \details Since this is a [initnode] routine, see collector.ci, the
+    //!   Charm++ runtime system executes the routine exactly once on every
+    //!   logical node early on in the Charm++ init sequence. Must be static as
+    //!   it is called without an object.
+    static void registerMomentMerger()
+    { MomentMerger = CkReduction::addReducer( tk::mergeCentralMoments ); }
+
     //! Chares register on my PE
     //! \note This function does not have to be declared as a Charm++ entry
     //!   method since it is always called by chares on the same PE.
     void checkin() { ++m_nchare; }
 
-    //! Chares contribute ordinary moments and ordinary PDFs
-    void chareOrd( const std::vector< tk::real >& ord,
+    //! Chares contribute ordinary and central moments and ordinary PDFs
+    void chareOrd( uint64_t it,
+                   const std::vector< tk::real >& ord,
+                   const tk::CentralMoments& cen,
                    const std::vector< tk::UniPDF >& updf,
                    const std::vector< tk::BiPDF >& bpdf,
                    const std::vector< tk::TriPDF >& tpdf );
 
-    //! Chares contribute central moments and central PDFs
-    void chareCen( const std::vector< tk::real >& cen,
-                   const std::vector< tk::UniPDF >& updf,
-                   const std::vector< tk::BiPDF >& bpdf,
-                   const std::vector< tk::TriPDF >& tpdf );
+    //! Chares contribute central PDFs
+    void chareCenPDF( const std::vector< tk::UniPDF >& updf,
+                      const std::vector< tk::BiPDF >& bpdf,
+                      const std::vector< tk::TriPDF >& tpdf );
 
   private:
+    //! Partial sums of moments and ordinary PDFs of a time step on my PE
+    struct Partial {
+      std::size_t nord;                         //!< Number of contributions
+      std::vector< tk::real > ordinary;         //!< Ordinary moments
+      tk::CentralMoments central;               //!< Central moments
+      std::vector< tk::UniPDF > ordupdf;        //!< Ordinary univariate PDFs
+      std::vector< tk::BiPDF > ordbpdf;         //!< Ordinary bivariate PDFs
+      std::vector< tk::TriPDF > ordtpdf;        //!< Ordinary trivariate PDFs
+    };
+
     CProxy_Distributor m_hostproxy;             //!< Host proxy    
     std::size_t m_nchare;  //!< Number of chares contributing to my PE
-    std::size_t m_nord;    //!< Number of chares contributed ordinary moments
-    std::size_t m_ncen;    //!< Number of chares contributed central moments
-    std::vector< tk::real > m_ordinary;         //!< Ordinary moments
-    std::vector< tk::real > m_central;          //!< Central moments
-    std::vector< tk::UniPDF > m_ordupdf;        //!< Ordinary univariate PDFs
-    std::vector< tk::BiPDF > m_ordbpdf;         //!< Ordinary bivariate PDFs
-    std::vector< tk::TriPDF > m_ordtpdf;        //!< Ordinary trivariate PDFs
+    std::size_t m_ncen;    //!< Number of chares contributed central PDFs
+    //! \brief Zero ordinary moments and empty ordinary PDFs to start
+    //!   collecting a time step with
+    Partial m_zero;
+    //! \brief Partial sums being collected, associated to iteration counts
+    //! \details In pipelined mode, see Integrator::advance(), Integrators on
+    //!   my PE may be at different time steps, so partial sums are collected
+    //!   separately for each time step, at most for as many as the number of
+    //!   time steps in flight allowed, see Lookahead.
+    std::map< uint64_t, Partial > m_ord;
     std::vector< tk::UniPDF > m_cenupdf;        //!< Central univariate PDFs
     std::vector< tk::BiPDF > m_cenbpdf;         //!< Central bivariate PDFs
     std::vector< tk::TriPDF > m_centpdf;        //!< Central trivariate PDFs
@@ -33,6 +33,7 @@
 #include "Tags.hpp"
 #include "StatCtr.hpp"
 #include "Exception.hpp"
+#include "ContainerUtil.hpp"
 #include "Particles.hpp"
 #include "LoadDistributor.hpp"
 #include "Distributor.hpp"
@@ -40,6 +41,7 @@
 #include "DiffEqStack.hpp"
 #include "TxtStatWriter.hpp"
 #include "PDFReducer.hpp"
+#include "MomentReducer.hpp"
 #include "PDFWriter.hpp"
 #include "Options/PDFFile.hpp"
 #include "Options/PDFPolicy.hpp"
@@ -70,6 +72,10 @@ Distributor::Distributor( const ctr::CmdLine& cmdline ) :
   m_cenupdf(),
   m_cenbpdf(),
   m_centpdf(),
+  m_stat(),
+  m_itOrd( 0 ),
+  m_itCen( 0 ),
+  m_itOrdPDF( 0 ),
   m_tables(),
   m_moments()
 // *****************************************************************************
@@ -229,52 +235,80 @@ Distributor::estimateOrd( tk::real* ord, int n )
 // Estimate ordinary moments
 //! \param[in] ord Ordinary moments (sum) collected over all chares
 //! \param[in] n Number of ordinary moments in array ord
+//! \details Reductions over the Collector group complete in the order they
+//!   are started, and Collectors contribute the time steps in order, so
+//!   statistics of a given kind arrive in the order of the time steps, also
+//!   in pipelined mode.
 // *****************************************************************************
 {
-  #ifdef NDEBUG
-  IGNORE(n);
-  #endif
-
   Assert( static_cast<std::size_t>(n) == m_ordinary.size(),
           "Number of ordinary moments contributed not equal to expected" );
 
-  // Add contribution from PE to total sums, i.e., u[i] += v[i] for all i
-  for (std::size_t i=0; i<m_ordinary.size(); ++i) m_ordinary[i] += ord[i];
+  auto& o = m_stat[ m_itOrd++ ].ordinary;
+  o.assign( ord, ord + n );
 
   // Finish computing moments, i.e., divide sums by the number of samples
   // cppcheck-suppress useStlAlgorithm
-  for (auto& m : m_ordinary) m /= m_npar;
+  for (auto& m : o) m /= m_npar;
 
   // Activate SDAG trigger signaling that ordinary moments have been estimated
   estimateOrdDone();
 }
 
 void
-Distributor::estimateCen( tk::real* cen, int n )
+Distributor::estimateCen( CkReductionMsg* msg )
 // *****************************************************************************
-// Estimate ordinary moments
-//! \param[in] cen Central moments (sum) collected over all chares
-//! \param[in] n Number of central moments in array cen
+// Estimate central moments
+//! \param[in] msg Serialized central moments accumulator merged over all chares
 // *****************************************************************************
 {
-  #ifdef NDEBUG
-  IGNORE(n);
-  #endif
+  // Deserialize final central moments accumulator
+  tk::CentralMoments cen;
+  PUP::fromMem creator( msg->getData() );
+  creator | cen;
 
-  Assert( static_cast<std::size_t>(n) == m_central.size(),
-          "Number of central moments contributed not equal to expected" );
+  delete msg;
 
-  // Add contribution from PE to total sums, i.e., u[i] += v[i] for all i
-  for (std::size_t i=0; i<m_central.size(); ++i) m_central[i] += cen[i];
+  Assert( cen.nprod() == m_central.size(),
+          "Number of central moments contributed not equal to expected" );
 
   // Finish computing moments, i.e., divide sums by the number of samples
-  // cppcheck-suppress useStlAlgorithm
-  for (auto& m : m_central) m /= m_npar;
+  auto& c = m_stat[ m_itCen++ ].central;
+  c.resize( m_central.size() );
+  for (std::size_t i=0; i<c.size(); ++i) c[i] = cen.moment(i);
 
   // Activate SDAG trigger signaling that central moments have been estimated
   estimateCenDone();
 }
 
+void
+Distributor::accumulateCenPDF()
+// *****************************************************************************
+// Start accumulating central PDFs if estimated in this time step
+//! \details Central moments are estimated together with the ordinary moments
+//!   in a single pass, so the ordinary moments are only required to be
+//!   broadcast back to the Integrators to estimate central PDFs, which are
+//!   only estimated at the first and last iterations and at select times, see
+//!   also Integrator::accumulateOrd(). Otherwise we signal that central PDFs
+//!   have been estimated right away, skipping a round trip to all Integrators.
+// *****************************************************************************
+{
+  const auto term = g_inputdeck.get< tag::discr, tag::term >();
+  const auto eps = std::numeric_limits< tk::real >::epsilon();
+  const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
+  const auto pdffreq = g_inputdeck.get< tag::interval, tag::pdf >();
+  const auto& pdf = g_inputdeck.get< tag::pdf >();
+
+  if ( std::any_of( begin(pdf), end(pdf),
+         []( const tk::ctr::Probability& p ){ return tk::ctr::central(p); } ) &&
+       ( m_it == 0 ||
+         !((m_it+1) % pdffreq) ||
+         (std::fabs(m_t+m_dt-term) < eps && (m_it+1) >= nstep) ) )
+    m_intproxy.accumulateCenPDF( tk::cref_find( m_stat, m_it ).ordinary );
+  else
+    estimateCenPDFDone();
+}
+
 void
 Distributor::estimateOrdPDF( CkReductionMsg* msg )
 // *****************************************************************************
@@ -283,10 +317,11 @@ Distributor::estimateOrdPDF( CkReductionMsg* msg )
 // *****************************************************************************
 {
   // Deserialize final PDFs
+  auto& s = m_stat[ m_itOrdPDF++ ];
   PUP::fromMem creator( msg->getData() );
-  creator | m_ordupdf;
-  creator | m_ordbpdf;
-  creator | m_ordtpdf;
+  creator | s.ordupdf;
+  creator | s.ordbpdf;
+  creator | s.ordtpdf;
 
   delete msg;
 
@@ -313,6 +348,28 @@ Distributor::estimateCenPDF( CkReductionMsg* msg )
   estimateCenPDFDone();
 }
 
+void
+Distributor::nextStat()
+// *****************************************************************************
+// Take the statistics estimated in the time step being evaluated
+//! \details Moves the moments and ordinary PDFs of the time step being
+//!   evaluated to where they are output from. Central PDFs are estimated
+//!   directly there, since they are only estimated while the time step is
+//!   being evaluated, see accumulateCenPDF().
+// *****************************************************************************
+{
+  auto s = m_stat.find( m_it );
+  Assert( s != end(m_stat), "Statistics of time step not found" );
+
+  m_ordinary = std::move( s->second.ordinary );
+  m_central = std::move( s->second.central );
+  m_ordupdf = std::move( s->second.ordupdf );
+  m_ordbpdf = std::move( s->second.ordbpdf );
+  m_ordtpdf = std::move( s->second.ordtpdf );
+
+  m_stat.erase( s );
+}
+
 void
 Distributor::outStat()
 // *****************************************************************************
@@ -639,18 +696,20 @@ Distributor::evaluateTime()
         else
           m_moments[ product ] = m_central[ cen++ ];
 
-      // Zero statistics counters and accumulators
-      std::fill( begin(m_ordinary), end(m_ordinary), 0.0 );
-      std::fill( begin(m_central), end(m_central), 0.0 );
-
       // Re-activate SDAG-wait for estimation of ordinary stats for next step
       thisProxy.wait4ord();
       // Re-activate SDAG-wait for estimation of PDFs for next step
       thisProxy.wait4pdf();
     }
 
-    // Continue with next time step with all integrators
-    m_intproxy.advance( m_dt, m_t, m_it, m_moments );
+    // Continue with next time step with all integrators, unless they have
+    // already continued in pipelined mode, see Integrator::advance(), in
+    // which case they are only told how many time steps have been evaluated,
+    // so those that stalled, see Integrator::next(), can continue
+    if (!g_inputdeck.stat() || g_inputdeck.momentsUsed())
+      m_intproxy.advance( m_dt, m_t, m_it, m_moments );
+    else
+      m_intproxy.evaluated( m_it );
 
   } else finish();
 }
@@ -82,7 +82,7 @@ class Distributor : public CBase_Distributor {
     void estimateOrd( tk::real* ord, int n );
 
     //! Estimate central moments
-    void estimateCen( tk::real* cen, int n );
+    void estimateCen( CkReductionMsg* msg );
 
     //! Estimate ordinary PDFs
     void estimateOrdPDF( CkReductionMsg* msg );
@@ -94,9 +94,24 @@ class Distributor : public CBase_Distributor {
     void nostat();
 
   private:
+    //! Moments and ordinary PDFs estimated in a time step
+    struct Stat {
+      std::vector< tk::real > ordinary;         //!< Ordinary moments
+      std::vector< tk::real > central;          //!< Central moments
+      std::vector< tk::UniPDF > ordupdf;        //!< Ordinary univariate PDFs
+      std::vector< tk::BiPDF > ordbpdf;         //!< Ordinary bivariate PDFs
+      std::vector< tk::TriPDF > ordtpdf;        //!< Ordinary trivariate PDFs
+    };
+
     //! Print information at startup
     void info( uint64_t chunksize, std::size_t nchare );
 
+    //! Start accumulating central PDFs if estimated in this time step
+    void accumulateCenPDF();
+
+    //! Take the statistics estimated in the time step being evaluated
+    void nextStat();
+
     //! Compute size of next time step
     tk::real computedt();
 
@@ -165,6 +180,16 @@ class Distributor : public CBase_Distributor {
     std::vector< tk::UniPDF > m_cenupdf;        //!< Central univariate PDFs
     std::vector< tk::BiPDF > m_cenbpdf;         //!< Central bivariate PDFs
     std::vector< tk::TriPDF > m_centpdf;        //!< Central trivariate PDFs
+    //! \brief Statistics estimated, associated to iteration counts, not yet
+    //!   taken by nextStat()
+    //! \details In pipelined mode, see Integrator::advance(), statistics of
+    //!   later time steps may be estimated before the time step being
+    //!   evaluated is finished. At most as many as the number of time steps
+    //!   in flight allowed, see Lookahead.
+    std::map< uint64_t, Stat > m_stat;
+    uint64_t m_itOrd;           //!< Iteration of next ordinary moments
+    uint64_t m_itCen;           //!< Iteration of next central moments
+    uint64_t m_itOrdPDF;        //!< Iteration of next ordinary PDFs
 
     //! Names of and tables to sample and output to statistics file
     std::pair< std::vector< std::string >,
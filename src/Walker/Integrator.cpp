@@ -15,6 +15,8 @@
 */
 // *****************************************************************************
 
+#include <algorithm>
+
 #include "Integrator.hpp"
 #include "Collector.hpp"
 
@@ -31,12 +33,17 @@ Integrator::Integrator( CProxy_Distributor hostproxy,
                         uint64_t npar ) :
   m_hostproxy( hostproxy ),
   m_collproxy( collproxy ),
+  m_it( 0 ),
+  m_t( 0.0 ),
+  m_dt( 0.0 ),
   m_particles( npar, g_inputdeck.get< tag::component >().nprop() ),
   m_stat( m_particles,
           g_inputdeck.get< tag::component >().offsetmap( g_inputdeck ),
           g_inputdeck.get< tag::stat >(),
           g_inputdeck.get< tag::pdf >(),
-          g_inputdeck.get< tag::discr, tag::binsize >() )
+          g_inputdeck.get< tag::discr, tag::binsize >() ),
+  m_lookahead( g_inputdeck.get< tag::discr, tag::lookahead >() ),
+  m_stalled( false )
 // *****************************************************************************
 // Constructor
 //! \param[in] hostproxy Host proxy to call back to
@@ -94,8 +101,19 @@ Integrator::advance( tk::real dt,
 //! \param[in] t Physical time
 //! \param[in] it Iteration count
 //! \param[in] moments Map of statistical moments
+//! \details If statistics are estimated but none of the differential
+//!   equations consumes them, time stepping is pipelined: we continue with
+//!   the next time step right after our contribution to the statistics has
+//!   been sent, without waiting for the host, Distributor, to finish their
+//!   estimation. Only in time steps in which central PDFs are estimated do we
+//!   wait for the host to broadcast the ordinary moments, see
+//!   accumulateCenPDF().
 // *****************************************************************************
 {
+  m_it = it;
+  m_t = t;
+  m_dt = dt;
+
   // Advance all equations one step in time. At the 0th iteration skip advance
   // but estimate statistics and (potentially) PDFs (at the interval given by
   // the user).
@@ -109,13 +127,16 @@ Integrator::advance( tk::real dt,
   } else {
     // Accumulate sums for ordinary moments (every time step)
     accumulateOrd( it, t, dt );
+    // Continue with next time step in pipelined mode, unless central PDFs are
+    // estimated in this time step
+    if (!g_inputdeck.momentsUsed() && !cenpdf()) next();
   }
 }
 
 void
 Integrator::accumulateOrd( uint64_t it, tk::real t, tk::real dt )
 // *****************************************************************************
-// Accumulate sums for ordinary moments and ordinary PDFs
+// Accumulate sums for ordinary and central moments and ordinary PDFs
 //! \param[in] it Iteration count
 //! \param[in] t Physical time
 //! \param[in] dt Time step size
@@ -126,8 +147,9 @@ Integrator::accumulateOrd( uint64_t it, tk::real t, tk::real dt )
   const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
   const auto pdffreq = g_inputdeck.get< tag::interval, tag::pdf >();
 
-  // Accumulate partial sums for ordinary moments
-  m_stat.accumulateOrd();
+  // Accumulate partial sums for ordinary moments and partial accumulators for
+  // central moments in a single pass
+  m_stat.accumulate();
   // Accumulate sums for ordinary PDFs at first and last iterations and at
   // select times
   if ( g_inputdeck.pdf() &&
@@ -136,47 +158,110 @@ Integrator::accumulateOrd( uint64_t it, tk::real t, tk::real dt )
          (std::fabs(t+dt-term) < eps && (it+1) >= nstep) ) )
     m_stat.accumulateOrdPDF();
 
-  // Send accumulated ordinary moments and ordinary PDFs to collector for
-  // estimation
-  m_collproxy.ckLocalBranch()->chareOrd( m_stat.ord(),
+  // Send accumulated ordinary and central moments and ordinary PDFs to
+  // collector for estimation
+  m_collproxy.ckLocalBranch()->chareOrd( it,
+                                         m_stat.ord(),
+                                         m_stat.cen(),
                                          m_stat.oupdf(),
                                          m_stat.obpdf(),
                                          m_stat.otpdf() );
 }
 
 void
-Integrator::accumulateCen( uint64_t it,
-                           tk::real t,
-                           tk::real dt,
-                           const std::vector< tk::real >& ord )
+Integrator::accumulateCenPDF( const std::vector< tk::real >& ord )
 // *****************************************************************************
-// Accumulate sums for central moments and central PDFs
-//! \param[in] it Iteration count
-//! \param[in] t Physical time
-//! \param[in] dt Time step size
+// Accumulate sums for central PDFs
 //! \param[in] ord Estimated ordinary moments (collected from all PEs)
+//! \details This is only called by the host, Distributor, in time steps in
+//!   which central PDFs are estimated, since central moments are accumulated
+//!   together with the ordinary moments in accumulateOrd().
+// *****************************************************************************
+{
+  // Accumulate partial sums for central PDFs
+  m_stat.accumulateCenPDF( ord );
+
+  // Send accumulated central PDFs to host for estimation
+  m_collproxy.ckLocalBranch()->chareCenPDF( m_stat.cupdf(),
+                                            m_stat.cbpdf(),
+                                            m_stat.ctpdf() );
+
+  // Continue with next time step in pipelined mode
+  if (!g_inputdeck.momentsUsed()) next();
+}
+
+bool
+Integrator::cenpdf() const
+// *****************************************************************************
+// Query if central PDFs are estimated in this time step
+//! \return True if central PDFs are estimated in this time step
+//! \details This must agree with Distributor::accumulateCenPDF().
 // *****************************************************************************
 {
   const auto term = g_inputdeck.get< tag::discr, tag::term >();
   const auto eps = std::numeric_limits< tk::real >::epsilon();
   const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
   const auto pdffreq = g_inputdeck.get< tag::interval, tag::pdf >();
+  const auto& pdf = g_inputdeck.get< tag::pdf >();
 
-  // Accumulate partial sums for central moments
-  m_stat.accumulateCen( ord );
-  // Accumulate partial sums for central PDFs at first and last iteraions and
-  // at select times
-  if ( g_inputdeck.pdf() &&
-       ( it == 0 ||
-         !((it+1) % pdffreq) ||
-         (std::fabs(t+dt-term) < eps && (it+1) >= nstep) ) )
-    m_stat.accumulateCenPDF( ord );
+  return
+    std::any_of( begin(pdf), end(pdf),
+      []( const tk::ctr::Probability& p ){ return tk::ctr::central(p); } ) &&
+    ( m_it == 0 ||
+      !((m_it+1) % pdffreq) ||
+      (std::fabs(m_t+m_dt-term) < eps && (m_it+1) >= nstep) );
+}
 
-  // Send accumulated central moments to host for estimation
-  m_collproxy.ckLocalBranch()->chareCen( m_stat.ctr(),
-                                         m_stat.cupdf(),
-                                         m_stat.cbpdf(),
-                                         m_stat.ctpdf() );
+void
+Integrator::next()
+// *****************************************************************************
+// Continue with the next time step without waiting for the host
+//! \details This is only called in pipelined mode, i.e., if none of the
+//!   differential equations consumes statistical moments. The time step size
+//!   is constant, and the next time step is computed here the same way as
+//!   Distributor::evaluateTime() does, which finishes once the statistics of
+//!   the last time step have been estimated. If starting the next time step
+//!   would exceed the number of time steps in flight allowed, see Lookahead,
+//!   we stall until the host has evaluated enough time steps, see evaluated().
+// *****************************************************************************
+{
+  const auto term = g_inputdeck.get< tag::discr, tag::term >();
+  const auto eps = std::numeric_limits< tk::real >::epsilon();
+  const auto nstep = g_inputdeck.get< tag::discr, tag::nstep >();
+
+  auto it = m_it + 1;
+  auto t = m_t + m_dt;
+  if (t > term) t = term;
+
+  // Advance to next time step unless this was the last one. Advancing via an
+  // asynchronous call to ourselves, instead of a function call, yields to the
+  // Charm++ runtime system, so messages, e.g., reductions of statistics, can
+  // be processed in between time steps.
+  if (std::fabs(t-term) > eps && it < nstep) {
+    if (m_lookahead.open( it ))
+      thisProxy[ thisIndex ].advance( m_dt, t, it,
+        std::map< tk::ctr::Product, tk::real >() );
+    else
+      m_stalled = true;
+  }
+}
+
+void
+Integrator::evaluated( uint64_t n )
+// *****************************************************************************
+// Receive the number of time steps evaluated by the host
+//! \param[in] n Number of time steps evaluated by the host, Distributor
+//! \details This is only called in pipelined mode, by the host broadcasting
+//!   after it has evaluated a time step. If we stalled because too many time
+//!   steps were in flight, we continue with the next time step once allowed.
+// *****************************************************************************
+{
+  m_lookahead.evaluated( n );
+
+  if (m_stalled && m_lookahead.open( m_it+1 )) {
+    m_stalled = false;
+    next();
+  }
 }
 
 #include "NoWarning/integrator.def.h"
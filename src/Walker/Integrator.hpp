@@ -28,6 +28,7 @@
 #include "Particles.hpp"
 #include "SystemComponents.hpp"
 #include "Statistics.hpp"
+#include "Lookahead.hpp"
 #include "Walker/InputDeck/InputDeck.hpp"
 
 #include "NoWarning/integrator.decl.h"
@@ -58,7 +59,9 @@ class Integrator : public CBase_Integrator {
                 g_inputdeck.get< tag::component >().offsetmap( g_inputdeck ),
                 g_inputdeck.get< tag::stat >(),
                 g_inputdeck.get< tag::pdf >(),
-                g_inputdeck.get< tag::discr, tag::binsize >() ) {}
+                g_inputdeck.get< tag::discr, tag::binsize >() ),
+      m_lookahead( g_inputdeck.get< tag::discr, tag::lookahead >() ),
+      m_stalled( false ) {}
 
     //! Perform setup: set initial conditions and advance a time step
     void setup( tk::real dt,
@@ -75,20 +78,33 @@ class Integrator : public CBase_Integrator {
                   uint64_t it,
                   const std::map< tk::ctr::Product, tk::real >& moments );
 
-    // Accumulate sums for ordinary moments and ordinary PDFs
+    // Accumulate sums for ordinary and central moments and ordinary PDFs
     void accumulateOrd( uint64_t it, tk::real t, tk::real dt );
 
-    // Accumulate sums for central moments and central PDFs
-    void accumulateCen( uint64_t it,
-                        tk::real t,
-                        tk::real dt,
-                        const std::vector< tk::real >& ord );
+    // Accumulate sums for central PDFs
+    void accumulateCenPDF( const std::vector< tk::real >& ord );
+
+    //! Receive the number of time steps evaluated by the host
+    void evaluated( uint64_t n );
 
   private:
     CProxy_Distributor m_hostproxy;     //!< Host proxy
     CProxy_Collector m_collproxy;       //!< Collector proxy
+    uint64_t m_it;                      //!< Iteration count
+    tk::real m_t;                       //!< Physical time
+    tk::real m_dt;                      //!< Time step size
     tk::Particles m_particles;          //!< Particle properties
     tk::Statistics m_stat;              //!< Statistics
+    //! Bound on the number of time steps in flight in pipelined mode
+    Lookahead m_lookahead;
+    //! True if waiting for the host to evaluate time steps in pipelined mode
+    bool m_stalled;
+
+    //! Query if central PDFs are estimated in this time step
+    bool cenpdf() const;
+
+    //! Continue with the next time step without waiting for the host
+    void next();
 };
 
 #if defined(__clang__)
@@ -0,0 +1,63 @@
+// *****************************************************************************
+/*!
+  \file      src/Walker/Lookahead.hpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Bound on the number of time steps in flight in pipelined mode
+  \details   Bound on the number of time steps in flight in pipelined mode. In
+    pipelined mode, see Integrator::advance(), an Integrator continues with the
+    next time step right after its contribution to the statistics of a time
+    step has been sent, without waiting for the host, Distributor, to evaluate
+    the time step. A time step is in flight from when its statistics are sent
+    until the host has evaluated it. Collector and Distributor store partial
+    and estimated statistics for every time step in flight, so without a bound
+    on how far ahead Integrators may run, their storage would grow without
+    bound if particles are advanced faster than statistics are reduced and
+    written to disk. Lookahead allows at most k time steps in flight: an
+    Integrator may only start time step it if the host has already evaluated
+    at least it-k+1 time steps. With k=1 time stepping is synchronous.
+*/
+// *****************************************************************************
+#ifndef Lookahead_h
+#define Lookahead_h
+
+#include <algorithm>
+#include <cstdint>
+
+namespace walker {
+
+//! Bound on the number of time steps in flight in pipelined mode
+class Lookahead {
+
+  public:
+    //! Constructor
+    //! \param[in] k Maximum number of time steps in flight, 0 is taken as 1
+    explicit Lookahead( uint64_t k = 1 ) :
+      m_k( std::max( k, uint64_t(1) ) ), m_evaluated( 0 ) {}
+
+    //! Query if a time step may be started
+    //! \param[in] it Iteration count of the time step to start
+    //! \return True if starting time step it keeps the number of time steps
+    //!   in flight at most k
+    bool open( uint64_t it ) const { return it < m_evaluated + m_k; }
+
+    //! Record the number of time steps evaluated by the host
+    //! \param[in] n Number of time steps evaluated
+    //! \details Since broadcasts from the host may arrive out of order, the
+    //!   largest count received is kept.
+    void evaluated( uint64_t n ) { m_evaluated = std::max( m_evaluated, n ); }
+
+    //! Maximum number of time steps in flight
+    //! \return Maximum number of time steps in flight, k
+    uint64_t size() const { return m_k; }
+
+  private:
+    uint64_t m_k;               //!< Maximum number of time steps in flight
+    uint64_t m_evaluated;       //!< Number of time steps evaluated by host
+};
+
+} // walker::
+
+#endif // Lookahead_h
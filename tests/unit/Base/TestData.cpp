@@ -10,9 +10,11 @@
 */
 // *****************************************************************************
 
+#include <cmath>
 #include <limits>
 #include <array>
 #include <vector>
+#include <cstdint>
 
 #include "NoWarning/tut.hpp"
 
@@ -1886,6 +1888,167 @@ void Data_object::test< 41 >() {
          std::vector< tk::real >{ 3.0, 4.0 }, r[0] );
 }
 
+//! Test that the blocked data layout stores the same data as the others
+template<> template<>
+void Data_object::test< 42 >() {
+  set_test_name( "blocked layout accessors" );
+
+  // number of unknowns not a multiple of the block width
+  const std::size_t nu = 3*tk::DataBlockWidth + 1, np = 5;
+  tk::Data< tk::UnkEqComp > p( nu, np );
+  tk::Data< tk::BlkEqCompUnk > b( nu, np );
+
+  ensure_equals( "<BlkEqCompUnk>::nunk() incorrect", b.nunk(), nu );
+  ensure_equals( "<BlkEqCompUnk>::nprop() incorrect", b.nprop(), np );
+  ensure_equals( "<BlkEqCompUnk>::nblock() incorrect", b.nblock(), 4 );
+  ensure_equals( "<BlkEqCompUnk> storage size incorrect", b.data().size(),
+                 4*tk::DataBlockWidth*np );
+
+  for (std::size_t u=0; u<nu; ++u)
+    for (std::size_t c=0; c<np; ++c)
+      p(u,c,0) = b(u,c,0) = static_cast< tk::real >( u*np + c );
+
+  using unittest::veceq;
+
+  for (std::size_t c=0; c<np-1; ++c) {
+    const auto bp = b.cptr( c, 1 );
+    const auto pp = p.cptr( c, 1 );
+    for (std::size_t u=0; u<nu; ++u)
+      ensure_equals( "<BlkEqCompUnk>::var(cptr()) incorrect",
+                     b.var(bp,u), p.var(pp,u), prec );
+    veceq( "<BlkEqCompUnk>::extract(c,o) incorrect",
+           p.extract(c,1), b.extract(c,1) );
+  }
+  for (std::size_t u=0; u<nu; ++u)
+    veceq( "<BlkEqCompUnk>::extract(u) incorrect", p.extract(u), b.extract(u) );
+}
+
+//! Test blocked data layout block access
+template<> template<>
+void Data_object::test< 43 >() {
+  set_test_name( "blocked layout bptr()" );
+
+  const std::size_t nu = 2*tk::DataBlockWidth + 3, np = 3;
+  tk::Data< tk::BlkEqCompUnk > b( nu, np );
+  for (std::size_t u=0; u<nu; ++u)
+    for (std::size_t c=0; c<np; ++c)
+      b(u,c,0) = static_cast< tk::real >( u*np + c );
+
+  for (std::size_t k=0; k<b.nblock(); ++k)
+    for (std::size_t c=0; c<np; ++c) {
+      const auto x = b.bptr( k, c, 0 );
+      ensure_equals( "<BlkEqCompUnk>::bptr() not aligned",
+                     reinterpret_cast< std::uintptr_t >( x ) %
+                       tk::DataBlockAlign % (tk::DataBlockWidth*sizeof(x[0])),
+                     0 );
+      for (std::size_t i=0; i<tk::DataBlockWidth; ++i) {
+        auto u = k*tk::DataBlockWidth + i;
+        if (u < nu)
+          ensure_equals( "<BlkEqCompUnk>::bptr() incorrect", x[i], b(u,c,0),
+                         prec );
+      }
+    }
+}
+
+//! Test tk::Data::push_back(), resize(), and rm() with the blocked layout
+template<> template<>
+void Data_object::test< 44 >() {
+  set_test_name( "blocked layout push_back, resize, rm" );
+
+  tk::Data< tk::BlkEqCompUnk > b( 3, 2 );
+  b(0,0,0) = 1.0;  b(0,1,0) = 2.0;
+  b(1,0,0) = 3.0;  b(1,1,0) = 4.0;
+  b(2,0,0) = 5.0;  b(2,1,0) = 6.0;
+
+  using unittest::veceq;
+
+  b.push_back( {0.2, 0.3} );
+  ensure_equals( "nunk after <BlkEqCompUnk>::push_back() incorrect",
+                 b.nunk(), 4 );
+  veceq( "<BlkEqCompUnk>::push_back() at 3 incorrect",
+         std::vector< tk::real >{ 0.2, 0.3 }, b[3] );
+
+  // enlarge across multiple blocks, new unknowns in the last block's padding
+  // must be initialized as well
+  b.resize( 2*tk::DataBlockWidth + 1, -2.13 );
+  ensure_equals( "nunk after <BlkEqCompUnk>::resize() incorrect",
+                 b.nunk(), 2*tk::DataBlockWidth + 1 );
+  veceq( "<BlkEqCompUnk>::resize() at 2 incorrect",
+         std::vector< tk::real >{ 5.0, 6.0 }, b[2] );
+  veceq( "<BlkEqCompUnk>::resize() at 3 incorrect",
+         std::vector< tk::real >{ 0.2, 0.3 }, b[3] );
+  for (std::size_t u=4; u<b.nunk(); ++u)
+    veceq( "<BlkEqCompUnk>::resize() at " + std::to_string(u) + " incorrect",
+           std::vector< tk::real >{ -2.13, -2.13 }, b[u] );
+
+  b.rm( { 0, 2 } );
+  ensure_equals( "nunk after <BlkEqCompUnk>::rm() incorrect",
+                 b.nunk(), 2*tk::DataBlockWidth - 1 );
+  veceq( "<BlkEqCompUnk>::rm() at 0 incorrect",
+         std::vector< tk::real >{ 3.0, 4.0 }, b[0] );
+  veceq( "<BlkEqCompUnk>::rm() at 1 incorrect",
+         std::vector< tk::real >{ 0.2, 0.3 }, b[1] );
+  veceq( "<BlkEqCompUnk>::rm() at 2 incorrect",
+         std::vector< tk::real >{ -2.13, -2.13 }, b[2] );
+}
+
+//! Test tk::fused()
+template<> template<>
+void Data_object::test< 45 >() {
+  set_test_name( "fused" );
+
+  tk::Data< tk::UnkEqComp > u( 3, 2 ), du( 3, 2 ), m( 3, 2 );
+  u.fill( 1.0 );
+  for (std::size_t i=0; i<3; ++i)
+    for (std::size_t c=0; c<2; ++c) {
+      du(i,c,0) = static_cast< tk::real >( i*2 + c );
+      m(i,c,0) = 2.0;
+    }
+
+  // update one operand in place from two others
+  tk::fused( []( tk::real& a, tk::real b, tk::real l ){ a += b/l; }, u, du, m );
+  for (std::size_t i=0; i<3; ++i)
+    for (std::size_t c=0; c<2; ++c)
+      ensure_equals( "<UnkEqComp>::fused() in-place update incorrect",
+                     u(i,c,0), 1.0 + static_cast< tk::real >(i*2+c)/2.0,
+                     prec );
+
+  // update two operands in a single pass
+  const tk::Data< tk::UnkEqComp > r( m );
+  tk::fused( []( tk::real& a, tk::real& b, tk::real l ){ a = l; b = 2.0*l; },
+             u, du, r );
+  for (std::size_t i=0; i<3; ++i)
+    for (std::size_t c=0; c<2; ++c) {
+      ensure_equals( "<UnkEqComp>::fused() 1st output incorrect",
+                     u(i,c,0), 2.0, prec );
+      ensure_equals( "<UnkEqComp>::fused() 2nd output incorrect",
+                     du(i,c,0), 4.0, prec );
+    }
+
+  // blocked layout with a partially filled last block: padding is skipped, so
+  // dividing by an operand, zero in the padding, does not produce NaNs
+  const std::size_t nu = 2*tk::DataBlockWidth + 1;
+  tk::Data< tk::BlkEqCompUnk > bu( nu, 2 ), bdu( nu, 2 ), bm( nu, 2 );
+  for (std::size_t i=0; i<nu; ++i)
+    for (std::size_t c=0; c<2; ++c) {
+      bu(i,c,0) = 1.0;
+      bdu(i,c,0) = static_cast< tk::real >( i*2 + c );
+      bm(i,c,0) = 2.0;
+    }
+  std::size_t ncall = 0;
+  tk::fused( [&]( tk::real& a, tk::real b, tk::real l ){ a += b/l; ++ncall; },
+             bu, bdu, bm );
+  ensure_equals( "<BlkEqCompUnk>::fused() not called once per unknown and "
+                 "property", ncall, 2*nu );
+  for (std::size_t i=0; i<nu; ++i)
+    for (std::size_t c=0; c<2; ++c)
+      ensure_equals( "<BlkEqCompUnk>::fused() in-place update incorrect",
+                     bu(i,c,0), 1.0 + static_cast< tk::real >(i*2+c)/2.0,
+                     prec );
+  for (auto v : bu.data())
+    ensure( "<BlkEqCompUnk>::fused() produced NaN in padding", !std::isnan(v) );
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,241 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestDataLayout.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Benchmarks of the data layouts of tk::Data
+  \details   Benchmarks of the data layouts of tk::Data on representative DG
+    and particle kernels. Each kernel is run with all three data layouts,
+    unknown-major (UnkEqComp), equation-major (EqCompUnk), and blocked
+    equation-major (BlkEqCompUnk), the results are compared, and the
+    throughput of each layout is reported in the test name. With the blocked
+    layout the kernels are also run in a variant that sweeps over the unknowns
+    of a block using tk::Data::bptr(), which the compiler can vectorize.
+*/
+// *****************************************************************************
+
+#include <cmath>
+#include <random>
+#include <sstream>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Data.hpp"
+#include "Timer.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct DataLayout_common {
+
+  //! Number of unknowns, i.e., elements or particles
+  const std::size_t nunk = 100000;
+  //! Number of repetitions of the kernels for timing
+  const std::size_t nrep = 20;
+
+  //! Number of scalar components of the DG kernel
+  static const std::size_t ncomp = 5;
+  //! Number of degrees of freedom per component of the DG kernel (P1)
+  static const std::size_t ndof = 4;
+
+  //! Fill data with random numbers
+  //! \param[in,out] d Data to fill
+  template< uint8_t Layout >
+  void random( tk::Data< Layout >& d ) {
+    std::mt19937 gen( 1234 );
+    std::uniform_real_distribution< tk::real > dist( 0.5, 1.5 );
+    for (std::size_t u=0; u<d.nunk(); ++u)
+      for (std::size_t c=0; c<d.nprop(); ++c)
+        d(u,c,0) = dist(gen);
+  }
+
+  //! DG kernel: evaluate a P1 solution at a quadrature point and add the
+  //!   weighted contribution of a nonlinear flux to the right hand side
+  //! \param[in] U Solution degrees of freedom
+  //! \param[in,out] R Right hand side
+  template< uint8_t Layout >
+  void dg( const tk::Data< Layout >& U, tk::Data< Layout >& R ) {
+    const tk::real B[ndof] = { 1.0, 0.2, -0.3, 0.1 }, wt = 0.25;
+    for (std::size_t c=0; c<ncomp; ++c) {
+      const tk::real* u[ndof];
+      const tk::real* r[ndof];
+      for (std::size_t k=0; k<ndof; ++k) {
+        u[k] = U.cptr( c*ndof+k, 0 );
+        r[k] = R.cptr( c*ndof+k, 0 );
+      }
+      for (std::size_t e=0; e<U.nunk(); ++e) {
+        auto s = U.var(u[0],e)*B[0] + U.var(u[1],e)*B[1] +
+                 U.var(u[2],e)*B[2] + U.var(u[3],e)*B[3];
+        auto f = wt * s * s;
+        for (std::size_t k=0; k<ndof; ++k) R.var(r[k],e) += f*B[k];
+      }
+    }
+  }
+
+  //! DG kernel sweeping over the elements of a block of the blocked layout
+  //! \param[in] U Solution degrees of freedom
+  //! \param[in,out] R Right hand side
+  void dgBlock( const tk::Data< tk::BlkEqCompUnk >& U,
+                tk::Data< tk::BlkEqCompUnk >& R )
+  {
+    const tk::real B[ndof] = { 1.0, 0.2, -0.3, 0.1 }, wt = 0.25;
+    for (std::size_t b=0; b<U.nblock(); ++b)
+      for (std::size_t c=0; c<ncomp; ++c) {
+        const auto u0 = U.bptr( b, c*ndof+0, 0 );
+        const auto u1 = U.bptr( b, c*ndof+1, 0 );
+        const auto u2 = U.bptr( b, c*ndof+2, 0 );
+        const auto u3 = U.bptr( b, c*ndof+3, 0 );
+        tk::real f[ tk::DataBlockWidth ];
+        for (std::size_t i=0; i<tk::DataBlockWidth; ++i) {
+          auto s = u0[i]*B[0] + u1[i]*B[1] + u2[i]*B[2] + u3[i]*B[3];
+          f[i] = wt * s * s;
+        }
+        for (std::size_t k=0; k<ndof; ++k) {
+          auto r = R.bptr( b, c*ndof+k, 0 );
+          for (std::size_t i=0; i<tk::DataBlockWidth; ++i) r[i] += f[i]*B[k];
+        }
+      }
+  }
+
+  //! Particle kernel: advance a system of coupled Ornstein-Uhlenbeck
+  //!   processes, sharing the diffusion coefficient of the first component
+  //! \param[in,out] X Particle properties
+  //! \param[in] dW Increments of the Wiener processes, one for each property
+  template< uint8_t Layout >
+  void particle( tk::Data< Layout >& X, const tk::Data< Layout >& dW ) {
+    const tk::real theta = 0.7, mu = 1.0, sigma = 0.3, dt = 1.0e-3;
+    const auto x0 = X.cptr( 0, 0 );
+    for (std::size_t c=X.nprop(); c>0; --c) {
+      const auto x = X.cptr( c-1, 0 );
+      const auto w = dW.cptr( c-1, 0 );
+      for (std::size_t p=0; p<X.nunk(); ++p) {
+        auto d = sigma * std::sqrt( X.var(x0,p) );
+        X.var(x,p) += theta*(mu - X.var(x,p))*dt + d*dW.var(w,p);
+      }
+    }
+  }
+
+  //! Particle kernel sweeping over the particles of a block of the blocked
+  //!   layout
+  //! \param[in,out] X Particle properties
+  //! \param[in] dW Increments of the Wiener processes, one for each property
+  void particleBlock( tk::Data< tk::BlkEqCompUnk >& X,
+                      const tk::Data< tk::BlkEqCompUnk >& dW )
+  {
+    const tk::real theta = 0.7, mu = 1.0, sigma = 0.3, dt = 1.0e-3;
+    for (std::size_t b=0; b<X.nblock(); ++b) {
+      tk::real d[ tk::DataBlockWidth ];
+      const auto x0 = X.bptr( b, 0, 0 );
+      for (std::size_t i=0; i<tk::DataBlockWidth; ++i)
+        d[i] = sigma * std::sqrt( x0[i] );
+      for (std::size_t c=0; c<X.nprop(); ++c) {
+        auto x = X.bptr( b, c, 0 );
+        const auto w = dW.bptr( b, c, 0 );
+        for (std::size_t i=0; i<tk::DataBlockWidth; ++i)
+          x[i] += theta*(mu - x[i])*dt + d[i]*w[i];
+      }
+    }
+  }
+
+  //! Compare all values of two Data objects of different layouts
+  //! \param[in] msg Message to output if the objects are not equal
+  //! \param[in] a 1st Data object
+  //! \param[in] b 2nd Data object
+  template< uint8_t L1, uint8_t L2 >
+  void compare( const std::string& msg,
+                const tk::Data< L1 >& a,
+                const tk::Data< L2 >& b )
+  {
+    ensure_equals( msg + ": nunk", a.nunk(), b.nunk() );
+    ensure_equals( msg + ": nprop", a.nprop(), b.nprop() );
+    for (std::size_t u=0; u<a.nunk(); ++u)
+      for (std::size_t c=0; c<a.nprop(); ++c)
+        ensure_equals( msg, a(u,c,0), b(u,c,0), 1.0e-12 );
+  }
+
+  //! Time a kernel
+  //! \param[in] kernel Kernel to time
+  //! \return Number of unknowns updated per second
+  template< class Kernel >
+  tk::real time( Kernel kernel ) {
+    tk::Timer t;
+    for (std::size_t r=0; r<nrep; ++r) kernel();
+    return static_cast< tk::real >( nrep * nunk ) / t.dsec();
+  }
+};
+
+//! Test group shortcuts
+using DataLayout_group = test_group< DataLayout_common, MAX_TESTS_IN_GROUP >;
+using DataLayout_object = DataLayout_group::object;
+
+//! Define test group
+static DataLayout_group DataLayout( "Base/DataLayout" );
+
+//! Test definitions for group
+
+//! Compare DG kernel results and throughput with all data layouts
+template<> template<>
+void DataLayout_object::test< 1 >() {
+  tk::Data< tk::UnkEqComp > Uu( nunk, ncomp*ndof ), Ru( nunk, ncomp*ndof );
+  tk::Data< tk::EqCompUnk > Ue( nunk, ncomp*ndof ), Re( nunk, ncomp*ndof );
+  tk::Data< tk::BlkEqCompUnk > Ub( nunk, ncomp*ndof ), Rb( nunk, ncomp*ndof ),
+                               Rv( nunk, ncomp*ndof );
+  random( Uu );
+  random( Ue );
+  random( Ub );
+  Ru.fill( 0.0 );
+  Re.fill( 0.0 );
+  Rb.fill( 0.0 );
+  Rv.fill( 0.0 );
+
+  auto tu = time( [&](){ dg( Uu, Ru ); } );
+  auto te = time( [&](){ dg( Ue, Re ); } );
+  auto tb = time( [&](){ dg( Ub, Rb ); } );
+  auto tv = time( [&](){ dgBlock( Ub, Rv ); } );
+
+  compare( "DG rhs equation-major vs. unknown-major", Ru, Re );
+  compare( "DG rhs blocked vs. unknown-major", Ru, Rb );
+  compare( "DG rhs blocked (by block) vs. unknown-major", Ru, Rv );
+
+  std::stringstream ss;
+  ss << "DG P1 elements/s: unknown-major " << tu << ", equation-major " << te
+     << ", blocked " << tb << ", blocked by block " << tv;
+  set_test_name( ss.str() );
+}
+
+//! Compare particle kernel results and throughput with all data layouts
+template<> template<>
+void DataLayout_object::test< 2 >() {
+  const std::size_t nprop = 3;
+  tk::Data< tk::UnkEqComp > Xu( nunk, nprop ), Wu( nunk, nprop );
+  tk::Data< tk::EqCompUnk > Xe( nunk, nprop ), We( nunk, nprop );
+  tk::Data< tk::BlkEqCompUnk > Xb( nunk, nprop ), Xv( nunk, nprop ),
+                               Wb( nunk, nprop );
+  random( Xu );  random( Wu );
+  random( Xe );  random( We );
+  random( Xb );  random( Wb );
+  random( Xv );
+
+  auto tu = time( [&](){ particle( Xu, Wu ); } );
+  auto te = time( [&](){ particle( Xe, We ); } );
+  auto tb = time( [&](){ particle( Xb, Wb ); } );
+  auto tv = time( [&](){ particleBlock( Xv, Wb ); } );
+
+  compare( "particles equation-major vs. unknown-major", Xu, Xe );
+  compare( "particles blocked vs. unknown-major", Xu, Xb );
+  compare( "particles blocked (by block) vs. unknown-major", Xu, Xv );
+
+  std::stringstream ss;
+  ss << "OU particles/s: unknown-major " << tu << ", equation-major " << te
+     << ", blocked " << tb << ", blocked by block " << tv;
+  set_test_name( ss.str() );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
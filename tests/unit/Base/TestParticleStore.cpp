@@ -0,0 +1,140 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestParticleStore.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Base/ParticleStore
+  \details   Unit tests for Base/ParticleStore
+*/
+// *****************************************************************************
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "ParticleStore.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct ParticleStore_common {
+  //! Create a particle store with n particles, particle i at (i,2i,3i) in
+  //! element 10+i
+  tk::ParticleStore store( std::size_t n ) const {
+    tk::ParticleStore s;
+    for (std::size_t i=0; i<n; ++i) {
+      auto x = static_cast< tk::real >( i );
+      s.push_back( {{ x, 2.0*x, 3.0*x }}, 10+i );
+    }
+    return s;
+  }
+};
+
+//! Test group shortcuts
+using ParticleStore_group =
+  test_group< ParticleStore_common, MAX_TESTS_IN_GROUP >;
+using ParticleStore_object = ParticleStore_group::object;
+
+//! Define test group
+static ParticleStore_group ParticleStore( "Base/ParticleStore" );
+
+//! Test definitions for group
+
+//! Test that added particles are stored as structure of arrays
+template<> template<>
+void ParticleStore_object::test< 1 >() {
+  set_test_name( "push_back" );
+
+  auto s = store( 5 );
+  ensure_equals( "size incorrect", s.size(), 5UL );
+  ensure_equals( "number of live particles incorrect", s.nlive(), 5UL );
+  for (std::size_t d=0; d<3; ++d)
+    ensure_equals( "coordinate array size incorrect", s.coord()[d].size(),
+                   5UL );
+  for (std::size_t i=0; i<5; ++i) {
+    auto x = static_cast< tk::real >( i );
+    ensure_equals( "x incorrect", s.coord()[0][i], x, 1.0e-15 );
+    ensure_equals( "y incorrect", s.coord()[1][i], 2.0*x, 1.0e-15 );
+    ensure_equals( "z incorrect", s.coord()[2][i], 3.0*x, 1.0e-15 );
+    ensure_equals( "element incorrect", s.elem(i), 10+i );
+  }
+}
+
+//! Test that killing particles keeps the indices of the others
+template<> template<>
+void ParticleStore_object::test< 2 >() {
+  set_test_name( "kill keeps indices" );
+
+  auto s = store( 6 );
+  s.kill( 1 );
+  s.kill( 4 );
+  s.kill( 4 );    // killing a dead particle again has no effect
+
+  ensure_equals( "size incorrect", s.size(), 6UL );
+  ensure_equals( "number of dead particles incorrect", s.ndead(), 2UL );
+  ensure_equals( "number of live particles incorrect", s.nlive(), 4UL );
+  ensure( "killed particle live", !s.live(1) && !s.live(4) );
+  ensure( "particle not killed dead", s.live(0) && s.live(5) );
+  ensure_equals( "element of live particle changed", s.elem(5), 15UL );
+  ensure_equals( "coordinate of live particle changed", s.position(5)[2],
+                 15.0, 1.0e-15 );
+}
+
+//! Test that compaction removes dead particles in a single pass keeping order
+template<> template<>
+void ParticleStore_object::test< 3 >() {
+  set_test_name( "compact" );
+
+  auto s = store( 7 );
+  for (auto i : { 0UL, 2UL, 3UL, 6UL }) s.kill( i );
+  s.compact();
+
+  ensure_equals( "size incorrect", s.size(), 3UL );
+  ensure_equals( "number of dead particles incorrect", s.ndead(), 0UL );
+  const std::vector< std::size_t > kept{ 1, 4, 5 };
+  for (std::size_t i=0; i<kept.size(); ++i) {
+    auto x = static_cast< tk::real >( kept[i] );
+    ensure( "particle dead after compaction", s.live(i) );
+    ensure_equals( "x incorrect", s.coord()[0][i], x, 1.0e-15 );
+    ensure_equals( "y incorrect", s.coord()[1][i], 2.0*x, 1.0e-15 );
+    ensure_equals( "z incorrect", s.coord()[2][i], 3.0*x, 1.0e-15 );
+    ensure_equals( "element incorrect", s.elem(i), 10+kept[i] );
+  }
+}
+
+//! Test that compaction only happens above the fraction of dead particles
+template<> template<>
+void ParticleStore_object::test< 4 >() {
+  set_test_name( "compact above threshold" );
+
+  auto s = store( 8 );
+  s.kill( 3 );
+  s.kill( 7 );
+  ensure( "compacted at threshold", !s.compact( 0.25 ) );
+  ensure_equals( "size changed", s.size(), 8UL );
+  s.kill( 0 );
+  ensure( "not compacted above threshold", s.compact( 0.25 ) );
+  ensure_equals( "size incorrect", s.size(), 5UL );
+  ensure_equals( "number of dead particles incorrect", s.ndead(), 0UL );
+}
+
+//! Test packing coordinates of particles for migration
+template<> template<>
+void ParticleStore_object::test< 5 >() {
+  set_test_name( "pack" );
+
+  auto s = store( 5 );
+  auto p = s.pack( { 4, 1 } );
+  ensure_equals( "packed size incorrect", p.size(), 6UL );
+  const std::vector< tk::real > correct{ 4.0, 8.0, 12.0, 1.0, 2.0, 3.0 };
+  for (std::size_t j=0; j<p.size(); ++j)
+    ensure_equals( "packed coordinate incorrect", p[j], correct[j],
+                   1.0e-15 );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,146 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Base/TestThreadPool.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for tk::ThreadPool
+  \details   Unit tests for tk::ThreadPool
+*/
+// *****************************************************************************
+
+#include <vector>
+#include <atomic>
+#include <numeric>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "ThreadPool.hpp"
+#include "Exception.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct ThreadPool_common {};
+
+//! Test group shortcuts
+using ThreadPool_group = test_group< ThreadPool_common, MAX_TESTS_IN_GROUP >;
+using ThreadPool_object = ThreadPool_group::object;
+
+//! Define test group
+static ThreadPool_group ThreadPool( "Base/ThreadPool" );
+
+//! Test definitions for group
+
+//! Test that a single-thread pool executes the whole range on the caller
+template<> template<>
+void ThreadPool_object::test< 1 >() {
+  set_test_name( "single thread executes whole range" );
+
+  tk::ThreadPool pool;
+  ensure_equals( "pool size", pool.size(), 1UL );
+
+  std::size_t ncall = 0, b = 1, e = 0, tid = 1;
+  pool.parallelFor( 10,
+    [&]( std::size_t first, std::size_t last, std::size_t t ){
+      ++ncall; b = first; e = last; tid = t; } );
+
+  ensure_equals( "number of calls", ncall, 1UL );
+  ensure_equals( "first", b, 0UL );
+  ensure_equals( "last", e, 10UL );
+  ensure_equals( "thread id", tid, 0UL );
+}
+
+//! Test that multiple threads visit every index exactly once
+template<> template<>
+void ThreadPool_object::test< 2 >() {
+  set_test_name( "threads visit every index once" );
+
+  tk::ThreadPool pool( 4 );
+  ensure_equals( "pool size", pool.size(), 4UL );
+
+  for (std::size_t n : { 0UL, 1UL, 3UL, 4UL, 1001UL }) {
+    std::vector< std::size_t > v( n, 0 );
+    for (std::size_t r=0; r<100; ++r)
+      pool.parallelFor( n,
+        [&]( std::size_t first, std::size_t last, std::size_t ){
+          for (auto i=first; i<last; ++i) ++v[i]; } );
+    for (std::size_t i=0; i<n; ++i)
+      ensure_equals( "visits of index " + std::to_string(i) + " of " +
+                     std::to_string(n), v[i], 100UL );
+  }
+}
+
+//! Test that chunks are assigned to distinct threads
+template<> template<>
+void ThreadPool_object::test< 3 >() {
+  set_test_name( "chunks executed by distinct threads" );
+
+  tk::ThreadPool pool( 3 );
+
+  std::vector< std::atomic< std::size_t > > count( pool.size() );
+  for (auto& c : count) c = 0;
+  std::atomic< std::size_t > sum( 0 );
+  pool.parallelFor( 100,
+    [&]( std::size_t first, std::size_t last, std::size_t t ){
+      ++count[t]; sum += last - first; } );
+
+  ensure_equals( "total chunk size", sum.load(), 100UL );
+  for (std::size_t t=0; t<pool.size(); ++t)
+    ensure_equals( "chunks executed by thread " + std::to_string(t),
+                   count[t].load(), 1UL );
+}
+
+//! Test that an exception thrown on a worker is rethrown on the caller
+template<> template<>
+void ThreadPool_object::test< 4 >() {
+  set_test_name( "exception rethrown on caller" );
+
+  tk::ThreadPool pool( 4 );
+
+  try {
+    pool.parallelFor( 4, []( std::size_t, std::size_t, std::size_t t ){
+      if (t == 2) Throw( "worker exception" ); } );
+    fail( "should throw exception" );
+  }
+  catch ( tk::Exception& ) {
+    // exception thrown from worker, test ok
+  }
+
+  // the pool must remain usable after an exception
+  std::atomic< std::size_t > sum( 0 );
+  pool.parallelFor( 100,
+    [&]( std::size_t first, std::size_t last, std::size_t ){
+      sum += last - first; } );
+  ensure_equals( "total chunk size after exception", sum.load(), 100UL );
+}
+
+//! Test resizing the pool
+template<> template<>
+void ThreadPool_object::test< 5 >() {
+  set_test_name( "resize" );
+
+  tk::ThreadPool pool( 2 );
+  pool.resize( 5 );
+  ensure_equals( "pool size after growing", pool.size(), 5UL );
+  pool.resize( 5 );
+  ensure_equals( "pool size after same size", pool.size(), 5UL );
+  pool.resize( 1 );
+  ensure_equals( "pool size after shrinking", pool.size(), 1UL );
+
+  std::vector< std::size_t > v( 50 );
+  pool.resize( 3 );
+  pool.parallelFor( v.size(),
+    [&]( std::size_t first, std::size_t last, std::size_t ){
+      for (auto i=first; i<last; ++i) v[i] = i; } );
+  ensure_equals( "sum after resize",
+                 std::accumulate( begin(v), end(v), 0UL ), 50UL*49UL/2UL );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
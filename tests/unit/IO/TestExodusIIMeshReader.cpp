@@ -1775,6 +1775,85 @@ void ExodusIIMeshReader_object::test< 8 >() {
   ensure( "element connectivity incorrect", inpoel == box24_inpoel );
 }
 
+//! Test reading coordinates of unordered node IDs
+template<> template<>
+void ExodusIIMeshReader_object::test< 9 >() {
+  set_test_name( "read coordinates of unordered node IDs" );
+
+  // Will use this mesh from the regression test suite
+  std::string infile( tk::regression_dir()+"/meshconv/gmsh_output/box_24.exo" );
+  // Create mesh reader
+  tk::ExodusIIMeshReader er( infile );
+
+  // Node IDs unordered, with gaps, and repeated, as well as all node IDs
+  std::vector< std::vector< std::size_t > > gids{
+    { 13, 2, 7, 0, 2, 11, 5 },
+    { 9 },
+    { 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0 } };
+
+  for (const auto& gid : gids) {
+    auto coord = er.readCoords( gid );
+    for (std::size_t d=0; d<3; ++d)
+      ensure_equals( "number of coordinates incorrect", coord[d].size(),
+                     gid.size() );
+    for (std::size_t i=0; i<gid.size(); ++i)
+      for (std::size_t d=0; d<3; ++d)
+        ensure_equals( "node coordinate incorrect", coord[d][i],
+                       box24_coord[ gid[i]*3+d ], 1.0e-15 );
+  }
+
+  auto coord = er.readCoords( {} );
+  ensure( "coordinates of no nodes not empty",
+          coord[0].empty() && coord[1].empty() && coord[2].empty() );
+}
+
+//! Test that readMeshPart keeps the triangles that are faces of the part
+template<> template<>
+void ExodusIIMeshReader_object::test< 10 >() {
+  set_test_name( "parallel readMeshPart keeps triangles of part" );
+
+  // Will use this mesh from the regression test suite
+  std::string infile( tk::regression_dir()+"/meshconv/gmsh_output/box_24.exo" );
+
+  // Read all triangles in file
+  std::vector< std::size_t > alltri;
+  tk::ExodusIIMeshReader fr( infile );
+  fr.readElemBlockIDs();
+  fr.readFaces( alltri );
+  ensure( "no triangles in file", !alltri.empty() );
+  tk::UnsMesh::FaceSet filetri;
+  for (std::size_t t=0; t<alltri.size()/3; ++t)
+    filetri.insert( {{ alltri[t*3+0], alltri[t*3+1], alltri[t*3+2] }} );
+
+  for (int npes=1; npes<4; ++npes) {
+    // Triangles kept by all parts
+    tk::UnsMesh::FaceSet kept;
+    for (int pe=0; pe<npes; ++pe) {
+      tk::ExodusIIMeshReader er( infile );
+      std::vector< std::size_t > ginpoel, inpoel, triinpoel;
+      std::unordered_map< std::size_t, std::size_t > lid;
+      tk::UnsMesh::Coords coord;
+      er.readMeshPart( ginpoel, inpoel, triinpoel, lid, coord, npes, pe );
+      // Faces of the tetrahedra of this part
+      tk::UnsMesh::FaceSet faces;
+      for (std::size_t e=0; e<ginpoel.size()/4; ++e)
+        for (const auto& f : tk::expofa)
+          faces.insert( {{ ginpoel[e*4+f[0]], ginpoel[e*4+f[1]],
+                           ginpoel[e*4+f[2]] }} );
+      for (std::size_t t=0; t<triinpoel.size()/3; ++t) {
+        tk::UnsMesh::Face f{{ triinpoel[t*3+0], triinpoel[t*3+1],
+                              triinpoel[t*3+2] }};
+        ensure( "triangle kept that is not a face of the part",
+                faces.find(f) != end(faces) );
+        kept.insert( f );
+      }
+    }
+    // Each triangle in file is a boundary face of one of the parts
+    ensure_equals( "number of triangles kept by all parts incorrect",
+                   kept.size(), filetri.size() );
+  }
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,469 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Inciter/AMR/TestContainers.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for the flat AMR tet and edge stores
+  \details   Unit tests for the flat containers underlying the AMR tet and edge
+    stores, Inciter/AMR/id_set.h, Inciter/AMR/id_map.h, and
+    Inciter/AMR/edge_table.h, and their use by the mesh adapter. Benchmarks
+    of uniform refinement of a box of about a million tetrahedra, and of the
+    flat containers against the map-based ones, are in a separate group,
+    only run if selected.
+*/
+// *****************************************************************************
+
+#include <vector>
+#include <algorithm>
+#include <sstream>
+#include <map>
+#include <set>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Timer.hpp"
+#include "Reorder.hpp"
+#include "AMR/id_set.hpp"
+#include "AMR/id_map.hpp"
+#include "AMR/edge_table.hpp"
+#include "AMR/mesh_adapter.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct AMRContainers_common {
+  // mesh connectivity for simple tetrahedron-only mesh of a unit cube
+  std::vector< std::size_t > inpoel { 12, 14,  9, 11,
+                                      10, 14, 13, 12,
+                                      14, 13, 12,  9,
+                                      10, 14, 12, 11,
+                                      1,  14,  5, 11,
+                                      7,   6, 10, 12,
+                                      14,  8,  5, 10,
+                                      8,   7, 10, 13,
+                                      7,  13,  3, 12,
+                                      1,   4, 14,  9,
+                                      13,  4,  3,  9,
+                                      3,   2, 12,  9,
+                                      4,   8, 14, 13,
+                                      6,   5, 10, 11,
+                                      1,   2,  9, 11,
+                                      2,   6, 12, 11,
+                                      6,  10, 12, 11,
+                                      2,  12,  9, 11,
+                                      5,  14, 10, 11,
+                                      14,  8, 10, 13,
+                                      13,  3, 12,  9,
+                                      7,  10, 13, 12,
+                                      14,  4, 13,  9,
+                                      14,  1,  9, 11 };
+
+  //! \brief Generate the connectivity of a box of n^3 hexahedra, each split
+  //!   into 6 tetrahedra
+  //! \param[in] n Number of hexahedra in each direction
+  //! \return Element connectivity of 6n^3 tetrahedra
+  //! \details Each hexahedron is split into the 6 tetrahedra along paths
+  //!   from its lowest to its highest corner, which conform across faces.
+  std::vector< std::size_t > box( std::size_t n ) {
+    const std::size_t m = n+1;
+    auto node = [m]( std::size_t i, std::size_t j, std::size_t k )
+                { return (k*m + j)*m + i; };
+    const std::size_t perm[6][3] =
+      { {0,1,2}, {0,2,1}, {1,0,2}, {1,2,0}, {2,0,1}, {2,1,0} };
+    std::vector< std::size_t > tets;
+    tets.reserve( 24*n*n*n );
+    for (std::size_t k=0; k<n; ++k)
+      for (std::size_t j=0; j<n; ++j)
+        for (std::size_t i=0; i<n; ++i)
+          for (const auto& p : perm) {
+            std::size_t c[3] = { i, j, k };
+            tets.push_back( node( c[0], c[1], c[2] ) );
+            for (std::size_t d=0; d<3; ++d) {
+              ++c[ p[d] ];
+              tets.push_back( node( c[0], c[1], c[2] ) );
+            }
+          }
+    return tets;
+  }
+};
+
+//! Test group shortcuts
+using AMRContainers_group =
+  test_group< AMRContainers_common, MAX_TESTS_IN_GROUP >;
+using AMRContainers_object = AMRContainers_group::object;
+
+//! Define test group
+static AMRContainers_group AMRContainers( "Inciter/AMR/containers" );
+
+//! Test definitions for group
+
+//! Test inserting, erasing, and iterating ids of id_set_t
+template<> template<>
+void AMRContainers_object::test< 1 >() {
+  set_test_name( "id_set_t" );
+
+  AMR::id_set_t s;
+  ensure( "new set not empty", s.empty() );
+
+  // Ids spanning several words of the bitset, inserted out of order
+  const std::vector< std::size_t > ids{ 200, 3, 64, 0, 63, 130, 65 };
+  for (auto i : ids) ensure( "id not inserted", s.insert(i) );
+  ensure( "id inserted twice", !s.insert(64) );
+  ensure_equals( "size incorrect", s.size(), ids.size() );
+
+  auto sorted = ids;
+  std::sort( begin(sorted), end(sorted) );
+  ensure( "ids not iterated in ascending order",
+          std::vector< std::size_t >( s.begin(), s.end() ) == sorted );
+
+  ensure_equals( "id not erased", s.erase(63), 1UL );
+  ensure_equals( "id not in set erased", s.erase(63), 0UL );
+  ensure_equals( "id beyond set erased", s.erase(1000), 0UL );
+  ensure_equals( "erased id found", s.count(63), 0UL );
+  ensure_equals( "id found beyond set", s.count(1000), 0UL );
+  ensure_equals( "id not found", s.count(64), 1UL );
+  ensure_equals( "next id incorrect", s.next(4), 64UL );
+  ensure_equals( "next id incorrect", s.next(131), 200UL );
+  ensure( "next id beyond last found", s.next(201) == AMR::id_set_t::npos );
+
+  s.clear();
+  ensure( "cleared set not empty", s.empty() && s.begin() == s.end() );
+}
+
+//! Test inserting, erasing, and iterating values of id_map_t
+template<> template<>
+void AMRContainers_object::test< 2 >() {
+  set_test_name( "id_map_t" );
+
+  AMR::id_map_t< int > m;
+  for (std::size_t i=0; i<10; i+=3)
+    ensure( "value not inserted",
+            m.insert( { i, static_cast<int>(10*i) } ).second );
+  ensure( "value inserted twice", !m.insert( { 3, 1 } ).second );
+  ensure_equals( "value overwritten by insert", m.at(3), 30 );
+  ensure_equals( "size incorrect", m.size(), 4UL );
+
+  m[5] = 50;
+  ensure_equals( "size incorrect after operator[]", m.size(), 5UL );
+  ensure_equals( "erase incorrect", m.erase(6), 1UL );
+  ensure_equals( "erase of id not in map incorrect", m.erase(6), 0UL );
+  ensure( "erased id found", m.find(6) == m.end() );
+  ensure( "id beyond map found", m.find(100) == m.end() );
+  ensure_equals( "found value incorrect", m.find(9)->second, 90 );
+
+  // Iterate in ascending id order, inserting while iterating, as done by the
+  // mesh adapter when refining tets: entries added at larger ids are visited
+  std::vector< std::size_t > visited;
+  for (const auto& kv : m) {
+    visited.push_back( kv.first );
+    if (kv.first == 3) m.insert( { 100, 1000 } );
+  }
+  ensure( "ids not iterated in ascending order",
+          visited == std::vector< std::size_t >{ 0, 3, 5, 9, 100 } );
+}
+
+//! Test inserting, finding, and erasing many edges of edge_table_t
+template<> template<>
+void AMRContainers_object::test< 3 >() {
+  set_test_name( "edge_table_t" );
+
+  using AMR::edge_t;
+  AMR::edge_table_t< std::size_t > t;
+
+  // Edges between consecutive and strided node ids, forcing several rehashes
+  const std::size_t n = 1000;
+  for (std::size_t i=0; i<n; ++i) {
+    ensure( "edge not inserted", t.insert( { edge_t(i+1,i), i } ).second );
+    ensure( "edge not inserted", t.insert( { edge_t(i,i+n), n+i } ).second );
+  }
+  ensure( "edge inserted twice", !t.insert( { edge_t(0,1), 0 } ).second );
+  ensure_equals( "size incorrect", t.size(), 2*n );
+
+  // Keys are node pairs sorted, so the order of the nodes does not matter
+  ensure_equals( "value of edge incorrect", t.at( edge_t(5,6) ), 5UL );
+  ensure_equals( "value of edge incorrect", t.at( edge_t(6,5) ), 5UL );
+
+  // Erase every other edge, then all remaining edges must still be found
+  for (std::size_t i=0; i<n; i+=2) {
+    ensure_equals( "edge not erased", t.erase( edge_t(i,i+1) ), 1UL );
+    ensure_equals( "edge not erased", t.erase( edge_t(i,i+n) ), 1UL );
+  }
+  ensure_equals( "edge not in table erased", t.erase( edge_t(0,1) ), 0UL );
+  ensure_equals( "size incorrect after erase", t.size(), n );
+  for (std::size_t i=0; i<n; ++i) {
+    const std::size_t c = i % 2;
+    ensure_equals( "edge count incorrect", t.count( edge_t(i,i+1) ), c );
+    ensure_equals( "edge count incorrect", t.count( edge_t(i,i+n) ), c );
+    if (c) ensure_equals( "value of edge incorrect after erase",
+                          t.at( edge_t(i,i+n) ), n+i );
+  }
+
+  // Iteration visits each remaining edge exactly once
+  std::size_t sum = 0;
+  for (const auto& e : t) sum += e.second;
+  std::size_t correct = 0;
+  for (std::size_t i=1; i<n; i+=2) correct += i + n+i;
+  ensure_equals( "sum of values over iteration incorrect", sum, correct );
+
+  ++t[ edge_t(1,2) ];
+  ensure_equals( "value via operator[] incorrect", t.at( edge_t(1,2) ), 2UL );
+  t[ edge_t(7,7000) ] = 3;
+  ensure_equals( "size incorrect after operator[]", t.size(), n+1 );
+}
+
+//! Test that tet ids are recycled across repeated uniform refinement and
+//! derefinement, so the tet store does not grow with the number of cycles
+template<> template<>
+void AMRContainers_object::test< 4 >() {
+  set_test_name( "refine-derefine cycles recycle tet ids" );
+
+  tk::shiftToZero( inpoel );
+  const auto ntet = inpoel.size()/4;
+
+  AMR::mesh_adapter_t m( inpoel );
+  auto& ts = m.tet_store;
+
+  // Largest tet id in the tet store
+  auto maxid = [&]() {
+    std::size_t mx = 0;
+    for (const auto& t : ts.tets) mx = std::max( mx, t.first );
+    return mx;
+  };
+
+  for (std::size_t cycle=0; cycle<5; ++cycle) {
+    const auto cyc = " in cycle " + std::to_string(cycle);
+
+    m.mark_uniform_refinement();
+    m.perform_refinement();
+
+    const auto& active = ts.get_active_inpoel();
+    ensure_equals( "number of active tets after refinement incorrect" + cyc,
+                   active.size()/4, 8*ntet );
+    ensure_equals( "number of tets after refinement incorrect" + cyc,
+                   ts.size(), 9*ntet );
+    // Ids of derefined tets are handed out again, so ids stay dense
+    ensure( "tet ids not dense after refinement" + cyc, maxid() < 9*ntet );
+
+    // The active element connectivity follows the tet store's iteration
+    // order and every active tet is a child of its parent
+    std::size_t e = 0;
+    for (const auto& t : ts.tets) {
+      if (!ts.is_active( t.first )) continue;
+      for (std::size_t i=0; i<4; ++i)
+        ensure_equals( "active connectivity of tet " + std::to_string(e) +
+                       " incorrect" + cyc, active[4*e+i], t.second[i] );
+      const auto parent = ts.data( t.first ).parent_id;
+      ensure( "parent of tet " + std::to_string(t.first) + " not an original "
+              "tet" + cyc, parent < ntet );
+      const auto& children = ts.data( parent ).children;
+      auto c = std::find( begin(children), end(children), t.first );
+      ensure( "tet " + std::to_string(t.first) + " not a child of its "
+              "parent" + cyc, c != end(children) );
+      const auto k = static_cast< std::size_t >( c - begin(children) );
+      ensure_equals( "child id of parent incorrect" + cyc,
+                     ts.get_child_id( parent, k ), t.first );
+      ++e;
+    }
+
+    m.mark_uniform_derefinement();
+    m.perform_derefinement();
+    ensure_equals( "number of active tets after derefinement incorrect" + cyc,
+                   ts.get_active_inpoel().size()/4, ntet );
+    ensure_equals( "number of tets after derefinement incorrect" + cyc,
+                   ts.size(), ntet );
+    for (const auto& t : ts.tets)
+      ensure( "tet " + std::to_string(t.first) + " after derefinement is "
+              "not an original tet" + cyc, t.first < ntet );
+    // Nothing keyed by the erased (recycled) ids is left behind
+    ensure( "marked refinements left after derefinement" + cyc,
+            ts.marked_refinements.size() == 0 );
+    ensure( "marked derefinements left after derefinement" + cyc,
+            ts.marked_derefinements.size() == 0 );
+  }
+}
+
+//! Test uniform refinement and derefinement of a box of tetrahedra
+template<> template<>
+void AMRContainers_object::test< 5 >() {
+  set_test_name( "uniform refinement and derefinement of a box" );
+
+  const auto tets = box( 4 );   // 6*4^3 = 384 tets
+  const auto ntet = tets.size()/4;
+
+  AMR::mesh_adapter_t m( tets );
+
+  m.mark_uniform_refinement();
+  m.perform_refinement();
+  ensure_equals( "number of active tets after refinement incorrect",
+                 m.tet_store.get_active_inpoel().size()/4, 8*ntet );
+
+  m.mark_uniform_derefinement();
+  m.perform_derefinement();
+  const auto& active = m.tet_store.get_active_inpoel();
+  ensure_equals( "number of active tets after derefinement incorrect",
+                 active.size()/4, ntet );
+  ensure( "connectivity after derefinement differs from original",
+          std::is_permutation( begin(active), end(active), begin(tets) ) );
+}
+
+//! All tests in group inherited from this base
+struct AMRContainersBenchmark_common : AMRContainers_common {
+
+  //! \brief Replay the container operations of a uniform refinement and a
+  //!   derefinement pass of the AMR tet and edge stores
+  //! \tparam TetMap Map type from tet id to tet
+  //! \tparam IdSet Set type of tet ids
+  //! \tparam EdgeMap Map type from edge to the id of its midpoint
+  //! \param[in] tets Element connectivity of the mesh to refine
+  //! \return Wall-clock time of the replay in seconds
+  //! \details The tets are stored, marked active, and their edges inserted.
+  //!   Refinement then visits every tet in id order, looks up its edges,
+  //!   inserts the 8 children and the half edges, and deactivates the parent.
+  //!   Derefinement erases the children and half edges and reactivates the
+  //!   parents. This is the access pattern of mesh_adapter_t on the tet
+  //!   store, without the refinement logic, so the map- and the flat
+  //!   containers can be compared on the same work.
+  template< class TetMap, class IdSet, class EdgeMap >
+  tk::real replay( const std::vector< std::size_t >& tets ) {
+    using AMR::edge_t;
+    const std::size_t ntet = tets.size()/4;
+    const std::size_t npoin =
+      *std::max_element( begin(tets), end(tets) ) + 1;
+    const std::size_t lpoed[6][2] =
+      { {0,1}, {1,2}, {2,0}, {0,3}, {1,3}, {2,3} };
+
+    tk::Timer t;
+    TetMap tet;
+    IdSet active;
+    EdgeMap edge;
+
+    std::size_t np = npoin;
+    for (std::size_t e=0; e<ntet; ++e) {
+      tet.insert( { e, {{ tets[e*4+0], tets[e*4+1], tets[e*4+2],
+                          tets[e*4+3] }} } );
+      active.insert( e );
+      for (const auto& l : lpoed) {
+        edge_t d( tets[e*4+l[0]], tets[e*4+l[1]] );
+        if (!edge.count( d )) edge[ d ] = np++;
+      }
+    }
+
+    // Refine: visit tets in id order, inserting children while iterating
+    for (const auto& p : tet) {
+      // copy, as inserting invalidates references into the flat store
+      const auto e = p.first;
+      if (e >= ntet) continue;
+      const auto n = p.second;
+      std::size_t mid[6];
+      for (std::size_t i=0; i<6; ++i)
+        mid[i] = edge.at( edge_t( n[lpoed[i][0]], n[lpoed[i][1]] ) );
+      for (std::size_t i=0; i<6; ++i) {
+        edge[ edge_t( n[lpoed[i][0]], mid[i] ) ] = 0;
+        edge[ edge_t( mid[i], n[lpoed[i][1]] ) ] = 0;
+      }
+      for (std::size_t c=0; c<8; ++c) {
+        const auto id = ntet + 8*e + c;
+        tet.insert( { id, {{ n[c%4], mid[c%6], mid[(c+1)%6],
+                             mid[(c+2)%6] }} } );
+        active.insert( id );
+      }
+      active.erase( e );
+    }
+    ensure_equals( "number of tets after refinement incorrect",
+                   tet.size(), 9*ntet );
+
+    // Derefine: erase children and half edges, reactivate parents
+    for (std::size_t e=0; e<ntet; ++e) {
+      const auto n = tet.at( e );
+      for (std::size_t i=0; i<6; ++i) {
+        const auto m = edge.at( edge_t( n[lpoed[i][0]], n[lpoed[i][1]] ) );
+        edge.erase( edge_t( n[lpoed[i][0]], m ) );
+        edge.erase( edge_t( m, n[lpoed[i][1]] ) );
+      }
+      for (std::size_t c=0; c<8; ++c) {
+        tet.erase( ntet + 8*e + c );
+        active.erase( ntet + 8*e + c );
+      }
+      active.insert( e );
+    }
+    const auto time = t.dsec();
+
+    ensure_equals( "number of tets after derefinement incorrect",
+                   tet.size(), ntet );
+    ensure_equals( "number of active tets after derefinement incorrect",
+                   active.size(), ntet );
+    return time;
+  }
+};
+
+//! Test group shortcuts
+using AMRContainersBenchmark_group =
+  test_group< AMRContainersBenchmark_common, MAX_TESTS_IN_GROUP >;
+using AMRContainersBenchmark_object = AMRContainersBenchmark_group::object;
+
+//! Define test group, only run if selected, see unittest::TUTSuite
+static AMRContainersBenchmark_group
+  AMRContainersBenchmark( "Benchmark/Inciter/AMR/containers" );
+
+//! Test definitions for group
+
+//! Benchmark uniform refinement and derefinement of a box of about a million
+//! tetrahedra
+template<> template<>
+void AMRContainersBenchmark_object::test< 1 >() {
+  const std::size_t n = 55;     // 6*55^3 = 998250 tets
+  const auto tets = box( n );
+  const auto ntet = tets.size()/4;
+
+  AMR::mesh_adapter_t m( tets );
+
+  tk::Timer tr;
+  m.mark_uniform_refinement();
+  m.perform_refinement();
+  const auto ref = tr.dsec();
+  ensure_equals( "number of active tets after refinement incorrect",
+                 m.tet_store.get_active_inpoel().size()/4, 8*ntet );
+
+  tk::Timer td;
+  m.mark_uniform_derefinement();
+  m.perform_derefinement();
+  const auto deref = td.dsec();
+  ensure_equals( "number of active tets after derefinement incorrect",
+                 m.tet_store.get_active_inpoel().size()/4, ntet );
+
+  std::stringstream ss;
+  ss << "uniform AMR of " << ntet << " tets, passes/s (tets/s): refine "
+     << 1.0/ref << " (" << static_cast< tk::real >( ntet )/ref
+     << "), derefine " << 1.0/deref << " ("
+     << static_cast< tk::real >( ntet )/deref << ')';
+  set_test_name( ss.str() );
+}
+
+//! Benchmark the flat tet and edge stores against the map-based ones
+template<> template<>
+void AMRContainersBenchmark_object::test< 2 >() {
+  const auto tets = box( 55 );
+  const auto ntet = tets.size()/4;
+
+  auto map = replay< std::map< std::size_t, AMR::tet_t >,
+                     std::set< std::size_t >,
+                     std::map< AMR::edge_t, std::size_t > >( tets );
+  auto flat = replay< AMR::id_map_t< AMR::tet_t >,
+                      AMR::id_set_t,
+                      AMR::edge_table_t< std::size_t > >( tets );
+
+  std::stringstream ss;
+  ss << "tet/edge stores replaying uniform AMR of " << ntet
+     << " tets, passes/s: map " << 1.0/map << ", flat " << 1.0/flat
+     << ", speedup " << map/flat;
+  set_test_name( ss.str() );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
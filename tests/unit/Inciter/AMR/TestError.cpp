@@ -63,6 +63,7 @@
 */
 // *****************************************************************************
 
+#include <cmath>
 #include <limits>
 
 #include "NoWarning/tut.hpp"
@@ -72,6 +73,7 @@
 #include "Fields.hpp"
 #include "Reorder.hpp"
 #include "DerivedData.hpp"
+#include "Gradients.hpp"
 #include "AMR/Error.hpp"
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -236,6 +238,43 @@ void AMRError_object::test< 2 >() {
   TestErrorIndicator( inciter::ctr::AMRErrorType::HESSIAN );
 }
 
+//! Test Hessian error indicator using precomputed node gradients
+template<> template<>
+void AMRError_object::test< 3 >() {
+  set_test_name( "Hessian indicator with node gradients" );
+
+  // Shift node IDs to start from zero
+  tk::shiftToZero( inpoel );
+
+  auto npoin = tk::npoin_in_graph( inpoel );
+  auto esup = tk::genEsup( inpoel, 4 );
+  auto inpoed = tk::genInpoed( inpoel, 4, esup );
+
+  // generate a field with quadratic and nonlinear components
+  tk::Fields u( npoin, 2 );
+  for (std::size_t p=0; p<npoin; ++p) {
+    const auto x = coord[0][p], y = coord[1][p], z = coord[2][p];
+    u(p,0,0) = z*z + x*y;
+    u(p,1,0) = std::sin(3.0*x) * std::exp(y) - z;
+  }
+
+  // compute gradients of both components at all nodes at once, in reverse
+  const std::vector< std::size_t > comp{ 1, 0 };
+  auto grad = tk::nodegrads( coord, inpoel, u, comp );
+
+  const auto hessian = inciter::ctr::AMRErrorType::HESSIAN;
+  AMR::Error err;
+  for (std::size_t e=0; e<inpoed.size()/2; ++e) {
+    AMR::edge_t edge{ inpoed[e*2], inpoed[e*2+1] };
+    for (std::size_t g=0; g<comp.size(); ++g) {
+      auto r = err.scalar( u, edge, comp[g], coord, inpoel, esup, hessian );
+      auto rg = err.scalar( u, edge, comp[g], coord, grad, g, hessian );
+      ensure_equals( "edge error using node gradients incorrect", rg, r,
+                     1.0e-12 );
+    }
+  }
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
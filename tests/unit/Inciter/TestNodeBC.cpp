@@ -0,0 +1,250 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Inciter/TestNodeBC.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Inciter/NodeBC
+  \details   Unit tests for Inciter/NodeBC. The Dirichlet boundary conditions
+    matched to nodes once, by DirichletBC, and evaluated by
+    DirichletBC::update(), are compared to those matched every time step by
+    match(), using a test PDE system on a small mesh with side sets.
+*/
+// *****************************************************************************
+
+#include <map>
+#include <array>
+#include <string>
+#include <vector>
+#include <limits>
+#include <algorithm>
+#include <unordered_set>
+#include <unordered_map>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Types.hpp"
+#include "Fields.hpp"
+#include "CGPDE.hpp"
+#include "Inciter/NodeBC.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace inciter {
+
+extern std::vector< CGPDE > g_cgpde;
+
+} // inciter::
+
+namespace tut {
+
+//! \brief PDE system of two scalar components with Dirichlet BCs prescribed
+//!   on side sets 1 (component 0) and 2 (both components)
+//! \details Only those member functions are implemented that match() and
+//!   DirichletBC query. The increments only depend on the node coordinates
+//!   and time, as for the PDEs in PDE/, so are the same whichever side set a
+//!   node is matched from.
+struct NodeBCPDE {
+  using Coord = std::array< std::vector< tk::real >, 3 >;
+  using NodeBC = std::vector< std::pair< bool, tk::real > >;
+
+  static const std::size_t ncomp = 2;
+
+  //! Solution increment of component c at a point from t to t+deltat
+  static tk::real inc( std::size_t c, tk::real x, tk::real y, tk::real z,
+                       tk::real t, tk::real deltat )
+  {
+    auto s = [&]( tk::real tt ){ return (c+1.0)*(x + 2.0*y + 3.0*z)*tt*tt; };
+    return s( t+deltat ) - s( t );
+  }
+
+  void initialize( const Coord&, tk::Fields&, tk::real ) const {}
+  void lhs( const Coord&,
+            const std::vector< std::size_t >&,
+            const std::pair< std::vector< std::size_t >,
+                             std::vector< std::size_t > >&,
+            tk::Fields&, tk::Fields& ) const {}
+  void rhs( tk::real, tk::real, const Coord&,
+            const std::vector< std::size_t >&,
+            const tk::Fields&, tk::Fields&, tk::Fields& ) const {}
+  void rhs( tk::real, const Coord&, const std::vector< std::size_t >&,
+            const std::vector< tk::real >&, const std::vector< tk::real >&,
+            const tk::Fields&, tk::Fields& ) const {}
+  tk::real dt( const Coord&, const std::vector< std::size_t >&,
+               const tk::Fields& ) const { return 0.0; }
+  void side( std::unordered_set< int >& conf ) const { conf.insert( {1,2} ); }
+
+  std::map< std::size_t, NodeBC >
+  dirbc( tk::real t,
+         tk::real deltat,
+         const std::pair< const int, std::vector< std::size_t > >& ss,
+         const Coord& coord ) const
+  {
+    std::map< std::size_t, NodeBC > bc;
+    if (ss.first != 1 && ss.first != 2) return bc;
+    for (auto n : ss.second) {
+      auto& nbc = bc[n] = NodeBC( ncomp, { false, 0.0 } );
+      for (std::size_t c=0; c<ncomp; ++c)
+        if (c == 0 || ss.first == 2)
+          nbc[c] = { true, inc( c, coord[0][n], coord[1][n], coord[2][n],
+                                t, deltat ) };
+    }
+    return bc;
+  }
+
+  void solinc( tk::real t,
+               tk::real deltat,
+               const std::vector< std::size_t >& nodes,
+               const Coord& coord,
+               tk::Fields& u ) const
+  {
+    for (std::size_t i=0; i<nodes.size(); ++i) {
+      auto n = nodes[i];
+      for (std::size_t c=0; c<ncomp; ++c)
+        u(i,c,0) = inc( c, coord[0][n], coord[1][n], coord[2][n], t, deltat );
+    }
+  }
+
+  std::vector< std::string > fieldNames() const { return {}; }
+  std::vector< std::string > names() const { return {}; }
+  std::vector< std::vector< tk::real > >
+  fieldOutput( tk::real, tk::real, const Coord&,
+               const std::vector< tk::real >&, tk::Fields& ) const
+  { return {}; }
+  std::vector< tk::real >
+  analyticSolution( tk::real, tk::real, tk::real, tk::real ) const
+  { return {}; }
+};
+
+//! All tests in group inherited from this base
+struct NodeBC_common {
+
+  //! Register the test PDE system as the only one integrated
+  NodeBC_common() { inciter::g_cgpde = { inciter::CGPDE( NodeBCPDE() ) }; }
+  //! Leave no PDE systems behind for other tests
+  ~NodeBC_common() { inciter::g_cgpde.clear(); }
+
+  //! \brief Coordinates of the 5 nodes of two tetrahedra sharing the face
+  //!   of local nodes 0, 1, 2
+  const tk::UnsMesh::Coords coord {{ {{ 0.0, 1.0, 0.0, 0.0, 0.4 }},
+                                     {{ 0.0, 0.0, 1.0, 0.0, 0.3 }},
+                                     {{ 0.0, 0.0, 0.0, 1.0, -0.8 }} }};
+  //! Global node IDs of local nodes
+  const std::vector< std::size_t > gid {{ 10, 3, 7, 0, 5 }};
+  //! Local node IDs of global nodes
+  const std::unordered_map< std::size_t, std::size_t > lid {
+    {10,0}, {3,1}, {7,2}, {0,3}, {5,4} };
+  //! \brief Global node IDs of side sets, node 7 is shared by side sets 1 and
+  //!   2, and the test PDE sets no BCs on side set 4
+  const std::map< int, std::vector< std::size_t > > sidenodes {
+    { 1, {{ 10, 3, 7 }} }, { 2, {{ 7, 0 }} }, { 4, {{ 3, 5 }} } };
+
+  //! \brief Compare DirichletBC to the BCs matched by match() at t, dt
+  //! \param[in] bc Dirichlet BCs matched to nodes and evaluated at t, dt
+  //! \param[in] t Physical time
+  //! \param[in] dt Time step size
+  void compare( const inciter::DirichletBC& bc, tk::real t, tk::real dt ) {
+    const auto ncomp = NodeBCPDE::ncomp;
+    const auto npoin = coord[0].size();
+    const auto old = inciter::match( ncomp, t, dt, coord, gid, lid,
+                                     sidenodes );
+
+    ensure_equals( "number of components", bc.ncomp(), ncomp );
+    ensure_equals( "mask size", bc.Mask().size(), npoin*ncomp );
+
+    for (std::size_t c=0; c<ncomp; ++c) {
+      // nodes and values at which match() sets a BC for c, by local node id
+      std::vector< std::size_t > l;
+      std::vector< tk::real > v;
+      for (std::size_t p=0; p<npoin; ++p) {
+        auto it = old.find( gid[p] );
+        auto set = it != end(old) && it->second[c].first;
+        if (set) {
+          l.push_back( p );
+          v.push_back( it->second[c].second );
+        }
+        ensure_equals( "mask of node " + std::to_string(p) + ", component " +
+                       std::to_string(c), bc.Mask()[ p*ncomp+c ],
+                       static_cast< char >( set ? 1 : 0 ) );
+      }
+      ensure( "node ids of component " + std::to_string(c), bc.Lid(c) == l );
+      ensure_equals( "number of values of component " + std::to_string(c),
+                     bc.Inc(c).size(), v.size() );
+      for (std::size_t i=0; i<v.size(); ++i)
+        ensure_equals( "value of component " + std::to_string(c) + " at " +
+                       std::to_string(l[i]), bc.Inc(c)[i], v[i], prec );
+    }
+  }
+
+  const tk::real prec = std::numeric_limits< tk::real >::epsilon();
+};
+
+//! Test group shortcuts
+using NodeBC_group = test_group< NodeBC_common, MAX_TESTS_IN_GROUP >;
+using NodeBC_object = NodeBC_group::object;
+
+//! Define test group
+static NodeBC_group NodeBC( "Inciter/NodeBC" );
+
+//! Test definitions for group
+
+//! Test if DirichletBC matches BCs to the same nodes as match()
+template<> template<>
+void NodeBC_object::test< 1 >() {
+  set_test_name( "DirichletBC nodes and mask" );
+
+  inciter::DirichletBC bc( NodeBCPDE::ncomp, coord, gid, lid, sidenodes );
+
+  // nodes in increasing local id order: side set 1 sets component 0 on global
+  // nodes 10, 3, 7 and side set 2 sets both components on global nodes 7, 0
+  ensure( "node ids of component 0",
+          bc.Lid(0) == std::vector< std::size_t >{{ 0, 1, 2, 3 }} );
+  ensure( "node ids of component 1",
+          bc.Lid(1) == std::vector< std::size_t >{{ 2, 3 }} );
+  ensure_equals( "number of nodes masked",
+    std::count( begin(bc.Mask()), end(bc.Mask()), 1 ), 6 );
+
+  bc.update( 0.5, 0.1, coord );
+  compare( bc, 0.5, 0.1 );
+}
+
+//! Test if DirichletBC::update() evaluates the same values as match()
+template<> template<>
+void NodeBC_object::test< 2 >() {
+  set_test_name( "DirichletBC values over time steps" );
+
+  inciter::DirichletBC bc( NodeBCPDE::ncomp, coord, gid, lid, sidenodes );
+
+  tk::real t = 0.0, dt = 0.125;
+  for (std::size_t it=0; it<4; ++it) {
+    bc.update( t, dt, coord );
+    compare( bc, t, dt );
+    t += dt;
+    dt *= 1.5;
+  }
+}
+
+//! Test DirichletBC without side sets
+template<> template<>
+void NodeBC_object::test< 3 >() {
+  set_test_name( "DirichletBC without side sets" );
+
+  inciter::DirichletBC bc( NodeBCPDE::ncomp, coord, gid, lid, {} );
+  bc.update( 1.0, 0.1, coord );
+
+  const std::size_t ncomp = NodeBCPDE::ncomp;
+  ensure_equals( "number of components", bc.ncomp(), ncomp );
+  for (std::size_t c=0; c<bc.ncomp(); ++c) {
+    ensure( "node ids of component " + std::to_string(c), bc.Lid(c).empty() );
+    ensure( "values of component " + std::to_string(c), bc.Inc(c).empty() );
+  }
+  ensure( "no node masked",
+    std::all_of( begin(bc.Mask()), end(bc.Mask()),
+                 []( char m ){ return m == 0; } ) );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -113,11 +113,16 @@
 */
 // *****************************************************************************
 
+#include <cmath>
+#include <numeric>
+#include <unordered_map>
+
 #include "NoWarning/tut.hpp"
 
 #include "TUTConfig.hpp"
 #include "DerivedData.hpp"
 #include "Reorder.hpp"
+#include "Vector.hpp"
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
 
@@ -3379,6 +3384,425 @@ void DerivedData_object::test< 75 >() {
   #endif
 }
 
+//! Generate and test dual-face normals of edges for a single tetrahedron
+template<> template<>
+void DerivedData_object::test< 76 >() {
+  set_test_name( "Dual-face normals (genDfnorm) for a tetrahedron" );
+
+  // coordinates of tetrahedron vertices
+  tk::UnsMesh::Coords coord {{ {0.0, 1.0, 0.0, 0.0},
+                               {0.0, 0.0, 1.0, 0.0},
+                               {0.0, 0.0, 0.0, 1.0} }};
+
+  // element-node connectivity
+  std::vector< std::size_t > inpoel { 0, 1, 2, 3 };
+
+  auto inpoed = tk::genInpoed( inpoel, 4, tk::genEsup( inpoel, 4 ) );
+  auto dfn = tk::genDfnorm( inpoel, coord, inpoed );
+
+  ensure( "number of edges", inpoed.size()/2 == 6 );
+  ensure( "size of dual-face normals", dfn.size() == 6*6 );
+
+  // correct dual-face normal (d) and boundary coefficient (s) of edge (0,1)
+  std::array< tk::real, 6 > correct{{ 2.0/48.0, 1.0/48.0, 1.0/48.0,
+                                      0.0, -1.0/48.0, -1.0/48.0 }};
+
+  tk::real prec = std::numeric_limits< tk::real >::epsilon();
+
+  ensure( "first edge", inpoed[0] == 0 && inpoed[1] == 1 );
+  for (std::size_t i=0; i<6; ++i)
+    ensure_equals( "incorrect entry " + std::to_string(i) + " in dfn",
+                   dfn[i], correct[i], prec );
+}
+
+//! \brief Test if the edge-based Galerkin derivative computed using the
+//!   dual-face normals is exact for a linear function
+//! \details The Galerkin integral of the divergence of the linear flux F = x
+//!   e_x tested with the shapefunction of node p must equal the volume
+//!   associated to node p, i.e., a quarter of the volumes of the elements
+//!   surrounding p.
+template<> template<>
+void DerivedData_object::test< 77 >() {
+  set_test_name( "Dual-face normals (genDfnorm) exact for linear flux" );
+
+  // Mesh connectivity for simple tetrahedron-only mesh
+  std::vector< std::size_t > inpoel { 12, 14,  9, 11,
+                                      10, 14, 13, 12,
+                                      14, 13, 12,  9,
+                                      10, 14, 12, 11,
+                                      1,  14,  5, 11,
+                                      7,   6, 10, 12,
+                                      14,  8,  5, 10,
+                                      8,   7, 10, 13,
+                                      7,  13,  3, 12,
+                                      1,   4, 14,  9,
+                                      13,  4,  3,  9,
+                                      3,   2, 12,  9,
+                                      4,   8, 14, 13,
+                                      6,   5, 10, 11,
+                                      1,   2,  9, 11,
+                                      2,   6, 12, 11,
+                                      6,  10, 12, 11,
+                                      2,  12,  9, 11,
+                                      5,  14, 10, 11,
+                                      14,  8, 10, 13,
+                                      13,  3, 12,  9,
+                                      7,  10, 13, 12,
+                                      14,  4, 13,  9,
+                                      14,  1,  9, 11 };
+
+  // Shift node IDs to start from zero
+  tk::shiftToZero( inpoel );
+
+  // Mesh node coordinates
+  tk::UnsMesh::Coords coord {{
+    {{ 0, 1, 1, 0, 0, 1, 1, 0, 0.5, 0.5, 0.5, 1,   0.5, 0 }},
+    {{ 0, 0, 1, 1, 0, 0, 1, 1, 0.5, 0.5, 0,   0.5, 1,   0.5 }},
+    {{ 0, 0, 0, 0, 1, 1, 1, 1, 0,   1,   0.5, 0.5, 0.5, 0.5 }} }};
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  auto inpoed = tk::genInpoed( inpoel, 4, tk::genEsup( inpoel, 4 ) );
+  auto dfn = tk::genDfnorm( inpoel, coord, inpoed );
+
+  // compute nodal volumes
+  std::vector< tk::real > vol( x.size(), 0.0 );
+  for (std::size_t e=0; e<inpoel.size()/4; ++e) {
+    const std::array< std::size_t, 4 > N{{ inpoel[e*4+0], inpoel[e*4+1],
+                                           inpoel[e*4+2], inpoel[e*4+3] }};
+    const std::array< tk::real, 3 >
+      ba{{ x[N[1]]-x[N[0]], y[N[1]]-y[N[0]], z[N[1]]-z[N[0]] }},
+      ca{{ x[N[2]]-x[N[0]], y[N[2]]-y[N[0]], z[N[2]]-z[N[0]] }},
+      da{{ x[N[3]]-x[N[0]], y[N[3]]-y[N[0]], z[N[3]]-z[N[0]] }};
+    auto J = tk::triple( ba, ca, da );
+    for (auto p : N) vol[p] += J/24.0;
+  }
+
+  // assemble Galerkin integral of the divergence of F = x e_x over edges
+  std::vector< tk::real > R( x.size(), 0.0 );
+  for (std::size_t e=0; e<inpoed.size()/2; ++e) {
+    auto p = inpoed[e*2];
+    auto q = inpoed[e*2+1];
+    auto dF = x[q] - x[p];
+    R[p] += dF * (dfn[e*6+0] + dfn[e*6+3]);
+    R[q] -= dF * (dfn[e*6+3] - dfn[e*6+0]);
+  }
+
+  tk::real prec = 1.0e2 * std::numeric_limits< tk::real >::epsilon();
+
+  for (std::size_t p=0; p<x.size(); ++p)
+    ensure_equals( "incorrect derivative at node " + std::to_string(p),
+                   R[p], vol[p], prec );
+}
+
+//! \brief Test if completing the dual-face normals on partition boundaries
+//!   (bndDfnorm, addDfnorm) yields the serial right hand side
+//! \details The mesh is split into 3 partitions, the partial dual-face normals
+//!   of the edges shared among partitions are exchanged, and each edge is
+//!   assigned to the lowest partition id having the edge, as done by
+//!   inciter::ALECG. The nonlinear Rusanov-type dissipation assembled over the
+//!   owned edges of all partitions must then equal that assembled on the whole
+//!   mesh, independent of the partitioning.
+template<> template<>
+void DerivedData_object::test< 78 >() {
+  set_test_name( "Dual-face normals on partition boundaries (add,bndDfnorm)" );
+
+  // Mesh connectivity for simple tetrahedron-only mesh
+  std::vector< std::size_t > ginpoel { 12, 14,  9, 11,
+                                       10, 14, 13, 12,
+                                       14, 13, 12,  9,
+                                       10, 14, 12, 11,
+                                       1,  14,  5, 11,
+                                       7,   6, 10, 12,
+                                       14,  8,  5, 10,
+                                       8,   7, 10, 13,
+                                       7,  13,  3, 12,
+                                       1,   4, 14,  9,
+                                       13,  4,  3,  9,
+                                       3,   2, 12,  9,
+                                       4,   8, 14, 13,
+                                       6,   5, 10, 11,
+                                       1,   2,  9, 11,
+                                       2,   6, 12, 11,
+                                       6,  10, 12, 11,
+                                       2,  12,  9, 11,
+                                       5,  14, 10, 11,
+                                       14,  8, 10, 13,
+                                       13,  3, 12,  9,
+                                       7,  10, 13, 12,
+                                       14,  4, 13,  9,
+                                       14,  1,  9, 11 };
+
+  // Shift node IDs to start from zero
+  tk::shiftToZero( ginpoel );
+
+  // Mesh node coordinates
+  tk::UnsMesh::Coords gcoord {{
+    {{ 0, 1, 1, 0, 0, 1, 1, 0, 0.5, 0.5, 0.5, 1,   0.5, 0 }},
+    {{ 0, 0, 1, 1, 0, 0, 1, 1, 0.5, 0.5, 0,   0.5, 1,   0.5 }},
+    {{ 0, 0, 0, 0, 1, 1, 1, 1, 0,   1,   0.5, 0.5, 0.5, 0.5 }} }};
+  const auto npoin = gcoord[0].size();
+
+  // nonlinear scalar field at (global) mesh nodes
+  std::vector< tk::real > u( npoin );
+  for (std::size_t p=0; p<npoin; ++p)
+    u[p] = 1.0 + gcoord[0][p]*gcoord[0][p] - gcoord[1][p] + 2.0*gcoord[2][p];
+
+  // assemble rhs with Rusanov-type dissipation over edges given by global ids
+  auto assemble = [&]( const std::vector< std::size_t >& inpoed,
+                       const std::vector< tk::real >& dfn,
+                       const std::vector< std::size_t >& gid,
+                       std::vector< tk::real >& R )
+  {
+    for (std::size_t e=0; e<inpoed.size()/2; ++e) {
+      auto p = gid[ inpoed[e*2] ];
+      auto q = gid[ inpoed[e*2+1] ];
+      const auto f = dfn.data() + e*6;
+      auto n = std::sqrt( f[0]*f[0] + f[1]*f[1] + f[2]*f[2] );
+      auto dF = u[q] - u[p];
+      R[p] -= dF * (f[0] + f[3]);
+      R[q] += dF * (f[3] - f[0]);
+      auto d = 0.5 * std::max( std::abs(u[p]), std::abs(u[q]) ) * n * dF;
+      R[p] += d;
+      R[q] -= d;
+    }
+  };
+
+  // serial: local ids equal global ids
+  auto inpoed = tk::genInpoed( ginpoel, 4, tk::genEsup( ginpoel, 4 ) );
+  auto dfn = tk::genDfnorm( ginpoel, gcoord, inpoed );
+  std::vector< std::size_t > sgid( npoin );
+  std::iota( begin(sgid), end(sgid), 0 );
+  std::vector< tk::real > Rs( npoin, 0.0 );
+  assemble( inpoed, dfn, sgid, Rs );
+
+  // partitions: 8 consecutive elements each
+  const std::size_t npart = 3;
+  std::vector< std::vector< std::size_t > > inpoel( npart ), gid( npart ),
+    ped( npart );
+  std::vector< std::unordered_map< std::size_t, std::size_t > > lid( npart );
+  std::vector< std::vector< tk::real > > pdfn( npart ), pdfnc( npart );
+  std::vector< std::vector< std::size_t > > owner( npart );
+  for (std::size_t c=0; c<npart; ++c) {
+    std::vector< std::size_t > g( begin(ginpoel)+c*32,
+                                  begin(ginpoel)+(c+1)*32 );
+    auto l = tk::global2local( g );
+    inpoel[c] = std::get< 0 >( l );
+    gid[c] = std::get< 1 >( l );
+    // renumber local ids of the middle partition in reverse, so that the
+    // orientation of some edges differs among partitions
+    if (c == 1) {
+      auto n = gid[c].size();
+      for (auto& p : inpoel[c]) p = n-1-p;
+      std::reverse( begin(gid[c]), end(gid[c]) );
+    }
+    for (std::size_t p=0; p<gid[c].size(); ++p) lid[c][ gid[c][p] ] = p;
+    tk::UnsMesh::Coords coord;
+    for (std::size_t j=0; j<3; ++j)
+      for (auto p : gid[c]) coord[j].push_back( gcoord[j][p] );
+    ped[c] = tk::genInpoed( inpoel[c], 4, tk::genEsup( inpoel[c], 4 ) );
+    pdfn[c] = tk::genDfnorm( inpoel[c], coord, ped[c] );
+    pdfnc[c].assign( pdfn[c].size(), 0.0 );
+    owner[c].assign( ped[c].size()/2, c );
+  }
+
+  // exchange partial dual-face normals of edges among partitions
+  for (std::size_t a=0; a<npart; ++a)
+    for (std::size_t b=0; b<npart; ++b) {
+      if (a == b) continue;
+      std::vector< std::size_t > nodes;       // local ids in a shared with b
+      for (std::size_t p=0; p<gid[a].size(); ++p)
+        if (lid[b].count( gid[a][p] )) nodes.push_back( p );
+      auto bnd = tk::bndDfnorm( ped[a], pdfn[a], gid[a], nodes );
+      for (auto e : tk::addDfnorm( ped[b], lid[b], bnd.first, bnd.second,
+                                   pdfnc[b] ))
+        owner[b][e] = std::min( owner[b][e], a );
+    }
+
+  // collect owned edges with complete dual-face normals and assemble rhs
+  std::vector< tk::real > Rp( npoin, 0.0 );
+  std::vector< std::size_t > nown( inpoed.size()/2, 0 );
+  tk::real prec = 1.0e2 * std::numeric_limits< tk::real >::epsilon();
+  for (std::size_t c=0; c<npart; ++c) {
+    std::vector< std::size_t > oed;
+    std::vector< tk::real > odfn;
+    for (std::size_t e=0; e<ped[c].size()/2; ++e) {
+      if (owner[c][e] != c) continue;
+      oed.push_back( ped[c][e*2+0] );
+      oed.push_back( ped[c][e*2+1] );
+      for (std::size_t j=0; j<6; ++j)
+        odfn.push_back( pdfn[c][e*6+j] + pdfnc[c][e*6+j] );
+      // find serial edge and compare complete dual-face normals
+      auto p = gid[c][ ped[c][e*2] ], q = gid[c][ ped[c][e*2+1] ];
+      tk::real sign = p < q ? 1.0 : -1.0;
+      if (p > q) std::swap( p, q );
+      std::size_t s = 0;
+      while (inpoed[s*2] != p || inpoed[s*2+1] != q) ++s;
+      ++nown[s];
+      for (std::size_t j=0; j<6; ++j)
+        ensure_equals( "incorrect dfn of edge " + std::to_string(s),
+                       odfn[odfn.size()-6+j], (j<3 ? sign : 1.0)*dfn[s*6+j],
+                       prec );
+    }
+    assemble( oed, odfn, gid[c], Rp );
+  }
+
+  for (std::size_t e=0; e<nown.size(); ++e)
+    ensure_equals( "edge " + std::to_string(e) + " not owned exactly once",
+                   nown[e], static_cast< std::size_t >( 1 ) );
+
+  for (std::size_t p=0; p<npoin; ++p)
+    ensure_equals( "incorrect partitioned rhs at node " + std::to_string(p),
+                   Rp[p], Rs[p], prec );
+}
+
+//! Mesh connectivity of the simple tetrahedron-only mesh used below for
+//! testing cached element Jacobians, with node ids starting from zero
+static const std::vector< std::size_t > jac_inpoel {
+  11, 13,  8, 10,   9, 13, 12, 11,  13, 12, 11,  8,   9, 13, 11, 10,
+   0, 13,  4, 10,   6,  5,  9, 11,  13,  7,  4,  9,   7,  6,  9, 12,
+   6, 12,  2, 11,   0,  3, 13,  8,  12,  3,  2,  8,   2,  1, 11,  8,
+   3,  7, 13, 12,   5,  4,  9, 10,   0,  1,  8, 10,   1,  5, 11, 10,
+   5,  9, 11, 10,   1, 11,  8, 10,   4, 13,  9, 10,  13,  7,  9, 12,
+  12,  2, 11,  8,   6,  9, 12, 11,  13,  3, 12,  8,  13,  0,  8, 10 };
+
+//! Node coordinates of the mesh above, with interior nodes perturbed so that
+//! the element Jacobians differ from each other
+static tk::UnsMesh::Coords
+jacCoord() {
+  tk::UnsMesh::Coords coord {{
+    {{ 0, 1, 1, 0, 0, 1, 1, 0, 0.5, 0.5, 0.5, 1,   0.5, 0 }},
+    {{ 0, 0, 1, 1, 0, 0, 1, 1, 0.5, 0.5, 0,   0.5, 1,   0.5 }},
+    {{ 0, 0, 0, 0, 1, 1, 1, 1, 0,   1,   0.5, 0.5, 0.5, 0.5 }} }};
+  for (std::size_t p=8; p<coord[0].size(); ++p)
+    for (std::size_t j=0; j<3; ++j)
+      coord[j][p] += 0.05 * std::sin( static_cast< tk::real >( 3*p+j ) );
+  return coord;
+}
+
+//! Test cached element Jacobians against direct recomputation
+template<> template<>
+void DerivedData_object::test< 79 >() {
+  set_test_name( "Element Jacobians (genJacElemTet) vs. recomputation" );
+
+  const auto coord = jacCoord();
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  auto jacElem = tk::genJacElemTet( jac_inpoel, coord );
+
+  ensure_equals( "number of elements in jacElem incorrect",
+                 jacElem.nunk(), jac_inpoel.size()/4 );
+
+  tk::real prec = 1.0e-14;
+
+  for (std::size_t e=0; e<jac_inpoel.size()/4; ++e) {
+    const auto A = jac_inpoel[4*e+0];
+    const auto B = jac_inpoel[4*e+1];
+    const auto C = jac_inpoel[4*e+2];
+    const auto D = jac_inpoel[4*e+3];
+    std::array< std::array< tk::real, 3 >, 4 > v{{ {{ x[A], y[A], z[A] }},
+                                                  {{ x[B], y[B], z[B] }},
+                                                  {{ x[C], y[C], z[C] }},
+                                                  {{ x[D], y[D], z[D] }} }};
+    const auto el = " of element " + std::to_string(e);
+
+    ensure_equals( "incorrect Jacobian determinant" + el, jacElem(e,0,0),
+                   tk::Jacobian( v[0], v[1], v[2], v[3] ), prec );
+
+    const auto jacInv = tk::inverseJacobian( v[0], v[1], v[2], v[3] );
+    const auto cached = tk::jacInvElem( jacElem, e );
+    for (std::size_t i=0; i<3; ++i)
+      for (std::size_t j=0; j<3; ++j)
+        ensure_equals( "incorrect inverse Jacobian entry " +
+                       std::to_string(i) + std::to_string(j) + el,
+                       cached[i][j], jacInv[i][j], prec );
+
+    for (std::size_t i=0; i<3; ++i) {
+      ensure_equals( "incorrect first node coordinate " + std::to_string(i) +
+                     el, jacElem(e,10+i,0), v[0][i], prec );
+      for (std::size_t j=0; j<3; ++j) {
+        ensure_equals( "incorrect Jacobian entry " + std::to_string(i) +
+                       std::to_string(j) + el, jacElem(e,13+3*i+j,0),
+                       v[j+1][i] - v[0][i], prec );
+        // the cached Jacobian and its inverse must multiply to identity
+        tk::real I = 0.0;
+        for (std::size_t k=0; k<3; ++k)
+          I += jacElem(e,13+3*i+k,0) * cached[k][j];
+        ensure_equals( "Jacobian times inverse not identity" + el, I,
+                       i==j ? 1.0 : 0.0, prec );
+      }
+    }
+  }
+}
+
+//! Test cached reference/physical coordinate maps against recomputation
+template<> template<>
+void DerivedData_object::test< 80 >() {
+  set_test_name( "refCoordElem/physCoordElem vs. recomputation" );
+
+  const auto coord = jacCoord();
+  const auto& x = coord[0];
+  const auto& y = coord[1];
+  const auto& z = coord[2];
+
+  auto jacElem = tk::genJacElemTet( jac_inpoel, coord );
+
+  // reference coordinates of the vertices, the centroid, and a few points
+  // inside and outside the reference tetrahedron
+  const std::vector< std::array< tk::real, 3 > > ref{{
+    {{ 0.0, 0.0, 0.0 }}, {{ 1.0, 0.0, 0.0 }}, {{ 0.0, 1.0, 0.0 }},
+    {{ 0.0, 0.0, 1.0 }}, {{ 0.25, 0.25, 0.25 }}, {{ 0.1, 0.2, 0.3 }},
+    {{ 0.6, 0.05, 0.15 }}, {{ -0.2, 0.7, 0.9 }} }};
+
+  tk::real prec = 1.0e-14;
+
+  for (std::size_t e=0; e<jac_inpoel.size()/4; ++e) {
+    const auto A = jac_inpoel[4*e+0];
+    const auto B = jac_inpoel[4*e+1];
+    const auto C = jac_inpoel[4*e+2];
+    const auto D = jac_inpoel[4*e+3];
+    std::array< std::array< tk::real, 3 >, 4 > v{{ {{ x[A], y[A], z[A] }},
+                                                  {{ x[B], y[B], z[B] }},
+                                                  {{ x[C], y[C], z[C] }},
+                                                  {{ x[D], y[D], z[D] }} }};
+    const auto detJ = tk::Jacobian( v[0], v[1], v[2], v[3] );
+    const auto el = " of element " + std::to_string(e);
+
+    for (std::size_t q=0; q<ref.size(); ++q) {
+      const auto& r = ref[q];
+      const auto pt = " at point " + std::to_string(q) + el;
+
+      // physical coordinates from the linear shape functions
+      const auto N0 = 1.0 - r[0] - r[1] - r[2];
+      std::array< tk::real, 3 > gp;
+      for (std::size_t i=0; i<3; ++i)
+        gp[i] = N0*v[0][i] + r[0]*v[1][i] + r[1]*v[2][i] + r[2]*v[3][i];
+
+      const auto phys = tk::physCoordElem( jacElem, e, r[0], r[1], r[2] );
+      for (std::size_t i=0; i<3; ++i)
+        ensure_equals( "incorrect physical coordinate " + std::to_string(i) +
+                       pt, phys[i], gp[i], prec );
+
+      // reference coordinates from ratios of sub-tetrahedron volumes
+      const std::array< tk::real, 3 > xi{{
+        tk::Jacobian( v[0], gp, v[2], v[3] ) / detJ,
+        tk::Jacobian( v[0], v[1], gp, v[3] ) / detJ,
+        tk::Jacobian( v[0], v[1], v[2], gp ) / detJ }};
+
+      const auto refc = tk::refCoordElem( jacElem, e, gp );
+      for (std::size_t i=0; i<3; ++i) {
+        ensure_equals( "incorrect reference coordinate " + std::to_string(i) +
+                       pt, refc[i], xi[i], prec );
+        ensure_equals( "reference coordinate " + std::to_string(i) +
+                       " not recovered" + pt, refc[i], r[i], prec );
+      }
+    }
+  }
+}
+
 #if defined(STRICT_GNUC)
   #pragma GCC diagnostic pop
 #endif
@@ -63,6 +63,7 @@
 // *****************************************************************************
 
 #include <algorithm>
+#include <cmath>
 
 #include "TUTConfig.hpp"
 #include "NoWarning/tut.hpp"
@@ -297,6 +298,57 @@ void Gradients_object::test< 2 >() {
   }
 }
 
+//! Test node gradients of multiple components computed in a single pass
+template<> template<>
+void Gradients_object::test< 3 >() {
+  set_test_name( "node gradients of multiple components at once" );
+
+  // Shift node IDs to start from zero
+  tk::shiftToZero( inpoel );
+
+  // find out number of points in mesh connectivity
+  auto minmax = std::minmax_element( begin(inpoel), end(inpoel) );
+  Assert( *minmax.first == 0, "node ids should start from zero" );
+  auto npoin = *minmax.second + 1;
+
+  // Generate elements surrounding points
+  auto esup = tk::genEsup( inpoel, 4 );
+
+  // generate a field with linear and nonlinear components
+  tk::Fields u( npoin, 4 );
+  for (std::size_t p=0; p<npoin; ++p) {
+     const auto x = coord[0][p], y = coord[1][p], z = coord[2][p];
+     u(p,0,0) = 2.0*x - y + 0.5*z;
+     u(p,1,0) = x*x + y*z;
+     u(p,2,0) = 3.0;
+     u(p,3,0) = std::sin(x) * std::cos(2.0*y) + z*z*z;
+  }
+
+  // compute gradients of a subset of components in a different order
+  const std::vector< std::size_t > comp{ 3, 0, 1 };
+  auto G = tk::nodegrads( coord, inpoel, u, comp );
+  ensure_equals( "number of nodes incorrect", G.nunk(), npoin );
+  ensure_equals( "number of gradient components incorrect", G.nprop(), 9UL );
+
+  // test against gradients computed at nodes one by one
+  for (std::size_t p=0; p<npoin; ++p)
+    for (std::size_t k=0; k<comp.size(); ++k) {
+      auto g = nodegrad( p, coord, inpoel, esup, u, comp[k] );
+      for (std::size_t j=0; j<3; ++j)
+        ensure_equals( "node gradient incorrect", G(p,k*3+j,0), g[j],
+                       1.0e-12 );
+    }
+
+  // test gradient of the linear component
+  for (std::size_t p=0; p<npoin; ++p) {
+    ensure_equals( "x-gradient of linear field incorrect", G(p,3,0), 2.0, pr );
+    ensure_equals( "y-gradient of linear field incorrect", G(p,4,0), -1.0,
+                   pr );
+    ensure_equals( "z-gradient of linear field incorrect", G(p,5,0), 0.5,
+                   pr );
+  }
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
@@ -0,0 +1,170 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Mesh/TestPointLocator.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Mesh/PointLocator
+  \details   Unit tests for Mesh/PointLocator.
+*/
+// *****************************************************************************
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "PointLocator.hpp"
+#include "Reorder.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct PointLocator_common {
+
+  PointLocator_common() { tk::shiftToZero( inpoel ); }
+
+  // Mesh connectivity for simple tetrahedron-only mesh of a unit cube
+  std::vector< std::size_t > inpoel { 12, 14,  9, 11,
+                                      10, 14, 13, 12,
+                                      14, 13, 12,  9,
+                                      10, 14, 12, 11,
+                                      1,  14,  5, 11,
+                                      7,   6, 10, 12,
+                                      14,  8,  5, 10,
+                                      8,   7, 10, 13,
+                                      7,  13,  3, 12,
+                                      1,   4, 14,  9,
+                                      13,  4,  3,  9,
+                                      3,   2, 12,  9,
+                                      4,   8, 14, 13,
+                                      6,   5, 10, 11,
+                                      1,   2,  9, 11,
+                                      2,   6, 12, 11,
+                                      6,  10, 12, 11,
+                                      2,  12,  9, 11,
+                                      5,  14, 10, 11,
+                                      14,  8, 10, 13,
+                                      13,  3, 12,  9,
+                                      7,  10, 13, 12,
+                                      14,  4, 13,  9,
+                                      14,  1,  9, 11 };
+
+  // Mesh node coordinates for simple tet mesh above
+  tk::UnsMesh::Coords coord {{
+    {{ 0, 1, 1, 0, 0, 1, 1, 0, 0.5, 0.5, 0.5, 1,   0.5, 0 }},
+    {{ 0, 0, 1, 1, 0, 0, 1, 1, 0.5, 0.5, 0,   0.5, 1,   0.5 }},
+    {{ 0, 0, 0, 0, 1, 1, 1, 1, 0,   1,   0.5, 0.5, 0.5, 0.5 }} }};
+
+  // Points inside the unit cube, none of them on a face of an element
+  std::vector< std::array< tk::real, 3 > > points {{
+    {{ 0.1, 0.2, 0.3 }}, {{ 0.9, 0.8, 0.7 }}, {{ 0.45, 0.55, 0.15 }},
+    {{ 0.05, 0.95, 0.35 }}, {{ 0.7, 0.15, 0.9 }}, {{ 0.33, 0.71, 0.62 }},
+    {{ 0.81, 0.42, 0.27 }}, {{ 0.22, 0.13, 0.87 }} }};
+};
+
+// Test group shortcuts
+// The 2nd template argument is the max number of tests in this group. If
+// omitted, the default is 50, specified in tut/tut.hpp.
+using PointLocator_group =
+  test_group< PointLocator_common, MAX_TESTS_IN_GROUP >;
+using PointLocator_object = PointLocator_group::object;
+
+//! Define test group
+static PointLocator_group PointLocator( "Mesh/PointLocator" );
+
+//! Test definitions for group
+
+//! Test shapefunctions at the nodes and the centroids of elements
+template<> template<>
+void PointLocator_object::test< 1 >() {
+  set_test_name( "shapefunctions at nodes and centroids" );
+
+  tk::PointLocator loc( inpoel, coord );
+  ensure_equals( "number of elements incorrect", loc.nelem(),
+                 inpoel.size()/4 );
+
+  const tk::real prec = 1.0e-14;
+  for (std::size_t e=0; e<loc.nelem(); ++e) {
+    std::array< tk::real, 3 > c{{ 0.0, 0.0, 0.0 }};
+    for (std::size_t a=0; a<4; ++a) {
+      const auto n = inpoel[e*4+a];
+      const std::array< tk::real, 3 > p{{ coord[0][n], coord[1][n],
+                                          coord[2][n] }};
+      for (std::size_t d=0; d<3; ++d) c[d] += p[d]/4.0;
+      auto N = loc.shapefn( e, p );
+      for (std::size_t b=0; b<4; ++b)
+        ensure_equals( "shapefunction at node incorrect", N[b],
+                       a == b ? 1.0 : 0.0, prec );
+    }
+    auto N = loc.shapefn( e, c );
+    ensure( "centroid not inside its element", loc.inside(N) );
+    for (std::size_t b=0; b<4; ++b)
+      ensure_equals( "shapefunction at centroid incorrect", N[b], 0.25,
+                     prec );
+  }
+}
+
+//! Test that walking from any element locates points in their elements
+template<> template<>
+void PointLocator_object::test< 2 >() {
+  set_test_name( "locate points walking from all elements" );
+
+  tk::PointLocator loc( inpoel, coord );
+
+  for (const auto& p : points) {
+    // Find element containing point by brute force
+    std::size_t correct = loc.nelem();
+    for (std::size_t e=0; e<loc.nelem(); ++e)
+      if (loc.inside( loc.shapefn(e,p) )) correct = e;
+    ensure( "point not found by brute force", correct < loc.nelem() );
+    // Locate point starting from all elements
+    for (std::size_t s=0; s<loc.nelem(); ++s) {
+      auto e = s;
+      std::array< tk::real, 4 > N;
+      ensure( "point not located", loc.locate( p, e, N ) );
+      ensure_equals( "point located in wrong element", e, correct );
+      ensure( "shapefunctions of point located incorrect", loc.inside(N) );
+    }
+  }
+}
+
+//! Test that searching the bins locates points in their elements
+template<> template<>
+void PointLocator_object::test< 3 >() {
+  set_test_name( "search points in bins" );
+
+  tk::PointLocator loc( inpoel, coord );
+
+  for (const auto& p : points) {
+    std::size_t e = loc.nelem();
+    std::array< tk::real, 4 > N;
+    ensure( "point not found", loc.search( p, e, N ) );
+    ensure( "point found in wrong element", loc.inside( loc.shapefn(e,p) ) );
+  }
+}
+
+//! Test that points outside of the mesh are not located
+template<> template<>
+void PointLocator_object::test< 4 >() {
+  set_test_name( "points outside of mesh not located" );
+
+  tk::PointLocator loc( inpoel, coord );
+
+  std::vector< std::array< tk::real, 3 > > outside {{
+    {{ -0.1, 0.5, 0.5 }}, {{ 0.5, 1.2, 0.5 }}, {{ 0.5, 0.5, 1.0001 }} }};
+
+  const std::size_t start = 3;
+  for (const auto& p : outside) {
+    auto e = start;
+    std::array< tk::real, 4 > N;
+    ensure( "point outside found", !loc.locate( p, e, N ) );
+    ensure_equals( "element changed for point not found", e, start );
+    ensure( "point outside found in bins", !loc.search( p, e, N ) );
+  }
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
@@ -113,6 +113,8 @@
 */
 // *****************************************************************************
 
+#include <algorithm>
+
 #include "NoWarning/tut.hpp"
 
 #include "TUTConfig.hpp"
@@ -788,6 +790,91 @@ void Reorder_object::test< 18 >() {
              {1,{3,1,0,2}}, {32,{1,0,2,3}}, {42,{0,3,1}}, {12,{2,1,0,3}} } );
 }
 
+//! Renumber tetrahedron mesh with reverse Cuthill-McKee
+template<> template<>
+void Reorder_object::test< 19 >() {
+  set_test_name( "reverse Cuthill-McKee on tetrahedron mesh" );
+
+  // Shift node IDs to start from zero
+  auto inpoel = tetinpoel;
+  tk::shiftToZero( inpoel );
+
+  const auto psup = tk::genPsup( inpoel, 4, tk::genEsup( inpoel, 4 ) );
+  auto map = tk::rcm( psup );
+
+  // Test if mapping is a permutation
+  auto sorted = map;
+  std::sort( begin(sorted), end(sorted) );
+  for (std::size_t i=0; i<sorted.size(); ++i)
+    ensure_equals( "RCM mapping not a permutation", sorted[i], i );
+
+  // Test if bandwidth and profile are reduced
+  auto before = tk::orderingQuality( inpoel, 4 );
+  tk::remap( inpoel, map );
+  auto after = tk::orderingQuality( inpoel, 4 );
+  ensure_equals( "RCM bandwidth incorrect", after.bandwidth, 9UL );
+  ensure( "RCM did not reduce bandwidth", after.bandwidth < before.bandwidth );
+  ensure( "RCM did not reduce profile", after.profile < before.profile );
+}
+
+//! Renumber tetrahedron mesh along space-filling curves
+template<> template<>
+void Reorder_object::test< 20 >() {
+  set_test_name( "space-filling curves on tetrahedron mesh" );
+
+  for (auto curve : { tk::SpaceFillingCurve::MORTON,
+                      tk::SpaceFillingCurve::HILBERT })
+  {
+    auto map = tk::sfc( tetcoord[0], tetcoord[1], tetcoord[2], curve );
+
+    // Test if mapping is a permutation
+    auto sorted = map;
+    std::sort( begin(sorted), end(sorted) );
+    ensure_equals( "SFC mapping size incorrect", sorted.size(),
+                   tetcoord[0].size() );
+    for (std::size_t i=0; i<sorted.size(); ++i)
+      ensure_equals( "SFC mapping not a permutation", sorted[i], i );
+
+    // The corner at the origin is the first point along both curves
+    ensure_equals( "SFC does not start at origin", map[0], 0UL );
+  }
+}
+
+//! Renumber elements following the order of their nodes
+template<> template<>
+void Reorder_object::test< 21 >() {
+  set_test_name( "renumber elements following node order" );
+
+  std::vector< std::size_t > inpoel { 3, 4, 5,
+                                      0, 2, 1,
+                                      1, 2, 3 };
+
+  auto map = tk::renumberElements( inpoel, 3 );
+  ensure( "element mapping incorrect",
+          map == std::vector< std::size_t >{ 2, 0, 1 } );
+
+  tk::remapElements( inpoel, 3, map );
+  ensure( "remapped elements incorrect",
+          inpoel == std::vector< std::size_t >{ 0, 2, 1,
+                                                1, 2, 3,
+                                                3, 4, 5 } );
+}
+
+//! Compute quality of mesh ordering
+template<> template<>
+void Reorder_object::test< 22 >() {
+  set_test_name( "ordering quality" );
+
+  auto q = tk::orderingQuality( { 0, 1, 2,
+                                  1, 3, 2 }, 3 );
+
+  ensure_equals( "bandwidth incorrect", q.bandwidth, 2UL );
+  ensure_equals( "profile incorrect", q.profile, 5UL );
+  ensure_equals( "element span incorrect", q.span, 2.0, 1.0e-15 );
+  // all nodes fit into a single cache line: one miss for six node accesses
+  ensure_equals( "cache miss rate incorrect", q.missrate, 1.0/6.0, 1.0e-15 );
+}
+
 #if defined(STRICT_GNUC)
   #pragma GCC diagnostic pop
 #endif
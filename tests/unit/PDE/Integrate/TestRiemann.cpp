@@ -0,0 +1,293 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/PDE/Integrate/TestRiemann.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for the batched Riemann solver flux functions
+  \details   Unit tests for the batched Riemann solver flux functions in
+     PDE/Integrate/Riemann, taking a RiemannBlock. The batched fluxes are
+     compared to those computed by the single-point flux functions on random
+     left and right states and face normals. The throughput benchmarks, in
+     a separate group only run if selected, time both and report the number
+     of Riemann problems (faces) per second in their test name.
+*/
+// *****************************************************************************
+
+#include <random>
+#include <limits>
+#include <sstream>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Types.hpp"
+#include "Timer.hpp"
+#include "Inciter/InputDeck/InputDeck.hpp"
+#include "Integrate/Riemann/RiemannBlock.hpp"
+#include "Integrate/Riemann/HLLC.hpp"
+#include "Integrate/Riemann/LaxFriedrichs.hpp"
+#include "Integrate/Riemann/AUSM.hpp"
+#include "Integrate/Riemann/Upwind.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace inciter {
+
+extern ctr::InputDeck g_inputdeck;
+
+} // inciter::
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Riemann_common {
+
+  // relative tolerance of batched vs. single-point fluxes
+  const tk::real prec = 1.0e4 * std::numeric_limits< tk::real >::epsilon();
+
+  // random number generator for states and normals
+  std::mt19937 gen{ 1234 };
+
+  //! Configure input deck with material parameters for the Riemann solvers
+  Riemann_common() {
+    using inciter::g_inputdeck;
+    g_inputdeck.get< tag::param, tag::compflow, tag::gamma >() = {{ 1.4 }};
+    g_inputdeck.get< tag::param, tag::compflow, tag::pstiff >() = {{ 0.0 }};
+    g_inputdeck.get< tag::param, tag::multimat, tag::nmat >() = { 2 };
+    g_inputdeck.get< tag::param, tag::multimat, tag::gamma >() =
+      {{ 1.4, 4.4 }};
+    g_inputdeck.get< tag::param, tag::multimat, tag::pstiff >() =
+      {{ 0.0, 6.0e2 }};
+  }
+
+  //! Generate random unit face normal
+  std::array< tk::real, 3 > normal() {
+    std::normal_distribution< tk::real > n( 0.0, 1.0 );
+    std::array< tk::real, 3 > fn{{ n(gen), n(gen), n(gen) }};
+    auto l = std::sqrt( fn[0]*fn[0] + fn[1]*fn[1] + fn[2]*fn[2] );
+    for (auto& x : fn) x /= l;
+    return fn;
+  }
+
+  //! Generate random single-material compflow state
+  std::vector< tk::real > compflow() {
+    std::uniform_real_distribution< tk::real > pos( 0.5, 2.0 ), vel( -1, 1 );
+    auto rho = pos(gen), p = pos(gen);
+    auto u = vel(gen), v = vel(gen), w = vel(gen);
+    return { rho, rho*u, rho*v, rho*w,
+             p/(1.4-1.0) + 0.5*rho*(u*u + v*v + w*w) };
+  }
+
+  //! Generate random two-material state
+  std::vector< tk::real > multimat() {
+    using inciter::volfracIdx;
+    using inciter::densityIdx;
+    using inciter::momentumIdx;
+    using inciter::energyIdx;
+    std::uniform_real_distribution< tk::real > pos( 0.5, 2.0 ), vel( -1, 1 ),
+                                               vf( 0.1, 0.9 );
+    const std::size_t nmat = 2;
+    const std::array< tk::real, 2 > g{{ 1.4, 4.4 }}, p_c{{ 0.0, 6.0e2 }};
+    std::vector< tk::real > s( 3*nmat+3 );
+    auto u = vel(gen), v = vel(gen), w = vel(gen), p = pos(gen);
+    auto a = vf(gen);
+    tk::real rho = 0.0;
+    for (std::size_t k=0; k<nmat; ++k) {
+      auto al = k==0 ? a : 1.0-a;
+      auto rhok = k==0 ? pos(gen) : 1.0e3*pos(gen);
+      s[volfracIdx(nmat,k)] = al;
+      s[densityIdx(nmat,k)] = al*rhok;
+      s[energyIdx(nmat,k)] =
+        al*((p + g[k]*p_c[k])/(g[k]-1.0) + 0.5*rhok*(u*u + v*v + w*w));
+      rho += al*rhok;
+    }
+    s[momentumIdx(nmat,0)] = rho*u;
+    s[momentumIdx(nmat,1)] = rho*v;
+    s[momentumIdx(nmat,2)] = rho*w;
+    return s;
+  }
+
+  //! Fill a block with random Riemann problems
+  //! \param[in] gen_state Function generating a random state
+  //! \param[in,out] b Block to fill
+  //! \param[in,out] fn Face normals of all Riemann problems
+  //! \param[in,out] u Left and right states of all Riemann problems
+  //! \param[in,out] v Prescribed velocities of all Riemann problems
+  template< class GenState >
+  void fill( GenState gen_state,
+             inciter::RiemannBlock& b,
+             std::vector< std::array< tk::real, 3 > >& fn,
+             std::vector< std::array< std::vector< tk::real >, 2 > >& u,
+             std::vector< std::vector< std::array< tk::real, 3 > > >& v )
+  {
+    std::uniform_real_distribution< tk::real > vel( -1.0, 1.0 );
+    b.n = inciter::RiemannBlock::width;
+    fn.resize( b.n );
+    u.resize( b.n );
+    v.resize( b.n );
+    for (std::size_t i=0; i<b.n; ++i) {
+      fn[i] = normal();
+      u[i][0] = gen_state();
+      u[i][1] = gen_state();
+      v[i].resize( b.ncomp );
+      for (std::size_t c=0; c<b.ncomp; ++c) {
+        b.left(c)[i] = u[i][0][c];
+        b.right(c)[i] = u[i][1][c];
+        for (std::size_t d=0; d<3; ++d)
+          b.velocity(c,d)[i] = v[i][c][d] = vel(gen);
+      }
+      for (std::size_t d=0; d<3; ++d) b.fn[d][i] = fn[i][d];
+    }
+  }
+
+  //! Compare batched and single-point fluxes of a Riemann solver
+  //! \param[in] gen_state Function generating a random state
+  //! \param[in] ncomp Number of scalar components of the states
+  //! \param[in] nflux Number of flux components
+  template< class Solver, class GenState >
+  void compare( GenState gen_state, std::size_t ncomp, std::size_t nflux ) {
+    inciter::RiemannBlock b( ncomp, nflux );
+    Solver::configure( 0, b );
+    std::vector< std::array< tk::real, 3 > > fn;
+    std::vector< std::array< std::vector< tk::real >, 2 > > u;
+    std::vector< std::vector< std::array< tk::real, 3 > > > v;
+    fill( gen_state, b, fn, u, v );
+
+    Solver::flux( b );
+
+    for (std::size_t i=0; i<b.n; ++i) {
+      auto f = Solver::flux( fn[i], u[i], v[i] );
+      ensure_equals( "number of flux components", f.size(), nflux );
+      for (std::size_t c=0; c<nflux; ++c)
+        ensure_equals( "batched flux component " + std::to_string(c) +
+                       " of Riemann problem " + std::to_string(i),
+                       b.flux(c)[i], f[c],
+                       prec * std::max( 1.0, std::abs(f[c]) ) );
+    }
+  }
+
+  //! Time batched and single-point fluxes of a Riemann solver
+  //! \param[in] gen_state Function generating a random state
+  //! \param[in] ncomp Number of scalar components of the states
+  //! \param[in] nflux Number of flux components
+  //! \return String reporting faces/second for both
+  template< class Solver, class GenState >
+  std::string throughput( GenState gen_state, std::size_t ncomp,
+                          std::size_t nflux )
+  {
+    const std::size_t nrep = 2000;
+
+    inciter::RiemannBlock b( ncomp, nflux );
+    Solver::configure( 0, b );
+    std::vector< std::array< tk::real, 3 > > fn;
+    std::vector< std::array< std::vector< tk::real >, 2 > > u;
+    std::vector< std::vector< std::array< tk::real, 3 > > > v;
+    fill( gen_state, b, fn, u, v );
+
+    tk::real sum = 0.0;
+    tk::Timer tp;
+    for (std::size_t r=0; r<nrep; ++r)
+      for (std::size_t i=0; i<b.n; ++i)
+        sum += Solver::flux( fn[i], u[i], v[i] )[0];
+    auto point = tp.dsec();
+
+    tk::Timer tb;
+    for (std::size_t r=0; r<nrep; ++r) {
+      Solver::flux( b );
+      sum -= b.flux(0)[r % b.n];
+    }
+    auto batch = tb.dsec();
+
+    auto nf = static_cast< tk::real >( nrep * b.n );
+    std::stringstream ss;
+    ss << "faces/s: per-point " << nf/point << ", batched " << nf/batch
+       << " (" << sum << ")";
+    return ss.str();
+  }
+};
+
+//! Test group shortcuts
+using Riemann_group = test_group< Riemann_common, MAX_TESTS_IN_GROUP >;
+using Riemann_object = Riemann_group::object;
+
+//! Define test group
+static Riemann_group Riemann( "PDE/Integrate/Riemann" );
+
+//! Test definitions for group
+
+//! Test if batched HLLC flux equals the single-point one
+template<> template<>
+void Riemann_object::test< 1 >() {
+  set_test_name( "HLLC batched vs. single-point" );
+  compare< inciter::HLLC >( [this](){ return compflow(); }, 5, 5 );
+}
+
+//! Test if batched Lax-Friedrichs flux equals the single-point one
+template<> template<>
+void Riemann_object::test< 2 >() {
+  set_test_name( "LaxFriedrichs batched vs. single-point" );
+  compare< inciter::LaxFriedrichs >( [this](){ return compflow(); }, 5, 5 );
+}
+
+//! Test if batched AUSM flux equals the single-point one
+template<> template<>
+void Riemann_object::test< 3 >() {
+  set_test_name( "AUSM batched vs. single-point" );
+  compare< inciter::AUSM >( [this](){ return multimat(); }, 9, 12 );
+}
+
+//! Test if batched upwind flux equals the single-point one
+template<> template<>
+void Riemann_object::test< 4 >() {
+  set_test_name( "Upwind batched vs. single-point" );
+  compare< inciter::Upwind >( [this](){ return compflow(); }, 5, 5 );
+}
+
+//! All tests in group inherited from this base
+struct RiemannBenchmark_common : Riemann_common {};
+
+//! Test group shortcuts
+using RiemannBenchmark_group =
+  test_group< RiemannBenchmark_common, MAX_TESTS_IN_GROUP >;
+using RiemannBenchmark_object = RiemannBenchmark_group::object;
+
+//! Define test group, only run if selected, see unittest::TUTSuite
+static RiemannBenchmark_group
+  RiemannBenchmark( "Benchmark/PDE/Integrate/Riemann" );
+
+//! Test definitions for group
+
+//! Measure throughput of batched vs. single-point HLLC flux
+template<> template<>
+void RiemannBenchmark_object::test< 1 >() {
+  set_test_name( "HLLC " +
+    throughput< inciter::HLLC >( [this](){ return compflow(); }, 5, 5 ) );
+}
+
+//! Measure throughput of batched vs. single-point Lax-Friedrichs flux
+template<> template<>
+void RiemannBenchmark_object::test< 2 >() {
+  set_test_name( "LaxFriedrichs " +
+    throughput< inciter::LaxFriedrichs >( [this](){ return compflow(); },
+                                          5, 5 ) );
+}
+
+//! Measure throughput of batched vs. single-point AUSM flux
+template<> template<>
+void RiemannBenchmark_object::test< 3 >() {
+  set_test_name( "AUSM " +
+    throughput< inciter::AUSM >( [this](){ return multimat(); }, 9, 12 ) );
+}
+
+//! Measure throughput of batched vs. single-point upwind flux
+template<> template<>
+void RiemannBenchmark_object::test< 4 >() {
+  set_test_name( "Upwind " +
+    throughput< inciter::Upwind >( [this](){ return compflow(); }, 5, 5 ) );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
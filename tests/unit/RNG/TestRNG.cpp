@@ -10,6 +10,10 @@
 */
 // *****************************************************************************
 
+#include <string>
+#include <sstream>
+#include <utility>
+
 #include "NoWarning/tut.hpp"
 
 #include "TUTConfig.hpp"
@@ -39,6 +43,7 @@
 #endif
 
 #include "Random123.hpp"
+#include "Timer.hpp"
 #include "TestRNG.hpp"
 
 #ifndef DOXYGEN_GENERATING_OUTPUT
@@ -157,6 +162,42 @@ void RNG_object::test< 9 >() {
   for (const auto& r : rngs) test_move_assignment( r );
 }
 
+//! \brief Compare throughput of uniform and Gaussian random number generation
+//!   of Random123 with MKL and RNGSSE, if available
+template<> template<>
+void RNG_object::test< 10 >() {
+  std::vector< std::pair< std::string, tk::RNG > > v;
+  #ifdef HAS_MKL
+  v.emplace_back( "MKL mcg59", tk::RNG( tk::MKLRNG( 1, VSL_BRNG_MCG59 ) ) );
+  #endif
+  #ifdef HAS_RNGSSE2
+  v.emplace_back( "RNGSSE mrg32k3a", tk::RNG(
+    tk::RNGSSE< mrg32k3a_state, unsigned long long, mrg32k3a_generate_ >
+              ( 1, mrg32k3a_init_sequence_ ) ) );
+  #endif
+  v.emplace_back( "R123 threefry",
+                  tk::RNG( tk::Random123< r123::Threefry2x64 >( 1 ) ) );
+  v.emplace_back( "R123 philox",
+                  tk::RNG( tk::Random123< r123::Philox2x64 >( 1 ) ) );
+
+  const std::size_t num = 1000000, nrep = 10;
+  std::vector< double > numbers( num );
+  std::stringstream ss;
+  ss << "numbers/s (uniform, Gaussian):";
+  for (const auto& r : v) {
+    tk::Timer tu;
+    for (std::size_t i=0; i<nrep; ++i)
+      r.second.uniform( 0, num, numbers.data() );
+    auto u = static_cast< double >( nrep * num ) / tu.dsec();
+    tk::Timer tg;
+    for (std::size_t i=0; i<nrep; ++i)
+      r.second.gaussian( 0, num, numbers.data() );
+    auto g = static_cast< double >( nrep * num ) / tg.dsec();
+    ss << ' ' << r.first << " (" << u << ", " << g << ')';
+  }
+  set_test_name( ss.str() );
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
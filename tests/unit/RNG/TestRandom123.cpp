@@ -10,6 +10,10 @@
 */
 // *****************************************************************************
 
+#include <array>
+#include <cmath>
+#include <vector>
+
 #include "NoWarning/tut.hpp"
 
 #include "NoWarning/threefry.hpp"
@@ -259,6 +263,82 @@ void Random123_object::test< 21 >() {
   RNG_common::test_move_assignment( r );
 }
 
+//! \brief Test multi-variate Gaussian generator statistics from threefry using
+//!    multiple threads
+template<> template<>
+void Random123_object::test< 22 >() {
+  set_test_name( "multi-variate Gaussian threefry from 4 emulated streams" );
+
+  tk::Random123< r123::Threefry2x64 > r( 4 );
+
+  std::array< double, 3 > m3{{ 3.0, 5.0, 2.0 }};
+  std::array< double, 3*(3+1)/2 > c3{{ 16.0,  8.0,  4.0,
+                                             13.0, 17.0,
+                                                   62.0 }};
+  RNG_common::test_gaussianmv< 3 >( r, m3, c3 );
+
+  std::array< double, 5 > m5{{ 1.0, -2.0, 3.4, 5.6, 2.3 }};
+  std::array< double, 5*(5+1)/2 > c5{{ 16.0, -8.0,  -2.0,  2.0,  1.3,
+                                              12.5, -1.0,  2.0, -0.3,
+                                                     8.5, -3.0, -1.0,
+                                                          18.0, -1.0,
+                                                                10.0 }};
+  RNG_common::test_gaussianmv< 5 >( r, m5, c5 );
+}
+
+//! \brief Test multi-variate Gaussian generator statistics from philox using
+//!    multiple threads
+template<> template<>
+void Random123_object::test< 23 >() {
+  set_test_name( "multi-variate Gaussian philox from 4 emulated streams" );
+
+  tk::Random123< r123::Philox2x64 > r( 4 );
+
+  std::array< double, 3 > m3{{ 3.0, 5.0, 2.0 }};
+  std::array< double, 3*(3+1)/2 > c3{{ 16.0,  8.0,  4.0,
+                                             13.0, 17.0,
+                                                   62.0 }};
+  RNG_common::test_gaussianmv< 3 >( r, m3, c3 );
+
+  std::array< double, 5 > m5{{ 1.0, -2.0, 3.4, 5.6, 2.3 }};
+  std::array< double, 5*(5+1)/2 > c5{{ 16.0, -8.0,  -2.0,  2.0,  1.3,
+                                              12.5, -1.0,  2.0, -0.3,
+                                                     8.5, -3.0, -1.0,
+                                                          18.0, -1.0,
+                                                                10.0 }};
+  RNG_common::test_gaussianmv< 5 >( r, m5, c5 );
+}
+
+//! \brief Test that uniform random numbers use all words of the output of the
+//!   bijection and are independent of how they are requested
+template<> template<>
+void Random123_object::test< 24 >() {
+  set_test_name( "uniform uses all words of the bijection" );
+
+  tk::Random123< r123::Philox2x64 > p( 1 ), q( 1 );
+  std::array< double, 4 > a, b;
+  p.uniform( 0, 4, a.data() );
+  q.uniform( 0, 2, b.data() );
+  q.uniform( 0, 2, b.data()+2 );
+  for (std::size_t i=0; i<a.size(); ++i)
+    ensure_equals( "uniform number " + std::to_string(i) + " differs",
+                   a[i], b[i], 0.0 );
+  ensure( "words of the same block must differ", a[0] != a[1] );
+}
+
+//! Test Gaussian generator statistics with an odd number of random numbers
+template<> template<>
+void Random123_object::test< 25 >() {
+  set_test_name( "Gaussian philox with odd number of samples" );
+
+  tk::Random123< r123::Philox2x64 > r( 1 );
+  std::vector< double > numbers( 100001 );
+  r.gaussian( 0, numbers.size(), numbers.data() );
+  for (auto n : numbers)
+    ensure( "Gaussian sample not finite", std::isfinite(n) );
+  RNG_common::test_stats( numbers, 0.0, 1.0, 0.0, 0.0 );
+}
+
 } // tut::
 
 #endif  // DOXYGEN_GENERATING_OUTPUT
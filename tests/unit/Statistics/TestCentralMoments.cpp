@@ -0,0 +1,246 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Statistics/TestCentralMoments.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Statistics/CentralMoments.hpp and MomentReducer
+  \details   Unit tests for Statistics/CentralMoments.hpp and MomentReducer.
+    The central moments of a sample accumulated in a single pass are compared
+    to those obtained by merging the central moments of partitions of the
+    sample, which is how the moments accumulated in blocks, on PEs, and
+    across PEs during reduction are combined.
+*/
+// *****************************************************************************
+
+#include <array>
+#include <vector>
+#include <cmath>
+#include <string>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "CentralMoments.hpp"
+#include "MomentReducer.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct CentralMoments_common {
+  //! Number of variables
+  static const std::size_t nvar = 4;
+
+  //! Variables 0, 1, 2 are fluctuations, variable 3 is a full variable
+  const std::vector< bool > center{ true, true, true, false };
+
+  //! Products whose central moments are tested
+  const std::vector< std::vector< std::size_t > > product{
+    {0,0}, {0,1}, {1,2}, {0,0,0}, {0,1,2}, {0,0,1,1}, {3,0}, {3,3,1}, {3} };
+
+  //! Samples of all variables
+  std::vector< std::array< tk::real, nvar > > sample;
+
+  //! Constructor: generate correlated samples with large means
+  CentralMoments_common() : sample( 1000 ) {
+    unsigned long r = 12345;
+    auto rnd = [&](){            // linear congruential generator in [0,1)
+      r = (r * 6364136223846793005UL + 1442695040888963407UL);
+      return static_cast< tk::real >( r >> 11 ) / 9007199254740992.0; };
+    for (auto& s : sample) {
+      auto a = rnd(), b = rnd(), c = rnd();
+      s[0] = 1.0e3 + a;
+      s[1] = -2.0e2 + a*a + b;
+      s[2] = 5.0 + b*c - a;
+      s[3] = 3.0 + c;
+    }
+  }
+
+  //! Accumulate central moments of a range of samples in a single block
+  //! \param[in] first Index of first sample
+  //! \param[in] last Index of one past the last sample
+  //! \return Central moments accumulator of samples [first,last)
+  tk::CentralMoments accumulate( std::size_t first, std::size_t last ) const {
+    tk::CentralMoments c( center, product );
+    if (first == last) return c;
+    const auto n = last - first;
+    std::array< tk::real, nvar > mean;
+    mean.fill( 0.0 );
+    for (auto q=first; q<last; ++q)
+      for (std::size_t v=0; v<nvar; ++v) mean[v] += sample[q][v];
+    for (auto& m : mean) m /= static_cast< tk::real >( n );
+    c.set( n, mean.data(), [&]( std::size_t i, std::size_t m ){
+      tk::real sum = 0.0;
+      for (auto q=first; q<last; ++q) {
+        tk::real p = 1.0;
+        for (std::size_t j=0; j<product[i].size(); ++j)
+          if ((m >> j) & 1) {
+            auto v = product[i][j];
+            p *= sample[q][v] - mean[v];
+          }
+        sum += p;
+      }
+      return sum; } );
+    return c;
+  }
+
+  //! Compute central moment of a product directly from all samples
+  //! \param[in] i Product index
+  //! \return Central moment of product i computed in two passes
+  tk::real exact( std::size_t i ) const {
+    std::array< tk::real, nvar > mean;
+    mean.fill( 0.0 );
+    for (const auto& s : sample)
+      for (std::size_t v=0; v<nvar; ++v) mean[v] += s[v];
+    for (auto& m : mean) m /= static_cast< tk::real >( sample.size() );
+    tk::real sum = 0.0;
+    for (const auto& s : sample) {
+      tk::real p = 1.0;
+      for (auto v : product[i]) p *= center[v] ? s[v] - mean[v] : s[v];
+      sum += p;
+    }
+    return sum / static_cast< tk::real >( sample.size() );
+  }
+
+  //! Compare central moments to those computed directly from all samples
+  //! \param[in] msg Message to prefix failures with
+  //! \param[in] c Central moments accumulator to test
+  void compare( const std::string& msg, const tk::CentralMoments& c ) const {
+    ensure_equals( msg + ": incorrect count", c.count(),
+                   static_cast< tk::real >( sample.size() ), 0.0 );
+    for (std::size_t i=0; i<product.size(); ++i) {
+      auto e = exact( i );
+      ensure_equals( msg + ": incorrect central moment " + std::to_string(i),
+                     c.moment(i), e, 1.0e-10 * std::max( 1.0, std::abs(e) ) );
+    }
+  }
+};
+
+//! Test group shortcuts
+using CentralMoments_group =
+  test_group< CentralMoments_common, MAX_TESTS_IN_GROUP >;
+using CentralMoments_object = CentralMoments_group::object;
+
+//! Define test group
+static CentralMoments_group CentralMoments( "Statistics/CentralMoments" );
+
+//! Test definitions for group
+
+//! Test central moments accumulated in a single pass over all samples
+template<> template<>
+void CentralMoments_object::test< 1 >() {
+  set_test_name( "single pass" );
+
+  compare( "single pass", accumulate( 0, sample.size() ) );
+}
+
+//! Test merging central moments of two partitions of unequal size
+template<> template<>
+void CentralMoments_object::test< 2 >() {
+  set_test_name( "merge two partitions" );
+
+  for (std::size_t s : { std::size_t(1), std::size_t(17), std::size_t(500),
+                         sample.size()-1 })
+  {
+    auto a = accumulate( 0, s );
+    a.merge( accumulate( s, sample.size() ) );
+    compare( "split at " + std::to_string(s), a );
+  }
+}
+
+//! Test merging central moments of many partitions sequentially and pairwise
+//! \details Sequential merging is how the blocks of particles are merged,
+//!   pairwise (tree) merging is how the partial results of PEs are merged
+//!   during reduction.
+template<> template<>
+void CentralMoments_object::test< 3 >() {
+  set_test_name( "merge many partitions" );
+
+  const std::size_t npart = 13;
+  std::vector< tk::CentralMoments > part;
+  for (std::size_t p=0; p<npart; ++p)
+    part.push_back( accumulate( sample.size()*p*p/(npart*npart),
+                                sample.size()*(p+1)*(p+1)/(npart*npart) ) );
+
+  auto s = part[0];
+  for (std::size_t p=1; p<npart; ++p) s.merge( part[p] );
+  compare( "sequential", s );
+
+  while (part.size() > 1) {
+    std::vector< tk::CentralMoments > merged;
+    for (std::size_t p=0; p<part.size(); p+=2) {
+      merged.push_back( part[p] );
+      if (p+1 < part.size()) merged.back().merge( part[p+1] );
+    }
+    part = merged;
+  }
+  compare( "pairwise", part[0] );
+}
+
+//! Test merging empty partitions
+template<> template<>
+void CentralMoments_object::test< 4 >() {
+  set_test_name( "merge empty partitions" );
+
+  const auto n = sample.size();
+
+  // empty into nonempty, nonempty into empty, empty in between
+  auto a = accumulate( 0, 0 );
+  a.merge( accumulate( 0, 300 ) );
+  a.merge( accumulate( 300, 300 ) );
+  a.merge( accumulate( 300, n ) );
+  a.merge( accumulate( n, n ) );
+  compare( "empty partitions", a );
+
+  // zeroed accumulator is empty
+  auto b = accumulate( 0, n );
+  b.zero();
+  b.merge( accumulate( 0, n ) );
+  compare( "zeroed", b );
+
+  // empty merged with empty stays empty
+  auto e = accumulate( 0, 0 );
+  e.merge( accumulate( 0, 0 ) );
+  ensure_equals( "empty count nonzero", e.count(), 0.0, 0.0 );
+  for (std::size_t i=0; i<product.size(); ++i)
+    ensure_equals( "empty moment nonzero", e.moment(i), 0.0, 0.0 );
+}
+
+//! Test merging central moments during reduction with tk::mergeCentralMoments
+template<> template<>
+void CentralMoments_object::test< 5 >() {
+  set_test_name( "reducer mergeCentralMoments" );
+
+  const auto n = sample.size();
+  const std::array< std::size_t, 5 > split{{ 0, 0, 400, 401, n }};
+
+  // Serialize partial accumulators into reduction messages, starting with an
+  // empty one
+  std::vector< CkReductionMsg* > msg;
+  for (std::size_t p=0; p+1<split.size(); ++p) {
+    auto stream = tk::serialize( accumulate( split[p], split[p+1] ) );
+    msg.push_back( CkReductionMsg::buildNew( stream.first,
+                                             stream.second.get() ) );
+  }
+
+  // Merge messages using the custom reducer
+  auto merged = tk::mergeCentralMoments( static_cast< int >( msg.size() ),
+                                         msg.data() );
+
+  // Deserialize merged accumulator
+  tk::CentralMoments c;
+  PUP::fromMem creator( merged->getData() );
+  creator | c;
+
+  delete merged;
+  for (auto m : msg) delete m;
+
+  compare( "reducer", c );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
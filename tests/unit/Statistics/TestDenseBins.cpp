@@ -0,0 +1,169 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Statistics/TestDenseBins.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Statistics/DenseBins.hpp
+  \details   Unit tests for Statistics/DenseBins.hpp
+*/
+// *****************************************************************************
+
+#include <map>
+#include <limits>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "DenseBins.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct DenseBins_common {
+  //! Collect nonzero bins into an ordered container for comparison
+  //! \param[in] b Bins to collect
+  //! \return Ordered container of the nonzero bins
+  template< std::size_t D >
+  std::map< std::array< long, D >, tk::real >
+  bins( const tk::DenseBins< D >& b ) const {
+    std::map< std::array< long, D >, tk::real > m;
+    b.each( [&]( const std::array< long, D >& k, tk::real c ){
+      ensure( "bin visited more than once", m.find(k) == end(m) );
+      m[k] = c; } );
+    return m;
+  }
+};
+
+//! Test group shortcuts
+using DenseBins_group = test_group< DenseBins_common, MAX_TESTS_IN_GROUP >;
+using DenseBins_object = DenseBins_group::object;
+
+//! Define test group
+static DenseBins_group DenseBins( "Statistics/DenseBins" );
+
+//! Test definitions for group
+
+//! Test adding samples, growing the range in both directions
+template<> template<>
+void DenseBins_object::test< 1 >() {
+  set_test_name( "add grows range" );
+
+  tk::DenseBins< 2 > b;
+  ensure( "new bins not empty", b.empty() );
+
+  std::map< std::array< long, 2 >, tk::real > correct;
+  for (long i=-5; i<=7; ++i)
+    for (long j=3; j>=-2; --j) {
+      b.add( {{ i, j }}, 0.5 );
+      b.add( {{ i, j }} );
+      correct[ {{i,j}} ] = 1.5;
+    }
+
+  ensure( "bins differ", bins( b ) == correct );
+  ensure_equals( "incorrect sum", b.sum(), 1.5*13*6, 1.0e-12 );
+  ensure( "incorrect extents",
+          b.extents() == std::array< long, 4 >{{ -5, 7, -2, 3 }} );
+
+  b.zero();
+  ensure( "zeroed bins not empty", b.empty() );
+  ensure_equals( "zeroed bins sum nonzero", b.sum(), 0.0, 0.0 );
+}
+
+//! Test that outliers do not grow the range beyond the maximum
+//! \details Bins of outliers, which would require a range with more bins than
+//!   tk::maxDenseBins, are stored outside of the range, but are still visited
+//!   by each(), added up by sum(), and accounted for by extents().
+template<> template<>
+void DenseBins_object::test< 2 >() {
+  set_test_name( "outliers stored outside range" );
+
+  const long big = std::numeric_limits< long >::max() / 4;
+
+  tk::DenseBins< 3 > b;
+  std::map< std::array< long, 3 >, tk::real > correct;
+  for (long i=0; i<10; ++i) {
+    b.add( {{ i, -i, 2*i }} );
+    correct[ {{ i, -i, 2*i }} ] = 1.0;
+  }
+  b.add( {{ big, 0, 0 }} );
+  b.add( {{ 0, -big, 0 }}, 2.0 );
+  b.add( {{ 0, -big, 0 }}, 2.0 );
+  b.add( {{ 1, 2, big }} );
+  correct[ {{ big, 0, 0 }} ] = 1.0;
+  correct[ {{ 0, -big, 0 }} ] = 4.0;
+  correct[ {{ 1, 2, big }} ] = 1.0;
+
+  ensure( "bins differ", bins( b ) == correct );
+  ensure_equals( "incorrect sum", b.sum(), 16.0, 1.0e-12 );
+  ensure( "incorrect extents",
+          b.extents() == std::array< long, 6 >{{ 0, big, -big, 2, 0, big }} );
+}
+
+//! Test merging bins with different ranges and outliers
+template<> template<>
+void DenseBins_object::test< 3 >() {
+  set_test_name( "merge bins with outliers" );
+
+  const long big = std::numeric_limits< long >::max() / 4;
+
+  tk::DenseBins< 1 > a, b, c;
+  std::map< std::array< long, 1 >, tk::real > correct;
+  for (long i=-100; i<100; ++i) {
+    a.add( {{ i }} );
+    correct[ {{i}} ] += 1.0;
+  }
+  for (long i=50; i<400; ++i) {
+    b.add( {{ i }}, 2.0 );
+    correct[ {{i}} ] += 2.0;
+  }
+  b.add( {{ big }} );
+  b.add( {{ -big }} );
+  correct[ {{big}} ] += 1.0;
+  correct[ {{-big}} ] += 1.0;
+
+  // merge into empty bins and into bins with a different range
+  c.add( a );
+  c.add( b );
+  a.add( b );
+
+  ensure( "bins differ after merging into empty", bins( c ) == correct );
+  ensure( "bins differ after merging", bins( a ) == correct );
+  ensure_equals( "incorrect sum", a.sum(), 200.0 + 700.0 + 2.0, 1.0e-12 );
+  ensure( "incorrect extents",
+          a.extents() == std::array< long, 2 >{{ -big, big }} );
+}
+
+//! Test computing bin ids of samples
+template<> template<>
+void DenseBins_object::test< 4 >() {
+  set_test_name( "binid" );
+
+  ensure_equals( "incorrect bin id", tk::binid( 0.26, 0.1 ), 3L );
+  ensure_equals( "incorrect bin id", tk::binid( -0.26, 0.1 ), -3L );
+  ensure_equals( "incorrect bin id", tk::binid( 0.0, 0.1 ), 0L );
+}
+
+//! Test that computing bin ids of non-finite or too large samples throws
+template<> template<>
+void DenseBins_object::test< 5 >() {
+  set_test_name( "binid throws for non-finite sample" );
+
+  const auto inf = std::numeric_limits< tk::real >::infinity();
+  for (auto s : { std::numeric_limits< tk::real >::quiet_NaN(), inf, -inf,
+                  std::numeric_limits< tk::real >::max() })
+  {
+    try {
+      tk::binid( s, 0.1 );
+      fail( "should throw exception" );
+    }
+    catch ( tk::Exception& ) {}
+  }
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT
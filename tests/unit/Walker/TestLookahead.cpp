@@ -0,0 +1,146 @@
+// *****************************************************************************
+/*!
+  \file      tests/unit/Walker/TestLookahead.cpp
+  \copyright 2012-2015 J. Bakosi,
+             2016-2018 Los Alamos National Security, LLC.,
+             2019 Triad National Security, LLC.
+             All rights reserved. See the LICENSE file for details.
+  \brief     Unit tests for Walker/Lookahead
+  \details   Unit tests for Walker/Lookahead
+*/
+// *****************************************************************************
+
+#include <vector>
+#include <algorithm>
+
+#include "NoWarning/tut.hpp"
+
+#include "TUTConfig.hpp"
+#include "Walker/Lookahead.hpp"
+
+#ifndef DOXYGEN_GENERATING_OUTPUT
+
+namespace tut {
+
+//! All tests in group inherited from this base
+struct Lookahead_common {
+
+  //! \brief Simulate pipelined time stepping of Integrators with a host that
+  //!   evaluates time steps as their statistics complete
+  //! \param[in] k Maximum number of time steps in flight
+  //! \param[in] nint Number of Integrators
+  //! \param[in] nstep Number of time steps to take
+  //! \param[in] delay Number of rounds the host takes to evaluate a time step
+  //! \return Largest number of time steps in flight observed, i.e., largest
+  //!   number of time steps whose statistics are stored by the host
+  //! \details In each round every Integrator that is not stalled advances a
+  //!   time step and sends its statistics, Integrator i only every (i+1)th
+  //!   round, so Integrators are at different time steps. The host evaluates
+  //!   a time step once all Integrators have sent their statistics and delay
+  //!   rounds have passed, then tells all Integrators how many time steps it
+  //!   has evaluated. Fails if time stepping does not finish.
+  uint64_t pipeline( uint64_t k, std::size_t nint, uint64_t nstep,
+                     std::size_t delay )
+  {
+    std::vector< walker::Lookahead > la( nint, walker::Lookahead( k ) );
+    std::vector< uint64_t > sent( nint, 0 );    // time steps sent
+    uint64_t evaluated = 0;
+    std::size_t wait = 0;
+    uint64_t maxinflight = 0;
+
+    for (std::size_t round=0; evaluated < nstep; ++round) {
+      ensure( "time stepping does not finish", round < 100*nstep*(delay+1) );
+      for (std::size_t i=0; i<nint; ++i)
+        if (sent[i] < nstep && round % (i+1) == 0 && la[i].open( sent[i] ))
+          ++sent[i];
+      maxinflight = std::max( maxinflight,
+                      *std::max_element( begin(sent), end(sent) ) - evaluated );
+      if (*std::min_element( begin(sent), end(sent) ) > evaluated) {
+        if (wait++ == delay) {
+          wait = 0;
+          ++evaluated;
+          for (auto& l : la) l.evaluated( evaluated );
+        }
+      }
+    }
+
+    return maxinflight;
+  }
+};
+
+//! Test group shortcuts
+using Lookahead_group = test_group< Lookahead_common, MAX_TESTS_IN_GROUP >;
+using Lookahead_object = Lookahead_group::object;
+
+//! Define test group
+static Lookahead_group Lookahead( "Walker/Lookahead" );
+
+//! Test definitions for group
+
+//! Test that a single time step in flight is synchronous time stepping
+template<> template<>
+void Lookahead_object::test< 1 >() {
+  set_test_name( "one time step in flight is synchronous" );
+
+  walker::Lookahead l( 1 );
+  ensure_equals( "incorrect size", l.size(), 1UL );
+  ensure( "cannot start first time step", l.open( 0 ) );
+  ensure( "can start second time step before first evaluated", !l.open( 1 ) );
+  l.evaluated( 1 );
+  ensure( "cannot start second time step after first evaluated", l.open(1) );
+  ensure( "can start third time step before second evaluated", !l.open( 2 ) );
+
+  // zero time steps in flight would never start, taken as one
+  walker::Lookahead z( 0 );
+  ensure_equals( "zero not taken as one", z.size(), 1UL );
+  ensure( "cannot start first time step with zero", z.open( 0 ) );
+}
+
+//! Test that at most k time steps may be in flight
+template<> template<>
+void Lookahead_object::test< 2 >() {
+  set_test_name( "at most k time steps in flight" );
+
+  walker::Lookahead l( 4 );
+  for (uint64_t it=0; it<4; ++it)
+    ensure( "cannot start time step " + std::to_string(it), l.open( it ) );
+  ensure( "can start fifth time step", !l.open( 4 ) );
+
+  l.evaluated( 2 );
+  ensure( "cannot start time step 5", l.open( 5 ) );
+  ensure( "can start time step 6", !l.open( 6 ) );
+}
+
+//! Test that out-of-order evaluated counts do not shrink the window
+template<> template<>
+void Lookahead_object::test< 3 >() {
+  set_test_name( "out-of-order evaluated counts" );
+
+  walker::Lookahead l( 2 );
+  l.evaluated( 5 );
+  l.evaluated( 3 );     // arrives late
+  ensure( "cannot start time step 6", l.open( 6 ) );
+  ensure( "can start time step 7", !l.open( 7 ) );
+}
+
+//! Test that pipelined time stepping finishes with bounded time steps in
+//! flight for Integrators at different time steps and a slow host
+template<> template<>
+void Lookahead_object::test< 4 >() {
+  set_test_name( "bounded time steps in flight while pipelining" );
+
+  for (uint64_t k : { 1, 2, 3, 8 })
+    for (std::size_t delay : { 0, 1, 5 }) {
+      auto n = pipeline( k, 4, 50, delay );
+      ensure( "more than k=" + std::to_string(k) + " time steps in flight "
+              "with delay " + std::to_string(delay) + ": " + std::to_string(n),
+              n <= k );
+    }
+
+  // with a slow host Integrators do run ahead up to the bound
+  ensure_equals( "lookahead not used", pipeline( 8, 1, 50, 5 ), 8UL );
+}
+
+} // tut::
+
+#endif  // DOXYGEN_GENERATING_OUTPUT